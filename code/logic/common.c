@@ -24,6 +24,7 @@
  */
 #include "fossil/maip/common.h"
 #include <stdio.h>
+#include <errno.h>
 
 // *****************************************************************************
 // macro definitions
@@ -55,6 +56,7 @@ uint64_t get_maip_time_microseconds(void)
     return t / 10; // 100-nanosecond intervals to microseconds
 }
 #else
+#include <pthread.h>
 #include <sys/time.h>
 uint64_t get_maip_time_microseconds(void)
 {
@@ -156,6 +158,265 @@ void fossil_maip_hash(const char *input, const char *output, uint8_t *hash_out)
     }
 }
 
+// *****************************************************************************
+// Timing
+// *****************************************************************************
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define MAIP_TIME_HAS_TSC 1
+#include <cpuid.h>
+#include <x86intrin.h>
+#elif (defined(_M_X64) || defined(_M_IX86)) && defined(_MSC_VER)
+#define MAIP_TIME_HAS_TSC 1
+#include <intrin.h>
+#endif
+
+#if !defined(_WIN32) && !defined(_WIN64)
+#if defined(CLOCK_MONOTONIC_RAW)
+#define MAIP_TIME_CLOCK_ID CLOCK_MONOTONIC_RAW // Not slewed by NTP
+#else
+#define MAIP_TIME_CLOCK_ID CLOCK_MONOTONIC
+#endif
+#endif
+
+#define MAIP_TIME_CALIBRATION_NS 10000000ULL
+
+// The clock is chosen once, before any runner thread or worker starts.
+static int maip_time_tsc_enabled = 0;
+static uint64_t maip_time_tsc_base = 0;     // TSC reading at calibration
+static uint64_t maip_time_mono_base = 0;    // Monotonic time at the same instant
+static double maip_time_ns_per_tick = 0.0;
+static uint64_t maip_time_overhead = 0;
+
+static uint64_t maip_time_monotonic_ns(void)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    static LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+    if (frequency.QuadPart == 0)
+        QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+
+    uint64_t ticks = (uint64_t)counter.QuadPart;
+    uint64_t hz = (uint64_t)frequency.QuadPart;
+    return (ticks / hz) * 1000000000ULL + (ticks % hz) * 1000000000ULL / hz;
+#else
+    struct timespec ts;
+    clock_gettime(MAIP_TIME_CLOCK_ID, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+#ifdef MAIP_TIME_HAS_TSC
+static uint64_t maip_time_tsc_read(void)
+{
+    unsigned int aux;
+    return (uint64_t)__rdtscp(&aux); // Waits for earlier instructions to retire
+}
+
+// The TSC is only a clock when it ticks at a constant rate through frequency
+// changes and sleep states (invariant TSC), and rdtscp is needed to read it.
+static int maip_time_tsc_supported(void)
+{
+#if defined(_MSC_VER)
+    int regs[4];
+    __cpuid(regs, 0x80000000);
+    if ((unsigned int)regs[0] < 0x80000007u)
+        return 0;
+    __cpuid(regs, 0x80000001);
+    if (!(regs[3] & (1 << 27)))
+        return 0;
+    __cpuid(regs, 0x80000007);
+    return (regs[3] & (1 << 8)) != 0;
+#else
+    unsigned int eax, ebx, ecx, edx;
+    if (__get_cpuid_max(0x80000000u, NULL) < 0x80000007u)
+        return 0;
+    if (!__get_cpuid(0x80000001u, &eax, &ebx, &ecx, &edx) || !(edx & (1u << 27)))
+        return 0;
+    if (!__get_cpuid(0x80000007u, &eax, &ebx, &ecx, &edx))
+        return 0;
+    return (edx & (1u << 8)) != 0;
+#endif
+}
+
+static int maip_time_tsc_calibrate(void)
+{
+    if (!maip_time_tsc_supported())
+        return -1;
+
+    uint64_t mono_start = maip_time_monotonic_ns();
+    uint64_t tsc_start = maip_time_tsc_read();
+    uint64_t mono_end;
+    do
+    {
+        mono_end = maip_time_monotonic_ns();
+    } while (mono_end - mono_start < MAIP_TIME_CALIBRATION_NS);
+    uint64_t tsc_end = maip_time_tsc_read();
+
+    if (tsc_end <= tsc_start)
+        return -1;
+
+    maip_time_ns_per_tick = (double)(mono_end - mono_start) / (double)(tsc_end - tsc_start);
+    maip_time_tsc_base = tsc_end;
+    maip_time_mono_base = mono_end;
+    maip_time_tsc_enabled = 1;
+    return 0;
+}
+#endif
+
+uint64_t maip_time_now_ns(void)
+{
+#ifdef MAIP_TIME_HAS_TSC
+    if (maip_time_tsc_enabled)
+    {
+        uint64_t ticks = maip_time_tsc_read() - maip_time_tsc_base;
+        return maip_time_mono_base + (uint64_t)((double)ticks * maip_time_ns_per_tick);
+    }
+#endif
+    return maip_time_monotonic_ns();
+}
+
+uint64_t maip_time_thread_cpu_ns(void)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    FILETIME created, exited, kernel, user;
+    if (!GetThreadTimes(GetCurrentThread(), &created, &exited, &kernel, &user))
+        return 0;
+    uint64_t k = ((uint64_t)kernel.dwHighDateTime << 32) | kernel.dwLowDateTime;
+    uint64_t u = ((uint64_t)user.dwHighDateTime << 32) | user.dwLowDateTime;
+    return (k + u) * 100ULL; // 100-nanosecond intervals
+#elif defined(CLOCK_THREAD_CPUTIME_ID)
+    struct timespec ts;
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0)
+        return 0;
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+#else
+    return 0;
+#endif
+}
+
+// Smallest back-to-back delta of the selected clock.
+static uint64_t maip_time_measure_overhead(void)
+{
+    uint64_t best = UINT64_MAX;
+    for (int i = 0; i < 64; ++i)
+    {
+        uint64_t first = maip_time_now_ns();
+        uint64_t second = maip_time_now_ns();
+        if (second - first < best)
+            best = second - first;
+    }
+    return best;
+}
+
+int maip_time_use_clock(const char *name)
+{
+    int status = 0;
+    maip_time_tsc_enabled = 0;
+
+    if (name && maip_io_cstr_compare(name, "tsc") == 0)
+    {
+#ifdef MAIP_TIME_HAS_TSC
+        status = maip_time_tsc_calibrate();
+#else
+        status = -1;
+#endif
+    }
+    else if (name && maip_io_cstr_compare(name, "monotonic") != 0)
+    {
+        status = -1;
+    }
+
+    maip_time_overhead = maip_time_measure_overhead();
+    return status;
+}
+
+const char *maip_time_clock_name(void)
+{
+    return maip_time_tsc_enabled ? "tsc" : "monotonic";
+}
+
+uint64_t maip_time_overhead_ns(void)
+{
+    return maip_time_overhead;
+}
+
+uint64_t maip_time_interval_ns(uint64_t start, uint64_t end)
+{
+    if (end <= start)
+        return 0;
+    uint64_t elapsed = end - start;
+    return elapsed > maip_time_overhead ? elapsed - maip_time_overhead : 0;
+}
+
+// *****************************************************************************
+// random numbers
+// *****************************************************************************
+
+static uint64_t maip_rand_splitmix(uint64_t *x)
+{
+    uint64_t z = (*x += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+static uint64_t maip_rand_rotl(uint64_t x, int k)
+{
+    return (x << k) | (x >> (64 - k));
+}
+
+void maip_rand_seed(maip_rand_t *rng, uint64_t seed, uint64_t stream)
+{
+    // Mix the stream in before expanding, so nearby ids give unrelated states
+    uint64_t x = seed;
+    uint64_t mixed = maip_rand_splitmix(&x) ^ stream;
+    for (int i = 0; i < 4; ++i)
+        rng->state[i] = maip_rand_splitmix(&mixed);
+}
+
+uint64_t maip_rand_next(maip_rand_t *rng)
+{
+    uint64_t *s = rng->state;
+    uint64_t result = maip_rand_rotl(s[1] * 5, 7) * 9;
+    uint64_t t = s[1] << 17;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = maip_rand_rotl(s[3], 45);
+    return result;
+}
+
+uint64_t maip_rand_below(maip_rand_t *rng, uint64_t bound)
+{
+    if (bound == 0)
+        return 0;
+
+    // Reject the short top range that would bias the modulo
+    uint64_t threshold = (0 - bound) % bound;
+    for (;;)
+    {
+        uint64_t r = maip_rand_next(rng);
+        if (r >= threshold)
+            return r % bound;
+    }
+}
+
+double maip_rand_unit(maip_rand_t *rng)
+{
+    return (double)((maip_rand_next(rng) >> 11) + 1) * (1.0 / 9007199254740992.0);
+}
+
+uint64_t maip_rand_entropy(void)
+{
+    uint64_t x = (uint64_t)time(NULL) ^ maip_time_now_ns() ^ (uint64_t)(uintptr_t)&x;
+    return maip_rand_splitmix(&x);
+}
+
 // *****************************************************************************
 // command pallet
 // *****************************************************************************
@@ -211,7 +472,8 @@ static void _show_help(void)
     maip_io_printf("{cyan}  color <mode>       {white}Set color mode (enable, disable, auto){reset}\n");
     maip_io_printf("{cyan}  theme <name>       {white}Set the theme (fossil, catch, doctest, etc.){reset}\n");
     maip_io_printf("{cyan}  info               {white}Show detailed information about the environment{reset}\n");
-    maip_io_printf("{cyan}  timeout=<seconds>  {white}Set the timeout for commands (default: 60 seconds){reset}\n");
+    maip_io_printf("{cyan}  serve              {white}Keep the runner resident on a socket and run requests there{reset}\n");
+    maip_io_printf("{cyan}  timeout=<seconds>  {white}Set the default time budget of each case (default: 60 seconds){reset}\n");
     exit(EXIT_SUCCESS);
 }
 
@@ -230,23 +492,46 @@ static void _show_subhelp_run(void)
 {
     maip_io_printf("{blue}Run command options:{reset}\n");
     maip_io_printf("{cyan}  --fail-fast        {white}Stop on the first failure{reset}\n");
-    maip_io_printf("{cyan}  --only <test>      {white}Run only the specified test{reset}\n");
-    maip_io_printf("{cyan}  --skip <test>      {white}Skip the specified test{reset}\n");
-    maip_io_printf("{cyan}  --repeat <count>   {white}Repeat the test a specified number of times{reset}\n");
+    maip_io_printf("{cyan}  --only <tests>     {white}Run only the listed tests (comma separated, '*' and '?' globs){reset}\n");
+    maip_io_printf("{cyan}  --skip <tests>     {white}Skip the listed tests (comma separated, '*' and '?' globs){reset}\n");
+    maip_io_printf("{cyan}  --repeat <count>   {white}Repeat each case, reporting latency percentiles and flaky rates{reset}\n");
+    maip_io_printf("{cyan}  --until-fail       {white}Rerun the cases until one fails (--repeat caps it, --threads fans out){reset}\n");
+    maip_io_printf("{cyan}  --jobs <count|auto> {white}Run test cases across worker processes{reset}\n");
+    maip_io_printf("{cyan}  --threads <count|auto> {white}Run test cases on a pool of threads{reset}\n");
+    maip_io_printf("{cyan}  --timeout [name=]<seconds> {white}Interrupt cases that run longer (run, suite or case){reset}\n");
+    maip_io_printf("{cyan}  --isolate          {white}Run each case in its own process forked from a per-suite zygote{reset}\n");
+    maip_io_printf("{cyan}  --clock <monotonic|tsc> {white}Clock used to time cases (default: monotonic){reset}\n");
+    maip_io_printf("{cyan}  --history <file>   {white}Keep case durations across runs in this file (off by default){reset}\n");
+    maip_io_printf("{cyan}  --shard <index>/<total> {white}Run only this machine's share of the cases (index from 1){reset}\n");
+    maip_io_printf("{cyan}  --shard-mode <hash|balanced> {white}Split by name hash, or by recorded durations (default: hash){reset}\n");
+    maip_io_printf("{cyan}  --results <file>   {white}Keep case outcomes across runs in this file (off by default){reset}\n");
+    maip_io_printf("{cyan}  --sites <file>     {white}Write the hits and failures of every assertion site to this file{reset}\n");
+    maip_io_printf("{cyan}  --last-failed      {white}Run only the cases that failed last time (needs --results){reset}\n");
+    maip_io_printf("{cyan}  --failed-first     {white}Run the cases that failed last time before the rest (needs --results){reset}\n");
     exit(EXIT_SUCCESS);
 }
 
 static void _show_subhelp_filter(void)
 {
     maip_io_printf("{blue}Filter command options:{reset}\n");
-    maip_io_printf("{cyan}  --test-name <name> {white}Filter by test name{reset}\n");
-    maip_io_printf("{cyan}  --suite-name <name> {white}Filter by suite name{reset}\n");
-    maip_io_printf("{cyan}  --tag <tag>        {white}Filter by tag{reset}\n");
+    maip_io_printf("{cyan}  --test-name <names> {white}Filter by test name (comma separated, '*' and '?' globs){reset}\n");
+    maip_io_printf("{cyan}  --not-test-name <names> {white}Exclude tests by name{reset}\n");
+    maip_io_printf("{cyan}  --suite-name <names> {white}Filter by suite name{reset}\n");
+    maip_io_printf("{cyan}  --tag <expr>       {white}Filter by tags, e.g. \"fast & !flaky & (net | disk)\"{reset}\n");
     maip_io_printf("{cyan}  --help             {white}Show help for filter command{reset}\n");
     maip_io_printf("{cyan}  --options          {white}Show all valid tags{reset}\n");
     exit(EXIT_SUCCESS);
 }
 
+static void _show_subhelp_serve(void)
+{
+    maip_io_printf("{blue}Serve command options:{reset}\n");
+    maip_io_printf("{cyan}  --socket <path>    {white}Unix domain socket to listen on (default: .fossil_maip_serve){reset}\n");
+    maip_io_printf("{cyan}  --send <request>   {white}Send a request, e.g. \"run --only my_case --repeat 20\", to a running server{reset}\n");
+    maip_io_printf("{cyan}  --help             {white}Show help for serve command{reset}\n");
+    exit(EXIT_SUCCESS);
+}
+
 static void _show_subhelp_report(void)
 {
     maip_io_printf("{blue}Report command options:{reset}\n");
@@ -258,8 +543,9 @@ static void _show_subhelp_report(void)
 static void _show_subhelp_sort(void)
 {
     maip_io_printf("{blue}Sort command options:{reset}\n");
-    maip_io_printf("{cyan}  --by <criteria>    {white}Sort by specified criteria{reset}\n");
+    maip_io_printf("{cyan}  --by <criteria>    {white}Sort by name, result, time, priority or hash{reset}\n");
     maip_io_printf("{cyan}  --order <asc|desc> {white}Sort in ascending or descending order{reset}\n");
+    maip_io_printf("{cyan}  --then-by <key[:asc|:desc],...> {white}Break ties with further keys{reset}\n");
     maip_io_printf("{cyan}  --help             {white}Show help for sort command{reset}\n");
     maip_io_printf("{cyan}  --options          {white}Show all valid criteria{reset}\n");
     exit(EXIT_SUCCESS);
@@ -268,11 +554,10 @@ static void _show_subhelp_sort(void)
 static void _show_subhelp_shuffle(void)
 {
     maip_io_printf("{blue}Shuffle command options:{reset}\n");
-    maip_io_printf("{cyan}  --seed <seed>      {white}Specify the seed for shuffling{reset}\n");
-    maip_io_printf("{cyan}  --count <count>    {white}Number of items to shuffle{reset}\n");
-    maip_io_printf("{cyan}  --by <criteria>    {white}Shuffle by specified criteria{reset}\n");
+    maip_io_printf("{cyan}  --seed <seed>      {white}Replay the order of an earlier run (its seed is printed){reset}\n");
+    maip_io_printf("{cyan}  --count <count>    {white}Run only this many random cases of each suite{reset}\n");
+    maip_io_printf("{cyan}  --mode <uniform|weighted> {white}Favour cases that failed last time or are new{reset}\n");
     maip_io_printf("{cyan}  --help             {white}Show help for shuffle command{reset}\n");
-    maip_io_printf("{cyan}  --options          {white}Show all valid criteria for shuffling{reset}\n");
     exit(EXIT_SUCCESS);
 }
 
@@ -300,7 +585,7 @@ static void _show_subhelp_show(void)
     maip_io_printf("{blue}Show command options:{reset}\n");
     maip_io_printf("{cyan}  --test-name <name>   {white}Filter by test name{reset}\n");
     maip_io_printf("{cyan}  --suite-name <name>  {white}Filter by suite name{reset}\n");
-    maip_io_printf("{cyan}  --tag <tag>          {white}Filter by tag{reset}\n");
+    maip_io_printf("{cyan}  --tag <expr>         {white}Filter by tag expression (&, |, !, parentheses){reset}\n");
     maip_io_printf("{cyan}  --result <result>    {white}Filter by result (pass, fail, timeout, skipped, unexpected){reset}\n");
     maip_io_printf("{cyan}  --verbose <level>    {white}Set verbosity level (plain, ci, doge){reset}\n");
     maip_io_printf("{cyan}  --mode <mode>        {white}Show mode (list, tree, graph){reset}\n");
@@ -410,7 +695,8 @@ typedef enum
     MAIP_CMD_HELP,
     MAIP_CMD_COLOR,
     MAIP_CMD_THEME,
-    MAIP_CMD_INFO
+    MAIP_CMD_INFO,
+    MAIP_CMD_SERVE
 } fossil_maip_cmd_t;
 
 typedef struct
@@ -430,15 +716,141 @@ static fossil_cmd_map_t CMD_MAP[] = {
     {MAIP_CMD_COLOR, "color"},
     {MAIP_CMD_THEME, "theme"},
     {MAIP_CMD_INFO, "info"},
+    {MAIP_CMD_SERVE, "serve"},
     {MAIP_CMD_NONE, NULL}};
 
+// Parses a worker count, where "auto" means one per online processor.
+static int fossil_maip_parse_workers(const char *value)
+{
+    int count;
+    if (maip_io_cstr_compare(value, "auto") == 0)
+    {
+#ifdef _WIN32
+        SYSTEM_INFO sysinfo;
+        GetSystemInfo(&sysinfo);
+        count = (int)sysinfo.dwNumberOfProcessors;
+#else
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        count = online > 0 ? (int)online : 1;
+#endif
+    }
+    else
+    {
+        count = atoi(value);
+    }
+
+    return count < 1 ? 1 : count;
+}
+
+// Parses a duration in (possibly fractional) seconds into nanoseconds.
+// Returns 0 for malformed, non-positive or out-of-range values; durations stop
+// at half the nanosecond range, so deadlines taken from them cannot wrap.
+static uint64_t fossil_maip_parse_seconds(const char *value)
+{
+    char *end = null;
+    double seconds = strtod(value, &end);
+    if (end == value || *end != '\0' || !(seconds > 0.0))
+        return 0;
+
+    double nanoseconds = seconds * 1e9;
+    if (!(nanoseconds < (double)(UINT64_MAX / 2)))
+        return 0;
+
+    return (uint64_t)nanoseconds;
+}
+
+// Parses --timeout <seconds> or --timeout <name>=<seconds>, where name is a
+// suite or test case that gets its own budget. A bad timeout would silently
+// run with the default budget, so it is fatal.
+static void fossil_maip_parse_timeout(fossil_maip_pallet_t *p, const char *value)
+{
+    const char *split = strchr(value, '=');
+    uint64_t timeout_ns = fossil_maip_parse_seconds(split ? split + 1 : value);
+    if (split == value || timeout_ns == 0)
+    {
+        maip_io_printf("{red}Invalid timeout: %s (expected [name=]<seconds>, e.g. 2.5){reset}\n", value);
+        exit(EXIT_FAILURE);
+    }
+
+    if (!split)
+    {
+        p->run.timeout_ns = timeout_ns;
+        return;
+    }
+
+    fossil_maip_timeout_rule_t *rules = maip_sys_memory_realloc(
+        p->run.timeout_rules, (p->run.timeout_rule_count + 1) * sizeof(*rules));
+    if (!rules)
+        return;
+
+    rules[p->run.timeout_rule_count].name = maip_io_cstr_substring(value, 0, (size_t)(split - value));
+    rules[p->run.timeout_rule_count].timeout_ns = timeout_ns;
+    p->run.timeout_rules = rules;
+    p->run.timeout_rule_count++;
+}
+
+// Parses --shard <index>/<total> with a one-based index. A bad shard would
+// silently run every case on every machine, so it is fatal.
+static void fossil_maip_parse_shard(fossil_maip_pallet_t *p, const char *value)
+{
+    int index = 0;
+    int total = 0;
+    char extra;
+    if (sscanf(value, "%d/%d%c", &index, &total, &extra) != 2 || total < 1 || index < 1 || index > total)
+    {
+        maip_io_printf("{red}Invalid shard: %s (expected <index>/<total>, e.g. 1/4){reset}\n", value);
+        exit(EXIT_FAILURE);
+    }
+
+    p->run.shard_index = index - 1;
+    p->run.shard_total = total;
+}
+
+// Splits a comma separated name list. The engine compiles the lists into hash
+// sets and glob matchers once, so the flag only records whether globs occur.
+static void fossil_maip_parse_list(const char *value, cstr **list, size_t *count, int *has_wildcard)
+{
+    *list = maip_io_cstr_split(value, ',', count);
+    if (!*list)
+        *count = 0;
+
+    *has_wildcard = 0;
+    for (size_t k = 0; k < *count; ++k)
+    {
+        if (strpbrk((*list)[k], "*?"))
+            *has_wildcard = 1;
+    }
+}
+
 static int fossil_maip_parse_run(fossil_maip_pallet_t *p, int argc, char **argv, int i)
 {
     // set defaults for run command
+    p->run.only = null;
     p->run.only_cases = null;
     p->run.only_count = 0;
+    p->run.only_has_wildcard = 0;
+    p->run.skip = null;
+    p->run.skip_cases = null;
+    p->run.skip_count = 0;
+    p->run.skip_has_wildcard = 0;
     p->run.repeat = 1;
+    p->run.until_fail = 0;
     p->run.fail_fast = 0;
+    p->run.jobs = 1;
+    p->run.threads = 1;
+    p->run.timeout_ns = 0;
+    p->run.timeout_rules = null;
+    p->run.timeout_rule_count = 0;
+    p->run.isolate = 0;
+    p->run.clock = null;
+    p->run.history = null;
+    p->run.shard_index = 0;
+    p->run.shard_total = 0;
+    p->run.shard_mode = null;
+    p->run.results = null;
+    p->run.sites = null;
+    p->run.last_failed = 0;
+    p->run.failed_first = 0;
 
     for (int j = i + 1; j < argc; j++)
     {
@@ -457,12 +869,73 @@ static int fossil_maip_parse_run(fossil_maip_pallet_t *p, int argc, char **argv,
         {
             p->run.repeat = atoi(argv[++j]);
         }
+        else if (maip_io_cstr_compare(arg, "--until-fail") == 0)
+        {
+            p->run.until_fail = 1;
+        }
+        else if (maip_io_cstr_compare(arg, "--jobs") == 0 && j + 1 < argc)
+        {
+            p->run.jobs = fossil_maip_parse_workers(argv[++j]);
+        }
+        else if (maip_io_cstr_compare(arg, "--threads") == 0 && j + 1 < argc)
+        {
+            p->run.threads = fossil_maip_parse_workers(argv[++j]);
+        }
+        else if (maip_io_cstr_compare(arg, "--isolate") == 0)
+        {
+            p->run.isolate = 1;
+        }
+        else if (maip_io_cstr_compare(arg, "--last-failed") == 0)
+        {
+            p->run.last_failed = 1;
+        }
+        else if (maip_io_cstr_compare(arg, "--failed-first") == 0)
+        {
+            p->run.failed_first = 1;
+        }
+        else if (maip_io_cstr_compare(arg, "--results") == 0 && j + 1 < argc)
+        {
+            p->run.results = argv[++j];
+        }
+        else if (maip_io_cstr_compare(arg, "--sites") == 0 && j + 1 < argc)
+        {
+            p->run.sites = argv[++j];
+        }
+        else if (maip_io_cstr_compare(arg, "--shard") == 0 && j + 1 < argc)
+        {
+            fossil_maip_parse_shard(p, argv[++j]);
+        }
+        else if (maip_io_cstr_compare(arg, "--shard-mode") == 0 && j + 1 < argc)
+        {
+            p->run.shard_mode = argv[++j];
+            if (maip_io_cstr_compare(p->run.shard_mode, "hash") != 0 &&
+                maip_io_cstr_compare(p->run.shard_mode, "balanced") != 0)
+            {
+                maip_io_printf("{red}Invalid shard mode: %s{reset}\n", p->run.shard_mode);
+                exit(EXIT_FAILURE);
+            }
+        }
+        else if (maip_io_cstr_compare(arg, "--history") == 0 && j + 1 < argc)
+        {
+            p->run.history = argv[++j];
+        }
+        else if (maip_io_cstr_compare(arg, "--clock") == 0 && j + 1 < argc)
+        {
+            p->run.clock = argv[++j];
+        }
+        else if (maip_io_cstr_compare(arg, "--timeout") == 0 && j + 1 < argc)
+        {
+            fossil_maip_parse_timeout(p, argv[++j]);
+        }
         else if (maip_io_cstr_compare(arg, "--only") == 0 && j + 1 < argc)
         {
-            j++;
-            size_t count = 0;
-            p->run.only_cases = maip_io_cstr_split(argv[j], ',', &count);
-            p->run.only_count = count;
+            p->run.only = argv[++j];
+            fossil_maip_parse_list(p->run.only, &p->run.only_cases, &p->run.only_count, &p->run.only_has_wildcard);
+        }
+        else if (maip_io_cstr_compare(arg, "--skip") == 0 && j + 1 < argc)
+        {
+            p->run.skip = argv[++j];
+            fossil_maip_parse_list(p->run.skip, &p->run.skip_cases, &p->run.skip_count, &p->run.skip_has_wildcard);
         }
         else if (maip_io_cstr_compare(arg, "--help") == 0)
         {
@@ -477,7 +950,14 @@ static int fossil_maip_parse_filter(fossil_maip_pallet_t *p, int argc, char **ar
 {
     // set defaults for filter command
     p->filter.test_name = null;
+    p->filter.test_name_list = null;
+    p->filter.test_name_count = 0;
+    p->filter.test_name_has_wildcard = 0;
+    p->filter.test_name_inverted = 0;
     p->filter.name = null;
+    p->filter.name_list = null;
+    p->filter.name_count = 0;
+    p->filter.name_has_wildcard = 0;
     p->filter.tag = "fossil"; // default tag
 
     for (int j = i + 1; j < argc; j++)
@@ -489,17 +969,21 @@ static int fossil_maip_parse_filter(fossil_maip_pallet_t *p, int argc, char **ar
             return j - 1; // stop when next command starts
         }
 
-        if (maip_io_cstr_compare(arg, "--test-name") == 0 && j + 1 < argc)
+        if ((maip_io_cstr_compare(arg, "--test-name") == 0 || maip_io_cstr_compare(arg, "--not-test-name") == 0) && j + 1 < argc)
         {
+            p->filter.test_name_inverted = maip_io_cstr_compare(arg, "--not-test-name") == 0;
             p->filter.test_name = argv[++j];
+            fossil_maip_parse_list(p->filter.test_name, &p->filter.test_name_list, &p->filter.test_name_count,
+                                   &p->filter.test_name_has_wildcard);
         }
         else if (maip_io_cstr_compare(arg, "--suite-name") == 0 && j + 1 < argc)
         {
             p->filter.name = argv[++j];
+            fossil_maip_parse_list(p->filter.name, &p->filter.name_list, &p->filter.name_count, &p->filter.name_has_wildcard);
         }
         else if (maip_io_cstr_compare(arg, "--tag") == 0 && j + 1 < argc)
         {
-            p->filter.tag = argv[++j];
+            p->filter.tag = argv[++j]; // Tag expression, compiled by the engine
         }
         else if (maip_io_cstr_compare(arg, "--help") == 0)
         {
@@ -510,11 +994,45 @@ static int fossil_maip_parse_filter(fossil_maip_pallet_t *p, int argc, char **ar
     return argc;
 }
 
+// Validates one sort key, optionally suffixed with :asc or :desc. The engine
+// trusts the keys, so a bad one is fatal rather than silently unsorted.
+static void fossil_maip_parse_sort_key(const char *key, size_t length, int allow_order)
+{
+    static const char *keys[] = {"name", "result", "time", "priority", "hash"};
+
+    size_t name_length = length;
+    const char *colon = memchr(key, ':', length);
+    int valid = 0;
+    if (colon)
+    {
+        name_length = (size_t)(colon - key);
+        size_t order_length = length - name_length - 1;
+        valid = allow_order && ((order_length == 3 && strncmp(colon + 1, "asc", 3) == 0) ||
+                                (order_length == 4 && strncmp(colon + 1, "desc", 4) == 0));
+    }
+    else
+    {
+        valid = 1;
+    }
+
+    int known = 0;
+    for (size_t k = 0; k < sizeof(keys) / sizeof(keys[0]); ++k)
+        known |= strlen(keys[k]) == name_length && strncmp(keys[k], key, name_length) == 0;
+
+    if (!valid || !known)
+    {
+        maip_io_printf("{red}Invalid sort key: %.*s (expected name, result, time, priority or hash%s){reset}\n",
+                       (int)length, key, allow_order ? ", optionally with :asc or :desc" : "");
+        exit(EXIT_FAILURE);
+    }
+}
+
 static int fossil_maip_parse_sort(fossil_maip_pallet_t *p, int argc, char **argv, int i)
 {
     // set defaults for sort command
     p->sort.by = "name";
     p->sort.order = "asc";
+    p->sort.then_by = null;
 
     for (int j = i + 1; j < argc; j++)
     {
@@ -528,10 +1046,28 @@ static int fossil_maip_parse_sort(fossil_maip_pallet_t *p, int argc, char **argv
         if (maip_io_cstr_compare(arg, "--by") == 0 && j + 1 < argc)
         {
             p->sort.by = argv[++j];
+            fossil_maip_parse_sort_key(p->sort.by, strlen(p->sort.by), 0);
         }
         else if (maip_io_cstr_compare(arg, "--order") == 0 && j + 1 < argc)
         {
             p->sort.order = argv[++j];
+            if (maip_io_cstr_compare(p->sort.order, "asc") != 0 && maip_io_cstr_compare(p->sort.order, "desc") != 0)
+            {
+                maip_io_printf("{red}Invalid sort order: %s (expected asc or desc){reset}\n", p->sort.order);
+                exit(EXIT_FAILURE);
+            }
+        }
+        else if (maip_io_cstr_compare(arg, "--then-by") == 0 && j + 1 < argc)
+        {
+            p->sort.then_by = argv[++j];
+            for (const char *key = p->sort.then_by;; ++key)
+            {
+                size_t length = strcspn(key, ",");
+                fossil_maip_parse_sort_key(key, length, 1);
+                key += length;
+                if (*key == '\0')
+                    break;
+            }
         }
         else if (maip_io_cstr_compare(arg, "--help") == 0)
         {
@@ -545,9 +1081,11 @@ static int fossil_maip_parse_sort(fossil_maip_pallet_t *p, int argc, char **argv
 static int fossil_maip_parse_shuffle(fossil_maip_pallet_t *p, int argc, char **argv, int i)
 {
     // set defaults for shuffle command
-    p->shuffle.seed = 0;    // default seed (0 means use time/device entropy)
-    p->shuffle.count = 0;   // default to shuffle all items
-    p->shuffle.by = "name"; // default shuffle criteria
+    p->shuffle.enabled = 1;
+    p->shuffle.seed = 0;        // default seed (0 means use time/device entropy)
+    p->shuffle.seed_value = maip_rand_entropy();
+    p->shuffle.count = 0;       // default to shuffle all items
+    p->shuffle.mode = "uniform";
 
     for (int j = i + 1; j < argc; j++)
     {
@@ -560,15 +1098,37 @@ static int fossil_maip_parse_shuffle(fossil_maip_pallet_t *p, int argc, char **a
 
         if (maip_io_cstr_compare(arg, "--seed") == 0 && j + 1 < argc)
         {
+            // Printed with every shuffled run, so any order can be replayed
             p->shuffle.seed = argv[++j];
+            char *end = null;
+            errno = 0;
+            p->shuffle.seed_value = strtoull(p->shuffle.seed, &end, 0);
+            if (errno != 0 || end == p->shuffle.seed || *end != '\0' || p->shuffle.seed[0] == '-')
+            {
+                maip_io_printf("{red}Invalid shuffle seed: %s (expected an unsigned 64-bit number){reset}\n", p->shuffle.seed);
+                exit(EXIT_FAILURE);
+            }
         }
         else if (maip_io_cstr_compare(arg, "--count") == 0 && j + 1 < argc)
         {
-            p->shuffle.count = atoi(argv[++j]);
+            const char *value = argv[++j];
+            char *end = null;
+            long count = strtol(value, &end, 10);
+            if (end == value || *end != '\0' || count < 0 || count > INT_MAX)
+            {
+                maip_io_printf("{red}Invalid shuffle count: %s (expected a number of cases, 0 = all){reset}\n", value);
+                exit(EXIT_FAILURE);
+            }
+            p->shuffle.count = (int)count;
         }
-        else if (maip_io_cstr_compare(arg, "--by") == 0 && j + 1 < argc)
+        else if (maip_io_cstr_compare(arg, "--mode") == 0 && j + 1 < argc)
         {
-            p->shuffle.by = argv[++j];
+            p->shuffle.mode = argv[++j];
+            if (maip_io_cstr_compare(p->shuffle.mode, "uniform") != 0 && maip_io_cstr_compare(p->shuffle.mode, "weighted") != 0)
+            {
+                maip_io_printf("{red}Invalid shuffle mode: %s (expected uniform or weighted){reset}\n", p->shuffle.mode);
+                exit(EXIT_FAILURE);
+            }
         }
         else if (maip_io_cstr_compare(arg, "--help") == 0)
         {
@@ -660,6 +1220,38 @@ static int fossil_maip_parse_report(fossil_maip_pallet_t *p, int argc, char **ar
     return argc;
 }
 
+static int fossil_maip_parse_serve(fossil_maip_pallet_t *p, int argc, char **argv, int i)
+{
+    p->serve.enabled = 1;
+    p->serve.argc = argc;
+    p->serve.argv = argv;
+
+    for (int j = i + 1; j < argc; j++)
+    {
+        const char *arg = argv[j];
+
+        if (arg[0] != '-')
+        {
+            return j - 1; // stop when next command starts
+        }
+
+        if (maip_io_cstr_compare(arg, "--socket") == 0 && j + 1 < argc)
+        {
+            p->serve.socket = argv[++j];
+        }
+        else if (maip_io_cstr_compare(arg, "--send") == 0 && j + 1 < argc)
+        {
+            p->serve.send = argv[++j];
+        }
+        else if (maip_io_cstr_compare(arg, "--help") == 0)
+        {
+            _show_subhelp_serve();
+        }
+    }
+
+    return argc;
+}
+
 static int fossil_maip_parse_help(int argc, char **argv, int i)
 {
     if (i + 1 < argc)
@@ -701,6 +1293,10 @@ static int fossil_maip_parse_help(int argc, char **argv, int i)
         {
             _show_subhelp_info();
         }
+        else if (maip_io_cstr_compare(subcmd, "serve") == 0)
+        {
+            _show_subhelp_serve();
+        }
     }
     else
     {
@@ -908,6 +1504,11 @@ fossil_maip_pallet_t fossil_maip_pallet_create(int argc, char **argv)
 {
     fossil_maip_pallet_t pallet = {0};
 
+    // An invocation without a run command still runs every case once, in turn
+    pallet.run.repeat = 1;
+    pallet.run.jobs = 1;
+    pallet.run.threads = 1;
+
     for (int i = 1; i < argc; i++)
     {
         const char *arg = argv[i];
@@ -925,6 +1526,18 @@ fossil_maip_pallet_t fossil_maip_pallet_create(int argc, char **argv)
             continue;
         }
 
+        if (maip_io_cstr_starts_with(arg, "timeout="))
+        {
+            // As with --timeout, a bad budget is fatal rather than ignored
+            pallet.timeout_ns = fossil_maip_parse_seconds(arg + 8);
+            if (pallet.timeout_ns == 0)
+            {
+                maip_io_printf("{red}Invalid timeout: %s (expected timeout=<seconds>, e.g. 2.5){reset}\n", arg + 8);
+                exit(EXIT_FAILURE);
+            }
+            continue;
+        }
+
         if (arg[0] == '-')
         {
             /* Unknown global flag: report and exit */
@@ -977,6 +1590,10 @@ fossil_maip_pallet_t fossil_maip_pallet_create(int argc, char **argv)
             _show_info(&pallet);
             break;
 
+        case MAIP_CMD_SERVE:
+            i = fossil_maip_parse_serve(&pallet, argc, argv, i);
+            break;
+
         default:
         {
             /* Try to detect possible intended command using fuzzy matching */
@@ -2618,6 +3235,43 @@ void maip_io_flush(void)
     fflush(stdout);
 }
 
+#if defined(_WIN32) || defined(_WIN64)
+static INIT_ONCE maip_io_lock_once = INIT_ONCE_STATIC_INIT;
+static CRITICAL_SECTION maip_io_lock_section;
+
+static BOOL CALLBACK maip_io_lock_init(PINIT_ONCE once, PVOID param, PVOID *context)
+{
+    (void)once;
+    (void)param;
+    (void)context;
+    InitializeCriticalSection(&maip_io_lock_section);
+    return TRUE;
+}
+
+void maip_io_lock(void)
+{
+    InitOnceExecuteOnce(&maip_io_lock_once, maip_io_lock_init, NULL, NULL);
+    EnterCriticalSection(&maip_io_lock_section);
+}
+
+void maip_io_unlock(void)
+{
+    LeaveCriticalSection(&maip_io_lock_section);
+}
+#else
+static pthread_mutex_t maip_io_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+void maip_io_lock(void)
+{
+    pthread_mutex_lock(&maip_io_mutex);
+}
+
+void maip_io_unlock(void)
+{
+    pthread_mutex_unlock(&maip_io_mutex);
+}
+#endif
+
 // *****************************************************************************
 // string management
 // *****************************************************************************
@@ -35,6 +35,10 @@ extern "C" {
 #define FOSSIL_TEST_FLOAT_EPSILON 1e-6
 #define FOSSIL_TEST_DOUBLE_EPSILON 1e-9
 
+// Each check is written once, as _FOSSIL_TEST_CHECK_<name>(dispatch, ...),
+// after the ASSUME_<name> that expands it with FOSSIL_TEST_ASSUME_AS;
+// expect.h expands the same body with FOSSIL_TEST_EXPECT_AS for EXPECT_<name>.
+
 // **************************************************
 //
 // Boolean assumtions
@@ -47,7 +51,9 @@ extern "C" {
  * @param actual The boolean expression to be evaluated.
  */
 #define ASSUME_ITS_TRUE(actual) \
-    FOSSIL_TEST_ASSUME((actual), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %s to be true", (actual) ? "true" : "false"))
+    _FOSSIL_TEST_CHECK_ITS_TRUE(FOSSIL_TEST_ASSUME_AS, actual)
+#define _FOSSIL_TEST_CHECK_ITS_TRUE(dispatch, actual) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_TRUE, (actual), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %s to be true", (actual) ? "true" : "false"))
 
 /**
  * @brief Assumes that the given boolean expression is false.
@@ -55,7 +61,9 @@ extern "C" {
  * @param actual The boolean expression to be evaluated.
  */
 #define ASSUME_ITS_FALSE(actual) \
-    FOSSIL_TEST_ASSUME(!(actual), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %s to be false", (actual) ? "true" : "false"))
+    _FOSSIL_TEST_CHECK_ITS_FALSE(FOSSIL_TEST_ASSUME_AS, actual)
+#define _FOSSIL_TEST_CHECK_ITS_FALSE(dispatch, actual) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_FALSE, !(actual), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %s to be false", (actual) ? "true" : "false"))
 
 /**
  * @brief Assumes that the given boolean expression is not true.
@@ -63,7 +71,9 @@ extern "C" {
  * @param actual The boolean expression to be evaluated.
  */
 #define ASSUME_NOT_TRUE(actual) \
-    FOSSIL_TEST_ASSUME(!(actual), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %s to not be true", (actual) ? "true" : "false"))
+    _FOSSIL_TEST_CHECK_NOT_TRUE(FOSSIL_TEST_ASSUME_AS, actual)
+#define _FOSSIL_TEST_CHECK_NOT_TRUE(dispatch, actual) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_FALSE, !(actual), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %s to not be true", (actual) ? "true" : "false"))
 
 /**
  * @brief Assumes that the given boolean expression is not false.
@@ -71,7 +81,9 @@ extern "C" {
  * @param actual The boolean expression to be evaluated.
  */
 #define ASSUME_NOT_FALSE(actual) \
-    FOSSIL_TEST_ASSUME((actual), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %s to not be false", (actual) ? "true" : "false"))
+    _FOSSIL_TEST_CHECK_NOT_FALSE(FOSSIL_TEST_ASSUME_AS, actual)
+#define _FOSSIL_TEST_CHECK_NOT_FALSE(dispatch, actual) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_TRUE, (actual), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %s to not be false", (actual) ? "true" : "false"))
 
 // **************************************************
 //
@@ -88,7 +100,9 @@ extern "C" {
  * @param tol The tolerance within which the values should be considered equal.
  */
 #define ASSUME_ITS_EQUAL_F64(actual, expected, tol) \
-    FOSSIL_TEST_ASSUME(fabs((actual) - (expected)) <= (tol), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %f to be equal to " #expected " of value %f within tolerance " #tol " of value %f", (actual), (expected), (tol)))
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_F64(FOSSIL_TEST_ASSUME_AS, actual, expected, tol)
+#define _FOSSIL_TEST_CHECK_ITS_EQUAL_F64(dispatch, actual, expected, tol) \
+    dispatch(FOSSIL_MAIP_CAUSE_FLOAT, FOSSIL_MAIP_OP_EQ, fabs((actual) - (expected)) <= (tol), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %f to be equal to " #expected " of value %f within tolerance " #tol " of value %f", (actual), (expected), (tol)))
 
 /**
  * @brief Assumes that the given double value is less than the expected value.
@@ -97,7 +111,9 @@ extern "C" {
  * @param expected The expected double value.
  */
 #define ASSUME_ITS_LESS_THAN_F64(actual, expected) \
-    FOSSIL_TEST_ASSUME((actual) < (expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %f to be less than " #expected " of value %f", (actual), (expected)))
+    _FOSSIL_TEST_CHECK_ITS_LESS_THAN_F64(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_LESS_THAN_F64(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_FLOAT, FOSSIL_MAIP_OP_LT, (actual) < (expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %f to be less than " #expected " of value %f", (actual), (expected)))
 
 /**
  * @brief Assumes that the given double value is more than the expected value.
@@ -106,7 +122,9 @@ extern "C" {
  * @param expected The expected double value.
  */
 #define ASSUME_ITS_MORE_THAN_F64(actual, expected) \
-    FOSSIL_TEST_ASSUME((actual) > (expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %f to be more than " #expected " of value %f", (actual), (expected)))
+    _FOSSIL_TEST_CHECK_ITS_MORE_THAN_F64(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_MORE_THAN_F64(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_FLOAT, FOSSIL_MAIP_OP_GT, (actual) > (expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %f to be more than " #expected " of value %f", (actual), (expected)))
 
 /**
  * @brief Assumes that the given double value is less than or equal to the expected value.
@@ -115,7 +133,9 @@ extern "C" {
  * @param expected The expected double value.
  */
 #define ASSUME_ITS_LESS_OR_EQUAL_F64(actual, expected) \
-    FOSSIL_TEST_ASSUME((actual) <= (expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %f to be less than or equal to " #expected " of value %f", (actual), (expected)))
+    _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_F64(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_F64(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_FLOAT, FOSSIL_MAIP_OP_LE, (actual) <= (expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %f to be less than or equal to " #expected " of value %f", (actual), (expected)))
 
 /**
  * @brief Assumes that the given double value is more than or equal to the expected value.
@@ -124,7 +144,9 @@ extern "C" {
  * @param expected The expected double value.
  */
 #define ASSUME_ITS_MORE_OR_EQUAL_F64(actual, expected) \
-    FOSSIL_TEST_ASSUME((actual) >= (expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %f to be more than or equal to " #expected " of value %f", (actual), (expected)))
+    _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_F64(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_F64(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_FLOAT, FOSSIL_MAIP_OP_GE, (actual) >= (expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %f to be more than or equal to " #expected " of value %f", (actual), (expected)))
 
 /**
  * @brief Assumes that the given double values are not equal within a specified tolerance.
@@ -134,7 +156,9 @@ extern "C" {
  * @param tol The tolerance within which the values should not be considered equal.
  */
 #define ASSUME_NOT_EQUAL_F64(actual, expected, tol) \
-    FOSSIL_TEST_ASSUME(fabs((actual) - (expected)) > (tol), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %f to not be equal to " #expected " of value %f within tolerance " #tol " of value %f", (actual), (expected), (tol)))
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_F64(FOSSIL_TEST_ASSUME_AS, actual, expected, tol)
+#define _FOSSIL_TEST_CHECK_NOT_EQUAL_F64(dispatch, actual, expected, tol) \
+    dispatch(FOSSIL_MAIP_CAUSE_FLOAT, FOSSIL_MAIP_OP_NE, fabs((actual) - (expected)) > (tol), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %f to not be equal to " #expected " of value %f within tolerance " #tol " of value %f", (actual), (expected), (tol)))
 
 /**
  * @brief Assumes that the given double value is not less than the expected value.
@@ -143,7 +167,9 @@ extern "C" {
  * @param expected The expected double value.
  */
 #define ASSUME_NOT_LESS_THAN_F64(actual, expected) \
-    FOSSIL_TEST_ASSUME((actual) >= (expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %f to not be less than " #expected " of value %f", (actual), (expected)))
+    _FOSSIL_TEST_CHECK_NOT_LESS_THAN_F64(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_LESS_THAN_F64(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_FLOAT, FOSSIL_MAIP_OP_GE, (actual) >= (expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %f to not be less than " #expected " of value %f", (actual), (expected)))
 
 /**
  * @brief Assumes that the given double value is not more than the expected value.
@@ -152,7 +178,9 @@ extern "C" {
  * @param expected The expected double value.
  */
 #define ASSUME_NOT_MORE_THAN_F64(actual, expected) \
-    FOSSIL_TEST_ASSUME((actual) <= (expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %f to not be more than " #expected " of value %f", (actual), (expected)))
+    _FOSSIL_TEST_CHECK_NOT_MORE_THAN_F64(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_MORE_THAN_F64(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_FLOAT, FOSSIL_MAIP_OP_LE, (actual) <= (expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %f to not be more than " #expected " of value %f", (actual), (expected)))
 
 /**
  * @brief Assumes that the given double value is not less than or equal to the expected value.
@@ -161,7 +189,9 @@ extern "C" {
  * @param expected The expected double value.
  */
 #define ASSUME_NOT_LESS_OR_EQUAL_F64(actual, expected) \
-    FOSSIL_TEST_ASSUME((actual) > (expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %f to not be less than or equal to " #expected " of value %f", (actual), (expected)))
+    _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_F64(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_F64(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_FLOAT, FOSSIL_MAIP_OP_GT, (actual) > (expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %f to not be less than or equal to " #expected " of value %f", (actual), (expected)))
 
 /**
  * @brief Assumes that the given double value is not more than or equal to the expected value.
@@ -170,7 +200,9 @@ extern "C" {
  * @param expected The expected double value.
  */
 #define ASSUME_NOT_MORE_OR_EQUAL_F64(actual, expected) \
-    FOSSIL_TEST_ASSUME((actual) < (expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %f to not be more than or equal to " #expected " of value %f", (actual), (expected)))
+    _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_F64(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_F64(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_FLOAT, FOSSIL_MAIP_OP_LT, (actual) < (expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %f to not be more than or equal to " #expected " of value %f", (actual), (expected)))
 
 // Float equality check with tolerance
 /**
@@ -181,7 +213,9 @@ extern "C" {
  * @param tol The tolerance within which the values should be considered equal.
  */
 #define ASSUME_ITS_EQUAL_F32(actual, expected, tol) \
-    FOSSIL_TEST_ASSUME(fabsf((actual) - (expected)) <= (tol), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %f to be equal to " #expected " of value %f within tolerance " #tol " of value %f", (actual), (expected), (tol)))
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_F32(FOSSIL_TEST_ASSUME_AS, actual, expected, tol)
+#define _FOSSIL_TEST_CHECK_ITS_EQUAL_F32(dispatch, actual, expected, tol) \
+    dispatch(FOSSIL_MAIP_CAUSE_FLOAT, FOSSIL_MAIP_OP_EQ, fabsf((actual) - (expected)) <= (tol), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %f to be equal to " #expected " of value %f within tolerance " #tol " of value %f", (actual), (expected), (tol)))
 
 /**
  * @brief Assumes that the given float value is less than the expected value.
@@ -190,7 +224,9 @@ extern "C" {
  * @param expected The expected float value.
  */
 #define ASSUME_ITS_LESS_THAN_F32(actual, expected) \
-    FOSSIL_TEST_ASSUME((actual) < (expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %f to be less than " #expected " of value %f", (actual), (expected)))
+    _FOSSIL_TEST_CHECK_ITS_LESS_THAN_F32(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_LESS_THAN_F32(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_FLOAT, FOSSIL_MAIP_OP_LT, (actual) < (expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %f to be less than " #expected " of value %f", (actual), (expected)))
 
 /**
  * @brief Assumes that the given float value is more than the expected value.
@@ -199,7 +235,9 @@ extern "C" {
  * @param expected The expected float value.
  */
 #define ASSUME_ITS_MORE_THAN_F32(actual, expected) \
-    FOSSIL_TEST_ASSUME((actual) > (expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %f to be more than " #expected " of value %f", (actual), (expected)))
+    _FOSSIL_TEST_CHECK_ITS_MORE_THAN_F32(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_MORE_THAN_F32(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_FLOAT, FOSSIL_MAIP_OP_GT, (actual) > (expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %f to be more than " #expected " of value %f", (actual), (expected)))
 
 /**
  * @brief Assumes that the given float value is less than or equal to the expected value.
@@ -208,7 +246,9 @@ extern "C" {
  * @param expected The expected float value.
  */
 #define ASSUME_ITS_LESS_OR_EQUAL_F32(actual, expected) \
-    FOSSIL_TEST_ASSUME((actual) <= (expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %f to be less than or equal to " #expected " of value %f", (actual), (expected)))
+    _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_F32(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_F32(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_FLOAT, FOSSIL_MAIP_OP_LE, (actual) <= (expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %f to be less than or equal to " #expected " of value %f", (actual), (expected)))
 
 /**
  * @brief Assumes that the given float value is more than or equal to the expected value.
@@ -217,7 +257,9 @@ extern "C" {
  * @param expected The expected float value.
  */
 #define ASSUME_ITS_MORE_OR_EQUAL_F32(actual, expected) \
-    FOSSIL_TEST_ASSUME((actual) >= (expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %f to be more than or equal to " #expected " of value %f", (actual), (expected)))
+    _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_F32(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_F32(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_FLOAT, FOSSIL_MAIP_OP_GE, (actual) >= (expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %f to be more than or equal to " #expected " of value %f", (actual), (expected)))
 
 /**
  * @brief Assumes that the given float values are not equal within a specified tolerance.
@@ -227,7 +269,9 @@ extern "C" {
  * @param tol The tolerance within which the values should not be considered equal.
  */
 #define ASSUME_NOT_EQUAL_F32(actual, expected, tol) \
-    FOSSIL_TEST_ASSUME(fabsf((actual) - (expected)) > (tol), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %f to not be equal to " #expected " of value %f within tolerance " #tol " of value %f", (actual), (expected), (tol)))
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_F32(FOSSIL_TEST_ASSUME_AS, actual, expected, tol)
+#define _FOSSIL_TEST_CHECK_NOT_EQUAL_F32(dispatch, actual, expected, tol) \
+    dispatch(FOSSIL_MAIP_CAUSE_FLOAT, FOSSIL_MAIP_OP_NE, fabsf((actual) - (expected)) > (tol), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %f to not be equal to " #expected " of value %f within tolerance " #tol " of value %f", (actual), (expected), (tol)))
 
 /**
  * @brief Assumes that the given float value is not less than the expected value.
@@ -236,7 +280,9 @@ extern "C" {
  * @param expected The expected float value.
  */
 #define ASSUME_NOT_LESS_THAN_F32(actual, expected) \
-    FOSSIL_TEST_ASSUME((actual) >= (expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %f to not be less than " #expected " of value %f", (actual), (expected)))
+    _FOSSIL_TEST_CHECK_NOT_LESS_THAN_F32(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_LESS_THAN_F32(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_FLOAT, FOSSIL_MAIP_OP_GE, (actual) >= (expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %f to not be less than " #expected " of value %f", (actual), (expected)))
 
 /**
  * @brief Assumes that the given float value is not more than the expected value.
@@ -245,7 +291,9 @@ extern "C" {
  * @param expected The expected float value.
  */
 #define ASSUME_NOT_MORE_THAN_F32(actual, expected) \
-    FOSSIL_TEST_ASSUME((actual) <= (expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %f to not be more than " #expected " of value %f", (actual), (expected)))
+    _FOSSIL_TEST_CHECK_NOT_MORE_THAN_F32(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_MORE_THAN_F32(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_FLOAT, FOSSIL_MAIP_OP_LE, (actual) <= (expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %f to not be more than " #expected " of value %f", (actual), (expected)))
 
 /**
  * @brief Assumes that the given float value is not less than or equal to the expected value.
@@ -254,7 +302,9 @@ extern "C" {
  * @param expected The expected float value.
  */
 #define ASSUME_NOT_LESS_OR_EQUAL_F32(actual, expected) \
-    FOSSIL_TEST_ASSUME((actual) > (expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %f to not be less than or equal to " #expected " of value %f", (actual), (expected)))
+    _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_F32(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_F32(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_FLOAT, FOSSIL_MAIP_OP_GT, (actual) > (expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %f to not be less than or equal to " #expected " of value %f", (actual), (expected)))
 
 /**
  * @brief Assumes that the given float value is not more than or equal to the expected value.
@@ -263,7 +313,9 @@ extern "C" {
  * @param expected The expected float value.
  */
 #define ASSUME_NOT_MORE_OR_EQUAL_F32(actual, expected) \
-    FOSSIL_TEST_ASSUME((actual) < (expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %f to not be more than or equal to " #expected " of value %f", (actual), (expected)))
+    _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_F32(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_F32(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_FLOAT, FOSSIL_MAIP_OP_LT, (actual) < (expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %f to not be more than or equal to " #expected " of value %f", (actual), (expected)))
 
 // Float NaN and Infinity checks
 /**
@@ -272,7 +324,9 @@ extern "C" {
  * @param actual The actual float value.
  */
 #define ASSUME_ITS_NAN_F32(actual) \
-    FOSSIL_TEST_ASSUME(isnan(actual), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %f to be NaN", (actual)))
+    _FOSSIL_TEST_CHECK_ITS_NAN_F32(FOSSIL_TEST_ASSUME_AS, actual)
+#define _FOSSIL_TEST_CHECK_ITS_NAN_F32(dispatch, actual) \
+    dispatch(FOSSIL_MAIP_CAUSE_FLOAT, FOSSIL_MAIP_OP_IS, isnan(actual), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %f to be NaN", (actual)))
 
 /**
  * @brief Assumes that the given float value is infinity.
@@ -280,7 +334,9 @@ extern "C" {
  * @param actual The actual float value.
  */
 #define ASSUME_ITS_INF_F32(actual) \
-    FOSSIL_TEST_ASSUME(isinf(actual), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %f to be infinity", (actual)))
+    _FOSSIL_TEST_CHECK_ITS_INF_F32(FOSSIL_TEST_ASSUME_AS, actual)
+#define _FOSSIL_TEST_CHECK_ITS_INF_F32(dispatch, actual) \
+    dispatch(FOSSIL_MAIP_CAUSE_FLOAT, FOSSIL_MAIP_OP_IS, isinf(actual), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %f to be infinity", (actual)))
 
 // Double NaN and Infinity checks
 /**
@@ -289,7 +345,9 @@ extern "C" {
  * @param actual The actual double value.
  */
 #define ASSUME_ITS_NAN_F64(actual) \
-    FOSSIL_TEST_ASSUME(isnan(actual), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %f to be NaN", (actual)))
+    _FOSSIL_TEST_CHECK_ITS_NAN_F64(FOSSIL_TEST_ASSUME_AS, actual)
+#define _FOSSIL_TEST_CHECK_ITS_NAN_F64(dispatch, actual) \
+    dispatch(FOSSIL_MAIP_CAUSE_FLOAT, FOSSIL_MAIP_OP_IS, isnan(actual), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %f to be NaN", (actual)))
 
 /**
  * @brief Assumes that the given double value is infinity.
@@ -297,7 +355,9 @@ extern "C" {
  * @param actual The actual double value.
  */
 #define ASSUME_ITS_INF_F64(actual) \
-    FOSSIL_TEST_ASSUME(isinf(actual), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %f to be infinity", (actual)))
+    _FOSSIL_TEST_CHECK_ITS_INF_F64(FOSSIL_TEST_ASSUME_AS, actual)
+#define _FOSSIL_TEST_CHECK_ITS_INF_F64(dispatch, actual) \
+    dispatch(FOSSIL_MAIP_CAUSE_FLOAT, FOSSIL_MAIP_OP_IS, isinf(actual), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %f to be infinity", (actual)))
 
 // **************************************************
 //
@@ -312,7 +372,9 @@ extern "C" {
  * @param expected The expected 8-bit octal value.
  */
 #define ASSUME_ITS_EQUAL_O8(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint8_t)(actual) == (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be equal to " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_O8(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_EQUAL_O8(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_EQ, (uint8_t)(actual) == (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be equal to " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
 
 /**
  * @brief Assumes that the given 8-bit octal value is less than the expected value.
@@ -321,7 +383,9 @@ extern "C" {
  * @param expected The expected 8-bit octal value.
  */
 #define ASSUME_ITS_LESS_THAN_O8(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint8_t)(actual) < (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be less than " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_LESS_THAN_O8(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_LESS_THAN_O8(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LT, (uint8_t)(actual) < (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be less than " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
 
 /**
  * @brief Assumes that the given 8-bit octal value is more than the expected value.
@@ -330,7 +394,9 @@ extern "C" {
  * @param expected The expected 8-bit octal value.
  */
 #define ASSUME_ITS_MORE_THAN_O8(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint8_t)(actual) > (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be more than " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_MORE_THAN_O8(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_MORE_THAN_O8(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GT, (uint8_t)(actual) > (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be more than " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
 
 /**
  * @brief Assumes that the given 8-bit octal value is less than or equal to the expected value.
@@ -339,7 +405,9 @@ extern "C" {
  * @param expected The expected 8-bit octal value.
  */
 #define ASSUME_ITS_LESS_OR_EQUAL_O8(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint8_t)(actual) <= (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be less than or equal to " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_O8(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_O8(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LE, (uint8_t)(actual) <= (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be less than or equal to " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
 
 /**
  * @brief Assumes that the given 8-bit octal value is more than or equal to the expected value.
@@ -348,7 +416,9 @@ extern "C" {
  * @param expected The expected 8-bit octal value.
  */
 #define ASSUME_ITS_MORE_OR_EQUAL_O8(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint8_t)(actual) >= (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be more than or equal to " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_O8(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_O8(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GE, (uint8_t)(actual) >= (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be more than or equal to " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
 
 /**
  * @brief Assumes that the given 8-bit octal values are not equal.
@@ -357,7 +427,9 @@ extern "C" {
  * @param expected The expected 8-bit octal value.
  */
 #define ASSUME_NOT_EQUAL_O8(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint8_t)(actual) != (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be equal to " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_O8(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_EQUAL_O8(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_NE, (uint8_t)(actual) != (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be equal to " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
 
 /**
  * @brief Assumes that the given 8-bit octal value is not less than the expected value.
@@ -366,7 +438,9 @@ extern "C" {
  * @param expected The expected 8-bit octal value.
  */
 #define ASSUME_NOT_LESS_THAN_O8(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint8_t)(actual) >= (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be less than " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_LESS_THAN_O8(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_LESS_THAN_O8(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GE, (uint8_t)(actual) >= (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be less than " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
 
 /**
  * @brief Assumes that the given 8-bit octal value is not more than the expected value.
@@ -375,7 +449,9 @@ extern "C" {
  * @param expected The expected 8-bit octal value.
  */
 #define ASSUME_NOT_MORE_THAN_O8(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint8_t)(actual) <= (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be more than " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_MORE_THAN_O8(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_MORE_THAN_O8(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LE, (uint8_t)(actual) <= (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be more than " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
 
 /**
  * @brief Assumes that the given 8-bit octal value is not less than or equal to the expected value.
@@ -384,7 +460,9 @@ extern "C" {
  * @param expected The expected 8-bit octal value.
  */
 #define ASSUME_NOT_LESS_OR_EQUAL_O8(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint8_t)(actual) > (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be less than or equal to " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_O8(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_O8(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GT, (uint8_t)(actual) > (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be less than or equal to " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
 
 /**
  * @brief Assumes that the given 8-bit octal value is not more than or equal to the expected value.
@@ -393,7 +471,9 @@ extern "C" {
  * @param expected The expected 8-bit octal value.
  */
 #define ASSUME_NOT_MORE_OR_EQUAL_O8(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint8_t)(actual) < (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be more than or equal to " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_O8(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_O8(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LT, (uint8_t)(actual) < (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be more than or equal to " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
 
 /**
  * @brief Assumes that the given 16-bit octal values are equal.
@@ -402,7 +482,9 @@ extern "C" {
  * @param expected The expected 16-bit octal value.
  */
 #define ASSUME_ITS_EQUAL_O16(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint16_t)(actual) == (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be equal to " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_O16(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_EQUAL_O16(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_EQ, (uint16_t)(actual) == (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be equal to " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
 
 /**
  * @brief Assumes that the given 16-bit octal value is less than the expected value.
@@ -411,7 +493,9 @@ extern "C" {
  * @param expected The expected 16-bit octal value.
  */
 #define ASSUME_ITS_LESS_THAN_O16(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint16_t)(actual) < (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be less than " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_LESS_THAN_O16(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_LESS_THAN_O16(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LT, (uint16_t)(actual) < (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be less than " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
 
 /**
  * @brief Assumes that the given 16-bit octal value is more than the expected value.
@@ -420,7 +504,9 @@ extern "C" {
  * @param expected The expected 16-bit octal value.
  */
 #define ASSUME_ITS_MORE_THAN_O16(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint16_t)(actual) > (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be more than " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_MORE_THAN_O16(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_MORE_THAN_O16(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GT, (uint16_t)(actual) > (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be more than " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
 
 /**
  * @brief Assumes that the given 16-bit octal value is less than or equal to the expected value.
@@ -429,7 +515,9 @@ extern "C" {
  * @param expected The expected 16-bit octal value.
  */
 #define ASSUME_ITS_LESS_OR_EQUAL_O16(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint16_t)(actual) <= (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be less than or equal to " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_O16(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_O16(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LE, (uint16_t)(actual) <= (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be less than or equal to " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
 
 /**
  * @brief Assumes that the given 16-bit octal value is more than or equal to the expected value.
@@ -438,7 +526,9 @@ extern "C" {
  * @param expected The expected 16-bit octal value.
  */
 #define ASSUME_ITS_MORE_OR_EQUAL_O16(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint16_t)(actual) >= (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be more than or equal to " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_O16(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_O16(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GE, (uint16_t)(actual) >= (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be more than or equal to " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
 
 /**
  * @brief Assumes that the given 16-bit octal values are not equal.
@@ -447,7 +537,9 @@ extern "C" {
  * @param expected The expected 16-bit octal value.
  */
 #define ASSUME_NOT_EQUAL_O16(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint16_t)(actual) != (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be equal to " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_O16(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_EQUAL_O16(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_NE, (uint16_t)(actual) != (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be equal to " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
 
 /**
  * @brief Assumes that the given 16-bit octal value is not less than the expected value.
@@ -456,7 +548,9 @@ extern "C" {
  * @param expected The expected 16-bit octal value.
  */
 #define ASSUME_NOT_LESS_THAN_O16(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint16_t)(actual) >= (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be less than " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_LESS_THAN_O16(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_LESS_THAN_O16(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GE, (uint16_t)(actual) >= (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be less than " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
 
 /**
  * @brief Assumes that the given 16-bit octal value is not more than the expected value.
@@ -465,7 +559,9 @@ extern "C" {
  * @param expected The expected 16-bit octal value.
  */
 #define ASSUME_NOT_MORE_THAN_O16(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint16_t)(actual) <= (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be more than " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_MORE_THAN_O16(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_MORE_THAN_O16(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LE, (uint16_t)(actual) <= (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be more than " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
 
 /**
  * @brief Assumes that the given 16-bit octal value is not less than or equal to the expected value.
@@ -474,7 +570,9 @@ extern "C" {
  * @param expected The expected 16-bit octal value.
  */
 #define ASSUME_NOT_LESS_OR_EQUAL_O16(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint16_t)(actual) > (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be less than or equal to " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_O16(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_O16(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GT, (uint16_t)(actual) > (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be less than or equal to " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
 
 /**
  * @brief Assumes that the given 16-bit octal value is not more than or equal to the expected value.
@@ -483,7 +581,9 @@ extern "C" {
  * @param expected The expected 16-bit octal value.
  */
 #define ASSUME_NOT_MORE_OR_EQUAL_O16(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint16_t)(actual) < (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be more than or equal to " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_O16(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_O16(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LT, (uint16_t)(actual) < (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be more than or equal to " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
 
 /**
  * @brief Assumes that the given 32-bit octal values are equal.
@@ -492,7 +592,9 @@ extern "C" {
  * @param expected The expected 32-bit octal value.
  */
 #define ASSUME_ITS_EQUAL_O32(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint32_t)(actual) == (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be equal to " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_O32(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_EQUAL_O32(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_EQ, (uint32_t)(actual) == (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be equal to " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
 
 /**
  * @brief Assumes that the given 32-bit octal value is less than the expected value.
@@ -501,7 +603,9 @@ extern "C" {
  * @param expected The expected 32-bit octal value.
  */
 #define ASSUME_ITS_LESS_THAN_O32(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint32_t)(actual) < (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be less than " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_LESS_THAN_O32(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_LESS_THAN_O32(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LT, (uint32_t)(actual) < (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be less than " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
 
 /**
  * @brief Assumes that the given 32-bit octal value is more than the expected value.
@@ -510,7 +614,9 @@ extern "C" {
  * @param expected The expected 32-bit octal value.
  */
 #define ASSUME_ITS_MORE_THAN_O32(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint32_t)(actual) > (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be more than " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_MORE_THAN_O32(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_MORE_THAN_O32(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GT, (uint32_t)(actual) > (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be more than " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
 
 /**
  * @brief Assumes that the given 32-bit octal value is less than or equal to the expected value.
@@ -519,7 +625,9 @@ extern "C" {
  * @param expected The expected 32-bit octal value.
  */
 #define ASSUME_ITS_LESS_OR_EQUAL_O32(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint32_t)(actual) <= (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be less than or equal to " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_O32(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_O32(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LE, (uint32_t)(actual) <= (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be less than or equal to " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
 
 /**
  * @brief Assumes that the given 32-bit octal value is more than or equal to the expected value.
@@ -528,7 +636,9 @@ extern "C" {
  * @param expected The expected 32-bit octal value.
  */
 #define ASSUME_ITS_MORE_OR_EQUAL_O32(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint32_t)(actual) >= (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be more than or equal to " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_O32(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_O32(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GE, (uint32_t)(actual) >= (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be more than or equal to " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
 
 /**
  * @brief Assumes that the given 32-bit octal values are not equal.
@@ -537,7 +647,9 @@ extern "C" {
  * @param expected The expected 32-bit octal value.
  */
 #define ASSUME_NOT_EQUAL_O32(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint32_t)(actual) != (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be equal to " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_O32(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_EQUAL_O32(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_NE, (uint32_t)(actual) != (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be equal to " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
 
 /**
  * @brief Assumes that the given 32-bit octal value is not less than the expected value.
@@ -546,7 +658,9 @@ extern "C" {
  * @param expected The expected 32-bit octal value.
  */
 #define ASSUME_NOT_LESS_THAN_O32(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint32_t)(actual) >= (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be less than " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_LESS_THAN_O32(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_LESS_THAN_O32(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GE, (uint32_t)(actual) >= (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be less than " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
 
 /**
  * @brief Assumes that the given 32-bit octal value is not more than the expected value.
@@ -555,7 +669,9 @@ extern "C" {
  * @param expected The expected 32-bit octal value.
  */
 #define ASSUME_NOT_MORE_THAN_O32(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint32_t)(actual) <= (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be more than " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_MORE_THAN_O32(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_MORE_THAN_O32(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LE, (uint32_t)(actual) <= (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be more than " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
 
 /**
  * @brief Assumes that the given 32-bit octal value is not less than or equal to the expected value.
@@ -564,7 +680,9 @@ extern "C" {
  * @param expected The expected 32-bit octal value.
  */
 #define ASSUME_NOT_LESS_OR_EQUAL_O32(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint32_t)(actual) > (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be less than or equal to " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_O32(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_O32(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GT, (uint32_t)(actual) > (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be less than or equal to " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
 
 /**
  * @brief Assumes that the given 32-bit octal value is not more than or equal to the expected value.
@@ -573,7 +691,9 @@ extern "C" {
  * @param expected The expected 32-bit octal value.
  */
 #define ASSUME_NOT_MORE_OR_EQUAL_O32(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint32_t)(actual) < (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be more than or equal to " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_O32(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_O32(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LT, (uint32_t)(actual) < (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be more than or equal to " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
 
 /**
  * @brief Assumes that the given 64-bit octal values are equal.
@@ -582,7 +702,9 @@ extern "C" {
  * @param expected The expected 64-bit octal value.
  */
 #define ASSUME_ITS_EQUAL_O64(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint64_t)(actual) == (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to be equal to " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_O64(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_EQUAL_O64(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_EQ, (uint64_t)(actual) == (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to be equal to " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
 
 /**
  * @brief Assumes that the given 64-bit octal value is less than the expected value.
@@ -591,7 +713,9 @@ extern "C" {
  * @param expected The expected 64-bit octal value.
  */
 #define ASSUME_ITS_LESS_THAN_O64(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint64_t)(actual) < (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to be less than " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_LESS_THAN_O64(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_LESS_THAN_O64(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LT, (uint64_t)(actual) < (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to be less than " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
 
 /**
  * @brief Assumes that the given 64-bit octal value is more than the expected value.
@@ -600,7 +724,9 @@ extern "C" {
  * @param expected The expected 64-bit octal value.
  */
 #define ASSUME_ITS_MORE_THAN_O64(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint64_t)(actual) > (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to be more than " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_MORE_THAN_O64(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_MORE_THAN_O64(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GT, (uint64_t)(actual) > (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to be more than " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
 
 /**
  * @brief Assumes that the given 64-bit octal value is less than or equal to the expected value.
@@ -609,7 +735,9 @@ extern "C" {
  * @param expected The expected 64-bit octal value.
  */
 #define ASSUME_ITS_LESS_OR_EQUAL_O64(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint64_t)(actual) <= (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to be less than or equal to " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_O64(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_O64(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LE, (uint64_t)(actual) <= (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to be less than or equal to " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
 
 /**
  * @brief Assumes that the given 64-bit octal value is more than or equal to the expected value.
@@ -618,7 +746,9 @@ extern "C" {
  * @param expected The expected 64-bit octal value.
  */
 #define ASSUME_ITS_MORE_OR_EQUAL_O64(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint64_t)(actual) >= (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to be more than or equal to " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_O64(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_O64(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GE, (uint64_t)(actual) >= (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to be more than or equal to " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
 
 /**
  * @brief Assumes that the given 64-bit octal values are not equal.
@@ -627,7 +757,9 @@ extern "C" {
  * @param expected The expected 64-bit octal value.
  */
 #define ASSUME_NOT_EQUAL_O64(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint64_t)(actual) != (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to not be equal to " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_O64(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_EQUAL_O64(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_NE, (uint64_t)(actual) != (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to not be equal to " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
 
 /**
  * @brief Assumes that the given 64-bit octal value is not less than the expected value.
@@ -636,7 +768,9 @@ extern "C" {
  * @param expected The expected 64-bit octal value.
  */
 #define ASSUME_NOT_LESS_THAN_O64(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint64_t)(actual) >= (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to not be less than " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_LESS_THAN_O64(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_LESS_THAN_O64(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GE, (uint64_t)(actual) >= (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to not be less than " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
 
 /**
  * @brief Assumes that the given 64-bit octal value is not more than the expected value.
@@ -645,7 +779,9 @@ extern "C" {
  * @param expected The expected 64-bit octal value.
  */
 #define ASSUME_NOT_MORE_THAN_O64(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint64_t)(actual) <= (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to not be more than " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_MORE_THAN_O64(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_MORE_THAN_O64(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LE, (uint64_t)(actual) <= (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to not be more than " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
 
 /**
  * @brief Assumes that the given 64-bit octal value is not less than or equal to the expected value.
@@ -654,7 +790,9 @@ extern "C" {
  * @param expected The expected 64-bit octal value.
  */
 #define ASSUME_NOT_LESS_OR_EQUAL_O64(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint64_t)(actual) > (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to not be less than or equal to " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_O64(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_O64(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GT, (uint64_t)(actual) > (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to not be less than or equal to " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
 
 /**
  * @brief Assumes that the given 64-bit octal value is not more than or equal to the expected value.
@@ -663,7 +801,9 @@ extern "C" {
  * @param expected The expected 64-bit octal value.
  */
 #define ASSUME_NOT_MORE_OR_EQUAL_O64(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint64_t)(actual) < (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to not be more than or equal to " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_O64(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_O64(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LT, (uint64_t)(actual) < (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to not be more than or equal to " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
 
 // Hexadecimal assumptions
 
@@ -674,7 +814,9 @@ extern "C" {
  * @param expected The expected 8-bit hexadecimal value.
  */
 #define ASSUME_ITS_EQUAL_H8(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint8_t)(actual) == (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be equal to " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_H8(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_EQUAL_H8(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_EQ, (uint8_t)(actual) == (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be equal to " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
 
 /**
  * @brief Assumes that the given 8-bit hexadecimal value is less than the expected value.
@@ -683,7 +825,9 @@ extern "C" {
  * @param expected The expected 8-bit hexadecimal value.
  */
 #define ASSUME_ITS_LESS_THAN_H8(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint8_t)(actual) < (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be less than " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_LESS_THAN_H8(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_LESS_THAN_H8(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LT, (uint8_t)(actual) < (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be less than " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
 
 /**
  * @brief Assumes that the given 8-bit hexadecimal value is more than the expected value.
@@ -692,7 +836,9 @@ extern "C" {
  * @param expected The expected 8-bit hexadecimal value.
  */
 #define ASSUME_ITS_MORE_THAN_H8(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint8_t)(actual) > (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be more than " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_MORE_THAN_H8(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_MORE_THAN_H8(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GT, (uint8_t)(actual) > (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be more than " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
 
 /**
  * @brief Assumes that the given 8-bit hexadecimal value is less than or equal to the expected value.
@@ -701,7 +847,9 @@ extern "C" {
  * @param expected The expected 8-bit hexadecimal value.
  */
 #define ASSUME_ITS_LESS_OR_EQUAL_H8(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint8_t)(actual) <= (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be less than or equal to " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_H8(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_H8(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LE, (uint8_t)(actual) <= (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be less than or equal to " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
 
 /**
  * @brief Assumes that the given 8-bit hexadecimal value is more than or equal to the expected value.
@@ -710,7 +858,9 @@ extern "C" {
  * @param expected The expected 8-bit hexadecimal value.
  */
 #define ASSUME_ITS_MORE_OR_EQUAL_H8(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint8_t)(actual) >= (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be more than or equal to " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_H8(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_H8(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GE, (uint8_t)(actual) >= (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be more than or equal to " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
 
 /**
  * @brief Assumes that the given 8-bit hexadecimal values are not equal.
@@ -719,7 +869,9 @@ extern "C" {
  * @param expected The expected 8-bit hexadecimal value.
  */
 #define ASSUME_NOT_EQUAL_H8(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint8_t)(actual) != (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be equal to " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_H8(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_EQUAL_H8(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_NE, (uint8_t)(actual) != (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be equal to " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
 
 /**
  * @brief Assumes that the given 8-bit hexadecimal value is not less than the expected value.
@@ -728,7 +880,9 @@ extern "C" {
  * @param expected The expected 8-bit hexadecimal value.
  */
 #define ASSUME_NOT_LESS_THAN_H8(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint8_t)(actual) >= (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be less than " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_LESS_THAN_H8(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_LESS_THAN_H8(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GE, (uint8_t)(actual) >= (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be less than " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
 
 /**
  * @brief Assumes that the given 8-bit hexadecimal value is not more than the expected value.
@@ -737,7 +891,9 @@ extern "C" {
  * @param expected The expected 8-bit hexadecimal value.
  */
 #define ASSUME_NOT_MORE_THAN_H8(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint8_t)(actual) <= (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be more than " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_MORE_THAN_H8(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_MORE_THAN_H8(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LE, (uint8_t)(actual) <= (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be more than " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
 
 /**
  * @brief Assumes that the given 8-bit hexadecimal value is not less than or equal to the expected value.
@@ -746,7 +902,9 @@ extern "C" {
  * @param expected The expected 8-bit hexadecimal value.
  */
 #define ASSUME_NOT_LESS_OR_EQUAL_H8(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint8_t)(actual) > (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be less than or equal to " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_H8(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_H8(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GT, (uint8_t)(actual) > (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be less than or equal to " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
 
 /**
  * @brief Assumes that the given 8-bit hexadecimal value is not more than or equal to the expected value.
@@ -755,7 +913,9 @@ extern "C" {
  * @param expected The expected 8-bit hexadecimal value.
  */
 #define ASSUME_NOT_MORE_OR_EQUAL_H8(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint8_t)(actual) < (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be more than or equal to " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_H8(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_H8(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LT, (uint8_t)(actual) < (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be more than or equal to " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
 
 /**
  * @brief Assumes that the given 16-bit hexadecimal values are equal.
@@ -764,7 +924,9 @@ extern "C" {
  * @param expected The expected 16-bit hexadecimal value.
  */
 #define ASSUME_ITS_EQUAL_H16(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint16_t)(actual) == (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be equal to " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_H16(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_EQUAL_H16(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_EQ, (uint16_t)(actual) == (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be equal to " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
 
 /**
  * @brief Assumes that the given 16-bit hexadecimal value is less than the expected value.
@@ -773,7 +935,9 @@ extern "C" {
  * @param expected The expected 16-bit hexadecimal value.
  */
 #define ASSUME_ITS_LESS_THAN_H16(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint16_t)(actual) < (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be less than " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_LESS_THAN_H16(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_LESS_THAN_H16(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LT, (uint16_t)(actual) < (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be less than " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
 
 /**
  * @brief Assumes that the given 16-bit hexadecimal value is more than the expected value.
@@ -782,7 +946,9 @@ extern "C" {
  * @param expected The expected 16-bit hexadecimal value.
  */
 #define ASSUME_ITS_MORE_THAN_H16(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint16_t)(actual) > (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be more than " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_MORE_THAN_H16(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_MORE_THAN_H16(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GT, (uint16_t)(actual) > (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be more than " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
 
 /**
  * @brief Assumes that the given 16-bit hexadecimal value is less than or equal to the expected value.
@@ -791,7 +957,9 @@ extern "C" {
  * @param expected The expected 16-bit hexadecimal value.
  */
 #define ASSUME_ITS_LESS_OR_EQUAL_H16(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint16_t)(actual) <= (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be less than or equal to " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_H16(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_H16(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LE, (uint16_t)(actual) <= (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be less than or equal to " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
 
 /**
  * @brief Assumes that the given 16-bit hexadecimal value is more than or equal to the expected value.
@@ -800,7 +968,9 @@ extern "C" {
  * @param expected The expected 16-bit hexadecimal value.
  */
 #define ASSUME_ITS_MORE_OR_EQUAL_H16(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint16_t)(actual) >= (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be more than or equal to " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_H16(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_H16(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GE, (uint16_t)(actual) >= (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be more than or equal to " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
 
 /**
  * @brief Assumes that the given 16-bit hexadecimal values are not equal.
@@ -809,7 +979,9 @@ extern "C" {
  * @param expected The expected 16-bit hexadecimal value.
  */
 #define ASSUME_NOT_EQUAL_H16(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint16_t)(actual) != (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be equal to " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_H16(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_EQUAL_H16(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_NE, (uint16_t)(actual) != (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be equal to " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
 
 /**
  * @brief Assumes that the given 16-bit hexadecimal value is not less than the expected value.
@@ -818,7 +990,9 @@ extern "C" {
  * @param expected The expected 16-bit hexadecimal value.
  */
 #define ASSUME_NOT_LESS_THAN_H16(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint16_t)(actual) >= (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be less than " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_LESS_THAN_H16(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_LESS_THAN_H16(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GE, (uint16_t)(actual) >= (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be less than " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
 
 /**
  * @brief Assumes that the given 16-bit hexadecimal value is not more than the expected value.
@@ -827,7 +1001,9 @@ extern "C" {
  * @param expected The expected 16-bit hexadecimal value.
  */
 #define ASSUME_NOT_MORE_THAN_H16(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint16_t)(actual) <= (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be more than " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_MORE_THAN_H16(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_MORE_THAN_H16(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LE, (uint16_t)(actual) <= (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be more than " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
 
 /**
  * @brief Assumes that the given 16-bit hexadecimal value is not less than or equal to the expected value.
@@ -836,7 +1012,9 @@ extern "C" {
  * @param expected The expected 16-bit hexadecimal value.
  */
 #define ASSUME_NOT_LESS_OR_EQUAL_H16(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint16_t)(actual) > (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be less than or equal to " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_H16(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_H16(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GT, (uint16_t)(actual) > (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be less than or equal to " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
 
 /**
  * @brief Assumes that the given 16-bit hexadecimal value is not more than or equal to the expected value.
@@ -845,7 +1023,9 @@ extern "C" {
  * @param expected The expected 16-bit hexadecimal value.
  */
 #define ASSUME_NOT_MORE_OR_EQUAL_H16(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint16_t)(actual) < (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be more than or equal to " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_H16(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_H16(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LT, (uint16_t)(actual) < (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be more than or equal to " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
 
 /**
  * @brief Assumes that the given 32-bit hexadecimal values are equal.
@@ -854,7 +1034,9 @@ extern "C" {
  * @param expected The expected 32-bit hexadecimal value.
  */
 #define ASSUME_ITS_EQUAL_H32(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint32_t)(actual) == (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be equal to " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_H32(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_EQUAL_H32(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_EQ, (uint32_t)(actual) == (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be equal to " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
 
 /**
  * @brief Assumes that the given 32-bit hexadecimal value is less than the expected value.
@@ -863,7 +1045,9 @@ extern "C" {
  * @param expected The expected 32-bit hexadecimal value.
  */
 #define ASSUME_ITS_LESS_THAN_H32(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint32_t)(actual) < (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be less than " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_LESS_THAN_H32(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_LESS_THAN_H32(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LT, (uint32_t)(actual) < (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be less than " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
 
 /**
  * @brief Assumes that the given 32-bit hexadecimal value is more than the expected value.
@@ -872,7 +1056,9 @@ extern "C" {
  * @param expected The expected 32-bit hexadecimal value.
  */
 #define ASSUME_ITS_MORE_THAN_H32(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint32_t)(actual) > (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be more than " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_MORE_THAN_H32(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_MORE_THAN_H32(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GT, (uint32_t)(actual) > (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be more than " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
 
 /**
  * @brief Assumes that the given 32-bit hexadecimal value is less than or equal to the expected value.
@@ -881,7 +1067,9 @@ extern "C" {
  * @param expected The expected 32-bit hexadecimal value.
  */
 #define ASSUME_ITS_LESS_OR_EQUAL_H32(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint32_t)(actual) <= (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be less than or equal to " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_H32(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_H32(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LE, (uint32_t)(actual) <= (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be less than or equal to " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
 
 /**
  * @brief Assumes that the given 32-bit hexadecimal value is more than or equal to the expected value.
@@ -890,7 +1078,9 @@ extern "C" {
  * @param expected The expected 32-bit hexadecimal value.
  */
 #define ASSUME_ITS_MORE_OR_EQUAL_H32(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint32_t)(actual) >= (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be more than or equal to " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_H32(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_H32(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GE, (uint32_t)(actual) >= (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be more than or equal to " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
 
 /**
  * @brief Assumes that the given 32-bit hexadecimal values are not equal.
@@ -899,7 +1089,9 @@ extern "C" {
  * @param expected The expected 32-bit hexadecimal value.
  */
 #define ASSUME_NOT_EQUAL_H32(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint32_t)(actual) != (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be equal to " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_H32(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_EQUAL_H32(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_NE, (uint32_t)(actual) != (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be equal to " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
 
 /**
  * @brief Assumes that the given 32-bit hexadecimal value is not less than the expected value.
@@ -908,7 +1100,9 @@ extern "C" {
  * @param expected The expected 32-bit hexadecimal value.
  */
 #define ASSUME_NOT_LESS_THAN_H32(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint32_t)(actual) >= (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be less than " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_LESS_THAN_H32(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_LESS_THAN_H32(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GE, (uint32_t)(actual) >= (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be less than " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
 
 /**
  * @brief Assumes that the given 32-bit hexadecimal value is not more than the expected value.
@@ -917,7 +1111,9 @@ extern "C" {
  * @param expected The expected 32-bit hexadecimal value.
  */
 #define ASSUME_NOT_MORE_THAN_H32(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint32_t)(actual) <= (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be more than " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_MORE_THAN_H32(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_MORE_THAN_H32(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LE, (uint32_t)(actual) <= (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be more than " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
 
 /**
  * @brief Assumes that the given 32-bit hexadecimal value is not less than or equal to the expected value.
@@ -926,7 +1122,9 @@ extern "C" {
  * @param expected The expected 32-bit hexadecimal value.
  */
 #define ASSUME_NOT_LESS_OR_EQUAL_H32(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint32_t)(actual) > (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be less than or equal to " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_H32(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_H32(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GT, (uint32_t)(actual) > (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be less than or equal to " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
 
 /**
  * @brief Assumes that the given 32-bit hexadecimal value is not more than or equal to the expected value.
@@ -935,7 +1133,9 @@ extern "C" {
  * @param expected The expected 32-bit hexadecimal value.
  */
 #define ASSUME_NOT_MORE_OR_EQUAL_H32(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint32_t)(actual) < (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be more than or equal to " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_H32(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_H32(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LT, (uint32_t)(actual) < (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be more than or equal to " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
 
 /**
  * @brief Assumes that the given 64-bit hexadecimal values are equal.
@@ -944,7 +1144,9 @@ extern "C" {
  * @param expected The expected 64-bit hexadecimal value.
  */
 #define ASSUME_ITS_EQUAL_H64(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint64_t)(actual) == (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to be equal to " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_H64(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_EQUAL_H64(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_EQ, (uint64_t)(actual) == (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to be equal to " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
 
 /**
  * @brief Assumes that the given 64-bit hexadecimal value is less than the expected value.
@@ -953,7 +1155,9 @@ extern "C" {
  * @param expected The expected 64-bit hexadecimal value.
  */
 #define ASSUME_ITS_LESS_THAN_H64(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint64_t)(actual) < (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to be less than " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_LESS_THAN_H64(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_LESS_THAN_H64(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LT, (uint64_t)(actual) < (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to be less than " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
 
 /**
  * @brief Assumes that the given 64-bit hexadecimal value is more than the expected value.
@@ -962,7 +1166,9 @@ extern "C" {
  * @param expected The expected 64-bit hexadecimal value.
  */
 #define ASSUME_ITS_MORE_THAN_H64(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint64_t)(actual) > (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to be more than " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_MORE_THAN_H64(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_MORE_THAN_H64(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GT, (uint64_t)(actual) > (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to be more than " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
 
 /**
  * @brief Assumes that the given 64-bit hexadecimal value is less than or equal to the expected value.
@@ -971,7 +1177,9 @@ extern "C" {
  * @param expected The expected 64-bit hexadecimal value.
  */
 #define ASSUME_ITS_LESS_OR_EQUAL_H64(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint64_t)(actual) <= (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to be less than or equal to " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_H64(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_H64(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LE, (uint64_t)(actual) <= (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to be less than or equal to " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
 
 /**
  * @brief Assumes that the given 64-bit hexadecimal value is more than or equal to the expected value.
@@ -980,7 +1188,9 @@ extern "C" {
  * @param expected The expected 64-bit hexadecimal value.
  */
 #define ASSUME_ITS_MORE_OR_EQUAL_H64(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint64_t)(actual) >= (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to be more than or equal to " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_H64(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_H64(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GE, (uint64_t)(actual) >= (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to be more than or equal to " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
 
 /**
  * @brief Assumes that the given 64-bit hexadecimal values are not equal.
@@ -989,7 +1199,9 @@ extern "C" {
  * @param expected The expected 64-bit hexadecimal value.
  */
 #define ASSUME_NOT_EQUAL_H64(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint64_t)(actual) != (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to not be equal to " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_H64(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_EQUAL_H64(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_NE, (uint64_t)(actual) != (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to not be equal to " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
 
 /**
  * @brief Assumes that the given 64-bit hexadecimal value is not less than the expected value.
@@ -998,7 +1210,9 @@ extern "C" {
  * @param expected The expected 64-bit hexadecimal value.
  */
 #define ASSUME_NOT_LESS_THAN_H64(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint64_t)(actual) >= (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to not be less than " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_LESS_THAN_H64(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_LESS_THAN_H64(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GE, (uint64_t)(actual) >= (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to not be less than " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
 
 /**
  * @brief Assumes that the given 64-bit hexadecimal value is not more than the expected value.
@@ -1007,7 +1221,9 @@ extern "C" {
  * @param expected The expected 64-bit hexadecimal value.
  */
 #define ASSUME_NOT_MORE_THAN_H64(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint64_t)(actual) <= (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to not be more than " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_MORE_THAN_H64(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_MORE_THAN_H64(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LE, (uint64_t)(actual) <= (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to not be more than " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
 
 /**
  * @brief Assumes that the given 64-bit hexadecimal value is not less than or equal to the expected value.
@@ -1016,7 +1232,9 @@ extern "C" {
  * @param expected The expected 64-bit hexadecimal value.
  */
 #define ASSUME_NOT_LESS_OR_EQUAL_H64(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint64_t)(actual) > (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to not be less than or equal to " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_H64(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_H64(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GT, (uint64_t)(actual) > (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to not be less than or equal to " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
 
 /**
  * @brief Assumes that the given 64-bit hexadecimal value is not more than or equal to the expected value.
@@ -1025,7 +1243,9 @@ extern "C" {
  * @param expected The expected 64-bit hexadecimal value.
  */
 #define ASSUME_NOT_MORE_OR_EQUAL_H64(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint64_t)(actual) < (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to not be more than or equal to " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_H64(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_H64(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LT, (uint64_t)(actual) < (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to not be more than or equal to " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
 
 /**
  * @brief Assumes that the given 8-bit integer values are equal.
@@ -1034,7 +1254,9 @@ extern "C" {
  * @param expected The expected 8-bit integer value.
  */
 #define ASSUME_ITS_EQUAL_I8(actual, expected) \
-    FOSSIL_TEST_ASSUME((int8_t)(actual) == (int8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to be equal to " #expected " of value %d", (int8_t)(actual), (int8_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_I8(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_EQUAL_I8(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_EQ, (int8_t)(actual) == (int8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to be equal to " #expected " of value %d", (int8_t)(actual), (int8_t)(expected)))
 
 /**
  * @brief Assumes that the given 8-bit integer value is less than the expected value.
@@ -1043,7 +1265,9 @@ extern "C" {
  * @param expected The expected 8-bit integer value.
  */
 #define ASSUME_ITS_LESS_THAN_I8(actual, expected) \
-    FOSSIL_TEST_ASSUME((int8_t)(actual) < (int8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to be less than " #expected " of value %d", (int8_t)(actual), (int8_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_LESS_THAN_I8(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_LESS_THAN_I8(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LT, (int8_t)(actual) < (int8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to be less than " #expected " of value %d", (int8_t)(actual), (int8_t)(expected)))
 
 /**
  * @brief Assumes that the given 8-bit integer value is more than the expected value.
@@ -1052,7 +1276,9 @@ extern "C" {
  * @param expected The expected 8-bit integer value.
  */
 #define ASSUME_ITS_MORE_THAN_I8(actual, expected) \
-    FOSSIL_TEST_ASSUME((int8_t)(actual) > (int8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to be more than " #expected " of value %d", (int8_t)(actual), (int8_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_MORE_THAN_I8(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_MORE_THAN_I8(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GT, (int8_t)(actual) > (int8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to be more than " #expected " of value %d", (int8_t)(actual), (int8_t)(expected)))
 
 /**
  * @brief Assumes that the given 8-bit integer value is less than or equal to the expected value.
@@ -1061,7 +1287,9 @@ extern "C" {
  * @param expected The expected 8-bit integer value.
  */
 #define ASSUME_ITS_LESS_OR_EQUAL_I8(actual, expected) \
-    FOSSIL_TEST_ASSUME((int8_t)(actual) <= (int8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to be less than or equal to " #expected " of value %d", (int8_t)(actual), (int8_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_I8(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_I8(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LE, (int8_t)(actual) <= (int8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to be less than or equal to " #expected " of value %d", (int8_t)(actual), (int8_t)(expected)))
 
 /**
  * @brief Assumes that the given 8-bit integer value is more than or equal to the expected value.
@@ -1070,7 +1298,9 @@ extern "C" {
  * @param expected The expected 8-bit integer value.
  */
 #define ASSUME_ITS_MORE_OR_EQUAL_I8(actual, expected) \
-    FOSSIL_TEST_ASSUME((int8_t)(actual) >= (int8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to be more than or equal to " #expected " of value %d", (int8_t)(actual), (int8_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_I8(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_I8(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GE, (int8_t)(actual) >= (int8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to be more than or equal to " #expected " of value %d", (int8_t)(actual), (int8_t)(expected)))
 
 /**
  * @brief Assumes that the given 8-bit integer values are not equal.
@@ -1079,7 +1309,9 @@ extern "C" {
  * @param expected The expected 8-bit integer value.
  */
 #define ASSUME_NOT_EQUAL_I8(actual, expected) \
-    FOSSIL_TEST_ASSUME((int8_t)(actual) != (int8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to not be equal to " #expected " of value %d", (int8_t)(actual), (int8_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_I8(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_EQUAL_I8(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_NE, (int8_t)(actual) != (int8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to not be equal to " #expected " of value %d", (int8_t)(actual), (int8_t)(expected)))
 
 /**
  * @brief Assumes that the given 8-bit integer value is not less than the expected value.
@@ -1088,7 +1320,9 @@ extern "C" {
  * @param expected The expected 8-bit integer value.
  */
 #define ASSUME_NOT_LESS_THAN_I8(actual, expected) \
-    FOSSIL_TEST_ASSUME((int8_t)(actual) >= (int8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to not be less than " #expected " of value %d", (int8_t)(actual), (int8_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_LESS_THAN_I8(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_LESS_THAN_I8(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GE, (int8_t)(actual) >= (int8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to not be less than " #expected " of value %d", (int8_t)(actual), (int8_t)(expected)))
 
 /**
  * @brief Assumes that the given 8-bit integer value is not more than the expected value.
@@ -1097,7 +1331,9 @@ extern "C" {
  * @param expected The expected 8-bit integer value.
  */
 #define ASSUME_NOT_MORE_THAN_I8(actual, expected) \
-    FOSSIL_TEST_ASSUME((int8_t)(actual) <= (int8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to not be more than " #expected " of value %d", (int8_t)(actual), (int8_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_MORE_THAN_I8(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_MORE_THAN_I8(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LE, (int8_t)(actual) <= (int8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to not be more than " #expected " of value %d", (int8_t)(actual), (int8_t)(expected)))
 
 /**
  * @brief Assumes that the given 8-bit integer value is not less than or equal to the expected value.
@@ -1106,7 +1342,9 @@ extern "C" {
  * @param expected The expected 8-bit integer value.
  */
 #define ASSUME_NOT_LESS_OR_EQUAL_I8(actual, expected) \
-    FOSSIL_TEST_ASSUME((int8_t)(actual) > (int8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to not be less than or equal to " #expected " of value %d", (int8_t)(actual), (int8_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_I8(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_I8(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GT, (int8_t)(actual) > (int8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to not be less than or equal to " #expected " of value %d", (int8_t)(actual), (int8_t)(expected)))
 
 /**
  * @brief Assumes that the given 8-bit integer value is not more than or equal to the expected value.
@@ -1115,7 +1353,9 @@ extern "C" {
  * @param expected The expected 8-bit integer value.
  */
 #define ASSUME_NOT_MORE_OR_EQUAL_I8(actual, expected) \
-    FOSSIL_TEST_ASSUME((int8_t)(actual) < (int8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to not be more than or equal to " #expected " of value %d", (int8_t)(actual), (int8_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_I8(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_I8(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LT, (int8_t)(actual) < (int8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to not be more than or equal to " #expected " of value %d", (int8_t)(actual), (int8_t)(expected)))
 
 /**
  * @brief Assumes that the given 16-bit integer values are equal.
@@ -1124,7 +1364,9 @@ extern "C" {
  * @param expected The expected 16-bit integer value.
  */
 #define ASSUME_ITS_EQUAL_I16(actual, expected) \
-    FOSSIL_TEST_ASSUME((int16_t)(actual) == (int16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to be equal to " #expected " of value %d", (int16_t)(actual), (int16_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_I16(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_EQUAL_I16(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_EQ, (int16_t)(actual) == (int16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to be equal to " #expected " of value %d", (int16_t)(actual), (int16_t)(expected)))
 
 /**
  * @brief Assumes that the given 16-bit integer value is less than the expected value.
@@ -1133,7 +1375,9 @@ extern "C" {
  * @param expected The expected 16-bit integer value.
  */
 #define ASSUME_ITS_LESS_THAN_I16(actual, expected) \
-    FOSSIL_TEST_ASSUME((int16_t)(actual) < (int16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to be less than " #expected " of value %d", (int16_t)(actual), (int16_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_LESS_THAN_I16(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_LESS_THAN_I16(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LT, (int16_t)(actual) < (int16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to be less than " #expected " of value %d", (int16_t)(actual), (int16_t)(expected)))
 
 /**
  * @brief Assumes that the given 16-bit integer value is more than the expected value.
@@ -1142,7 +1386,9 @@ extern "C" {
  * @param expected The expected 16-bit integer value.
  */
 #define ASSUME_ITS_MORE_THAN_I16(actual, expected) \
-    FOSSIL_TEST_ASSUME((int16_t)(actual) > (int16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to be more than " #expected " of value %d", (int16_t)(actual), (int16_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_MORE_THAN_I16(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_MORE_THAN_I16(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GT, (int16_t)(actual) > (int16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to be more than " #expected " of value %d", (int16_t)(actual), (int16_t)(expected)))
 
 /**
  * @brief Assumes that the given 16-bit integer value is less than or equal to the expected value.
@@ -1151,7 +1397,9 @@ extern "C" {
  * @param expected The expected 16-bit integer value.
  */
 #define ASSUME_ITS_LESS_OR_EQUAL_I16(actual, expected) \
-    FOSSIL_TEST_ASSUME((int16_t)(actual) <= (int16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to be less than or equal to " #expected " of value %d", (int16_t)(actual), (int16_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_I16(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_I16(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LE, (int16_t)(actual) <= (int16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to be less than or equal to " #expected " of value %d", (int16_t)(actual), (int16_t)(expected)))
 
 /**
  * @brief Assumes that the given 16-bit integer value is more than or equal to the expected value.
@@ -1160,7 +1408,9 @@ extern "C" {
  * @param expected The expected 16-bit integer value.
  */
 #define ASSUME_ITS_MORE_OR_EQUAL_I16(actual, expected) \
-    FOSSIL_TEST_ASSUME((int16_t)(actual) >= (int16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to be more than or equal to " #expected " of value %d", (int16_t)(actual), (int16_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_I16(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_I16(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GE, (int16_t)(actual) >= (int16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to be more than or equal to " #expected " of value %d", (int16_t)(actual), (int16_t)(expected)))
 
 /**
  * @brief Assumes that the given 16-bit integer values are not equal.
@@ -1169,7 +1419,9 @@ extern "C" {
  * @param expected The expected 16-bit integer value.
  */
 #define ASSUME_NOT_EQUAL_I16(actual, expected) \
-    FOSSIL_TEST_ASSUME((int16_t)(actual) != (int16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to not be equal to " #expected " of value %d", (int16_t)(actual), (int16_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_I16(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_EQUAL_I16(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_NE, (int16_t)(actual) != (int16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to not be equal to " #expected " of value %d", (int16_t)(actual), (int16_t)(expected)))
 
 /**
  * @brief Assumes that the given 16-bit integer value is not less than the expected value.
@@ -1178,7 +1430,9 @@ extern "C" {
  * @param expected The expected 16-bit integer value.
  */
 #define ASSUME_NOT_LESS_THAN_I16(actual, expected) \
-    FOSSIL_TEST_ASSUME((int16_t)(actual) >= (int16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to not be less than " #expected " of value %d", (int16_t)(actual), (int16_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_LESS_THAN_I16(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_LESS_THAN_I16(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GE, (int16_t)(actual) >= (int16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to not be less than " #expected " of value %d", (int16_t)(actual), (int16_t)(expected)))
 
 /**
  * @brief Assumes that the given 16-bit integer value is not more than the expected value.
@@ -1187,7 +1441,9 @@ extern "C" {
  * @param expected The expected 16-bit integer value.
  */
 #define ASSUME_NOT_MORE_THAN_I16(actual, expected) \
-    FOSSIL_TEST_ASSUME((int16_t)(actual) <= (int16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to not be more than " #expected " of value %d", (int16_t)(actual), (int16_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_MORE_THAN_I16(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_MORE_THAN_I16(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LE, (int16_t)(actual) <= (int16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to not be more than " #expected " of value %d", (int16_t)(actual), (int16_t)(expected)))
 
 /**
  * @brief Assumes that the given 16-bit integer value is not less than or equal to the expected value.
@@ -1196,7 +1452,9 @@ extern "C" {
  * @param expected The expected 16-bit integer value.
  */
 #define ASSUME_NOT_LESS_OR_EQUAL_I16(actual, expected) \
-    FOSSIL_TEST_ASSUME((int16_t)(actual) > (int16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to not be less than or equal to " #expected " of value %d", (int16_t)(actual), (int16_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_I16(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_I16(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GT, (int16_t)(actual) > (int16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to not be less than or equal to " #expected " of value %d", (int16_t)(actual), (int16_t)(expected)))
 
 /**
  * @brief Assumes that the given 16-bit integer value is not more than or equal to the expected value.
@@ -1205,7 +1463,9 @@ extern "C" {
  * @param expected The expected 16-bit integer value.
  */
 #define ASSUME_NOT_MORE_OR_EQUAL_I16(actual, expected) \
-    FOSSIL_TEST_ASSUME((int16_t)(actual) < (int16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to not be more than or equal to " #expected " of value %d", (int16_t)(actual), (int16_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_I16(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_I16(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LT, (int16_t)(actual) < (int16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to not be more than or equal to " #expected " of value %d", (int16_t)(actual), (int16_t)(expected)))
 
 /**
  * @brief Assumes that the given 32-bit integer values are equal.
@@ -1214,7 +1474,9 @@ extern "C" {
  * @param expected The expected 32-bit integer value.
  */
 #define ASSUME_ITS_EQUAL_I32(actual, expected) \
-    FOSSIL_TEST_ASSUME((int32_t)(actual) == (int32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to be equal to " #expected " of value %d", (int32_t)(actual), (int32_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_I32(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_EQUAL_I32(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_EQ, (int32_t)(actual) == (int32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to be equal to " #expected " of value %d", (int32_t)(actual), (int32_t)(expected)))
 
 /**
  * @brief Assumes that the given 32-bit integer value is less than the expected value.
@@ -1223,7 +1485,9 @@ extern "C" {
  * @param expected The expected 32-bit integer value.
  */
 #define ASSUME_ITS_LESS_THAN_I32(actual, expected) \
-    FOSSIL_TEST_ASSUME((int32_t)(actual) < (int32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to be less than " #expected " of value %d", (int32_t)(actual), (int32_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_LESS_THAN_I32(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_LESS_THAN_I32(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LT, (int32_t)(actual) < (int32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to be less than " #expected " of value %d", (int32_t)(actual), (int32_t)(expected)))
 
 /**
  * @brief Assumes that the given 32-bit integer value is more than the expected value.
@@ -1232,7 +1496,9 @@ extern "C" {
  * @param expected The expected 32-bit integer value.
  */
 #define ASSUME_ITS_MORE_THAN_I32(actual, expected) \
-    FOSSIL_TEST_ASSUME((int32_t)(actual) > (int32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to be more than " #expected " of value %d", (int32_t)(actual), (int32_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_MORE_THAN_I32(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_MORE_THAN_I32(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GT, (int32_t)(actual) > (int32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to be more than " #expected " of value %d", (int32_t)(actual), (int32_t)(expected)))
 
 /**
  * @brief Assumes that the given 32-bit integer value is less than or equal to the expected value.
@@ -1241,7 +1507,9 @@ extern "C" {
  * @param expected The expected 32-bit integer value.
  */
 #define ASSUME_ITS_LESS_OR_EQUAL_I32(actual, expected) \
-    FOSSIL_TEST_ASSUME((int32_t)(actual) <= (int32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to be less than or equal to " #expected " of value %d", (int32_t)(actual), (int32_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_I32(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_I32(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LE, (int32_t)(actual) <= (int32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to be less than or equal to " #expected " of value %d", (int32_t)(actual), (int32_t)(expected)))
 
 /**
  * @brief Assumes that the given 32-bit integer value is more than or equal to the expected value.
@@ -1250,7 +1518,9 @@ extern "C" {
  * @param expected The expected 32-bit integer value.
  */
 #define ASSUME_ITS_MORE_OR_EQUAL_I32(actual, expected) \
-    FOSSIL_TEST_ASSUME((int32_t)(actual) >= (int32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to be more than or equal to " #expected " of value %d", (int32_t)(actual), (int32_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_I32(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_I32(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GE, (int32_t)(actual) >= (int32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to be more than or equal to " #expected " of value %d", (int32_t)(actual), (int32_t)(expected)))
 
 /**
  * @brief Assumes that the given 32-bit integer values are not equal.
@@ -1259,7 +1529,9 @@ extern "C" {
  * @param expected The expected 32-bit integer value.
  */
 #define ASSUME_NOT_EQUAL_I32(actual, expected) \
-    FOSSIL_TEST_ASSUME((int32_t)(actual) != (int32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to not be equal to " #expected " of value %d", (int32_t)(actual), (int32_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_I32(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_EQUAL_I32(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_NE, (int32_t)(actual) != (int32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to not be equal to " #expected " of value %d", (int32_t)(actual), (int32_t)(expected)))
 
 /**
  * @brief Assumes that the given 32-bit integer value is not less than the expected value.
@@ -1268,7 +1540,9 @@ extern "C" {
  * @param expected The expected 32-bit integer value.
  */
 #define ASSUME_NOT_LESS_THAN_I32(actual, expected) \
-    FOSSIL_TEST_ASSUME((int32_t)(actual) >= (int32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to not be less than " #expected " of value %d", (int32_t)(actual), (int32_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_LESS_THAN_I32(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_LESS_THAN_I32(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GE, (int32_t)(actual) >= (int32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to not be less than " #expected " of value %d", (int32_t)(actual), (int32_t)(expected)))
 
 /**
  * @brief Assumes that the given 32-bit integer value is not more than the expected value.
@@ -1277,7 +1551,9 @@ extern "C" {
  * @param expected The expected 32-bit integer value.
  */
 #define ASSUME_NOT_MORE_THAN_I32(actual, expected) \
-    FOSSIL_TEST_ASSUME((int32_t)(actual) <= (int32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to not be more than " #expected " of value %d", (int32_t)(actual), (int32_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_MORE_THAN_I32(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_MORE_THAN_I32(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LE, (int32_t)(actual) <= (int32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to not be more than " #expected " of value %d", (int32_t)(actual), (int32_t)(expected)))
 
 /**
  * @brief Assumes that the given 32-bit integer value is not less than or equal to the expected value.
@@ -1286,7 +1562,9 @@ extern "C" {
  * @param expected The expected 32-bit integer value.
  */
 #define ASSUME_NOT_LESS_OR_EQUAL_I32(actual, expected) \
-    FOSSIL_TEST_ASSUME((int32_t)(actual) > (int32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to not be less than or equal to " #expected " of value %d", (int32_t)(actual), (int32_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_I32(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_I32(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GT, (int32_t)(actual) > (int32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to not be less than or equal to " #expected " of value %d", (int32_t)(actual), (int32_t)(expected)))
 
 /**
  * @brief Assumes that the given 32-bit integer value is not more than or equal to the expected value.
@@ -1295,7 +1573,9 @@ extern "C" {
  * @param expected The expected 32-bit integer value.
  */
 #define ASSUME_NOT_MORE_OR_EQUAL_I32(actual, expected) \
-    FOSSIL_TEST_ASSUME((int32_t)(actual) < (int32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to not be more than or equal to " #expected " of value %d", (int32_t)(actual), (int32_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_I32(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_I32(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LT, (int32_t)(actual) < (int32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %d to not be more than or equal to " #expected " of value %d", (int32_t)(actual), (int32_t)(expected)))
 
 /**
  * @brief Assumes that the given 64-bit integer values are equal.
@@ -1304,7 +1584,9 @@ extern "C" {
  * @param expected The expected 64-bit integer value.
  */
 #define ASSUME_ITS_EQUAL_I64(actual, expected) \
-    FOSSIL_TEST_ASSUME((int64_t)(actual) == (int64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %lld to be equal to " #expected " of value %lld", (int64_t)(actual), (int64_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_I64(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_EQUAL_I64(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_EQ, (int64_t)(actual) == (int64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %lld to be equal to " #expected " of value %lld", (int64_t)(actual), (int64_t)(expected)))
 
 /**
  * @brief Assumes that the given 64-bit integer value is less than the expected value.
@@ -1313,7 +1595,9 @@ extern "C" {
  * @param expected The expected 64-bit integer value.
  */
 #define ASSUME_ITS_LESS_THAN_I64(actual, expected) \
-    FOSSIL_TEST_ASSUME((int64_t)(actual) < (int64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %lld to be less than " #expected " of value %lld", (int64_t)(actual), (int64_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_LESS_THAN_I64(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_LESS_THAN_I64(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LT, (int64_t)(actual) < (int64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %lld to be less than " #expected " of value %lld", (int64_t)(actual), (int64_t)(expected)))
 
 /**
  * @brief Assumes that the given 64-bit integer value is more than the expected value.
@@ -1322,7 +1606,9 @@ extern "C" {
  * @param expected The expected 64-bit integer value.
  */
 #define ASSUME_ITS_MORE_THAN_I64(actual, expected) \
-    FOSSIL_TEST_ASSUME((int64_t)(actual) > (int64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %lld to be more than " #expected " of value %lld", (int64_t)(actual), (int64_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_MORE_THAN_I64(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_MORE_THAN_I64(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GT, (int64_t)(actual) > (int64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %lld to be more than " #expected " of value %lld", (int64_t)(actual), (int64_t)(expected)))
 
 /**
  * @brief Assumes that the given 64-bit integer value is less than or equal to the expected value.
@@ -1331,7 +1617,9 @@ extern "C" {
  * @param expected The expected 64-bit integer value.
  */
 #define ASSUME_ITS_LESS_OR_EQUAL_I64(actual, expected) \
-    FOSSIL_TEST_ASSUME((int64_t)(actual) <= (int64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %lld to be less than or equal to " #expected " of value %lld", (int64_t)(actual), (int64_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_I64(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_I64(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LE, (int64_t)(actual) <= (int64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %lld to be less than or equal to " #expected " of value %lld", (int64_t)(actual), (int64_t)(expected)))
 
 /**
  * @brief Assumes that the given 64-bit integer value is more than or equal to the expected value.
@@ -1340,7 +1628,9 @@ extern "C" {
  * @param expected The expected 64-bit integer value.
  */
 #define ASSUME_ITS_MORE_OR_EQUAL_I64(actual, expected) \
-    FOSSIL_TEST_ASSUME((int64_t)(actual) >= (int64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %lld to be more than or equal to " #expected " of value %lld", (int64_t)(actual), (int64_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_I64(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_I64(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GE, (int64_t)(actual) >= (int64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %lld to be more than or equal to " #expected " of value %lld", (int64_t)(actual), (int64_t)(expected)))
 
 /**
  * @brief Assumes that the given 64-bit integer values are not equal.
@@ -1349,7 +1639,9 @@ extern "C" {
  * @param expected The expected 64-bit integer value.
  */
 #define ASSUME_NOT_EQUAL_I64(actual, expected) \
-    FOSSIL_TEST_ASSUME((int64_t)(actual) != (int64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %lld to not be equal to " #expected " of value %lld", (int64_t)(actual), (int64_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_I64(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_EQUAL_I64(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_NE, (int64_t)(actual) != (int64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %lld to not be equal to " #expected " of value %lld", (int64_t)(actual), (int64_t)(expected)))
 
 /**
  * @brief Assumes that the given 64-bit integer value is not less than the expected value.
@@ -1358,7 +1650,9 @@ extern "C" {
  * @param expected The expected 64-bit integer value.
  */
 #define ASSUME_NOT_LESS_THAN_I64(actual, expected) \
-    FOSSIL_TEST_ASSUME((int64_t)(actual) >= (int64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %lld to not be less than " #expected " of value %lld", (int64_t)(actual), (int64_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_LESS_THAN_I64(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_LESS_THAN_I64(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GE, (int64_t)(actual) >= (int64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %lld to not be less than " #expected " of value %lld", (int64_t)(actual), (int64_t)(expected)))
 
 /**
  * @brief Assumes that the given 64-bit integer value is not more than the expected value.
@@ -1367,7 +1661,9 @@ extern "C" {
  * @param expected The expected 64-bit integer value.
  */
 #define ASSUME_NOT_MORE_THAN_I64(actual, expected) \
-    FOSSIL_TEST_ASSUME((int64_t)(actual) <= (int64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %lld to not be more than " #expected " of value %lld", (int64_t)(actual), (int64_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_MORE_THAN_I64(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_MORE_THAN_I64(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LE, (int64_t)(actual) <= (int64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %lld to not be more than " #expected " of value %lld", (int64_t)(actual), (int64_t)(expected)))
 
 /**
  * @brief Assumes that the given 64-bit integer value is not less than or equal to the expected value.
@@ -1376,7 +1672,9 @@ extern "C" {
  * @param expected The expected 64-bit integer value.
  */
 #define ASSUME_NOT_LESS_OR_EQUAL_I64(actual, expected) \
-    FOSSIL_TEST_ASSUME((int64_t)(actual) > (int64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %lld to not be less than or equal to " #expected " of value %lld", (int64_t)(actual), (int64_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_I64(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_I64(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GT, (int64_t)(actual) > (int64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %lld to not be less than or equal to " #expected " of value %lld", (int64_t)(actual), (int64_t)(expected)))
 
 /**
  * @brief Assumes that the given 64-bit integer value is not more than or equal to the expected value.
@@ -1385,7 +1683,9 @@ extern "C" {
  * @param expected The expected 64-bit integer value.
  */
 #define ASSUME_NOT_MORE_OR_EQUAL_I64(actual, expected) \
-    FOSSIL_TEST_ASSUME((int64_t)(actual) < (int64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %lld to not be more than or equal to " #expected " of value %lld", (int64_t)(actual), (int64_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_I64(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_I64(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LT, (int64_t)(actual) < (int64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %lld to not be more than or equal to " #expected " of value %lld", (int64_t)(actual), (int64_t)(expected)))
 
 /**
  * @brief Assumes that the given 8-bit unsigned integer values are equal.
@@ -1394,7 +1694,9 @@ extern "C" {
  * @param expected The expected 8-bit unsigned integer value.
  */
 #define ASSUME_ITS_EQUAL_U8(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint8_t)(actual) == (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be equal to " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_U8(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_EQUAL_U8(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_EQ, (uint8_t)(actual) == (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be equal to " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
 
 /**
  * @brief Assumes that the given 8-bit unsigned integer value is less than the expected value.
@@ -1403,7 +1705,9 @@ extern "C" {
  * @param expected The expected 8-bit unsigned integer value.
  */
 #define ASSUME_ITS_LESS_THAN_U8(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint8_t)(actual) < (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be less than " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_LESS_THAN_U8(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_LESS_THAN_U8(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LT, (uint8_t)(actual) < (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be less than " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
 
 /**
  * @brief Assumes that the given 8-bit unsigned integer value is more than the expected value.
@@ -1412,7 +1716,9 @@ extern "C" {
  * @param expected The expected 8-bit unsigned integer value.
  */
 #define ASSUME_ITS_MORE_THAN_U8(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint8_t)(actual) > (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be more than " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_MORE_THAN_U8(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_MORE_THAN_U8(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GT, (uint8_t)(actual) > (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be more than " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
 
 /**
  * @brief Assumes that the given 8-bit unsigned integer value is less than or equal to the expected value.
@@ -1421,7 +1727,9 @@ extern "C" {
  * @param expected The expected 8-bit unsigned integer value.
  */
 #define ASSUME_ITS_LESS_OR_EQUAL_U8(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint8_t)(actual) <= (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be less than or equal to " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_U8(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_U8(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LE, (uint8_t)(actual) <= (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be less than or equal to " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
 
 /**
  * @brief Assumes that the given 8-bit unsigned integer value is more than or equal to the expected value.
@@ -1430,7 +1738,9 @@ extern "C" {
  * @param expected The expected 8-bit unsigned integer value.
  */
 #define ASSUME_ITS_MORE_OR_EQUAL_U8(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint8_t)(actual) >= (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be more than or equal to " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_U8(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_U8(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GE, (uint8_t)(actual) >= (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be more than or equal to " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
 
 /**
  * @brief Assumes that the given 8-bit unsigned integer values are not equal.
@@ -1439,7 +1749,9 @@ extern "C" {
  * @param expected The expected 8-bit unsigned integer value.
  */
 #define ASSUME_NOT_EQUAL_U8(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint8_t)(actual) != (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be equal to " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_U8(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_EQUAL_U8(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_NE, (uint8_t)(actual) != (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be equal to " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
 
 /**
  * @brief Assumes that the given 8-bit unsigned integer value is not less than the expected value.
@@ -1448,7 +1760,9 @@ extern "C" {
  * @param expected The expected 8-bit unsigned integer value.
  */
 #define ASSUME_NOT_LESS_THAN_U8(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint8_t)(actual) >= (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be less than " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_LESS_THAN_U8(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_LESS_THAN_U8(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GE, (uint8_t)(actual) >= (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be less than " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
 
 /**
  * @brief Assumes that the given 8-bit unsigned integer value is not more than the expected value.
@@ -1457,7 +1771,9 @@ extern "C" {
  * @param expected The expected 8-bit unsigned integer value.
  */
 #define ASSUME_NOT_MORE_THAN_U8(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint8_t)(actual) <= (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be more than " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_MORE_THAN_U8(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_MORE_THAN_U8(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LE, (uint8_t)(actual) <= (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be more than " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
 
 /**
  * @brief Assumes that the given 8-bit unsigned integer value is not less than or equal to the expected value.
@@ -1466,7 +1782,9 @@ extern "C" {
  * @param expected The expected 8-bit unsigned integer value.
  */
 #define ASSUME_NOT_LESS_OR_EQUAL_U8(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint8_t)(actual) > (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be less than or equal to " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_U8(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_U8(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GT, (uint8_t)(actual) > (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be less than or equal to " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
 
 /**
  * @brief Assumes that the given 8-bit unsigned integer value is not more than or equal to the expected value.
@@ -1475,7 +1793,9 @@ extern "C" {
  * @param expected The expected 8-bit unsigned integer value.
  */
 #define ASSUME_NOT_MORE_OR_EQUAL_U8(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint8_t)(actual) < (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be more than or equal to " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_U8(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_U8(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LT, (uint8_t)(actual) < (uint8_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be more than or equal to " #expected " of value %u", (uint8_t)(actual), (uint8_t)(expected)))
 
 /**
  * @brief Assumes that the given 16-bit unsigned integer values are equal.
@@ -1484,7 +1804,9 @@ extern "C" {
  * @param expected The expected 16-bit unsigned integer value.
  */
 #define ASSUME_ITS_EQUAL_U16(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint16_t)(actual) == (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be equal to " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_U16(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_EQUAL_U16(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_EQ, (uint16_t)(actual) == (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be equal to " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
 
 /**
  * @brief Assumes that the given 16-bit unsigned integer value is less than the expected value.
@@ -1493,7 +1815,9 @@ extern "C" {
  * @param expected The expected 16-bit unsigned integer value.
  */
 #define ASSUME_ITS_LESS_THAN_U16(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint16_t)(actual) < (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be less than " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_LESS_THAN_U16(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_LESS_THAN_U16(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LT, (uint16_t)(actual) < (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be less than " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
 
 /**
  * @brief Assumes that the given 16-bit unsigned integer value is more than the expected value.
@@ -1502,7 +1826,9 @@ extern "C" {
  * @param expected The expected 16-bit unsigned integer value.
  */
 #define ASSUME_ITS_MORE_THAN_U16(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint16_t)(actual) > (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be more than " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_MORE_THAN_U16(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_MORE_THAN_U16(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GT, (uint16_t)(actual) > (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be more than " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
 
 /**
  * @brief Assumes that the given 16-bit unsigned integer value is less than or equal to the expected value.
@@ -1511,7 +1837,9 @@ extern "C" {
  * @param expected The expected 16-bit unsigned integer value.
  */
 #define ASSUME_ITS_LESS_OR_EQUAL_U16(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint16_t)(actual) <= (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be less than or equal to " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_U16(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_U16(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LE, (uint16_t)(actual) <= (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be less than or equal to " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
 
 /**
  * @brief Assumes that the given 16-bit unsigned integer value is more than or equal to the expected value.
@@ -1520,7 +1848,9 @@ extern "C" {
  * @param expected The expected 16-bit unsigned integer value.
  */
 #define ASSUME_ITS_MORE_OR_EQUAL_U16(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint16_t)(actual) >= (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be more than or equal to " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_U16(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_U16(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GE, (uint16_t)(actual) >= (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be more than or equal to " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
 
 /**
  * @brief Assumes that the given 16-bit unsigned integer values are not equal.
@@ -1529,7 +1859,9 @@ extern "C" {
  * @param expected The expected 16-bit unsigned integer value.
  */
 #define ASSUME_NOT_EQUAL_U16(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint16_t)(actual) != (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be equal to " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_U16(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_EQUAL_U16(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_NE, (uint16_t)(actual) != (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be equal to " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
 
 /**
  * @brief Assumes that the given 16-bit unsigned integer value is not less than the expected value.
@@ -1538,7 +1870,9 @@ extern "C" {
  * @param expected The expected 16-bit unsigned integer value.
  */
 #define ASSUME_NOT_LESS_THAN_U16(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint16_t)(actual) >= (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be less than " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_LESS_THAN_U16(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_LESS_THAN_U16(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GE, (uint16_t)(actual) >= (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be less than " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
 
 /**
  * @brief Assumes that the given 16-bit unsigned integer value is not more than the expected value.
@@ -1547,7 +1881,9 @@ extern "C" {
  * @param expected The expected 16-bit unsigned integer value.
  */
 #define ASSUME_NOT_MORE_THAN_U16(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint16_t)(actual) <= (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be more than " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_MORE_THAN_U16(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_MORE_THAN_U16(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LE, (uint16_t)(actual) <= (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be more than " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
 
 /**
  * @brief Assumes that the given 16-bit unsigned integer value is not less than or equal to the expected value.
@@ -1556,7 +1892,9 @@ extern "C" {
  * @param expected The expected 16-bit unsigned integer value.
  */
 #define ASSUME_NOT_LESS_OR_EQUAL_U16(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint16_t)(actual) > (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be less than or equal to " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_U16(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_U16(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GT, (uint16_t)(actual) > (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be less than or equal to " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
 
 /**
  * @brief Assumes that the given 16-bit unsigned integer value is not more than or equal to the expected value.
@@ -1565,7 +1903,9 @@ extern "C" {
  * @param expected The expected 16-bit unsigned integer value.
  */
 #define ASSUME_NOT_MORE_OR_EQUAL_U16(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint16_t)(actual) < (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be more than or equal to " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_U16(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_U16(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LT, (uint16_t)(actual) < (uint16_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be more than or equal to " #expected " of value %u", (uint16_t)(actual), (uint16_t)(expected)))
 
 /**
  * @brief Assumes that the given 32-bit unsigned integer values are equal.
@@ -1574,7 +1914,9 @@ extern "C" {
  * @param expected The expected 32-bit unsigned integer value.
  */
 #define ASSUME_ITS_EQUAL_U32(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint32_t)(actual) == (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be equal to " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_U32(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_EQUAL_U32(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_EQ, (uint32_t)(actual) == (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be equal to " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
 
 /**
  * @brief Assumes that the given 32-bit unsigned integer value is less than the expected value.
@@ -1583,7 +1925,9 @@ extern "C" {
  * @param expected The expected 32-bit unsigned integer value.
  */
 #define ASSUME_ITS_LESS_THAN_U32(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint32_t)(actual) < (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be less than " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_LESS_THAN_U32(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_LESS_THAN_U32(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LT, (uint32_t)(actual) < (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be less than " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
 
 /**
  * @brief Assumes that the given 32-bit unsigned integer value is more than the expected value.
@@ -1592,7 +1936,9 @@ extern "C" {
  * @param expected The expected 32-bit unsigned integer value.
  */
 #define ASSUME_ITS_MORE_THAN_U32(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint32_t)(actual) > (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be more than " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_MORE_THAN_U32(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_MORE_THAN_U32(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GT, (uint32_t)(actual) > (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be more than " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
 
 /**
  * @brief Assumes that the given 32-bit unsigned integer value is less than or equal to the expected value.
@@ -1601,7 +1947,9 @@ extern "C" {
  * @param expected The expected 32-bit unsigned integer value.
  */
 #define ASSUME_ITS_LESS_OR_EQUAL_U32(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint32_t)(actual) <= (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be less than or equal to " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_U32(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_U32(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LE, (uint32_t)(actual) <= (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be less than or equal to " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
 
 /**
  * @brief Assumes that the given 32-bit unsigned integer value is more than or equal to the expected value.
@@ -1610,7 +1958,9 @@ extern "C" {
  * @param expected The expected 32-bit unsigned integer value.
  */
 #define ASSUME_ITS_MORE_OR_EQUAL_U32(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint32_t)(actual) >= (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be more than or equal to " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_U32(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_U32(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GE, (uint32_t)(actual) >= (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to be more than or equal to " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
 
 /**
  * @brief Assumes that the given 32-bit unsigned integer values are not equal.
@@ -1619,7 +1969,9 @@ extern "C" {
  * @param expected The expected 32-bit unsigned integer value.
  */
 #define ASSUME_NOT_EQUAL_U32(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint32_t)(actual) != (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be equal to " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_U32(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_EQUAL_U32(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_NE, (uint32_t)(actual) != (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be equal to " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
 
 /**
  * @brief Assumes that the given 32-bit unsigned integer value is not less than the expected value.
@@ -1628,7 +1980,9 @@ extern "C" {
  * @param expected The expected 32-bit unsigned integer value.
  */
 #define ASSUME_NOT_LESS_THAN_U32(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint32_t)(actual) >= (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be less than " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_LESS_THAN_U32(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_LESS_THAN_U32(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GE, (uint32_t)(actual) >= (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be less than " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
 
 /**
  * @brief Assumes that the given 32-bit unsigned integer value is not more than the expected value.
@@ -1637,7 +1991,9 @@ extern "C" {
  * @param expected The expected 32-bit unsigned integer value.
  */
 #define ASSUME_NOT_MORE_THAN_U32(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint32_t)(actual) <= (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be more than " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_MORE_THAN_U32(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_MORE_THAN_U32(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LE, (uint32_t)(actual) <= (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be more than " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
 
 /**
  * @brief Assumes that the given 32-bit unsigned integer value is not less than or equal to the expected value.
@@ -1646,7 +2002,9 @@ extern "C" {
  * @param expected The expected 32-bit unsigned integer value.
  */
 #define ASSUME_NOT_LESS_OR_EQUAL_U32(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint32_t)(actual) > (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be less than or equal to " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_U32(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_U32(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GT, (uint32_t)(actual) > (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be less than or equal to " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
 
 /**
  * @brief Assumes that the given 32-bit unsigned integer value is not more than or equal to the expected value.
@@ -1655,7 +2013,9 @@ extern "C" {
  * @param expected The expected 32-bit unsigned integer value.
  */
 #define ASSUME_NOT_MORE_OR_EQUAL_U32(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint32_t)(actual) < (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be more than or equal to " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_U32(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_U32(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LT, (uint32_t)(actual) < (uint32_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %u to not be more than or equal to " #expected " of value %u", (uint32_t)(actual), (uint32_t)(expected)))
 
 /**
  * @brief Assumes that the given 64-bit unsigned integer values are equal.
@@ -1664,7 +2024,9 @@ extern "C" {
  * @param expected The expected 64-bit unsigned integer value.
  */
 #define ASSUME_ITS_EQUAL_U64(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint64_t)(actual) == (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to be equal to " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_U64(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_EQUAL_U64(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_EQ, (uint64_t)(actual) == (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to be equal to " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
 
 /**
  * @brief Assumes that the given 64-bit unsigned integer value is less than the expected value.
@@ -1673,7 +2035,9 @@ extern "C" {
  * @param expected The expected 64-bit unsigned integer value.
  */
 #define ASSUME_ITS_LESS_THAN_U64(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint64_t)(actual) < (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to be less than " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_LESS_THAN_U64(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_LESS_THAN_U64(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LT, (uint64_t)(actual) < (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to be less than " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
 
 /**
  * @brief Assumes that the given 64-bit unsigned integer value is more than the expected value.
@@ -1682,7 +2046,9 @@ extern "C" {
  * @param expected The expected 64-bit unsigned integer value.
  */
 #define ASSUME_ITS_MORE_THAN_U64(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint64_t)(actual) > (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to be more than " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_MORE_THAN_U64(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_MORE_THAN_U64(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GT, (uint64_t)(actual) > (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to be more than " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
 
 /**
  * @brief Assumes that the given 64-bit unsigned integer value is less than or equal to the expected value.
@@ -1691,7 +2057,9 @@ extern "C" {
  * @param expected The expected 64-bit unsigned integer value.
  */
 #define ASSUME_ITS_LESS_OR_EQUAL_U64(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint64_t)(actual) <= (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to be less than or equal to " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_U64(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_U64(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LE, (uint64_t)(actual) <= (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to be less than or equal to " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
 
 /**
  * @brief Assumes that the given 64-bit unsigned integer value is more than or equal to the expected value.
@@ -1700,7 +2068,9 @@ extern "C" {
  * @param expected The expected 64-bit unsigned integer value.
  */
 #define ASSUME_ITS_MORE_OR_EQUAL_U64(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint64_t)(actual) >= (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to be more than or equal to " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_U64(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_U64(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GE, (uint64_t)(actual) >= (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to be more than or equal to " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
 
 /**
  * @brief Assumes that the given 64-bit unsigned integer values are not equal.
@@ -1709,7 +2079,9 @@ extern "C" {
  * @param expected The expected 64-bit unsigned integer value.
  */
 #define ASSUME_NOT_EQUAL_U64(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint64_t)(actual) != (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to not be equal to " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_U64(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_EQUAL_U64(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_NE, (uint64_t)(actual) != (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to not be equal to " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
 
 /**
  * @brief Assumes that the given 64-bit unsigned integer value is not less than the expected value.
@@ -1718,7 +2090,9 @@ extern "C" {
  * @param expected The expected 64-bit unsigned integer value.
  */
 #define ASSUME_NOT_LESS_THAN_U64(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint64_t)(actual) >= (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to not be less than " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_LESS_THAN_U64(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_LESS_THAN_U64(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GE, (uint64_t)(actual) >= (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to not be less than " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
 
 /**
  * @brief Assumes that the given 64-bit unsigned integer value is not more than the expected value.
@@ -1727,7 +2101,9 @@ extern "C" {
  * @param expected The expected 64-bit unsigned integer value.
  */
 #define ASSUME_NOT_MORE_THAN_U64(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint64_t)(actual) <= (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to not be more than " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_MORE_THAN_U64(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_MORE_THAN_U64(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LE, (uint64_t)(actual) <= (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to not be more than " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
 
 /**
  * @brief Assumes that the given 64-bit unsigned integer value is not less than or equal to the expected value.
@@ -1736,7 +2112,9 @@ extern "C" {
  * @param expected The expected 64-bit unsigned integer value.
  */
 #define ASSUME_NOT_LESS_OR_EQUAL_U64(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint64_t)(actual) > (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to not be less than or equal to " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_U64(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_U64(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GT, (uint64_t)(actual) > (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to not be less than or equal to " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
 
 /**
  * @brief Assumes that the given 64-bit unsigned integer value is not more than or equal to the expected value.
@@ -1745,7 +2123,9 @@ extern "C" {
  * @param expected The expected 64-bit unsigned integer value.
  */
 #define ASSUME_NOT_MORE_OR_EQUAL_U64(actual, expected) \
-    FOSSIL_TEST_ASSUME((uint64_t)(actual) < (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to not be more than or equal to " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_U64(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_U64(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LT, (uint64_t)(actual) < (uint64_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %llu to not be more than or equal to " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
 
 // **************************************************
 //
@@ -1760,7 +2140,9 @@ extern "C" {
  * @param size The size of the memory to check.
  */
 #define ASSUME_ITS_ZERO_MEMORY(ptr, size) \
-    FOSSIL_TEST_ASSUME(maip_sys_memory_zero((ptr), (size)), _FOSSIL_TEST_ASSUME_MESSAGE("Expected memory at " #ptr " of size %zu to be zeroed", (size)))
+    _FOSSIL_TEST_CHECK_ITS_ZERO_MEMORY(FOSSIL_TEST_ASSUME_AS, ptr, size)
+#define _FOSSIL_TEST_CHECK_ITS_ZERO_MEMORY(dispatch, ptr, size) \
+    dispatch(FOSSIL_MAIP_CAUSE_MEMORY, FOSSIL_MAIP_OP_IS, maip_sys_memory_zero((ptr), (size)), _FOSSIL_TEST_ASSUME_MESSAGE("Expected memory at " #ptr " of size %zu to be zeroed", (size)))
 
 /**
  * @brief Assumes that the given memory is not zeroed.
@@ -1769,7 +2151,9 @@ extern "C" {
  * @param size The size of the memory to check.
  */
 #define ASSUME_NOT_ZERO_MEMORY(ptr, size) \
-    FOSSIL_TEST_ASSUME(!maip_sys_memory_zero((ptr), (size)), _FOSSIL_TEST_ASSUME_MESSAGE("Expected memory at " #ptr " of size %zu to not be zeroed", (size)))
+    _FOSSIL_TEST_CHECK_NOT_ZERO_MEMORY(FOSSIL_TEST_ASSUME_AS, ptr, size)
+#define _FOSSIL_TEST_CHECK_NOT_ZERO_MEMORY(dispatch, ptr, size) \
+    dispatch(FOSSIL_MAIP_CAUSE_MEMORY, FOSSIL_MAIP_OP_IS_NOT, !maip_sys_memory_zero((ptr), (size)), _FOSSIL_TEST_ASSUME_MESSAGE("Expected memory at " #ptr " of size %zu to not be zeroed", (size)))
 
 /**
  * @brief Assumes that the given memory regions are equal.
@@ -1779,7 +2163,9 @@ extern "C" {
  * @param size The size of the memory regions to compare.
  */
 #define ASSUME_ITS_EQUAL_MEMORY(ptr1, ptr2, size) \
-    FOSSIL_TEST_ASSUME(maip_sys_memory_compare((ptr1), (ptr2), (size)) == 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected memory regions " #ptr1 " and " #ptr2 " of size %zu to be equal", (size)))
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_MEMORY(FOSSIL_TEST_ASSUME_AS, ptr1, ptr2, size)
+#define _FOSSIL_TEST_CHECK_ITS_EQUAL_MEMORY(dispatch, ptr1, ptr2, size) \
+    dispatch(FOSSIL_MAIP_CAUSE_MEMORY, FOSSIL_MAIP_OP_EQ, maip_sys_memory_compare((ptr1), (ptr2), (size)) == 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected memory regions " #ptr1 " and " #ptr2 " of size %zu to be equal", (size)))
 
 /**
  * @brief Assumes that the given memory regions are not equal.
@@ -1789,7 +2175,9 @@ extern "C" {
  * @param size The size of the memory regions to compare.
  */
 #define ASSUME_NOT_EQUAL_MEMORY(ptr1, ptr2, size) \
-    FOSSIL_TEST_ASSUME(maip_sys_memory_compare((ptr1), (ptr2), (size)) != 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected memory regions " #ptr1 " and " #ptr2 " of size %zu to not be equal", (size)))
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_MEMORY(FOSSIL_TEST_ASSUME_AS, ptr1, ptr2, size)
+#define _FOSSIL_TEST_CHECK_NOT_EQUAL_MEMORY(dispatch, ptr1, ptr2, size) \
+    dispatch(FOSSIL_MAIP_CAUSE_MEMORY, FOSSIL_MAIP_OP_NE, maip_sys_memory_compare((ptr1), (ptr2), (size)) != 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected memory regions " #ptr1 " and " #ptr2 " of size %zu to not be equal", (size)))
 
 /**
  * @brief Assumes that the given memory region is more than the expected memory region.
@@ -1799,7 +2187,9 @@ extern "C" {
  * @param size The size of the memory regions to compare.
  */
 #define ASSUME_ITS_MORE_THAN_MEMORY(ptr1, ptr2, size) \
-    FOSSIL_TEST_ASSUME(maip_sys_memory_compare((ptr1), (ptr2), (size)) > 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected memory region " #ptr1 " to be more than " #ptr2 " for size %zu", (size)))
+    _FOSSIL_TEST_CHECK_ITS_MORE_THAN_MEMORY(FOSSIL_TEST_ASSUME_AS, ptr1, ptr2, size)
+#define _FOSSIL_TEST_CHECK_ITS_MORE_THAN_MEMORY(dispatch, ptr1, ptr2, size) \
+    dispatch(FOSSIL_MAIP_CAUSE_MEMORY, FOSSIL_MAIP_OP_GT, maip_sys_memory_compare((ptr1), (ptr2), (size)) > 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected memory region " #ptr1 " to be more than " #ptr2 " for size %zu", (size)))
 
 /**
  * @brief Assumes that the given memory region is less than the expected memory region.
@@ -1809,7 +2199,9 @@ extern "C" {
  * @param size The size of the memory regions to compare.
  */
 #define ASSUME_ITS_LESS_THAN_MEMORY(ptr1, ptr2, size) \
-    FOSSIL_TEST_ASSUME(maip_sys_memory_compare((ptr1), (ptr2), (size)) < 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected memory region " #ptr1 " to be less than " #ptr2 " for size %zu", (size)))
+    _FOSSIL_TEST_CHECK_ITS_LESS_THAN_MEMORY(FOSSIL_TEST_ASSUME_AS, ptr1, ptr2, size)
+#define _FOSSIL_TEST_CHECK_ITS_LESS_THAN_MEMORY(dispatch, ptr1, ptr2, size) \
+    dispatch(FOSSIL_MAIP_CAUSE_MEMORY, FOSSIL_MAIP_OP_LT, maip_sys_memory_compare((ptr1), (ptr2), (size)) < 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected memory region " #ptr1 " to be less than " #ptr2 " for size %zu", (size)))
 
 /**
  * @brief Assumes that the given memory region is more than or equal to the expected memory region.
@@ -1819,7 +2211,9 @@ extern "C" {
  * @param size The size of the memory regions to compare.
  */
 #define ASSUME_ITS_MORE_OR_EQUAL_MEMORY(ptr1, ptr2, size) \
-    FOSSIL_TEST_ASSUME(maip_sys_memory_compare((ptr1), (ptr2), (size)) >= 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected memory region " #ptr1 " to be more than or equal to " #ptr2 " for size %zu", (size)))
+    _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_MEMORY(FOSSIL_TEST_ASSUME_AS, ptr1, ptr2, size)
+#define _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_MEMORY(dispatch, ptr1, ptr2, size) \
+    dispatch(FOSSIL_MAIP_CAUSE_MEMORY, FOSSIL_MAIP_OP_GE, maip_sys_memory_compare((ptr1), (ptr2), (size)) >= 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected memory region " #ptr1 " to be more than or equal to " #ptr2 " for size %zu", (size)))
 
 /**
  * @brief Assumes that the given memory region is less than or equal to the expected memory region.
@@ -1829,7 +2223,9 @@ extern "C" {
  * @param size The size of the memory regions to compare.
  */
 #define ASSUME_ITS_LESS_OR_EQUAL_MEMORY(ptr1, ptr2, size) \
-    FOSSIL_TEST_ASSUME(maip_sys_memory_compare((ptr1), (ptr2), (size)) <= 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected memory region " #ptr1 " to be less than or equal to " #ptr2 " for size %zu", (size)))
+    _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_MEMORY(FOSSIL_TEST_ASSUME_AS, ptr1, ptr2, size)
+#define _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_MEMORY(dispatch, ptr1, ptr2, size) \
+    dispatch(FOSSIL_MAIP_CAUSE_MEMORY, FOSSIL_MAIP_OP_LE, maip_sys_memory_compare((ptr1), (ptr2), (size)) <= 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected memory region " #ptr1 " to be less than or equal to " #ptr2 " for size %zu", (size)))
     
 /**
  * @brief Assumes that the given memory region is not more than the expected memory region.
@@ -1839,7 +2235,9 @@ extern "C" {
  * @param size The size of the memory regions to compare.
  */
 #define ASSUME_NOT_MORE_THAN_MEMORY(ptr1, ptr2, size) \
-    FOSSIL_TEST_ASSUME(maip_sys_memory_compare((ptr1), (ptr2), (size)) <= 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected memory region " #ptr1 " to not be more than " #ptr2 " for size %zu", (size)))
+    _FOSSIL_TEST_CHECK_NOT_MORE_THAN_MEMORY(FOSSIL_TEST_ASSUME_AS, ptr1, ptr2, size)
+#define _FOSSIL_TEST_CHECK_NOT_MORE_THAN_MEMORY(dispatch, ptr1, ptr2, size) \
+    dispatch(FOSSIL_MAIP_CAUSE_MEMORY, FOSSIL_MAIP_OP_LE, maip_sys_memory_compare((ptr1), (ptr2), (size)) <= 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected memory region " #ptr1 " to not be more than " #ptr2 " for size %zu", (size)))
 
 /**
  * @brief Assumes that the given memory region is not less than the expected memory region.
@@ -1849,7 +2247,9 @@ extern "C" {
  * @param size The size of the memory regions to compare.
  */
 #define ASSUME_NOT_LESS_THAN_MEMORY(ptr1, ptr2, size) \
-    FOSSIL_TEST_ASSUME(maip_sys_memory_compare((ptr1), (ptr2), (size)) >= 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected memory region " #ptr1 " to not be less than " #ptr2 " for size %zu", (size)))
+    _FOSSIL_TEST_CHECK_NOT_LESS_THAN_MEMORY(FOSSIL_TEST_ASSUME_AS, ptr1, ptr2, size)
+#define _FOSSIL_TEST_CHECK_NOT_LESS_THAN_MEMORY(dispatch, ptr1, ptr2, size) \
+    dispatch(FOSSIL_MAIP_CAUSE_MEMORY, FOSSIL_MAIP_OP_GE, maip_sys_memory_compare((ptr1), (ptr2), (size)) >= 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected memory region " #ptr1 " to not be less than " #ptr2 " for size %zu", (size)))
 
 /**
  * @brief Assumes that the given memory region is not more than or equal to the expected memory region.
@@ -1859,7 +2259,9 @@ extern "C" {
  * @param size The size of the memory regions to compare.
  */
 #define ASSUME_NOT_MORE_OR_EQUAL_MEMORY(ptr1, ptr2, size) \
-    FOSSIL_TEST_ASSUME(maip_sys_memory_compare((ptr1), (ptr2), (size)) < 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected memory region " #ptr1 " to not be more than or equal to " #ptr2 " for size %zu", (size)))
+    _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_MEMORY(FOSSIL_TEST_ASSUME_AS, ptr1, ptr2, size)
+#define _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_MEMORY(dispatch, ptr1, ptr2, size) \
+    dispatch(FOSSIL_MAIP_CAUSE_MEMORY, FOSSIL_MAIP_OP_LT, maip_sys_memory_compare((ptr1), (ptr2), (size)) < 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected memory region " #ptr1 " to not be more than or equal to " #ptr2 " for size %zu", (size)))
 
 /**
  * @brief Assumes that the given memory region is not less than or equal to the expected memory region.
@@ -1869,7 +2271,9 @@ extern "C" {
  * @param size The size of the memory regions to compare.
  */
 #define ASSUME_NOT_LESS_OR_EQUAL_MEMORY(ptr1, ptr2, size) \
-    FOSSIL_TEST_ASSUME(maip_sys_memory_compare((ptr1), (ptr2), (size)) > 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected memory region " #ptr1 " to not be less than or equal to " #ptr2 " for size %zu", (size)))
+    _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_MEMORY(FOSSIL_TEST_ASSUME_AS, ptr1, ptr2, size)
+#define _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_MEMORY(dispatch, ptr1, ptr2, size) \
+    dispatch(FOSSIL_MAIP_CAUSE_MEMORY, FOSSIL_MAIP_OP_GT, maip_sys_memory_compare((ptr1), (ptr2), (size)) > 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected memory region " #ptr1 " to not be less than or equal to " #ptr2 " for size %zu", (size)))
 
 /**
  * @brief Assumes that the given memory pointer is valid.
@@ -1877,7 +2281,9 @@ extern "C" {
  * @param ptr A pointer to the memory to check.
  */
 #define ASSUME_ITS_VALID_MEMORY(ptr) \
-    FOSSIL_TEST_ASSUME(maip_sys_memory_is_valid((ptr)), _FOSSIL_TEST_ASSUME_MESSAGE("Expected memory pointer " #ptr " to be valid", null))
+    _FOSSIL_TEST_CHECK_ITS_VALID_MEMORY(FOSSIL_TEST_ASSUME_AS, ptr)
+#define _FOSSIL_TEST_CHECK_ITS_VALID_MEMORY(dispatch, ptr) \
+    dispatch(FOSSIL_MAIP_CAUSE_MEMORY, FOSSIL_MAIP_OP_IS, maip_sys_memory_is_valid((ptr)), _FOSSIL_TEST_ASSUME_MESSAGE("Expected memory pointer " #ptr " to be valid", null))
 
 /**
  * @brief Assumes that the given memory pointer is not valid.
@@ -1885,7 +2291,9 @@ extern "C" {
  * @param ptr A pointer to the memory to check.
  */
 #define ASSUME_NOT_VALID_MEMORY(ptr) \
-    FOSSIL_TEST_ASSUME(!maip_sys_memory_is_valid((ptr)), _FOSSIL_TEST_ASSUME_MESSAGE("Expected memory pointer " #ptr " to not be valid", null))
+    _FOSSIL_TEST_CHECK_NOT_VALID_MEMORY(FOSSIL_TEST_ASSUME_AS, ptr)
+#define _FOSSIL_TEST_CHECK_NOT_VALID_MEMORY(dispatch, ptr) \
+    dispatch(FOSSIL_MAIP_CAUSE_MEMORY, FOSSIL_MAIP_OP_IS_NOT, !maip_sys_memory_is_valid((ptr)), _FOSSIL_TEST_ASSUME_MESSAGE("Expected memory pointer " #ptr " to not be valid", null))
 
 // **************************************************
 //
@@ -1899,7 +2307,9 @@ extern "C" {
  * @param actual The pointer to be evaluated.
  */
 #define ASSUME_ITS_CNULL(actual) \
-    FOSSIL_TEST_ASSUME((actual) == null, _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " to be cnull, but got %p", (actual)))
+    _FOSSIL_TEST_CHECK_ITS_CNULL(FOSSIL_TEST_ASSUME_AS, actual)
+#define _FOSSIL_TEST_CHECK_ITS_CNULL(dispatch, actual) \
+    dispatch(FOSSIL_MAIP_CAUSE_MEMORY, FOSSIL_MAIP_OP_IS, (actual) == null, _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " to be cnull, but got %p", (actual)))
 
 /**
  * @brief Assumes that the given pointer is not cnull.
@@ -1907,7 +2317,9 @@ extern "C" {
  * @param actual The pointer to be evaluated.
  */
 #define ASSUME_NOT_CNULL(actual) \
-    FOSSIL_TEST_ASSUME((actual) != null, _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " to not be cnull, but got %p", (actual)))
+    _FOSSIL_TEST_CHECK_NOT_CNULL(FOSSIL_TEST_ASSUME_AS, actual)
+#define _FOSSIL_TEST_CHECK_NOT_CNULL(dispatch, actual) \
+    dispatch(FOSSIL_MAIP_CAUSE_MEMORY, FOSSIL_MAIP_OP_IS_NOT, (actual) != null, _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " to not be cnull, but got %p", (actual)))
 
 /**
  * @brief Assumes that the given pointer is cnull.
@@ -1915,7 +2327,9 @@ extern "C" {
  * @param actual The pointer to be evaluated.
  */
 #define ASSUME_ITS_CNULLABLE(actual) \
-    FOSSIL_TEST_ASSUME((actual) == null, _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " to be cnull, but got %p", (actual)))
+    _FOSSIL_TEST_CHECK_ITS_CNULLABLE(FOSSIL_TEST_ASSUME_AS, actual)
+#define _FOSSIL_TEST_CHECK_ITS_CNULLABLE(dispatch, actual) \
+    dispatch(FOSSIL_MAIP_CAUSE_MEMORY, FOSSIL_MAIP_OP_IS, (actual) == null, _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " to be cnull, but got %p", (actual)))
 
 /**
  * @brief Assumes that the given pointer is not cnull.
@@ -1923,7 +2337,9 @@ extern "C" {
  * @param actual The pointer to be evaluated.
  */
 #define ASSUME_NOT_CNULLABLE(actual) \
-    FOSSIL_TEST_ASSUME((actual) != null, _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " to not be cnull, but got %p", (actual)))
+    _FOSSIL_TEST_CHECK_NOT_CNULLABLE(FOSSIL_TEST_ASSUME_AS, actual)
+#define _FOSSIL_TEST_CHECK_NOT_CNULLABLE(dispatch, actual) \
+    dispatch(FOSSIL_MAIP_CAUSE_MEMORY, FOSSIL_MAIP_OP_IS_NOT, (actual) != null, _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " to not be cnull, but got %p", (actual)))
 
 /**
  * @brief Assumes that the given pointer is cnull.
@@ -1931,7 +2347,9 @@ extern "C" {
  * @param actual The pointer to be evaluated.
  */
 #define ASSUME_ITS_CNONNULL(actual) \
-    FOSSIL_TEST_ASSUME((actual) != null, _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " to not be cnull, but got %p", (actual)))
+    _FOSSIL_TEST_CHECK_ITS_CNONNULL(FOSSIL_TEST_ASSUME_AS, actual)
+#define _FOSSIL_TEST_CHECK_ITS_CNONNULL(dispatch, actual) \
+    dispatch(FOSSIL_MAIP_CAUSE_MEMORY, FOSSIL_MAIP_OP_IS, (actual) != null, _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " to not be cnull, but got %p", (actual)))
 
 /**
  * @brief Assumes that the given pointer is not cnull.
@@ -1939,7 +2357,9 @@ extern "C" {
  * @param actual The pointer to be evaluated.
  */
 #define ASSUME_NOT_CNONNULL(actual) \
-    FOSSIL_TEST_ASSUME((actual) == null, _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " to be cnull, but got %p", (actual)))
+    _FOSSIL_TEST_CHECK_NOT_CNONNULL(FOSSIL_TEST_ASSUME_AS, actual)
+#define _FOSSIL_TEST_CHECK_NOT_CNONNULL(dispatch, actual) \
+    dispatch(FOSSIL_MAIP_CAUSE_MEMORY, FOSSIL_MAIP_OP_IS_NOT, (actual) == null, _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " to be cnull, but got %p", (actual)))
 
 /**
  * @brief Assumes that the given condition is likely.
@@ -1947,7 +2367,9 @@ extern "C" {
  * @param x The condition to be evaluated.
  */
 #define ASSUME_ITS_LIKELY(x) \
-    FOSSIL_TEST_ASSUME(likely(x), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #x " to be likely, but got %d", (x)))
+    _FOSSIL_TEST_CHECK_ITS_LIKELY(FOSSIL_TEST_ASSUME_AS, x)
+#define _FOSSIL_TEST_CHECK_ITS_LIKELY(dispatch, x) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_IS, likely(x), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #x " to be likely, but got %d", (x)))
 
 /**
  * @brief Assumes that the given condition is not likely.
@@ -1955,7 +2377,9 @@ extern "C" {
  * @param x The condition to be evaluated.
  */
 #define ASSUME_NOT_LIKELY(x) \
-    FOSSIL_TEST_ASSUME(!likely(x), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #x " to not be likely, but got %d", (x)))
+    _FOSSIL_TEST_CHECK_NOT_LIKELY(FOSSIL_TEST_ASSUME_AS, x)
+#define _FOSSIL_TEST_CHECK_NOT_LIKELY(dispatch, x) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_IS_NOT, !likely(x), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #x " to not be likely, but got %d", (x)))
 
 /**
  * @brief Assumes that the given condition is unlikely.
@@ -1963,7 +2387,9 @@ extern "C" {
  * @param x The condition to be evaluated.
  */
 #define ASSUME_ITS_UNLIKELY(x) \
-    FOSSIL_TEST_ASSUME(unlikely(x), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #x " to be unlikely, but got %d", (x)))
+    _FOSSIL_TEST_CHECK_ITS_UNLIKELY(FOSSIL_TEST_ASSUME_AS, x)
+#define _FOSSIL_TEST_CHECK_ITS_UNLIKELY(dispatch, x) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_IS, unlikely(x), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #x " to be unlikely, but got %d", (x)))
 
 /**
  * @brief Assumes that the given condition is not unlikely.
@@ -1971,7 +2397,9 @@ extern "C" {
  * @param x The condition to be evaluated.
  */
 #define ASSUME_NOT_UNLIKELY(x) \
-    FOSSIL_TEST_ASSUME(!unlikely(x), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #x " to not be unlikely, but got %d", (x)))
+    _FOSSIL_TEST_CHECK_NOT_UNLIKELY(FOSSIL_TEST_ASSUME_AS, x)
+#define _FOSSIL_TEST_CHECK_NOT_UNLIKELY(dispatch, x) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_IS_NOT, !unlikely(x), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #x " to not be unlikely, but got %d", (x)))
 
 /**
  * @brief Assumes that the given pointers are equal.
@@ -1980,7 +2408,9 @@ extern "C" {
  * @param expected The expected pointer.
  */
 #define ASSUME_ITS_EQUAL_PTR(actual, expected) \
-    FOSSIL_TEST_ASSUME((actual) == (expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected pointer " #actual " of value %p to be equal to pointer " #expected " of value %p", (actual), (expected)))
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_PTR(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_EQUAL_PTR(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_MEMORY, FOSSIL_MAIP_OP_EQ, (actual) == (expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected pointer " #actual " of value %p to be equal to pointer " #expected " of value %p", (actual), (expected)))
 
 /**
  * @brief Assumes that the given pointers are not equal.
@@ -1989,7 +2419,9 @@ extern "C" {
  * @param expected The expected pointer.
  */
 #define ASSUME_NOT_EQUAL_PTR(actual, expected) \
-    FOSSIL_TEST_ASSUME((actual) != (expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected pointer " #actual " of value %p to not be equal to pointer " #expected " of value %p", (actual), (expected)))
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_PTR(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_EQUAL_PTR(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_MEMORY, FOSSIL_MAIP_OP_NE, (actual) != (expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected pointer " #actual " of value %p to not be equal to pointer " #expected " of value %p", (actual), (expected)))
 
 /**
  * @brief Assumes that the given size_t values are equal.
@@ -1998,7 +2430,9 @@ extern "C" {
  * @param expected The expected size_t value.
  */
 #define ASSUME_ITS_EQUAL_SIZE(actual, expected) \
-    FOSSIL_TEST_ASSUME((size_t)(actual) == (size_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %zu to be equal to " #expected " of value %zu", (size_t)(actual), (size_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_SIZE(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_EQUAL_SIZE(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_EQ, (size_t)(actual) == (size_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %zu to be equal to " #expected " of value %zu", (size_t)(actual), (size_t)(expected)))
 
 /**
  * @brief Assumes that the given size_t value is less than the expected value.
@@ -2007,7 +2441,9 @@ extern "C" {
  * @param expected The expected size_t value.
  */
 #define ASSUME_ITS_LESS_THAN_SIZE(actual, expected) \
-    FOSSIL_TEST_ASSUME((size_t)(actual) < (size_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %zu to be less than " #expected " of value %zu", (size_t)(actual), (size_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_LESS_THAN_SIZE(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_LESS_THAN_SIZE(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LT, (size_t)(actual) < (size_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %zu to be less than " #expected " of value %zu", (size_t)(actual), (size_t)(expected)))
 
 /**
  * @brief Assumes that the given size_t value is more than the expected value.
@@ -2016,7 +2452,9 @@ extern "C" {
  * @param expected The expected size_t value.
  */
 #define ASSUME_ITS_MORE_THAN_SIZE(actual, expected) \
-    FOSSIL_TEST_ASSUME((size_t)(actual) > (size_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %zu to be more than " #expected " of value %zu", (size_t)(actual), (size_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_MORE_THAN_SIZE(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_MORE_THAN_SIZE(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GT, (size_t)(actual) > (size_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %zu to be more than " #expected " of value %zu", (size_t)(actual), (size_t)(expected)))
 
 /**
  * @brief Assumes that the given size_t value is less than or equal to the expected value.
@@ -2025,7 +2463,9 @@ extern "C" {
  * @param expected The expected size_t value.
  */
 #define ASSUME_ITS_LESS_OR_EQUAL_SIZE(actual, expected) \
-    FOSSIL_TEST_ASSUME((size_t)(actual) <= (size_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %zu to be less than or equal to " #expected " of value %zu", (size_t)(actual), (size_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_SIZE(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_SIZE(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LE, (size_t)(actual) <= (size_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %zu to be less than or equal to " #expected " of value %zu", (size_t)(actual), (size_t)(expected)))
 
 /**
  * @brief Assumes that the given size_t value is more than or equal to the expected value.
@@ -2034,7 +2474,9 @@ extern "C" {
  * @param expected The expected size_t value.
  */
 #define ASSUME_ITS_MORE_OR_EQUAL_SIZE(actual, expected) \
-    FOSSIL_TEST_ASSUME((size_t)(actual) >= (size_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %zu to be more than or equal to " #expected " of value %zu", (size_t)(actual), (size_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_SIZE(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_SIZE(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GE, (size_t)(actual) >= (size_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %zu to be more than or equal to " #expected " of value %zu", (size_t)(actual), (size_t)(expected)))
 
 /**
  * @brief Assumes that the given size_t values are not equal.
@@ -2043,7 +2485,9 @@ extern "C" {
  * @param expected The expected size_t value.
  */
 #define ASSUME_NOT_EQUAL_SIZE(actual, expected) \
-    FOSSIL_TEST_ASSUME((size_t)(actual) != (size_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %zu to not be equal to " #expected " of value %zu", (size_t)(actual), (size_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_SIZE(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_EQUAL_SIZE(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_NE, (size_t)(actual) != (size_t)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected " #actual " of value %zu to not be equal to " #expected " of value %zu", (size_t)(actual), (size_t)(expected)))
 
 // **************************************************
 //
@@ -2059,7 +2503,9 @@ extern "C" {
  * @param max The maximum value of the range.
  */
 #define ASSUME_ITS_WITHIN_RANGE(value, min, max) \
-    FOSSIL_TEST_ASSUME((value) >= (min) && (value) <= (max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %d is not within range [" #min " of value %d, " #max " of value %d]", (value), (min), (max)))
+    _FOSSIL_TEST_CHECK_ITS_WITHIN_RANGE(FOSSIL_TEST_ASSUME_AS, value, min, max)
+#define _FOSSIL_TEST_CHECK_ITS_WITHIN_RANGE(dispatch, value, min, max) \
+    dispatch(FOSSIL_MAIP_CAUSE_RANGE, FOSSIL_MAIP_OP_WITHIN, (value) >= (min) && (value) <= (max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %d is not within range [" #min " of value %d, " #max " of value %d]", (value), (min), (max)))
 
 /**
  * @brief Assumes that the given value is not within the specified range.
@@ -2069,7 +2515,9 @@ extern "C" {
  * @param max The maximum value of the range.
  */
 #define ASSUME_NOT_WITHIN_RANGE(value, min, max) \
-    FOSSIL_TEST_ASSUME((value) < (min) || (value) > (max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %d is within range [" #min " of value %d, " #max " of value %d]", (value), (min), (max)))
+    _FOSSIL_TEST_CHECK_NOT_WITHIN_RANGE(FOSSIL_TEST_ASSUME_AS, value, min, max)
+#define _FOSSIL_TEST_CHECK_NOT_WITHIN_RANGE(dispatch, value, min, max) \
+    dispatch(FOSSIL_MAIP_CAUSE_RANGE, FOSSIL_MAIP_OP_OUTSIDE, (value) < (min) || (value) > (max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %d is within range [" #min " of value %d, " #max " of value %d]", (value), (min), (max)))
 
 // Unsigned integer type assumptions
 
@@ -2081,7 +2529,9 @@ extern "C" {
  * @param max The maximum value of the range.
  */
 #define ASSUME_ITS_WITHIN_RANGE_U8(value, min, max) \
-    FOSSIL_TEST_ASSUME((uint8_t)(value) >= (uint8_t)(min) && (uint8_t)(value) <= (uint8_t)(max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %u is not within range [" #min " of value %u, " #max " of value %u]", (uint8_t)(value), (uint8_t)(min), (uint8_t)(max)))
+    _FOSSIL_TEST_CHECK_ITS_WITHIN_RANGE_U8(FOSSIL_TEST_ASSUME_AS, value, min, max)
+#define _FOSSIL_TEST_CHECK_ITS_WITHIN_RANGE_U8(dispatch, value, min, max) \
+    dispatch(FOSSIL_MAIP_CAUSE_RANGE, FOSSIL_MAIP_OP_WITHIN, (uint8_t)(value) >= (uint8_t)(min) && (uint8_t)(value) <= (uint8_t)(max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %u is not within range [" #min " of value %u, " #max " of value %u]", (uint8_t)(value), (uint8_t)(min), (uint8_t)(max)))
 
 /**
  * @brief Assumes that the given 8-bit unsigned integer value is not within the specified range.
@@ -2091,7 +2541,9 @@ extern "C" {
  * @param max The maximum value of the range.
  */
 #define ASSUME_NOT_WITHIN_RANGE_U8(value, min, max) \
-    FOSSIL_TEST_ASSUME((uint8_t)(value) < (uint8_t)(min) || (uint8_t)(value) > (uint8_t)(max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %u is within range [" #min " of value %u, " #max " of value %u]", (uint8_t)(value), (uint8_t)(min), (uint8_t)(max)))
+    _FOSSIL_TEST_CHECK_NOT_WITHIN_RANGE_U8(FOSSIL_TEST_ASSUME_AS, value, min, max)
+#define _FOSSIL_TEST_CHECK_NOT_WITHIN_RANGE_U8(dispatch, value, min, max) \
+    dispatch(FOSSIL_MAIP_CAUSE_RANGE, FOSSIL_MAIP_OP_OUTSIDE, (uint8_t)(value) < (uint8_t)(min) || (uint8_t)(value) > (uint8_t)(max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %u is within range [" #min " of value %u, " #max " of value %u]", (uint8_t)(value), (uint8_t)(min), (uint8_t)(max)))
 
 /**
  * @brief Assumes that the given 16-bit unsigned integer value is within the specified range.
@@ -2101,7 +2553,9 @@ extern "C" {
  * @param max The maximum value of the range.
  */
 #define ASSUME_ITS_WITHIN_RANGE_U16(value, min, max) \
-    FOSSIL_TEST_ASSUME((uint16_t)(value) >= (uint16_t)(min) && (uint16_t)(value) <= (uint16_t)(max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %u is not within range [" #min " of value %u, " #max " of value %u]", (uint16_t)(value), (uint16_t)(min), (uint16_t)(max)))
+    _FOSSIL_TEST_CHECK_ITS_WITHIN_RANGE_U16(FOSSIL_TEST_ASSUME_AS, value, min, max)
+#define _FOSSIL_TEST_CHECK_ITS_WITHIN_RANGE_U16(dispatch, value, min, max) \
+    dispatch(FOSSIL_MAIP_CAUSE_RANGE, FOSSIL_MAIP_OP_WITHIN, (uint16_t)(value) >= (uint16_t)(min) && (uint16_t)(value) <= (uint16_t)(max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %u is not within range [" #min " of value %u, " #max " of value %u]", (uint16_t)(value), (uint16_t)(min), (uint16_t)(max)))
 
 /**
  * @brief Assumes that the given 16-bit unsigned integer value is not within the specified range.
@@ -2111,7 +2565,9 @@ extern "C" {
  * @param max The maximum value of the range.
  */
 #define ASSUME_NOT_WITHIN_RANGE_U16(value, min, max) \
-    FOSSIL_TEST_ASSUME((uint16_t)(value) < (uint16_t)(min) || (uint16_t)(value) > (uint16_t)(max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %u is within range [" #min " of value %u, " #max " of value %u]", (uint16_t)(value), (uint16_t)(min), (uint16_t)(max)))
+    _FOSSIL_TEST_CHECK_NOT_WITHIN_RANGE_U16(FOSSIL_TEST_ASSUME_AS, value, min, max)
+#define _FOSSIL_TEST_CHECK_NOT_WITHIN_RANGE_U16(dispatch, value, min, max) \
+    dispatch(FOSSIL_MAIP_CAUSE_RANGE, FOSSIL_MAIP_OP_OUTSIDE, (uint16_t)(value) < (uint16_t)(min) || (uint16_t)(value) > (uint16_t)(max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %u is within range [" #min " of value %u, " #max " of value %u]", (uint16_t)(value), (uint16_t)(min), (uint16_t)(max)))
 
 /**
  * @brief Assumes that the given 32-bit unsigned integer value is within the specified range.
@@ -2121,7 +2577,9 @@ extern "C" {
  * @param max The maximum value of the range.
  */
 #define ASSUME_ITS_WITHIN_RANGE_U32(value, min, max) \
-    FOSSIL_TEST_ASSUME((uint32_t)(value) >= (uint32_t)(min) && (uint32_t)(value) <= (uint32_t)(max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %u is not within range [" #min " of value %u, " #max " of value %u]", (uint32_t)(value), (uint32_t)(min), (uint32_t)(max)))
+    _FOSSIL_TEST_CHECK_ITS_WITHIN_RANGE_U32(FOSSIL_TEST_ASSUME_AS, value, min, max)
+#define _FOSSIL_TEST_CHECK_ITS_WITHIN_RANGE_U32(dispatch, value, min, max) \
+    dispatch(FOSSIL_MAIP_CAUSE_RANGE, FOSSIL_MAIP_OP_WITHIN, (uint32_t)(value) >= (uint32_t)(min) && (uint32_t)(value) <= (uint32_t)(max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %u is not within range [" #min " of value %u, " #max " of value %u]", (uint32_t)(value), (uint32_t)(min), (uint32_t)(max)))
 
 /**
  * @brief Assumes that the given 32-bit unsigned integer value is not within the specified range.
@@ -2131,7 +2589,9 @@ extern "C" {
  * @param max The maximum value of the range.
  */
 #define ASSUME_NOT_WITHIN_RANGE_U32(value, min, max) \
-    FOSSIL_TEST_ASSUME((uint32_t)(value) < (uint32_t)(min) || (uint32_t)(value) > (uint32_t)(max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %u is within range [" #min " of value %u, " #max " of value %u]", (uint32_t)(value), (uint32_t)(min), (uint32_t)(max)))
+    _FOSSIL_TEST_CHECK_NOT_WITHIN_RANGE_U32(FOSSIL_TEST_ASSUME_AS, value, min, max)
+#define _FOSSIL_TEST_CHECK_NOT_WITHIN_RANGE_U32(dispatch, value, min, max) \
+    dispatch(FOSSIL_MAIP_CAUSE_RANGE, FOSSIL_MAIP_OP_OUTSIDE, (uint32_t)(value) < (uint32_t)(min) || (uint32_t)(value) > (uint32_t)(max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %u is within range [" #min " of value %u, " #max " of value %u]", (uint32_t)(value), (uint32_t)(min), (uint32_t)(max)))
 
 /**
  * @brief Assumes that the given 64-bit unsigned integer value is within the specified range.
@@ -2141,7 +2601,9 @@ extern "C" {
  * @param max The maximum value of the range.
  */
 #define ASSUME_ITS_WITHIN_RANGE_U64(value, min, max) \
-    FOSSIL_TEST_ASSUME((uint64_t)(value) >= (uint64_t)(min) && (uint64_t)(value) <= (uint64_t)(max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %llu is not within range [" #min " of value %llu, " #max " of value %llu]", (uint64_t)(value), (uint64_t)(min), (uint64_t)(max)))
+    _FOSSIL_TEST_CHECK_ITS_WITHIN_RANGE_U64(FOSSIL_TEST_ASSUME_AS, value, min, max)
+#define _FOSSIL_TEST_CHECK_ITS_WITHIN_RANGE_U64(dispatch, value, min, max) \
+    dispatch(FOSSIL_MAIP_CAUSE_RANGE, FOSSIL_MAIP_OP_WITHIN, (uint64_t)(value) >= (uint64_t)(min) && (uint64_t)(value) <= (uint64_t)(max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %llu is not within range [" #min " of value %llu, " #max " of value %llu]", (uint64_t)(value), (uint64_t)(min), (uint64_t)(max)))
 
 /**
  * @brief Assumes that the given 64-bit unsigned integer value is not within the specified range.
@@ -2151,7 +2613,9 @@ extern "C" {
  * @param max The maximum value of the range.
  */
 #define ASSUME_NOT_WITHIN_RANGE_U64(value, min, max) \
-    FOSSIL_TEST_ASSUME((uint64_t)(value) < (uint64_t)(min) || (uint64_t)(value) > (uint64_t)(max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %llu is within range [" #min " of value %llu, " #max " of value %llu]", (uint64_t)(value), (uint64_t)(min), (uint64_t)(max)))
+    _FOSSIL_TEST_CHECK_NOT_WITHIN_RANGE_U64(FOSSIL_TEST_ASSUME_AS, value, min, max)
+#define _FOSSIL_TEST_CHECK_NOT_WITHIN_RANGE_U64(dispatch, value, min, max) \
+    dispatch(FOSSIL_MAIP_CAUSE_RANGE, FOSSIL_MAIP_OP_OUTSIDE, (uint64_t)(value) < (uint64_t)(min) || (uint64_t)(value) > (uint64_t)(max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %llu is within range [" #min " of value %llu, " #max " of value %llu]", (uint64_t)(value), (uint64_t)(min), (uint64_t)(max)))
 
 /**
  * @brief Assumes that the given 8-bit integer value is within the specified range.
@@ -2161,7 +2625,9 @@ extern "C" {
  * @param max The maximum value of the range.
  */
 #define ASSUME_ITS_WITHIN_RANGE_I8(value, min, max) \
-    FOSSIL_TEST_ASSUME((int8_t)(value) >= (int8_t)(min) && (int8_t)(value) <= (int8_t)(max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %d is not within range [" #min " of value %d, " #max " of value %d]", (int8_t)(value), (int8_t)(min), (int8_t)(max)))
+    _FOSSIL_TEST_CHECK_ITS_WITHIN_RANGE_I8(FOSSIL_TEST_ASSUME_AS, value, min, max)
+#define _FOSSIL_TEST_CHECK_ITS_WITHIN_RANGE_I8(dispatch, value, min, max) \
+    dispatch(FOSSIL_MAIP_CAUSE_RANGE, FOSSIL_MAIP_OP_WITHIN, (int8_t)(value) >= (int8_t)(min) && (int8_t)(value) <= (int8_t)(max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %d is not within range [" #min " of value %d, " #max " of value %d]", (int8_t)(value), (int8_t)(min), (int8_t)(max)))
 
 /**
  * @brief Assumes that the given 8-bit integer value is not within the specified range.
@@ -2171,7 +2637,9 @@ extern "C" {
  * @param max The maximum value of the range.
  */
 #define ASSUME_NOT_WITHIN_RANGE_I8(value, min, max) \
-    FOSSIL_TEST_ASSUME((int8_t)(value) < (int8_t)(min) || (int8_t)(value) > (int8_t)(max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %d is within range [" #min " of value %d, " #max " of value %d]", (int8_t)(value), (int8_t)(min), (int8_t)(max)))
+    _FOSSIL_TEST_CHECK_NOT_WITHIN_RANGE_I8(FOSSIL_TEST_ASSUME_AS, value, min, max)
+#define _FOSSIL_TEST_CHECK_NOT_WITHIN_RANGE_I8(dispatch, value, min, max) \
+    dispatch(FOSSIL_MAIP_CAUSE_RANGE, FOSSIL_MAIP_OP_OUTSIDE, (int8_t)(value) < (int8_t)(min) || (int8_t)(value) > (int8_t)(max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %d is within range [" #min " of value %d, " #max " of value %d]", (int8_t)(value), (int8_t)(min), (int8_t)(max)))
 
 /**
  * @brief Assumes that the given 16-bit integer value is within the specified range.
@@ -2181,7 +2649,9 @@ extern "C" {
  * @param max The maximum value of the range.
  */
 #define ASSUME_ITS_WITHIN_RANGE_I16(value, min, max) \
-    FOSSIL_TEST_ASSUME((int16_t)(value) >= (int16_t)(min) && (int16_t)(value) <= (int16_t)(max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %d is not within range [" #min " of value %d, " #max " of value %d]", (int16_t)(value), (int16_t)(min), (int16_t)(max)))
+    _FOSSIL_TEST_CHECK_ITS_WITHIN_RANGE_I16(FOSSIL_TEST_ASSUME_AS, value, min, max)
+#define _FOSSIL_TEST_CHECK_ITS_WITHIN_RANGE_I16(dispatch, value, min, max) \
+    dispatch(FOSSIL_MAIP_CAUSE_RANGE, FOSSIL_MAIP_OP_WITHIN, (int16_t)(value) >= (int16_t)(min) && (int16_t)(value) <= (int16_t)(max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %d is not within range [" #min " of value %d, " #max " of value %d]", (int16_t)(value), (int16_t)(min), (int16_t)(max)))
 
 /**
  * @brief Assumes that the given 16-bit integer value is not within the specified range.
@@ -2191,7 +2661,9 @@ extern "C" {
  * @param max The maximum value of the range.
  */
 #define ASSUME_NOT_WITHIN_RANGE_I16(value, min, max) \
-    FOSSIL_TEST_ASSUME((int16_t)(value) < (int16_t)(min) || (int16_t)(value) > (int16_t)(max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %d is within range [" #min " of value %d, " #max " of value %d]", (int16_t)(value), (int16_t)(min), (int16_t)(max)))
+    _FOSSIL_TEST_CHECK_NOT_WITHIN_RANGE_I16(FOSSIL_TEST_ASSUME_AS, value, min, max)
+#define _FOSSIL_TEST_CHECK_NOT_WITHIN_RANGE_I16(dispatch, value, min, max) \
+    dispatch(FOSSIL_MAIP_CAUSE_RANGE, FOSSIL_MAIP_OP_OUTSIDE, (int16_t)(value) < (int16_t)(min) || (int16_t)(value) > (int16_t)(max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %d is within range [" #min " of value %d, " #max " of value %d]", (int16_t)(value), (int16_t)(min), (int16_t)(max)))
 
 /**
  * @brief Assumes that the given 32-bit integer value is within the specified range.
@@ -2201,7 +2673,9 @@ extern "C" {
  * @param max The maximum value of the range.
  */
 #define ASSUME_ITS_WITHIN_RANGE_I32(value, min, max) \
-    FOSSIL_TEST_ASSUME((int32_t)(value) >= (int32_t)(min) && (int32_t)(value) <= (int32_t)(max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %d is not within range [" #min " of value %d, " #max " of value %d]", (int32_t)(value), (int32_t)(min), (int32_t)(max)))
+    _FOSSIL_TEST_CHECK_ITS_WITHIN_RANGE_I32(FOSSIL_TEST_ASSUME_AS, value, min, max)
+#define _FOSSIL_TEST_CHECK_ITS_WITHIN_RANGE_I32(dispatch, value, min, max) \
+    dispatch(FOSSIL_MAIP_CAUSE_RANGE, FOSSIL_MAIP_OP_WITHIN, (int32_t)(value) >= (int32_t)(min) && (int32_t)(value) <= (int32_t)(max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %d is not within range [" #min " of value %d, " #max " of value %d]", (int32_t)(value), (int32_t)(min), (int32_t)(max)))
 
 /**
  * @brief Assumes that the given 32-bit integer value is not within the specified range.
@@ -2211,7 +2685,9 @@ extern "C" {
  * @param max The maximum value of the range.
  */
 #define ASSUME_NOT_WITHIN_RANGE_I32(value, min, max) \
-    FOSSIL_TEST_ASSUME((int32_t)(value) < (int32_t)(min) || (int32_t)(value) > (int32_t)(max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %d is within range [" #min " of value %d, " #max " of value %d]", (int32_t)(value), (int32_t)(min), (int32_t)(max)))
+    _FOSSIL_TEST_CHECK_NOT_WITHIN_RANGE_I32(FOSSIL_TEST_ASSUME_AS, value, min, max)
+#define _FOSSIL_TEST_CHECK_NOT_WITHIN_RANGE_I32(dispatch, value, min, max) \
+    dispatch(FOSSIL_MAIP_CAUSE_RANGE, FOSSIL_MAIP_OP_OUTSIDE, (int32_t)(value) < (int32_t)(min) || (int32_t)(value) > (int32_t)(max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %d is within range [" #min " of value %d, " #max " of value %d]", (int32_t)(value), (int32_t)(min), (int32_t)(max)))
 
 /**
  * @brief Assumes that the given 64-bit integer value is within the specified range.
@@ -2221,7 +2697,9 @@ extern "C" {
  * @param max The maximum value of the range.
  */
 #define ASSUME_ITS_WITHIN_RANGE_I64(value, min, max) \
-    FOSSIL_TEST_ASSUME((int64_t)(value) >= (int64_t)(min) && (int64_t)(value) <= (int64_t)(max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %lld is not within range [" #min " of value %lld, " #max " of value %lld]", (int64_t)(value), (int64_t)(min), (int64_t)(max)))
+    _FOSSIL_TEST_CHECK_ITS_WITHIN_RANGE_I64(FOSSIL_TEST_ASSUME_AS, value, min, max)
+#define _FOSSIL_TEST_CHECK_ITS_WITHIN_RANGE_I64(dispatch, value, min, max) \
+    dispatch(FOSSIL_MAIP_CAUSE_RANGE, FOSSIL_MAIP_OP_WITHIN, (int64_t)(value) >= (int64_t)(min) && (int64_t)(value) <= (int64_t)(max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %lld is not within range [" #min " of value %lld, " #max " of value %lld]", (int64_t)(value), (int64_t)(min), (int64_t)(max)))
 
 /**
  * @brief Assumes that the given 64-bit integer value is not within the specified range.
@@ -2231,7 +2709,9 @@ extern "C" {
  * @param max The maximum value of the range.
  */
 #define ASSUME_NOT_WITHIN_RANGE_I64(value, min, max) \
-    FOSSIL_TEST_ASSUME((int64_t)(value) < (int64_t)(min) || (int64_t)(value) > (int64_t)(max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %lld is within range [" #min " of value %lld, " #max " of value %lld]", (int64_t)(value), (int64_t)(min), (int64_t)(max)))
+    _FOSSIL_TEST_CHECK_NOT_WITHIN_RANGE_I64(FOSSIL_TEST_ASSUME_AS, value, min, max)
+#define _FOSSIL_TEST_CHECK_NOT_WITHIN_RANGE_I64(dispatch, value, min, max) \
+    dispatch(FOSSIL_MAIP_CAUSE_RANGE, FOSSIL_MAIP_OP_OUTSIDE, (int64_t)(value) < (int64_t)(min) || (int64_t)(value) > (int64_t)(max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %lld is within range [" #min " of value %lld, " #max " of value %lld]", (int64_t)(value), (int64_t)(min), (int64_t)(max)))
 
 /**
  * @brief Assumes that the given float value is within the specified range.
@@ -2241,7 +2721,9 @@ extern "C" {
  * @param max The maximum value of the range.
  */
 #define ASSUME_ITS_WITHIN_RANGE_F32(value, min, max) \
-    FOSSIL_TEST_ASSUME((value) >= (min) && (value) <= (max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %f is not within range [" #min " of value %f, " #max " of value %f]", (value), (min), (max)))
+    _FOSSIL_TEST_CHECK_ITS_WITHIN_RANGE_F32(FOSSIL_TEST_ASSUME_AS, value, min, max)
+#define _FOSSIL_TEST_CHECK_ITS_WITHIN_RANGE_F32(dispatch, value, min, max) \
+    dispatch(FOSSIL_MAIP_CAUSE_RANGE, FOSSIL_MAIP_OP_WITHIN, (value) >= (min) && (value) <= (max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %f is not within range [" #min " of value %f, " #max " of value %f]", (value), (min), (max)))
 
 /**
  * @brief Assumes that the given float value is not within the specified range.
@@ -2251,7 +2733,9 @@ extern "C" {
  * @param max The maximum value of the range.
  */
 #define ASSUME_NOT_WITHIN_RANGE_F32(value, min, max) \
-    FOSSIL_TEST_ASSUME((value) < (min) || (value) > (max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %f is within range [" #min " of value %f, " #max " of value %f]", (value), (min), (max)))
+    _FOSSIL_TEST_CHECK_NOT_WITHIN_RANGE_F32(FOSSIL_TEST_ASSUME_AS, value, min, max)
+#define _FOSSIL_TEST_CHECK_NOT_WITHIN_RANGE_F32(dispatch, value, min, max) \
+    dispatch(FOSSIL_MAIP_CAUSE_RANGE, FOSSIL_MAIP_OP_OUTSIDE, (value) < (min) || (value) > (max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %f is within range [" #min " of value %f, " #max " of value %f]", (value), (min), (max)))
 
 /**
  * @brief Assumes that the given double value is within the specified range.
@@ -2261,7 +2745,9 @@ extern "C" {
  * @param max The maximum value of the range.
  */
 #define ASSUME_ITS_WITHIN_RANGE_F64(value, min, max) \
-    FOSSIL_TEST_ASSUME((value) >= (min) && (value) <= (max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %f is not within range [" #min " of value %f, " #max " of value %f]", (value), (min), (max)))
+    _FOSSIL_TEST_CHECK_ITS_WITHIN_RANGE_F64(FOSSIL_TEST_ASSUME_AS, value, min, max)
+#define _FOSSIL_TEST_CHECK_ITS_WITHIN_RANGE_F64(dispatch, value, min, max) \
+    dispatch(FOSSIL_MAIP_CAUSE_RANGE, FOSSIL_MAIP_OP_WITHIN, (value) >= (min) && (value) <= (max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %f is not within range [" #min " of value %f, " #max " of value %f]", (value), (min), (max)))
 
 /**
  * @brief Assumes that the given double value is not within the specified range.
@@ -2271,7 +2757,9 @@ extern "C" {
  * @param max The maximum value of the range.
  */
 #define ASSUME_NOT_WITHIN_RANGE_F64(value, min, max) \
-    FOSSIL_TEST_ASSUME((value) < (min) || (value) > (max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %f is within range [" #min " of value %f, " #max " of value %f]", (value), (min), (max)))
+    _FOSSIL_TEST_CHECK_NOT_WITHIN_RANGE_F64(FOSSIL_TEST_ASSUME_AS, value, min, max)
+#define _FOSSIL_TEST_CHECK_NOT_WITHIN_RANGE_F64(dispatch, value, min, max) \
+    dispatch(FOSSIL_MAIP_CAUSE_RANGE, FOSSIL_MAIP_OP_OUTSIDE, (value) < (min) || (value) > (max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %f is within range [" #min " of value %f, " #max " of value %f]", (value), (min), (max)))
 
 // Byte char type assumptions (uint8_t)
 
@@ -2283,7 +2771,9 @@ extern "C" {
  * @param max The maximum value of the range.
  */
 #define ASSUME_ITS_WITHIN_RANGE_BCHAR(value, min, max) \
-    FOSSIL_TEST_ASSUME((uint8_t)(value) >= (uint8_t)(min) && (uint8_t)(value) <= (uint8_t)(max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %u is not within range [" #min " of value %u, " #max " of value %u]", (uint8_t)(value), (uint8_t)(min), (uint8_t)(max)))
+    _FOSSIL_TEST_CHECK_ITS_WITHIN_RANGE_BCHAR(FOSSIL_TEST_ASSUME_AS, value, min, max)
+#define _FOSSIL_TEST_CHECK_ITS_WITHIN_RANGE_BCHAR(dispatch, value, min, max) \
+    dispatch(FOSSIL_MAIP_CAUSE_RANGE, FOSSIL_MAIP_OP_WITHIN, (uint8_t)(value) >= (uint8_t)(min) && (uint8_t)(value) <= (uint8_t)(max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %u is not within range [" #min " of value %u, " #max " of value %u]", (uint8_t)(value), (uint8_t)(min), (uint8_t)(max)))
 
 /**
  * @brief Assumes that the given byte char value is not within the specified range.
@@ -2293,7 +2783,9 @@ extern "C" {
  * @param max The maximum value of the range.
  */
 #define ASSUME_NOT_WITHIN_RANGE_BCHAR(value, min, max) \
-    FOSSIL_TEST_ASSUME((uint8_t)(value) < (uint8_t)(min) || (uint8_t)(value) > (uint8_t)(max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %u is within range [" #min " of value %u, " #max " of value %u]", (uint8_t)(value), (uint8_t)(min), (uint8_t)(max)))
+    _FOSSIL_TEST_CHECK_NOT_WITHIN_RANGE_BCHAR(FOSSIL_TEST_ASSUME_AS, value, min, max)
+#define _FOSSIL_TEST_CHECK_NOT_WITHIN_RANGE_BCHAR(dispatch, value, min, max) \
+    dispatch(FOSSIL_MAIP_CAUSE_RANGE, FOSSIL_MAIP_OP_OUTSIDE, (uint8_t)(value) < (uint8_t)(min) || (uint8_t)(value) > (uint8_t)(max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %u is within range [" #min " of value %u, " #max " of value %u]", (uint8_t)(value), (uint8_t)(min), (uint8_t)(max)))
 
 // Char type assumptions (char)
 
@@ -2305,7 +2797,9 @@ extern "C" {
  * @param max The maximum value of the range.
  */
 #define ASSUME_ITS_WITHIN_RANGE_CCHAR(value, min, max) \
-    FOSSIL_TEST_ASSUME((char)(value) >= (char)(min) && (char)(value) <= (char)(max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %c is not within range [" #min " of value %c, " #max " of value %c]", (char)(value), (char)(min), (char)(max)))
+    _FOSSIL_TEST_CHECK_ITS_WITHIN_RANGE_CCHAR(FOSSIL_TEST_ASSUME_AS, value, min, max)
+#define _FOSSIL_TEST_CHECK_ITS_WITHIN_RANGE_CCHAR(dispatch, value, min, max) \
+    dispatch(FOSSIL_MAIP_CAUSE_RANGE, FOSSIL_MAIP_OP_WITHIN, (char)(value) >= (char)(min) && (char)(value) <= (char)(max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %c is not within range [" #min " of value %c, " #max " of value %c]", (char)(value), (char)(min), (char)(max)))
 
 /**
  * @brief Assumes that the given char value is not within the specified range.
@@ -2315,7 +2809,9 @@ extern "C" {
  * @param max The maximum value of the range.
  */
 #define ASSUME_NOT_WITHIN_RANGE_CCHAR(value, min, max) \
-    FOSSIL_TEST_ASSUME((char)(value) < (char)(min) || (char)(value) > (char)(max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %c is within range [" #min " of value %c, " #max " of value %c]", (char)(value), (char)(min), (char)(max)))
+    _FOSSIL_TEST_CHECK_NOT_WITHIN_RANGE_CCHAR(FOSSIL_TEST_ASSUME_AS, value, min, max)
+#define _FOSSIL_TEST_CHECK_NOT_WITHIN_RANGE_CCHAR(dispatch, value, min, max) \
+    dispatch(FOSSIL_MAIP_CAUSE_RANGE, FOSSIL_MAIP_OP_OUTSIDE, (char)(value) < (char)(min) || (char)(value) > (char)(max), _FOSSIL_TEST_ASSUME_MESSAGE("Value " #value " of value %c is within range [" #min " of value %c, " #max " of value %c]", (char)(value), (char)(min), (char)(max)))
 
 // **************************************************
 //
@@ -2330,7 +2826,9 @@ extern "C" {
  * @param expected The expected C string.
  */
 #define ASSUME_ITS_EQUAL_CSTR(actual, expected) \
-    FOSSIL_TEST_ASSUME(strcmp((actual), (expected)) == 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected C string " #actual " of value \"%s\" to be equal to " #expected " of value \"%s\"", (actual), (expected)))
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_CSTR(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_EQUAL_CSTR(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_STRING, FOSSIL_MAIP_OP_EQ, strcmp((actual), (expected)) == 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected C string " #actual " of value \"%s\" to be equal to " #expected " of value \"%s\"", (actual), (expected)))
 
 /**
  * @brief Assumes that the given C strings are not equal.
@@ -2339,7 +2837,9 @@ extern "C" {
  * @param expected The expected C string.
  */
 #define ASSUME_NOT_EQUAL_CSTR(actual, expected) \
-    FOSSIL_TEST_ASSUME(strcmp((actual), (expected)) != 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected C string " #actual " of value \"%s\" to not be equal to " #expected " of value \"%s\"", (actual), (expected)))
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_CSTR(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_EQUAL_CSTR(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_STRING, FOSSIL_MAIP_OP_NE, strcmp((actual), (expected)) != 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected C string " #actual " of value \"%s\" to not be equal to " #expected " of value \"%s\"", (actual), (expected)))
 
 /**
  * @brief Assumes that the length of the given C string is equal to the expected length.
@@ -2348,7 +2848,9 @@ extern "C" {
  * @param expected_len The expected length of the C string.
  */
 #define ASSUME_ITS_LENGTH_EQUAL_CSTR(actual, expected_len) \
-    FOSSIL_TEST_ASSUME(strlen((actual)) == (expected_len), _FOSSIL_TEST_ASSUME_MESSAGE("Expected length of C string " #actual " of value \"%s\" to be equal to " #expected_len " of value %zu", (actual), (expected_len)))
+    _FOSSIL_TEST_CHECK_ITS_LENGTH_EQUAL_CSTR(FOSSIL_TEST_ASSUME_AS, actual, expected_len)
+#define _FOSSIL_TEST_CHECK_ITS_LENGTH_EQUAL_CSTR(dispatch, actual, expected_len) \
+    dispatch(FOSSIL_MAIP_CAUSE_STRING, FOSSIL_MAIP_OP_EQ, strlen((actual)) == (expected_len), _FOSSIL_TEST_ASSUME_MESSAGE("Expected length of C string " #actual " of value \"%s\" to be equal to " #expected_len " of value %zu", (actual), (expected_len)))
 
 /**
  * @brief Assumes that the length of the given C string is not equal to the expected length.
@@ -2357,7 +2859,9 @@ extern "C" {
  * @param expected_len The expected length of the C string.
  */
 #define ASSUME_NOT_LENGTH_EQUAL_CSTR(actual, expected_len) \
-    FOSSIL_TEST_ASSUME(strlen((actual)) != (expected_len), _FOSSIL_TEST_ASSUME_MESSAGE("Expected length of C string " #actual " of value \"%s\" to not be equal to " #expected_len " of value %zu", (actual), (expected_len)))
+    _FOSSIL_TEST_CHECK_NOT_LENGTH_EQUAL_CSTR(FOSSIL_TEST_ASSUME_AS, actual, expected_len)
+#define _FOSSIL_TEST_CHECK_NOT_LENGTH_EQUAL_CSTR(dispatch, actual, expected_len) \
+    dispatch(FOSSIL_MAIP_CAUSE_STRING, FOSSIL_MAIP_OP_NE, strlen((actual)) != (expected_len), _FOSSIL_TEST_ASSUME_MESSAGE("Expected length of C string " #actual " of value \"%s\" to not be equal to " #expected_len " of value %zu", (actual), (expected_len)))
 
 /**
  * @brief Assumes that the given cstr starts with the specified prefix.
@@ -2366,7 +2870,9 @@ extern "C" {
  * @param prefix The prefix to check for.
  */
 #define ASSUME_ITS_CSTR_STARTS_WITH(str, prefix) \
-    FOSSIL_TEST_ASSUME(maip_io_cstr_starts_with((str), (prefix)), _FOSSIL_TEST_ASSUME_MESSAGE("Expected cstr " #str " of value \"%s\" to start with prefix " #prefix " of value \"%s\"", (str), (prefix)))
+    _FOSSIL_TEST_CHECK_ITS_CSTR_STARTS_WITH(FOSSIL_TEST_ASSUME_AS, str, prefix)
+#define _FOSSIL_TEST_CHECK_ITS_CSTR_STARTS_WITH(dispatch, str, prefix) \
+    dispatch(FOSSIL_MAIP_CAUSE_STRING, FOSSIL_MAIP_OP_IS, maip_io_cstr_starts_with((str), (prefix)), _FOSSIL_TEST_ASSUME_MESSAGE("Expected cstr " #str " of value \"%s\" to start with prefix " #prefix " of value \"%s\"", (str), (prefix)))
 
 /**
  * @brief Assumes that the given cstr does not start with the specified prefix.
@@ -2375,7 +2881,9 @@ extern "C" {
  * @param prefix The prefix to check for.
  */
 #define ASSUME_NOT_CSTR_STARTS_WITH(str, prefix) \
-    FOSSIL_TEST_ASSUME(!maip_io_cstr_starts_with((str), (prefix)), _FOSSIL_TEST_ASSUME_MESSAGE("Expected cstr " #str " of value \"%s\" to not start with prefix " #prefix " of value \"%s\"", (str), (prefix)))
+    _FOSSIL_TEST_CHECK_NOT_CSTR_STARTS_WITH(FOSSIL_TEST_ASSUME_AS, str, prefix)
+#define _FOSSIL_TEST_CHECK_NOT_CSTR_STARTS_WITH(dispatch, str, prefix) \
+    dispatch(FOSSIL_MAIP_CAUSE_STRING, FOSSIL_MAIP_OP_IS_NOT, !maip_io_cstr_starts_with((str), (prefix)), _FOSSIL_TEST_ASSUME_MESSAGE("Expected cstr " #str " of value \"%s\" to not start with prefix " #prefix " of value \"%s\"", (str), (prefix)))
 
 /**
  * @brief Assumes that the given cstr ends with the specified suffix.
@@ -2384,7 +2892,9 @@ extern "C" {
  * @param suffix The suffix to check for.
  */
 #define ASSUME_ITS_CSTR_ENDS_WITH(str, suffix) \
-    FOSSIL_TEST_ASSUME(maip_io_cstr_ends_with((str), (suffix)), _FOSSIL_TEST_ASSUME_MESSAGE("Expected cstr " #str " of value \"%s\" to end with suffix " #suffix " of value \"%s\"", (str), (suffix)))
+    _FOSSIL_TEST_CHECK_ITS_CSTR_ENDS_WITH(FOSSIL_TEST_ASSUME_AS, str, suffix)
+#define _FOSSIL_TEST_CHECK_ITS_CSTR_ENDS_WITH(dispatch, str, suffix) \
+    dispatch(FOSSIL_MAIP_CAUSE_STRING, FOSSIL_MAIP_OP_IS, maip_io_cstr_ends_with((str), (suffix)), _FOSSIL_TEST_ASSUME_MESSAGE("Expected cstr " #str " of value \"%s\" to end with suffix " #suffix " of value \"%s\"", (str), (suffix)))
 
 /**
  * @brief Assumes that the given cstr does not end with the specified suffix.
@@ -2393,7 +2903,9 @@ extern "C" {
  * @param suffix The suffix to check for.
  */
 #define ASSUME_NOT_CSTR_ENDS_WITH(str, suffix) \
-    FOSSIL_TEST_ASSUME(!maip_io_cstr_ends_with((str), (suffix)), _FOSSIL_TEST_ASSUME_MESSAGE("Expected cstr " #str " of value \"%s\" to not end with suffix " #suffix " of value \"%s\"", (str), (suffix)))
+    _FOSSIL_TEST_CHECK_NOT_CSTR_ENDS_WITH(FOSSIL_TEST_ASSUME_AS, str, suffix)
+#define _FOSSIL_TEST_CHECK_NOT_CSTR_ENDS_WITH(dispatch, str, suffix) \
+    dispatch(FOSSIL_MAIP_CAUSE_STRING, FOSSIL_MAIP_OP_IS_NOT, !maip_io_cstr_ends_with((str), (suffix)), _FOSSIL_TEST_ASSUME_MESSAGE("Expected cstr " #str " of value \"%s\" to not end with suffix " #suffix " of value \"%s\"", (str), (suffix)))
 
 /**
  * @brief Assumes that the given cstr contains the specified substring.
@@ -2402,7 +2914,9 @@ extern "C" {
  * @param substr The substring to check for.
  */
 #define ASSUME_ITS_CSTR_CONTAINS(str, substr) \
-    FOSSIL_TEST_ASSUME(maip_io_cstr_contains((str), (substr)), _FOSSIL_TEST_ASSUME_MESSAGE("Expected cstr " #str " of value \"%s\" to contain substring " #substr " of value \"%s\"", (str), (substr)))
+    _FOSSIL_TEST_CHECK_ITS_CSTR_CONTAINS(FOSSIL_TEST_ASSUME_AS, str, substr)
+#define _FOSSIL_TEST_CHECK_ITS_CSTR_CONTAINS(dispatch, str, substr) \
+    dispatch(FOSSIL_MAIP_CAUSE_STRING, FOSSIL_MAIP_OP_IS, maip_io_cstr_contains((str), (substr)), _FOSSIL_TEST_ASSUME_MESSAGE("Expected cstr " #str " of value \"%s\" to contain substring " #substr " of value \"%s\"", (str), (substr)))
 
 /**
  * @brief Assumes that the given cstr does not contain the specified substring.
@@ -2411,7 +2925,9 @@ extern "C" {
  * @param substr The substring to check for.
  */
 #define ASSUME_NOT_CSTR_CONTAINS(str, substr) \
-    FOSSIL_TEST_ASSUME(!maip_io_cstr_contains((str), (substr)), _FOSSIL_TEST_ASSUME_MESSAGE("Expected cstr " #str " of value \"%s\" to not contain substring " #substr " of value \"%s\"", (str), (substr)))
+    _FOSSIL_TEST_CHECK_NOT_CSTR_CONTAINS(FOSSIL_TEST_ASSUME_AS, str, substr)
+#define _FOSSIL_TEST_CHECK_NOT_CSTR_CONTAINS(dispatch, str, substr) \
+    dispatch(FOSSIL_MAIP_CAUSE_STRING, FOSSIL_MAIP_OP_IS_NOT, !maip_io_cstr_contains((str), (substr)), _FOSSIL_TEST_ASSUME_MESSAGE("Expected cstr " #str " of value \"%s\" to not contain substring " #substr " of value \"%s\"", (str), (substr)))
 
 /**
  * @brief Assumes that the given cstr contains the specified number of occurrences of a substring.
@@ -2421,7 +2937,9 @@ extern "C" {
  * @param count The expected number of occurrences.
  */
 #define ASSUME_ITS_CSTR_COUNT(str, substr, count) \
-    FOSSIL_TEST_ASSUME(maip_io_cstr_count((str), (substr)) == (count), _FOSSIL_TEST_ASSUME_MESSAGE("Expected cstr " #str " of value \"%s\" to contain " #count " occurrences of substring " #substr " of value \"%s\"", (str), (substr), (count)))
+    _FOSSIL_TEST_CHECK_ITS_CSTR_COUNT(FOSSIL_TEST_ASSUME_AS, str, substr, count)
+#define _FOSSIL_TEST_CHECK_ITS_CSTR_COUNT(dispatch, str, substr, count) \
+    dispatch(FOSSIL_MAIP_CAUSE_STRING, FOSSIL_MAIP_OP_EQ, maip_io_cstr_count((str), (substr)) == (count), _FOSSIL_TEST_ASSUME_MESSAGE("Expected cstr " #str " of value \"%s\" to contain " #count " occurrences of substring " #substr " of value \"%s\"", (str), (substr), (count)))
 
 /**
  * @brief Assumes that the given cstr does not contain the specified number of occurrences of a substring.
@@ -2431,7 +2949,9 @@ extern "C" {
  * @param count The expected number of occurrences.
  */
 #define ASSUME_NOT_CSTR_COUNT(str, substr, count) \
-    FOSSIL_TEST_ASSUME(maip_io_cstr_count((str), (substr)) != (count), _FOSSIL_TEST_ASSUME_MESSAGE("Expected cstr " #str " of value \"%s\" to not contain " #count " occurrences of substring " #substr " of value \"%s\"", (str), (substr), (count)))
+    _FOSSIL_TEST_CHECK_NOT_CSTR_COUNT(FOSSIL_TEST_ASSUME_AS, str, substr, count)
+#define _FOSSIL_TEST_CHECK_NOT_CSTR_COUNT(dispatch, str, substr, count) \
+    dispatch(FOSSIL_MAIP_CAUSE_STRING, FOSSIL_MAIP_OP_NE, maip_io_cstr_count((str), (substr)) != (count), _FOSSIL_TEST_ASSUME_MESSAGE("Expected cstr " #str " of value \"%s\" to not contain " #count " occurrences of substring " #substr " of value \"%s\"", (str), (substr), (count)))
 
 // **************************************************
 //
@@ -2446,7 +2966,9 @@ extern "C" {
  * @param expected The expected char value.
  */
 #define ASSUME_ITS_EQUAL_CHAR(actual, expected) \
-    FOSSIL_TEST_ASSUME((char)(actual) == (char)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected char " #actual " of value %c to be equal to " #expected " of value %c", (char)(actual), (char)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_CHAR(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_EQUAL_CHAR(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_EQ, (char)(actual) == (char)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected char " #actual " of value %c to be equal to " #expected " of value %c", (char)(actual), (char)(expected)))
 
 /**
  * @brief Assumes that the given char values are not equal.
@@ -2455,7 +2977,9 @@ extern "C" {
  * @param expected The expected char value.
  */
 #define ASSUME_NOT_EQUAL_CHAR(actual, expected) \
-    FOSSIL_TEST_ASSUME((char)(actual) != (char)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected char " #actual " of value %c to not be equal to " #expected " of value %c", (char)(actual), (char)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_CHAR(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_EQUAL_CHAR(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_NE, (char)(actual) != (char)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected char " #actual " of value %c to not be equal to " #expected " of value %c", (char)(actual), (char)(expected)))
 
 /**
  * @brief Assumes that the given char value is less than the expected value.
@@ -2464,7 +2988,9 @@ extern "C" {
  * @param expected The expected char value.
  */
 #define ASSUME_ITS_LESS_THAN_CHAR(actual, expected) \
-    FOSSIL_TEST_ASSUME((char)(actual) < (char)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected char " #actual " of value %c to be less than " #expected " of value %c", (char)(actual), (char)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_LESS_THAN_CHAR(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_LESS_THAN_CHAR(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LT, (char)(actual) < (char)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected char " #actual " of value %c to be less than " #expected " of value %c", (char)(actual), (char)(expected)))
 
 /**
  * @brief Assumes that the given char value is more than the expected value.
@@ -2473,7 +2999,9 @@ extern "C" {
  * @param expected The expected char value.
  */
 #define ASSUME_ITS_MORE_THAN_CHAR(actual, expected) \
-    FOSSIL_TEST_ASSUME((char)(actual) > (char)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected char " #actual " of value %c to be more than " #expected " of value %c", (char)(actual), (char)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_MORE_THAN_CHAR(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_MORE_THAN_CHAR(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GT, (char)(actual) > (char)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected char " #actual " of value %c to be more than " #expected " of value %c", (char)(actual), (char)(expected)))
 
 /**
  * @brief Assumes that the given char value is less than or equal to the expected value.
@@ -2482,7 +3010,9 @@ extern "C" {
  * @param expected The expected char value.
  */
 #define ASSUME_ITS_LESS_OR_EQUAL_CHAR(actual, expected) \
-    FOSSIL_TEST_ASSUME((char)(actual) <= (char)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected char " #actual " of value %c to be less than or equal to " #expected " of value %c", (char)(actual), (char)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_CHAR(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_CHAR(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LE, (char)(actual) <= (char)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected char " #actual " of value %c to be less than or equal to " #expected " of value %c", (char)(actual), (char)(expected)))
 
 /**
  * @brief Assumes that the given char value is more than or equal to the expected value.
@@ -2491,7 +3021,9 @@ extern "C" {
  * @param expected The expected char value.
  */
 #define ASSUME_ITS_MORE_OR_EQUAL_CHAR(actual, expected) \
-    FOSSIL_TEST_ASSUME((char)(actual) >= (char)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected char " #actual " of value %c to be more than or equal to " #expected " of value %c", (char)(actual), (char)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_CHAR(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_CHAR(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GE, (char)(actual) >= (char)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected char " #actual " of value %c to be more than or equal to " #expected " of value %c", (char)(actual), (char)(expected)))
 
 /**
  * @brief Assumes that the given char value is not less than the expected value.
@@ -2500,7 +3032,9 @@ extern "C" {
  * @param expected The expected char value.
  */
 #define ASSUME_NOT_LESS_THAN_CHAR(actual, expected) \
-    FOSSIL_TEST_ASSUME((char)(actual) >= (char)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected char " #actual " of value %c to not be less than " #expected " of value %c", (char)(actual), (char)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_LESS_THAN_CHAR(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_LESS_THAN_CHAR(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GE, (char)(actual) >= (char)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected char " #actual " of value %c to not be less than " #expected " of value %c", (char)(actual), (char)(expected)))
 
 /**
  * @brief Assumes that the given char value is not more than the expected value.
@@ -2509,7 +3043,9 @@ extern "C" {
  * @param expected The expected char value.
  */
 #define ASSUME_NOT_MORE_THAN_CHAR(actual, expected) \
-    FOSSIL_TEST_ASSUME((char)(actual) <= (char)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected char " #actual " of value %c to not be more than " #expected " of value %c", (char)(actual), (char)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_MORE_THAN_CHAR(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_MORE_THAN_CHAR(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LE, (char)(actual) <= (char)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected char " #actual " of value %c to not be more than " #expected " of value %c", (char)(actual), (char)(expected)))
 
 /**
  * @brief Assumes that the given char value is not less than or equal to the expected value.
@@ -2518,7 +3054,9 @@ extern "C" {
  * @param expected The expected char value.
  */
 #define ASSUME_NOT_LESS_OR_EQUAL_CHAR(actual, expected) \
-    FOSSIL_TEST_ASSUME((char)(actual) > (char)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected char " #actual " of value %c to not be less than or equal to " #expected " of value %c", (char)(actual), (char)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_CHAR(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_CHAR(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_GT, (char)(actual) > (char)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected char " #actual " of value %c to not be less than or equal to " #expected " of value %c", (char)(actual), (char)(expected)))
 
 /**
  * @brief Assumes that the given char value is not more than or equal to the expected value.
@@ -2527,7 +3065,9 @@ extern "C" {
  * @param expected The expected char value.
  */
 #define ASSUME_NOT_MORE_OR_EQUAL_CHAR(actual, expected) \
-    FOSSIL_TEST_ASSUME((char)(actual) < (char)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected char " #actual " of value %c to not be more than or equal to " #expected " of value %c", (char)(actual), (char)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_CHAR(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_CHAR(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_LT, (char)(actual) < (char)(expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected char " #actual " of value %c to not be more than or equal to " #expected " of value %c", (char)(actual), (char)(expected)))
 
 // **************************************************
 // SOAP assumptions
@@ -2539,7 +3079,9 @@ extern "C" {
  * @param text The input text to check.
  */
 #define ASSUME_NOT_SOAP_ROT_BRAIN(text) \
-    FOSSIL_TEST_ASSUME(!maip_io_is_rot_brain((text)), _FOSSIL_TEST_ASSUME_MESSAGE("Expected text " #text " of value \"%s\" to not contain 'rot-brain' language", (text)))
+    _FOSSIL_TEST_CHECK_NOT_SOAP_ROT_BRAIN(FOSSIL_TEST_ASSUME_AS, text)
+#define _FOSSIL_TEST_CHECK_NOT_SOAP_ROT_BRAIN(dispatch, text) \
+    dispatch(FOSSIL_MAIP_CAUSE_TEXT, FOSSIL_MAIP_OP_IS_NOT, !maip_io_is_rot_brain((text)), _FOSSIL_TEST_ASSUME_MESSAGE("Expected text " #text " of value \"%s\" to not contain 'rot-brain' language", (text)))
 
 /**
  * @brief Assumes that the given text contains "rot-brain" language.
@@ -2547,7 +3089,9 @@ extern "C" {
  * @param text The input text to check.
  */
 #define ASSUME_ITS_SOAP_ROT_BRAIN(text) \
-    FOSSIL_TEST_ASSUME(maip_io_is_rot_brain((text)), _FOSSIL_TEST_ASSUME_MESSAGE("Expected text " #text " of value \"%s\" to contain 'rot-brain' language", (text)))
+    _FOSSIL_TEST_CHECK_ITS_SOAP_ROT_BRAIN(FOSSIL_TEST_ASSUME_AS, text)
+#define _FOSSIL_TEST_CHECK_ITS_SOAP_ROT_BRAIN(dispatch, text) \
+    dispatch(FOSSIL_MAIP_CAUSE_TEXT, FOSSIL_MAIP_OP_IS, maip_io_is_rot_brain((text)), _FOSSIL_TEST_ASSUME_MESSAGE("Expected text " #text " of value \"%s\" to contain 'rot-brain' language", (text)))
 
 /**
  * @brief Assumes that the tone of the given sentence is detected correctly.
@@ -2556,7 +3100,9 @@ extern "C" {
  * @param expected_tone The expected tone ("formal", "casual", "sarcastic", etc.).
  */
 #define ASSUME_ITS_SOAP_TONE_DETECTED(text, expected_tone) \
-    FOSSIL_TEST_ASSUME(strcmp(maip_io_soap_detect_tone((text)), (expected_tone)) == 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected tone of text " #text " of value \"%s\" to be " #expected_tone " of value \"%s\"", (text), (expected_tone)))
+    _FOSSIL_TEST_CHECK_ITS_SOAP_TONE_DETECTED(FOSSIL_TEST_ASSUME_AS, text, expected_tone)
+#define _FOSSIL_TEST_CHECK_ITS_SOAP_TONE_DETECTED(dispatch, text, expected_tone) \
+    dispatch(FOSSIL_MAIP_CAUSE_TEXT, FOSSIL_MAIP_OP_IS, strcmp(maip_io_soap_detect_tone((text)), (expected_tone)) == 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected tone of text " #text " of value \"%s\" to be " #expected_tone " of value \"%s\"", (text), (expected_tone)))
 
 /**
  * @brief Assumes that the tone of the given sentence is not detected correctly.
@@ -2565,7 +3111,9 @@ extern "C" {
  * @param expected_tone The expected tone ("formal", "casual", "sarcastic", etc.).
  */
 #define ASSUME_NOT_SOAP_TONE_DETECTED(text, expected_tone) \
-    FOSSIL_TEST_ASSUME(strcmp(maip_io_soap_detect_tone((text)), (expected_tone)) != 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected tone of text " #text " of value \"%s\" to not be " #expected_tone " of value \"%s\"", (text), (expected_tone)))
+    _FOSSIL_TEST_CHECK_NOT_SOAP_TONE_DETECTED(FOSSIL_TEST_ASSUME_AS, text, expected_tone)
+#define _FOSSIL_TEST_CHECK_NOT_SOAP_TONE_DETECTED(dispatch, text, expected_tone) \
+    dispatch(FOSSIL_MAIP_CAUSE_TEXT, FOSSIL_MAIP_OP_IS_NOT, strcmp(maip_io_soap_detect_tone((text)), (expected_tone)) != 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected tone of text " #text " of value \"%s\" to not be " #expected_tone " of value \"%s\"", (text), (expected_tone)))
 
 // **************************************************
 // Time assumptions
@@ -2579,7 +3127,9 @@ extern "C" {
  * @param tolerance_ns The tolerance in nanoseconds.
  */
 #define ASSUME_ITS_TIME_WITHIN_TOLERANCE(elapsed_ns, expected_ns, tolerance_ns) \
-    FOSSIL_TEST_ASSUME(llabs((int64_t)(elapsed_ns) - (int64_t)(expected_ns)) <= (int64_t)(tolerance_ns), _FOSSIL_TEST_ASSUME_MESSAGE("Expected elapsed time %lld ns to be within %lld ns of expected %lld ns", (int64_t)(elapsed_ns), (int64_t)(tolerance_ns), (int64_t)(expected_ns)))
+    _FOSSIL_TEST_CHECK_ITS_TIME_WITHIN_TOLERANCE(FOSSIL_TEST_ASSUME_AS, elapsed_ns, expected_ns, tolerance_ns)
+#define _FOSSIL_TEST_CHECK_ITS_TIME_WITHIN_TOLERANCE(dispatch, elapsed_ns, expected_ns, tolerance_ns) \
+    dispatch(FOSSIL_MAIP_CAUSE_TIMEOUT, FOSSIL_MAIP_OP_WITHIN, llabs((int64_t)(elapsed_ns) - (int64_t)(expected_ns)) <= (int64_t)(tolerance_ns), _FOSSIL_TEST_ASSUME_MESSAGE("Expected elapsed time %lld ns to be within %lld ns of expected %lld ns", (int64_t)(elapsed_ns), (int64_t)(tolerance_ns), (int64_t)(expected_ns)))
 
 /**
  * @brief Assumes that the given elapsed time exceeds a minimum threshold.
@@ -2588,7 +3138,9 @@ extern "C" {
  * @param min_ns The minimum expected time in nanoseconds.
  */
 #define ASSUME_ITS_TIME_AT_LEAST(elapsed_ns, min_ns) \
-    FOSSIL_TEST_ASSUME((int64_t)(elapsed_ns) >= (int64_t)(min_ns), _FOSSIL_TEST_ASSUME_MESSAGE("Expected elapsed time %lld ns to be at least %lld ns", (int64_t)(elapsed_ns), (int64_t)(min_ns)))
+    _FOSSIL_TEST_CHECK_ITS_TIME_AT_LEAST(FOSSIL_TEST_ASSUME_AS, elapsed_ns, min_ns)
+#define _FOSSIL_TEST_CHECK_ITS_TIME_AT_LEAST(dispatch, elapsed_ns, min_ns) \
+    dispatch(FOSSIL_MAIP_CAUSE_TIMEOUT, FOSSIL_MAIP_OP_GE, (int64_t)(elapsed_ns) >= (int64_t)(min_ns), _FOSSIL_TEST_ASSUME_MESSAGE("Expected elapsed time %lld ns to be at least %lld ns", (int64_t)(elapsed_ns), (int64_t)(min_ns)))
 
 /**
  * @brief Assumes that the given elapsed time does not exceed a maximum threshold.
@@ -2597,7 +3149,9 @@ extern "C" {
  * @param max_ns The maximum expected time in nanoseconds.
  */
 #define ASSUME_ITS_TIME_AT_MOST(elapsed_ns, max_ns) \
-    FOSSIL_TEST_ASSUME((int64_t)(elapsed_ns) <= (int64_t)(max_ns), _FOSSIL_TEST_ASSUME_MESSAGE("Expected elapsed time %lld ns to be at most %lld ns", (int64_t)(elapsed_ns), (int64_t)(max_ns)))
+    _FOSSIL_TEST_CHECK_ITS_TIME_AT_MOST(FOSSIL_TEST_ASSUME_AS, elapsed_ns, max_ns)
+#define _FOSSIL_TEST_CHECK_ITS_TIME_AT_MOST(dispatch, elapsed_ns, max_ns) \
+    dispatch(FOSSIL_MAIP_CAUSE_TIMEOUT, FOSSIL_MAIP_OP_LE, (int64_t)(elapsed_ns) <= (int64_t)(max_ns), _FOSSIL_TEST_ASSUME_MESSAGE("Expected elapsed time %lld ns to be at most %lld ns", (int64_t)(elapsed_ns), (int64_t)(max_ns)))
 
 /**
  * @brief Assumes that elapsed time falls within a range (min to max inclusive).
@@ -2607,7 +3161,9 @@ extern "C" {
  * @param max_ns The maximum expected time in nanoseconds.
  */
 #define ASSUME_ITS_TIME_WITHIN_RANGE(elapsed_ns, min_ns, max_ns) \
-    FOSSIL_TEST_ASSUME((int64_t)(elapsed_ns) >= (int64_t)(min_ns) && (int64_t)(elapsed_ns) <= (int64_t)(max_ns), _FOSSIL_TEST_ASSUME_MESSAGE("Expected elapsed time %lld ns to be within range [%lld ns, %lld ns]", (int64_t)(elapsed_ns), (int64_t)(min_ns), (int64_t)(max_ns)))
+    _FOSSIL_TEST_CHECK_ITS_TIME_WITHIN_RANGE(FOSSIL_TEST_ASSUME_AS, elapsed_ns, min_ns, max_ns)
+#define _FOSSIL_TEST_CHECK_ITS_TIME_WITHIN_RANGE(dispatch, elapsed_ns, min_ns, max_ns) \
+    dispatch(FOSSIL_MAIP_CAUSE_TIMEOUT, FOSSIL_MAIP_OP_WITHIN, (int64_t)(elapsed_ns) >= (int64_t)(min_ns) && (int64_t)(elapsed_ns) <= (int64_t)(max_ns), _FOSSIL_TEST_ASSUME_MESSAGE("Expected elapsed time %lld ns to be within range [%lld ns, %lld ns]", (int64_t)(elapsed_ns), (int64_t)(min_ns), (int64_t)(max_ns)))
 
 /**
  * @brief Assumes that the first elapsed time is faster than the second (relative performance).
@@ -2616,7 +3172,9 @@ extern "C" {
  * @param elapsed_ns_2 The second elapsed time in nanoseconds.
  */
 #define ASSUME_ITS_TIME_FASTER_THAN(elapsed_ns_1, elapsed_ns_2) \
-    FOSSIL_TEST_ASSUME((int64_t)(elapsed_ns_1) < (int64_t)(elapsed_ns_2), _FOSSIL_TEST_ASSUME_MESSAGE("Expected elapsed time %lld ns to be faster than %lld ns", (int64_t)(elapsed_ns_1), (int64_t)(elapsed_ns_2)))
+    _FOSSIL_TEST_CHECK_ITS_TIME_FASTER_THAN(FOSSIL_TEST_ASSUME_AS, elapsed_ns_1, elapsed_ns_2)
+#define _FOSSIL_TEST_CHECK_ITS_TIME_FASTER_THAN(dispatch, elapsed_ns_1, elapsed_ns_2) \
+    dispatch(FOSSIL_MAIP_CAUSE_TIMEOUT, FOSSIL_MAIP_OP_LT, (int64_t)(elapsed_ns_1) < (int64_t)(elapsed_ns_2), _FOSSIL_TEST_ASSUME_MESSAGE("Expected elapsed time %lld ns to be faster than %lld ns", (int64_t)(elapsed_ns_1), (int64_t)(elapsed_ns_2)))
 
 /**
  * @brief Assumes that the first elapsed time is slower than the second (relative performance).
@@ -2625,7 +3183,9 @@ extern "C" {
  * @param elapsed_ns_2 The second elapsed time in nanoseconds.
  */
 #define ASSUME_ITS_TIME_SLOWER_THAN(elapsed_ns_1, elapsed_ns_2) \
-    FOSSIL_TEST_ASSUME((int64_t)(elapsed_ns_1) > (int64_t)(elapsed_ns_2), _FOSSIL_TEST_ASSUME_MESSAGE("Expected elapsed time %lld ns to be slower than %lld ns", (int64_t)(elapsed_ns_1), (int64_t)(elapsed_ns_2)))
+    _FOSSIL_TEST_CHECK_ITS_TIME_SLOWER_THAN(FOSSIL_TEST_ASSUME_AS, elapsed_ns_1, elapsed_ns_2)
+#define _FOSSIL_TEST_CHECK_ITS_TIME_SLOWER_THAN(dispatch, elapsed_ns_1, elapsed_ns_2) \
+    dispatch(FOSSIL_MAIP_CAUSE_TIMEOUT, FOSSIL_MAIP_OP_GT, (int64_t)(elapsed_ns_1) > (int64_t)(elapsed_ns_2), _FOSSIL_TEST_ASSUME_MESSAGE("Expected elapsed time %lld ns to be slower than %lld ns", (int64_t)(elapsed_ns_1), (int64_t)(elapsed_ns_2)))
 
 /**
  * @brief Assumes that elapsed times are equivalent within a tolerance (for benchmarking).
@@ -2635,7 +3195,9 @@ extern "C" {
  * @param tolerance_ns The tolerance in nanoseconds.
  */
 #define ASSUME_ITS_TIME_EQUIVALENT(elapsed_ns_1, elapsed_ns_2, tolerance_ns) \
-    FOSSIL_TEST_ASSUME(llabs((int64_t)(elapsed_ns_1) - (int64_t)(elapsed_ns_2)) <= (int64_t)(tolerance_ns), _FOSSIL_TEST_ASSUME_MESSAGE("Expected elapsed times %lld ns and %lld ns to be equivalent within tolerance %lld ns", (int64_t)(elapsed_ns_1), (int64_t)(elapsed_ns_2), (int64_t)(tolerance_ns)))
+    _FOSSIL_TEST_CHECK_ITS_TIME_EQUIVALENT(FOSSIL_TEST_ASSUME_AS, elapsed_ns_1, elapsed_ns_2, tolerance_ns)
+#define _FOSSIL_TEST_CHECK_ITS_TIME_EQUIVALENT(dispatch, elapsed_ns_1, elapsed_ns_2, tolerance_ns) \
+    dispatch(FOSSIL_MAIP_CAUSE_TIMEOUT, FOSSIL_MAIP_OP_EQ, llabs((int64_t)(elapsed_ns_1) - (int64_t)(elapsed_ns_2)) <= (int64_t)(tolerance_ns), _FOSSIL_TEST_ASSUME_MESSAGE("Expected elapsed times %lld ns and %lld ns to be equivalent within tolerance %lld ns", (int64_t)(elapsed_ns_1), (int64_t)(elapsed_ns_2), (int64_t)(tolerance_ns)))
 
 /**
  * @brief Assumes that monotonic time is advancing (sanity check).
@@ -2644,7 +3206,9 @@ extern "C" {
  * @param time_after_ns The time captured after the operation.
  */
 #define ASSUME_ITS_TIME_MONOTONIC(time_before_ns, time_after_ns) \
-    FOSSIL_TEST_ASSUME((int64_t)(time_after_ns) >= (int64_t)(time_before_ns), _FOSSIL_TEST_ASSUME_MESSAGE("Expected monotonic time: after (%lld ns) >= before (%lld ns)", (int64_t)(time_after_ns), (int64_t)(time_before_ns)))
+    _FOSSIL_TEST_CHECK_ITS_TIME_MONOTONIC(FOSSIL_TEST_ASSUME_AS, time_before_ns, time_after_ns)
+#define _FOSSIL_TEST_CHECK_ITS_TIME_MONOTONIC(dispatch, time_before_ns, time_after_ns) \
+    dispatch(FOSSIL_MAIP_CAUSE_TIMEOUT, FOSSIL_MAIP_OP_IS, (int64_t)(time_after_ns) >= (int64_t)(time_before_ns), _FOSSIL_TEST_ASSUME_MESSAGE("Expected monotonic time: after (%lld ns) >= before (%lld ns)", (int64_t)(time_after_ns), (int64_t)(time_before_ns)))
 
 /**
  * @brief Assumes that a deadline has been met (elapsed time <= deadline).
@@ -2653,7 +3217,9 @@ extern "C" {
  * @param deadline_ns The deadline in nanoseconds.
  */
 #define ASSUME_ITS_DEADLINE_MET(elapsed_ns, deadline_ns) \
-    FOSSIL_TEST_ASSUME((int64_t)(elapsed_ns) <= (int64_t)(deadline_ns), _FOSSIL_TEST_ASSUME_MESSAGE("Expected elapsed time %lld ns to meet deadline of %lld ns", (int64_t)(elapsed_ns), (int64_t)(deadline_ns)))
+    _FOSSIL_TEST_CHECK_ITS_DEADLINE_MET(FOSSIL_TEST_ASSUME_AS, elapsed_ns, deadline_ns)
+#define _FOSSIL_TEST_CHECK_ITS_DEADLINE_MET(dispatch, elapsed_ns, deadline_ns) \
+    dispatch(FOSSIL_MAIP_CAUSE_TIMEOUT, FOSSIL_MAIP_OP_IS, (int64_t)(elapsed_ns) <= (int64_t)(deadline_ns), _FOSSIL_TEST_ASSUME_MESSAGE("Expected elapsed time %lld ns to meet deadline of %lld ns", (int64_t)(elapsed_ns), (int64_t)(deadline_ns)))
 
 /**
  * @brief Assumes that a deadline has been missed (elapsed time > deadline).
@@ -2662,7 +3228,9 @@ extern "C" {
  * @param deadline_ns The deadline in nanoseconds.
  */
 #define ASSUME_ITS_DEADLINE_MISSED(elapsed_ns, deadline_ns) \
-    FOSSIL_TEST_ASSUME((int64_t)(elapsed_ns) > (int64_t)(deadline_ns), _FOSSIL_TEST_ASSUME_MESSAGE("Expected elapsed time %lld ns to exceed deadline of %lld ns", (int64_t)(elapsed_ns), (int64_t)(deadline_ns)))
+    _FOSSIL_TEST_CHECK_ITS_DEADLINE_MISSED(FOSSIL_TEST_ASSUME_AS, elapsed_ns, deadline_ns)
+#define _FOSSIL_TEST_CHECK_ITS_DEADLINE_MISSED(dispatch, elapsed_ns, deadline_ns) \
+    dispatch(FOSSIL_MAIP_CAUSE_TIMEOUT, FOSSIL_MAIP_OP_IS, (int64_t)(elapsed_ns) > (int64_t)(deadline_ns), _FOSSIL_TEST_ASSUME_MESSAGE("Expected elapsed time %lld ns to exceed deadline of %lld ns", (int64_t)(elapsed_ns), (int64_t)(deadline_ns)))
 
 // **************************************************
 // Hash assumptions
@@ -2675,7 +3243,9 @@ extern "C" {
  * @param expected The expected hash value.
  */
 #define ASSUME_ITS_EQUAL_HASH(actual, expected) \
-    FOSSIL_TEST_ASSUME((actual) == (expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected hash " #actual " of value %llu to be equal to " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_HASH(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_EQUAL_HASH(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_EQ, (actual) == (expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected hash " #actual " of value %llu to be equal to " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
 
 /**
  * @brief Assumes that the given hash values are not equal.
@@ -2684,7 +3254,9 @@ extern "C" {
  * @param expected The expected hash value.
  */
 #define ASSUME_NOT_EQUAL_HASH(actual, expected) \
-    FOSSIL_TEST_ASSUME((actual) != (expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected hash " #actual " of value %llu to not be equal to " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_HASH(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_EQUAL_HASH(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_NE, (actual) != (expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected hash " #actual " of value %llu to not be equal to " #expected " of value %llu", (uint64_t)(actual), (uint64_t)(expected)))
 
 /**
  * @brief Assumes that the given hash value is valid (non-zero).
@@ -2692,7 +3264,9 @@ extern "C" {
  * @param hash The hash value to check.
  */
 #define ASSUME_ITS_VALID_HASH(hash) \
-    FOSSIL_TEST_ASSUME((hash) != 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected hash " #hash " of value %llu to be valid (non-zero)", (uint64_t)(hash)))
+    _FOSSIL_TEST_CHECK_ITS_VALID_HASH(FOSSIL_TEST_ASSUME_AS, hash)
+#define _FOSSIL_TEST_CHECK_ITS_VALID_HASH(dispatch, hash) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_IS, (hash) != 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected hash " #hash " of value %llu to be valid (non-zero)", (uint64_t)(hash)))
 
 /**
  * @brief Assumes that the given hash value is not valid (zero).
@@ -2700,7 +3274,9 @@ extern "C" {
  * @param hash The hash value to check.
  */
 #define ASSUME_NOT_VALID_HASH(hash) \
-    FOSSIL_TEST_ASSUME((hash) == 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected hash " #hash " of value %llu to not be valid (zero)", (uint64_t)(hash)))
+    _FOSSIL_TEST_CHECK_NOT_VALID_HASH(FOSSIL_TEST_ASSUME_AS, hash)
+#define _FOSSIL_TEST_CHECK_NOT_VALID_HASH(dispatch, hash) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_IS_NOT, (hash) == 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected hash " #hash " of value %llu to not be valid (zero)", (uint64_t)(hash)))
 
 /**
  * @brief Assumes that the given hash values are equal using byte array comparison.
@@ -2713,7 +3289,9 @@ extern "C" {
  * @param size The size of the hash in bytes.
  */
 #define ASSUME_ITS_EQUAL_HASH_BYTES(actual, expected, size) \
-    FOSSIL_TEST_ASSUME(maip_sys_memory_compare((actual), (expected), (size)) == 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected hash bytes " #actual " to be equal to " #expected " for size %zu bytes", (size)))
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_HASH_BYTES(FOSSIL_TEST_ASSUME_AS, actual, expected, size)
+#define _FOSSIL_TEST_CHECK_ITS_EQUAL_HASH_BYTES(dispatch, actual, expected, size) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_EQ, maip_sys_memory_compare((actual), (expected), (size)) == 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected hash bytes " #actual " to be equal to " #expected " for size %zu bytes", (size)))
 
 /**
  * @brief Assumes that the given hash byte arrays are not equal.
@@ -2723,7 +3301,9 @@ extern "C" {
  * @param size The size of the hash in bytes.
  */
 #define ASSUME_NOT_EQUAL_HASH_BYTES(actual, expected, size) \
-    FOSSIL_TEST_ASSUME(maip_sys_memory_compare((actual), (expected), (size)) != 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected hash bytes " #actual " to not be equal to " #expected " for size %zu bytes", (size)))
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_HASH_BYTES(FOSSIL_TEST_ASSUME_AS, actual, expected, size)
+#define _FOSSIL_TEST_CHECK_NOT_EQUAL_HASH_BYTES(dispatch, actual, expected, size) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_NE, maip_sys_memory_compare((actual), (expected), (size)) != 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected hash bytes " #actual " to not be equal to " #expected " for size %zu bytes", (size)))
 
 /**
  * @brief Assumes that the given hash is deterministic by comparing two computations.
@@ -2735,7 +3315,9 @@ extern "C" {
  * @param hash2 The second hash computation result (from identical input).
  */
 #define ASSUME_ITS_DETERMINISTIC_HASH(hash1, hash2) \
-    FOSSIL_TEST_ASSUME((hash1) == (hash2), _FOSSIL_TEST_ASSUME_MESSAGE("Expected hash computations to be deterministic: " #hash1 " (0x%llx) == " #hash2 " (0x%llx)", (uint64_t)(hash1), (uint64_t)(hash2)))
+    _FOSSIL_TEST_CHECK_ITS_DETERMINISTIC_HASH(FOSSIL_TEST_ASSUME_AS, hash1, hash2)
+#define _FOSSIL_TEST_CHECK_ITS_DETERMINISTIC_HASH(dispatch, hash1, hash2) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_IS, (hash1) == (hash2), _FOSSIL_TEST_ASSUME_MESSAGE("Expected hash computations to be deterministic: " #hash1 " (0x%llx) == " #hash2 " (0x%llx)", (uint64_t)(hash1), (uint64_t)(hash2)))
 
 /**
  * @brief Assumes that hash collision resistance by verifying two different inputs produce different hashes.
@@ -2747,7 +3329,9 @@ extern "C" {
  * @param hash2 Hash of second (different) input.
  */
 #define ASSUME_ITS_HASH_COLLISION_RESISTANT(hash1, hash2) \
-    FOSSIL_TEST_ASSUME((hash1) != (hash2), _FOSSIL_TEST_ASSUME_MESSAGE("Expected different inputs to produce different hashes: hash1 (0x%llx) != hash2 (0x%llx)", (uint64_t)(hash1), (uint64_t)(hash2)))
+    _FOSSIL_TEST_CHECK_ITS_HASH_COLLISION_RESISTANT(FOSSIL_TEST_ASSUME_AS, hash1, hash2)
+#define _FOSSIL_TEST_CHECK_ITS_HASH_COLLISION_RESISTANT(dispatch, hash1, hash2) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_IS, (hash1) != (hash2), _FOSSIL_TEST_ASSUME_MESSAGE("Expected different inputs to produce different hashes: hash1 (0x%llx) != hash2 (0x%llx)", (uint64_t)(hash1), (uint64_t)(hash2)))
 
 /**
  * @brief Assumes that the given hash is within the expected entropy distribution.
@@ -2758,7 +3342,9 @@ extern "C" {
  * @param hash The hash value to validate.
  */
 #define ASSUME_ITS_HASH_DISTRIBUTED(hash) \
-    FOSSIL_TEST_ASSUME((hash) != 0 && (hash) != UINT64_MAX, _FOSSIL_TEST_ASSUME_MESSAGE("Expected hash " #hash " of value 0x%llx to have reasonable entropy distribution", (uint64_t)(hash)))
+    _FOSSIL_TEST_CHECK_ITS_HASH_DISTRIBUTED(FOSSIL_TEST_ASSUME_AS, hash)
+#define _FOSSIL_TEST_CHECK_ITS_HASH_DISTRIBUTED(dispatch, hash) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_IS, (hash) != 0 && (hash) != UINT64_MAX, _FOSSIL_TEST_ASSUME_MESSAGE("Expected hash " #hash " of value 0x%llx to have reasonable entropy distribution", (uint64_t)(hash)))
 
 // **************************************************
 // Bitwise assumptions
@@ -2771,7 +3357,9 @@ extern "C" {
  * @param flag The bit flag to check for.
  */
 #define ASSUME_ITS_BIT_SET(value, flag) \
-    FOSSIL_TEST_ASSUME(((value) & (flag)) != 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected bit flag " #flag " to be set in value " #value " of value 0x%llx", (uint64_t)(value)))
+    _FOSSIL_TEST_CHECK_ITS_BIT_SET(FOSSIL_TEST_ASSUME_AS, value, flag)
+#define _FOSSIL_TEST_CHECK_ITS_BIT_SET(dispatch, value, flag) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_IS, ((value) & (flag)) != 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected bit flag " #flag " to be set in value " #value " of value 0x%llx", (uint64_t)(value)))
 
 /**
  * @brief Assumes that the given bit flag is not set in the value.
@@ -2780,7 +3368,9 @@ extern "C" {
  * @param flag The bit flag to check for.
  */
 #define ASSUME_NOT_BIT_SET(value, flag) \
-    FOSSIL_TEST_ASSUME(((value) & (flag)) == 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected bit flag " #flag " to not be set in value " #value " of value 0x%llx", (uint64_t)(value)))
+    _FOSSIL_TEST_CHECK_NOT_BIT_SET(FOSSIL_TEST_ASSUME_AS, value, flag)
+#define _FOSSIL_TEST_CHECK_NOT_BIT_SET(dispatch, value, flag) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_IS_NOT, ((value) & (flag)) == 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected bit flag " #flag " to not be set in value " #value " of value 0x%llx", (uint64_t)(value)))
 
 /**
  * @brief Assumes that all bits in the mask are set in the value.
@@ -2789,7 +3379,9 @@ extern "C" {
  * @param mask The bitmask to check for.
  */
 #define ASSUME_ITS_BITMASK_SET(value, mask) \
-    FOSSIL_TEST_ASSUME((((value) & (mask)) == (mask)), _FOSSIL_TEST_ASSUME_MESSAGE("Expected bitmask " #mask " of value 0x%llx to be fully set in value " #value " of value 0x%llx", (uint64_t)(mask), (uint64_t)(value)))
+    _FOSSIL_TEST_CHECK_ITS_BITMASK_SET(FOSSIL_TEST_ASSUME_AS, value, mask)
+#define _FOSSIL_TEST_CHECK_ITS_BITMASK_SET(dispatch, value, mask) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_IS, (((value) & (mask)) == (mask)), _FOSSIL_TEST_ASSUME_MESSAGE("Expected bitmask " #mask " of value 0x%llx to be fully set in value " #value " of value 0x%llx", (uint64_t)(mask), (uint64_t)(value)))
 
 /**
  * @brief Assumes that all bits in the mask are not set in the value.
@@ -2798,7 +3390,9 @@ extern "C" {
  * @param mask The bitmask to check for.
  */
 #define ASSUME_NOT_BITMASK_SET(value, mask) \
-    FOSSIL_TEST_ASSUME((((value) & (mask)) == 0), _FOSSIL_TEST_ASSUME_MESSAGE("Expected bitmask " #mask " of value 0x%llx to not be set in value " #value " of value 0x%llx", (uint64_t)(mask), (uint64_t)(value)))
+    _FOSSIL_TEST_CHECK_NOT_BITMASK_SET(FOSSIL_TEST_ASSUME_AS, value, mask)
+#define _FOSSIL_TEST_CHECK_NOT_BITMASK_SET(dispatch, value, mask) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_IS_NOT, (((value) & (mask)) == 0), _FOSSIL_TEST_ASSUME_MESSAGE("Expected bitmask " #mask " of value 0x%llx to not be set in value " #value " of value 0x%llx", (uint64_t)(mask), (uint64_t)(value)))
 
 /**
  * @brief Assumes that the given bit position is set in the value.
@@ -2807,7 +3401,9 @@ extern "C" {
  * @param bit The bit position (0-based) to check.
  */
 #define ASSUME_ITS_BIT_POSITION_SET(value, bit) \
-    FOSSIL_TEST_ASSUME((((value) >> (bit)) & 1U) != 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected bit at position " #bit " to be set in value " #value " of value 0x%llx", (uint64_t)(value)))
+    _FOSSIL_TEST_CHECK_ITS_BIT_POSITION_SET(FOSSIL_TEST_ASSUME_AS, value, bit)
+#define _FOSSIL_TEST_CHECK_ITS_BIT_POSITION_SET(dispatch, value, bit) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_IS, (((value) >> (bit)) & 1U) != 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected bit at position " #bit " to be set in value " #value " of value 0x%llx", (uint64_t)(value)))
 
 /**
  * @brief Assumes that the given bit position is not set in the value.
@@ -2816,7 +3412,9 @@ extern "C" {
  * @param bit The bit position (0-based) to check.
  */
 #define ASSUME_NOT_BIT_POSITION_SET(value, bit) \
-    FOSSIL_TEST_ASSUME((((value) >> (bit)) & 1U) == 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected bit at position " #bit " to not be set in value " #value " of value 0x%llx", (uint64_t)(value)))
+    _FOSSIL_TEST_CHECK_NOT_BIT_POSITION_SET(FOSSIL_TEST_ASSUME_AS, value, bit)
+#define _FOSSIL_TEST_CHECK_NOT_BIT_POSITION_SET(dispatch, value, bit) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_IS_NOT, (((value) >> (bit)) & 1U) == 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected bit at position " #bit " to not be set in value " #value " of value 0x%llx", (uint64_t)(value)))
 
 /**
  * @brief Assumes that the bit count in the value equals the expected count.
@@ -2825,7 +3423,9 @@ extern "C" {
  * @param expected_count The expected number of set bits.
  */
 #define ASSUME_ITS_BIT_COUNT(value, expected_count) \
-    FOSSIL_TEST_ASSUME(__builtin_popcountll((uint64_t)(value)) == (expected_count), _FOSSIL_TEST_ASSUME_MESSAGE("Expected bit count in value " #value " to be " #expected_count ", but got %d", __builtin_popcountll((uint64_t)(value))))
+    _FOSSIL_TEST_CHECK_ITS_BIT_COUNT(FOSSIL_TEST_ASSUME_AS, value, expected_count)
+#define _FOSSIL_TEST_CHECK_ITS_BIT_COUNT(dispatch, value, expected_count) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_EQ, __builtin_popcountll((uint64_t)(value)) == (expected_count), _FOSSIL_TEST_ASSUME_MESSAGE("Expected bit count in value " #value " to be " #expected_count ", but got %d", __builtin_popcountll((uint64_t)(value))))
 
 /**
  * @brief Assumes that the bit count in the value does not equal the expected count.
@@ -2834,7 +3434,9 @@ extern "C" {
  * @param expected_count The expected number of set bits.
  */
 #define ASSUME_NOT_BIT_COUNT(value, expected_count) \
-    FOSSIL_TEST_ASSUME(__builtin_popcountll((uint64_t)(value)) != (expected_count), _FOSSIL_TEST_ASSUME_MESSAGE("Expected bit count in value " #value " to not be " #expected_count ", but got %d", __builtin_popcountll((uint64_t)(value))))
+    _FOSSIL_TEST_CHECK_NOT_BIT_COUNT(FOSSIL_TEST_ASSUME_AS, value, expected_count)
+#define _FOSSIL_TEST_CHECK_NOT_BIT_COUNT(dispatch, value, expected_count) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_NE, __builtin_popcountll((uint64_t)(value)) != (expected_count), _FOSSIL_TEST_ASSUME_MESSAGE("Expected bit count in value " #value " to not be " #expected_count ", but got %d", __builtin_popcountll((uint64_t)(value))))
 
 /**
  * @brief Assumes that the given value is a power of two.
@@ -2842,7 +3444,9 @@ extern "C" {
  * @param value The value to check (must be unsigned and non-zero).
  */
 #define ASSUME_ITS_POWER_OF_TWO(value) \
-    FOSSIL_TEST_ASSUME(((value) != 0) && (((value) & ((value) - 1)) == 0), _FOSSIL_TEST_ASSUME_MESSAGE("Expected value " #value " of value 0x%llx to be a power of two", (uint64_t)(value)))
+    _FOSSIL_TEST_CHECK_ITS_POWER_OF_TWO(FOSSIL_TEST_ASSUME_AS, value)
+#define _FOSSIL_TEST_CHECK_ITS_POWER_OF_TWO(dispatch, value) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_IS, ((value) != 0) && (((value) & ((value) - 1)) == 0), _FOSSIL_TEST_ASSUME_MESSAGE("Expected value " #value " of value 0x%llx to be a power of two", (uint64_t)(value)))
 
 /**
  * @brief Assumes that the given value is not a power of two.
@@ -2850,7 +3454,9 @@ extern "C" {
  * @param value The value to check (must be unsigned).
  */
 #define ASSUME_NOT_POWER_OF_TWO(value) \
-    FOSSIL_TEST_ASSUME(((value) == 0) || (((value) & ((value) - 1)) != 0), _FOSSIL_TEST_ASSUME_MESSAGE("Expected value " #value " of value 0x%llx to not be a power of two", (uint64_t)(value)))
+    _FOSSIL_TEST_CHECK_NOT_POWER_OF_TWO(FOSSIL_TEST_ASSUME_AS, value)
+#define _FOSSIL_TEST_CHECK_NOT_POWER_OF_TWO(dispatch, value) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_IS_NOT, ((value) == 0) || (((value) & ((value) - 1)) != 0), _FOSSIL_TEST_ASSUME_MESSAGE("Expected value " #value " of value 0x%llx to not be a power of two", (uint64_t)(value)))
 
 /**
  * @brief Assumes that two values have the same bit pattern.
@@ -2859,7 +3465,9 @@ extern "C" {
  * @param expected The expected value.
  */
 #define ASSUME_ITS_EQUAL_BITS(actual, expected) \
-    FOSSIL_TEST_ASSUME((actual) == (expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected bit pattern " #actual " of value 0x%llx to equal " #expected " of value 0x%llx", (uint64_t)(actual), (uint64_t)(expected)))
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_BITS(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_ITS_EQUAL_BITS(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_EQ, (actual) == (expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected bit pattern " #actual " of value 0x%llx to equal " #expected " of value 0x%llx", (uint64_t)(actual), (uint64_t)(expected)))
 
 /**
  * @brief Assumes that two values have different bit patterns.
@@ -2868,7 +3476,9 @@ extern "C" {
  * @param expected The expected value.
  */
 #define ASSUME_NOT_EQUAL_BITS(actual, expected) \
-    FOSSIL_TEST_ASSUME((actual) != (expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected bit pattern " #actual " of value 0x%llx to not equal " #expected " of value 0x%llx", (uint64_t)(actual), (uint64_t)(expected)))
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_BITS(FOSSIL_TEST_ASSUME_AS, actual, expected)
+#define _FOSSIL_TEST_CHECK_NOT_EQUAL_BITS(dispatch, actual, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_NE, (actual) != (expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected bit pattern " #actual " of value 0x%llx to not equal " #expected " of value 0x%llx", (uint64_t)(actual), (uint64_t)(expected)))
 
 /**
  * @brief Assumes that a bitwise AND operation produces the expected result.
@@ -2878,7 +3488,9 @@ extern "C" {
  * @param expected The expected result.
  */
 #define ASSUME_ITS_BITWISE_AND_EQUAL(value, mask, expected) \
-    FOSSIL_TEST_ASSUME((((value) & (mask)) == (expected)), _FOSSIL_TEST_ASSUME_MESSAGE("Expected ((value " #value " & mask " #mask ") to equal " #expected ", got 0x%llx", (uint64_t)((value) & (mask))))
+    _FOSSIL_TEST_CHECK_ITS_BITWISE_AND_EQUAL(FOSSIL_TEST_ASSUME_AS, value, mask, expected)
+#define _FOSSIL_TEST_CHECK_ITS_BITWISE_AND_EQUAL(dispatch, value, mask, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_EQ, (((value) & (mask)) == (expected)), _FOSSIL_TEST_ASSUME_MESSAGE("Expected ((value " #value " & mask " #mask ") to equal " #expected ", got 0x%llx", (uint64_t)((value) & (mask))))
 
 /**
  * @brief Assumes that a bitwise OR operation produces the expected result.
@@ -2888,7 +3500,9 @@ extern "C" {
  * @param expected The expected result.
  */
 #define ASSUME_ITS_BITWISE_OR_EQUAL(value, mask, expected) \
-    FOSSIL_TEST_ASSUME((((value) | (mask)) == (expected)), _FOSSIL_TEST_ASSUME_MESSAGE("Expected (value " #value " | mask " #mask ") to equal " #expected ", got 0x%llx", (uint64_t)((value) | (mask))))
+    _FOSSIL_TEST_CHECK_ITS_BITWISE_OR_EQUAL(FOSSIL_TEST_ASSUME_AS, value, mask, expected)
+#define _FOSSIL_TEST_CHECK_ITS_BITWISE_OR_EQUAL(dispatch, value, mask, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_EQ, (((value) | (mask)) == (expected)), _FOSSIL_TEST_ASSUME_MESSAGE("Expected (value " #value " | mask " #mask ") to equal " #expected ", got 0x%llx", (uint64_t)((value) | (mask))))
 
 /**
  * @brief Assumes that a bitwise XOR operation produces the expected result.
@@ -2898,7 +3512,9 @@ extern "C" {
  * @param expected The expected result.
  */
 #define ASSUME_ITS_BITWISE_XOR_EQUAL(value, mask, expected) \
-    FOSSIL_TEST_ASSUME((((value) ^ (mask)) == (expected)), _FOSSIL_TEST_ASSUME_MESSAGE("Expected (value " #value " ^ mask " #mask ") to equal " #expected ", got 0x%llx", (uint64_t)((value) ^ (mask))))
+    _FOSSIL_TEST_CHECK_ITS_BITWISE_XOR_EQUAL(FOSSIL_TEST_ASSUME_AS, value, mask, expected)
+#define _FOSSIL_TEST_CHECK_ITS_BITWISE_XOR_EQUAL(dispatch, value, mask, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_EQ, (((value) ^ (mask)) == (expected)), _FOSSIL_TEST_ASSUME_MESSAGE("Expected (value " #value " ^ mask " #mask ") to equal " #expected ", got 0x%llx", (uint64_t)((value) ^ (mask))))
 
 /**
  * @brief Assumes that a left shift operation produces the expected result.
@@ -2910,7 +3526,9 @@ extern "C" {
  * @param expected The expected result.
  */
 #define ASSUME_ITS_SHIFT_LEFT_EQUAL(value, shift, expected) \
-    FOSSIL_TEST_ASSUME(((value) << (shift)) == (expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected (value " #value " << " #shift ") to equal " #expected ", got 0x%llx", (uint64_t)((value) << (shift))))
+    _FOSSIL_TEST_CHECK_ITS_SHIFT_LEFT_EQUAL(FOSSIL_TEST_ASSUME_AS, value, shift, expected)
+#define _FOSSIL_TEST_CHECK_ITS_SHIFT_LEFT_EQUAL(dispatch, value, shift, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_EQ, ((value) << (shift)) == (expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected (value " #value " << " #shift ") to equal " #expected ", got 0x%llx", (uint64_t)((value) << (shift))))
 
 /**
  * @brief Assumes that a right shift operation produces the expected result.
@@ -2922,7 +3540,9 @@ extern "C" {
  * @param expected The expected result.
  */
 #define ASSUME_ITS_SHIFT_RIGHT_EQUAL(value, shift, expected) \
-    FOSSIL_TEST_ASSUME(((value) >> (shift)) == (expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected (value " #value " >> " #shift ") to equal " #expected ", got 0x%llx", (uint64_t)((value) >> (shift))))
+    _FOSSIL_TEST_CHECK_ITS_SHIFT_RIGHT_EQUAL(FOSSIL_TEST_ASSUME_AS, value, shift, expected)
+#define _FOSSIL_TEST_CHECK_ITS_SHIFT_RIGHT_EQUAL(dispatch, value, shift, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_EQ, ((value) >> (shift)) == (expected), _FOSSIL_TEST_ASSUME_MESSAGE("Expected (value " #value " >> " #shift ") to equal " #expected ", got 0x%llx", (uint64_t)((value) >> (shift))))
 
 /**
  * @brief Assumes that rotating left produces the expected result.
@@ -2934,7 +3554,9 @@ extern "C" {
  * @param expected The expected result.
  */
 #define ASSUME_ITS_ROTATE_LEFT_EQUAL(value, n, expected) \
-    FOSSIL_TEST_ASSUME(((((uint64_t)(value) << ((uint64_t)(n) & 63)) | ((uint64_t)(value) >> (64 - ((uint64_t)(n) & 63)))) == (expected)), _FOSSIL_TEST_ASSUME_MESSAGE("Expected rotate_left(value " #value ", " #n ") to equal " #expected ", got 0x%llx", (((uint64_t)(value) << ((uint64_t)(n) & 63)) | ((uint64_t)(value) >> (64 - ((uint64_t)(n) & 63))))))
+    _FOSSIL_TEST_CHECK_ITS_ROTATE_LEFT_EQUAL(FOSSIL_TEST_ASSUME_AS, value, n, expected)
+#define _FOSSIL_TEST_CHECK_ITS_ROTATE_LEFT_EQUAL(dispatch, value, n, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_EQ, ((((uint64_t)(value) << ((uint64_t)(n) & 63)) | ((uint64_t)(value) >> (64 - ((uint64_t)(n) & 63)))) == (expected)), _FOSSIL_TEST_ASSUME_MESSAGE("Expected rotate_left(value " #value ", " #n ") to equal " #expected ", got 0x%llx", (((uint64_t)(value) << ((uint64_t)(n) & 63)) | ((uint64_t)(value) >> (64 - ((uint64_t)(n) & 63))))))
 
 /**
  * @brief Assumes that rotating right produces the expected result.
@@ -2946,7 +3568,9 @@ extern "C" {
  * @param expected The expected result.
  */
 #define ASSUME_ITS_ROTATE_RIGHT_EQUAL(value, n, expected) \
-    FOSSIL_TEST_ASSUME(((((uint64_t)(value) >> ((uint64_t)(n) & 63)) | ((uint64_t)(value) << (64 - ((uint64_t)(n) & 63)))) == (expected)), _FOSSIL_TEST_ASSUME_MESSAGE("Expected rotate_right(value " #value ", " #n ") to equal " #expected ", got 0x%llx", (((uint64_t)(value) >> ((uint64_t)(n) & 63)) | ((uint64_t)(value) << (64 - ((uint64_t)(n) & 63))))))
+    _FOSSIL_TEST_CHECK_ITS_ROTATE_RIGHT_EQUAL(FOSSIL_TEST_ASSUME_AS, value, n, expected)
+#define _FOSSIL_TEST_CHECK_ITS_ROTATE_RIGHT_EQUAL(dispatch, value, n, expected) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_EQ, ((((uint64_t)(value) >> ((uint64_t)(n) & 63)) | ((uint64_t)(value) << (64 - ((uint64_t)(n) & 63)))) == (expected)), _FOSSIL_TEST_ASSUME_MESSAGE("Expected rotate_right(value " #value ", " #n ") to equal " #expected ", got 0x%llx", (((uint64_t)(value) >> ((uint64_t)(n) & 63)) | ((uint64_t)(value) << (64 - ((uint64_t)(n) & 63))))))
 
 // **************************************************
 // Security assumptions
@@ -2959,7 +3583,9 @@ extern "C" {
  * @param required_size The required size for the operation.
  */
 #define ASSUME_ITS_BUFFER_OVERFLOW_SAFE(buffer_size, required_size) \
-    FOSSIL_TEST_ASSUME((buffer_size) >= (required_size), _FOSSIL_TEST_ASSUME_MESSAGE("Expected buffer size %zu to be at least %zu to prevent overflow", (size_t)(buffer_size), (size_t)(required_size)))
+    _FOSSIL_TEST_CHECK_ITS_BUFFER_OVERFLOW_SAFE(FOSSIL_TEST_ASSUME_AS, buffer_size, required_size)
+#define _FOSSIL_TEST_CHECK_ITS_BUFFER_OVERFLOW_SAFE(dispatch, buffer_size, required_size) \
+    dispatch(FOSSIL_MAIP_CAUSE_MEMORY, FOSSIL_MAIP_OP_IS, (buffer_size) >= (required_size), _FOSSIL_TEST_ASSUME_MESSAGE("Expected buffer size %zu to be at least %zu to prevent overflow", (size_t)(buffer_size), (size_t)(required_size)))
 
 /**
  * @brief Assumes that a pointer is properly aligned for its type.
@@ -2968,7 +3594,9 @@ extern "C" {
  * @param alignment The required alignment in bytes.
  */
 #define ASSUME_ITS_ALIGNED_PTR(ptr, alignment) \
-    FOSSIL_TEST_ASSUME(((uintptr_t)(ptr) % (alignment)) == 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected pointer %p to be aligned to %zu bytes", (ptr), (size_t)(alignment)))
+    _FOSSIL_TEST_CHECK_ITS_ALIGNED_PTR(FOSSIL_TEST_ASSUME_AS, ptr, alignment)
+#define _FOSSIL_TEST_CHECK_ITS_ALIGNED_PTR(dispatch, ptr, alignment) \
+    dispatch(FOSSIL_MAIP_CAUSE_MEMORY, FOSSIL_MAIP_OP_IS, ((uintptr_t)(ptr) % (alignment)) == 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected pointer %p to be aligned to %zu bytes", (ptr), (size_t)(alignment)))
 
 /**
  * @brief Assumes that the given value is properly range-validated.
@@ -2978,7 +3606,9 @@ extern "C" {
  * @param max The maximum allowed value.
  */
 #define ASSUME_ITS_INPUT_VALIDATED(value, min, max) \
-    FOSSIL_TEST_ASSUME((value) >= (min) && (value) <= (max), _FOSSIL_TEST_ASSUME_MESSAGE("Expected input value %lld to be within valid range [%lld, %lld]", (int64_t)(value), (int64_t)(min), (int64_t)(max)))
+    _FOSSIL_TEST_CHECK_ITS_INPUT_VALIDATED(FOSSIL_TEST_ASSUME_AS, value, min, max)
+#define _FOSSIL_TEST_CHECK_ITS_INPUT_VALIDATED(dispatch, value, min, max) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_IS, (value) >= (min) && (value) <= (max), _FOSSIL_TEST_ASSUME_MESSAGE("Expected input value %lld to be within valid range [%lld, %lld]", (int64_t)(value), (int64_t)(min), (int64_t)(max)))
 
 /**
  * @brief Assumes that the given string is null-terminated and safe to use.
@@ -2987,7 +3617,9 @@ extern "C" {
  * @param max_len The maximum expected length including null terminator.
  */
 #define ASSUME_ITS_SAFE_CSTR(str, max_len) \
-    FOSSIL_TEST_ASSUME((str) != null && strlen((str)) < (max_len), _FOSSIL_TEST_ASSUME_MESSAGE("Expected string %p to be null-terminated and shorter than %zu", (str), (size_t)(max_len)))
+    _FOSSIL_TEST_CHECK_ITS_SAFE_CSTR(FOSSIL_TEST_ASSUME_AS, str, max_len)
+#define _FOSSIL_TEST_CHECK_ITS_SAFE_CSTR(dispatch, str, max_len) \
+    dispatch(FOSSIL_MAIP_CAUSE_STRING, FOSSIL_MAIP_OP_IS, (str) != null && strlen((str)) < (max_len), _FOSSIL_TEST_ASSUME_MESSAGE("Expected string %p to be null-terminated and shorter than %zu", (str), (size_t)(max_len)))
 
 /**
  * @brief Assumes that integer arithmetic will not overflow.
@@ -2997,7 +3629,9 @@ extern "C" {
  * @param result The result of addition.
  */
 #define ASSUME_NO_INTEGER_OVERFLOW_ADD(a, b, result) \
-    FOSSIL_TEST_ASSUME((result) >= (a) && (result) >= (b), _FOSSIL_TEST_ASSUME_MESSAGE("Expected addition of %lld + %lld = %lld to not overflow", (int64_t)(a), (int64_t)(b), (int64_t)(result)))
+    _FOSSIL_TEST_CHECK_NO_INTEGER_OVERFLOW_ADD(FOSSIL_TEST_ASSUME_AS, a, b, result)
+#define _FOSSIL_TEST_CHECK_NO_INTEGER_OVERFLOW_ADD(dispatch, a, b, result) \
+    dispatch(FOSSIL_MAIP_CAUSE_RANGE, FOSSIL_MAIP_OP_IS, (result) >= (a) && (result) >= (b), _FOSSIL_TEST_ASSUME_MESSAGE("Expected addition of %lld + %lld = %lld to not overflow", (int64_t)(a), (int64_t)(b), (int64_t)(result)))
 
 /**
  * @brief Assumes that integer arithmetic will not underflow.
@@ -3007,7 +3641,9 @@ extern "C" {
  * @param result The result of subtraction.
  */
 #define ASSUME_NO_INTEGER_UNDERFLOW_SUB(a, b, result) \
-    FOSSIL_TEST_ASSUME(((a) >= (b)) == ((result) >= 0), _FOSSIL_TEST_ASSUME_MESSAGE("Expected subtraction of %lld - %lld = %lld to not underflow", (int64_t)(a), (int64_t)(b), (int64_t)(result)))
+    _FOSSIL_TEST_CHECK_NO_INTEGER_UNDERFLOW_SUB(FOSSIL_TEST_ASSUME_AS, a, b, result)
+#define _FOSSIL_TEST_CHECK_NO_INTEGER_UNDERFLOW_SUB(dispatch, a, b, result) \
+    dispatch(FOSSIL_MAIP_CAUSE_RANGE, FOSSIL_MAIP_OP_IS, ((a) >= (b)) == ((result) >= 0), _FOSSIL_TEST_ASSUME_MESSAGE("Expected subtraction of %lld - %lld = %lld to not underflow", (int64_t)(a), (int64_t)(b), (int64_t)(result)))
 
 /**
  * @brief Assumes that multiplication will not overflow.
@@ -3016,7 +3652,9 @@ extern "C" {
  * @param b The second operand.
  */
 #define ASSUME_NO_MULTIPLICATION_OVERFLOW(a, b) \
-    FOSSIL_TEST_ASSUME((a) == 0 || (b) == 0 || ((SIZE_MAX / (a)) >= (b)), _FOSSIL_TEST_ASSUME_MESSAGE("Expected multiplication of %zu * %zu to not overflow", (size_t)(a), (size_t)(b)))
+    _FOSSIL_TEST_CHECK_NO_MULTIPLICATION_OVERFLOW(FOSSIL_TEST_ASSUME_AS, a, b)
+#define _FOSSIL_TEST_CHECK_NO_MULTIPLICATION_OVERFLOW(dispatch, a, b) \
+    dispatch(FOSSIL_MAIP_CAUSE_RANGE, FOSSIL_MAIP_OP_IS, (a) == 0 || (b) == 0 || ((SIZE_MAX / (a)) >= (b)), _FOSSIL_TEST_ASSUME_MESSAGE("Expected multiplication of %zu * %zu to not overflow", (size_t)(a), (size_t)(b)))
 
 /**
  * @brief Assumes that a random value has sufficient entropy.
@@ -3024,7 +3662,9 @@ extern "C" {
  * @param random_value The random value to check.
  */
 #define ASSUME_ITS_RANDOM_ENTROPY(random_value) \
-    FOSSIL_TEST_ASSUME((random_value) != 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected random value 0x%llx to have non-zero entropy", (uint64_t)(random_value)))
+    _FOSSIL_TEST_CHECK_ITS_RANDOM_ENTROPY(FOSSIL_TEST_ASSUME_AS, random_value)
+#define _FOSSIL_TEST_CHECK_ITS_RANDOM_ENTROPY(dispatch, random_value) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_IS, (random_value) != 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected random value 0x%llx to have non-zero entropy", (uint64_t)(random_value)))
 
 /**
  * @brief Assumes that sensitive data is properly cleared from memory.
@@ -3033,7 +3673,9 @@ extern "C" {
  * @param size The size of the memory to verify.
  */
 #define ASSUME_ITS_SECURE_CLEARED(ptr, size) \
-    FOSSIL_TEST_ASSUME(maip_sys_memory_zero((ptr), (size)), _FOSSIL_TEST_ASSUME_MESSAGE("Expected sensitive memory at %p (%zu bytes) to be securely cleared", (ptr), (size_t)(size)))
+    _FOSSIL_TEST_CHECK_ITS_SECURE_CLEARED(FOSSIL_TEST_ASSUME_AS, ptr, size)
+#define _FOSSIL_TEST_CHECK_ITS_SECURE_CLEARED(dispatch, ptr, size) \
+    dispatch(FOSSIL_MAIP_CAUSE_MEMORY, FOSSIL_MAIP_OP_IS, maip_sys_memory_zero((ptr), (size)), _FOSSIL_TEST_ASSUME_MESSAGE("Expected sensitive memory at %p (%zu bytes) to be securely cleared", (ptr), (size_t)(size)))
 
 /**
  * @brief Assumes that a file descriptor is valid and open.
@@ -3041,7 +3683,9 @@ extern "C" {
  * @param fd The file descriptor to check.
  */
 #define ASSUME_ITS_VALID_FD(fd) \
-    FOSSIL_TEST_ASSUME((fd) >= 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected file descriptor %d to be valid", (int)(fd)))
+    _FOSSIL_TEST_CHECK_ITS_VALID_FD(FOSSIL_TEST_ASSUME_AS, fd)
+#define _FOSSIL_TEST_CHECK_ITS_VALID_FD(dispatch, fd) \
+    dispatch(FOSSIL_MAIP_CAUSE_IO, FOSSIL_MAIP_OP_IS, (fd) >= 0, _FOSSIL_TEST_ASSUME_MESSAGE("Expected file descriptor %d to be valid", (int)(fd)))
 
 /**
  * @brief Assumes that a cryptographic key has the expected length.
@@ -3050,7 +3694,9 @@ extern "C" {
  * @param expected_len The expected key length.
  */
 #define ASSUME_ITS_VALID_KEY_LENGTH(key_len, expected_len) \
-    FOSSIL_TEST_ASSUME((key_len) == (expected_len), _FOSSIL_TEST_ASSUME_MESSAGE("Expected cryptographic key length %zu to match expected length %zu", (size_t)(key_len), (size_t)(expected_len)))
+    _FOSSIL_TEST_CHECK_ITS_VALID_KEY_LENGTH(FOSSIL_TEST_ASSUME_AS, key_len, expected_len)
+#define _FOSSIL_TEST_CHECK_ITS_VALID_KEY_LENGTH(dispatch, key_len, expected_len) \
+    dispatch(FOSSIL_MAIP_CAUSE_RANGE, FOSSIL_MAIP_OP_IS, (key_len) == (expected_len), _FOSSIL_TEST_ASSUME_MESSAGE("Expected cryptographic key length %zu to match expected length %zu", (size_t)(key_len), (size_t)(expected_len)))
 
 /**
  * @brief Assumes that a session token is not expired.
@@ -3059,7 +3705,9 @@ extern "C" {
  * @param expiry_time The expiration time.
  */
 #define ASSUME_ITS_SESSION_VALID(current_time, expiry_time) \
-    FOSSIL_TEST_ASSUME((current_time) <= (expiry_time), _FOSSIL_TEST_ASSUME_MESSAGE("Expected session expiry time %lld to be after current time %lld", (int64_t)(expiry_time), (int64_t)(current_time)))
+    _FOSSIL_TEST_CHECK_ITS_SESSION_VALID(FOSSIL_TEST_ASSUME_AS, current_time, expiry_time)
+#define _FOSSIL_TEST_CHECK_ITS_SESSION_VALID(dispatch, current_time, expiry_time) \
+    dispatch(FOSSIL_MAIP_CAUSE_LOGIC, FOSSIL_MAIP_OP_IS, (current_time) <= (expiry_time), _FOSSIL_TEST_ASSUME_MESSAGE("Expected session expiry time %lld to be after current time %lld", (int64_t)(expiry_time), (int64_t)(current_time)))
 
 /**
  * @brief Assumes that bounds checking prevents out-of-bounds access.
@@ -3068,7 +3716,9 @@ extern "C" {
  * @param array_size The size of the array.
  */
 #define ASSUME_ITS_BOUNDS_CHECKED(index, array_size) \
-    FOSSIL_TEST_ASSUME((index) < (array_size), _FOSSIL_TEST_ASSUME_MESSAGE("Expected array index %zu to be within bounds [0, %zu)", (size_t)(index), (size_t)(array_size)))
+    _FOSSIL_TEST_CHECK_ITS_BOUNDS_CHECKED(FOSSIL_TEST_ASSUME_AS, index, array_size)
+#define _FOSSIL_TEST_CHECK_ITS_BOUNDS_CHECKED(dispatch, index, array_size) \
+    dispatch(FOSSIL_MAIP_CAUSE_RANGE, FOSSIL_MAIP_OP_IS, (index) < (array_size), _FOSSIL_TEST_ASSUME_MESSAGE("Expected array index %zu to be within bounds [0, %zu)", (size_t)(index), (size_t)(array_size)))
 
 #ifdef __cplusplus
 }
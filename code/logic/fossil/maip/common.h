@@ -216,6 +216,122 @@ typedef const char* ccstr;
  */
 FOSSIL_MAIP_API void fossil_maip_hash(const char *input, const char *output, uint8_t *hash_out);
 
+// *****************************************************************************
+// Timing
+// *****************************************************************************
+
+/**
+ * @brief Returns a monotonic timestamp in nanoseconds.
+ *
+ * Reads CLOCK_MONOTONIC_RAW (QueryPerformanceCounter on Windows) unless the
+ * calibrated TSC was selected with `maip_time_use_clock`. Only the difference
+ * between two timestamps is meaningful.
+ *
+ * @return The current timestamp in nanoseconds.
+ */
+FOSSIL_MAIP_API uint64_t maip_time_now_ns(void);
+
+/**
+ * @brief Returns the CPU time consumed by the calling thread in nanoseconds.
+ *
+ * @return The thread CPU time, or 0 when the platform cannot report it.
+ */
+FOSSIL_MAIP_API uint64_t maip_time_thread_cpu_ns(void);
+
+/**
+ * @brief Selects the clock behind `maip_time_now_ns` and measures its overhead.
+ *
+ * "monotonic" is always available. "tsc" needs an invariant TSC with rdtscp;
+ * it is calibrated against the monotonic clock for about 10ms. Call this
+ * before any runner threads start.
+ *
+ * @param name The clock name ("monotonic" or "tsc").
+ * @return 0 on success, or -1 when the clock is unknown or unavailable, in
+ *         which case the monotonic clock stays selected.
+ */
+FOSSIL_MAIP_API int maip_time_use_clock(const char *name);
+
+/**
+ * @brief Returns the name of the clock currently in use.
+ *
+ * @return "monotonic" or "tsc".
+ */
+FOSSIL_MAIP_API const char *maip_time_clock_name(void);
+
+/**
+ * @brief Returns the measured cost of reading the clock, in nanoseconds.
+ *
+ * @return The smallest back-to-back clock delta seen by `maip_time_use_clock`.
+ */
+FOSSIL_MAIP_API uint64_t maip_time_overhead_ns(void);
+
+/**
+ * @brief Returns the time between two timestamps minus the clock overhead.
+ *
+ * @param start A timestamp from `maip_time_now_ns`.
+ * @param end A later timestamp from `maip_time_now_ns`.
+ * @return The elapsed nanoseconds, never less than zero.
+ */
+FOSSIL_MAIP_API uint64_t maip_time_interval_ns(uint64_t start, uint64_t end);
+
+// *****************************************************************************
+// Random Numbers
+// *****************************************************************************
+
+/**
+ * @brief State of a xoshiro256** generator.
+ *
+ * Small, fast and reproducible on every platform, unlike rand(). Independent
+ * streams are derived from one seed by giving each a distinct stream id.
+ */
+typedef struct {
+    uint64_t state[4];
+} maip_rand_t;
+
+/**
+ * @brief Seeds a generator with a seed and a stream id.
+ *
+ * The state is expanded with splitmix64, so any seed (including 0) and any
+ * stream id give a well mixed, distinct sequence.
+ *
+ * @param rng The generator to seed.
+ * @param seed The master seed.
+ * @param stream The stream id (for example a hash of a suite name).
+ */
+FOSSIL_MAIP_API void maip_rand_seed(maip_rand_t *rng, uint64_t seed, uint64_t stream);
+
+/**
+ * @brief Returns the next 64 random bits.
+ *
+ * @param rng The generator.
+ * @return A uniformly distributed 64-bit value.
+ */
+FOSSIL_MAIP_API uint64_t maip_rand_next(maip_rand_t *rng);
+
+/**
+ * @brief Returns a uniform value below a bound, without modulo bias.
+ *
+ * @param rng The generator.
+ * @param bound The exclusive upper bound (0 returns 0).
+ * @return A value in [0, bound).
+ */
+FOSSIL_MAIP_API uint64_t maip_rand_below(maip_rand_t *rng, uint64_t bound);
+
+/**
+ * @brief Returns a uniform double in (0, 1].
+ *
+ * @param rng The generator.
+ * @return A value that is never 0, so its logarithm is finite.
+ */
+FOSSIL_MAIP_API double maip_rand_unit(maip_rand_t *rng);
+
+/**
+ * @brief Draws a seed from the clock and the address space layout.
+ *
+ * @return A seed that differs between runs.
+ */
+FOSSIL_MAIP_API uint64_t maip_rand_entropy(void);
+
 // *****************************************************************************
 // Command Pallet
 // *****************************************************************************
@@ -234,54 +350,79 @@ typedef enum {
     MAIP_VERBOSE_DOGE
 } fossil_maip_cli_verbose_t;
 
+typedef struct {
+    const char *name;              // Suite or test case the budget applies to
+    uint64_t timeout_ns;           // Time budget in nanoseconds
+} fossil_maip_timeout_rule_t;
+
 typedef struct {
     struct {
         int fail_fast;             // Flag for --fail-fast
         const char* only;          // Value for --only
         cstr *only_cases;          // Array of test case names (split by ',')
         size_t only_count;         // Number of test cases in only_cases
-        int only_has_wildcard;     // 1 if any test case contains '*', 0 otherwise
+        int only_has_wildcard;     // 1 if any test case contains '*' or '?', 0 otherwise
         const char* skip;          // Value for --skip
+        cstr *skip_cases;          // Array of test case names (split by ',')
+        size_t skip_count;         // Number of test cases in skip_cases
+        int skip_has_wildcard;     // 1 if any test case contains '*' or '?', 0 otherwise
         int repeat;                // Value for --repeat
         unsigned int random_seed;  // Optional random seed for reproducible runs
         int until_fail;            // Flag for --until-fail stress testing
+        int jobs;                  // Value for --jobs (worker processes, 1 = in-process)
+        int threads;               // Value for --threads (runner threads, 1 = sequential)
+        uint64_t timeout_ns;       // Value for --timeout <seconds> (0 = default budget)
+        fossil_maip_timeout_rule_t *timeout_rules; // Values for --timeout <name>=<seconds>
+        size_t timeout_rule_count; // Number of timeout rules
+        int isolate;               // Flag for --isolate (each case in its own process)
+        const char* clock;         // Value for --clock (monotonic/tsc)
+        const char* history;       // Value for --history (file; unset keeps no history)
+        int shard_index;           // Value for --shard <index>/<total>, zero-based
+        int shard_total;           // Number of shards (0 = not sharded)
+        const char* shard_mode;    // Value for --shard-mode (hash/balanced)
+        const char* results;       // Value for --results (file; unset keeps no outcomes)
+        const char* sites;         // Value for --sites (file; unset writes no site list)
+        int last_failed;           // Flag for --last-failed
+        int failed_first;          // Flag for --failed-first
     } run;                         // Run command flags
 
     struct {
-        const char* test_name;          // Value for --test-name
+        const char* test_name;          // Value for --test-name or --not-test-name
         cstr *test_name_list;           // Array of test names (split by ',')
         size_t test_name_count;         // Number of test names
-        int test_name_has_wildcard;     // 1 if any test name contains '*', 0 otherwise
+        int test_name_has_wildcard;     // 1 if any test name contains '*' or '?', 0 otherwise
         int test_name_inverted;         // 1 if --not-test-name is used
 
         const char* name;         // Value for --suite-name
         cstr *name_list;          // Array of suite names (split by ',')
         size_t name_count;        // Number of suite names
-        int name_has_wildcard;    // 1 if any suite name contains '*', 0 otherwise
+        int name_has_wildcard;    // 1 if any suite name contains '*' or '?', 0 otherwise
 
-        const char* tag;                // Value for --tag
+        const char* tag;                // Value for --tag (tag expression)
         cstr *tag_list;                 // Array of tags (split by ',')
         size_t tag_count;               // Number of tags
-        int tag_has_wildcard;           // 1 if any tag contains '*', 0 otherwise
+        int tag_has_wildcard;           // 1 if any tag contains '*' or '?', 0 otherwise
     } filter;                      // Filter command flags
 
     struct {
         const char* by;                // Value for --by
         const char* order;             // Value for --order
-        const char* then_by;           // Secondary sort criterion
+        const char* then_by;           // Value for --then-by (tie breaking keys, comma separated)
     } sort;                        // Sort command flags
 
     struct {
+        int enabled;                   // Set when the shuffle command is given
         const char* seed;              // Value for --seed
-        int count;                     // Value for --count
-        const char* by;                // Value for --by
+        uint64_t seed_value;           // Master seed in effect (--seed, or drawn at startup)
+        int count;                     // Value for --count (cases sampled per suite, 0 = all)
+        const char* by;                // Unused, kept for source compatibility
         const char* mode;              // Shuffle mode: uniform/weighted
     } shuffle;                     // Shuffle command flags
 
     struct {
         const char* test_name;         // Name of the test case to show
         const char* name;        // Name of the suite to show
-        const char* tag;               // Tag to filter which test cases to show
+        const char* tag;               // Tag expression selecting the test cases to show
         const char* result;            // Result to filter which test cases to show
         const char* mode;              // Mode to filter which test cases to show (list/tree/graph)
         const char* verbose;           // Verbosity level (plain/ci/doge)
@@ -301,7 +442,16 @@ typedef struct {
         int self;                     // Flag for --self
     } info;                        // Info command flags
 
+    struct {
+        int enabled;                   // Set when the serve command is given
+        const char* socket;            // Value for --socket (Unix domain socket path)
+        const char* send;              // Value for --send (request sent to a running server)
+        int argc;                      // Command line the server re-executes itself with
+        char **argv;
+    } serve;                       // Serve command flags
+
     fossil_maip_cli_theme_t theme; // Theme option
+    uint64_t timeout_ns;           // Global timeout=<seconds> (0 = default budget)
 } fossil_maip_pallet_t;
 
 // *****************************************************************************
@@ -1136,6 +1286,19 @@ FOSSIL_MAIP_API void maip_io_draw_vertical_line(int length, char ch);
  */
 FOSSIL_MAIP_API void maip_io_flush(void);
 
+/**
+ * Acquires the process-wide output lock.
+ *
+ * Runner threads hold this lock while reporting so case output is never
+ * interleaved; code that redirects stdout holds it for the whole redirection.
+ */
+FOSSIL_MAIP_API void maip_io_lock(void);
+
+/**
+ * Releases the process-wide output lock taken by `maip_io_lock`.
+ */
+FOSSIL_MAIP_API void maip_io_unlock(void);
+
 // *****************************************************************************
 // string management
 // *****************************************************************************
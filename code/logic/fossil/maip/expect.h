@@ -0,0 +1,793 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef FOSSIL_TEST_EXPECT_TYPE_H
+#define FOSSIL_TEST_EXPECT_TYPE_H
+
+#include "framework.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Non-fatal counterparts of the assume.h macros: EXPECT_<name> takes the same
+// arguments and checks the same condition as ASSUME_<name>, through the shared
+// _FOSSIL_TEST_CHECK_<name> body. A failed expectation is kept in the case's
+// bounded failure buffer and the case runs on; it fails once its body returns,
+// with every kept expectation reported together.
+
+// **************************************************
+//
+// Boolean expectations
+//
+// **************************************************
+
+#define EXPECT_ITS_TRUE(actual) \
+    _FOSSIL_TEST_CHECK_ITS_TRUE(FOSSIL_TEST_EXPECT_AS, actual)
+#define EXPECT_ITS_FALSE(actual) \
+    _FOSSIL_TEST_CHECK_ITS_FALSE(FOSSIL_TEST_EXPECT_AS, actual)
+#define EXPECT_NOT_TRUE(actual) \
+    _FOSSIL_TEST_CHECK_NOT_TRUE(FOSSIL_TEST_EXPECT_AS, actual)
+#define EXPECT_NOT_FALSE(actual) \
+    _FOSSIL_TEST_CHECK_NOT_FALSE(FOSSIL_TEST_EXPECT_AS, actual)
+
+// **************************************************
+//
+// Floating point expectations
+//
+// **************************************************
+// Double equality check with tolerance
+
+#define EXPECT_ITS_EQUAL_F64(actual, expected, tol) \
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_F64(FOSSIL_TEST_EXPECT_AS, actual, expected, tol)
+#define EXPECT_ITS_LESS_THAN_F64(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_LESS_THAN_F64(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_MORE_THAN_F64(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_MORE_THAN_F64(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_LESS_OR_EQUAL_F64(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_F64(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_MORE_OR_EQUAL_F64(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_F64(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_EQUAL_F64(actual, expected, tol) \
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_F64(FOSSIL_TEST_EXPECT_AS, actual, expected, tol)
+#define EXPECT_NOT_LESS_THAN_F64(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_LESS_THAN_F64(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_MORE_THAN_F64(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_MORE_THAN_F64(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_LESS_OR_EQUAL_F64(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_F64(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_MORE_OR_EQUAL_F64(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_F64(FOSSIL_TEST_EXPECT_AS, actual, expected)
+
+// Float equality check with tolerance
+
+#define EXPECT_ITS_EQUAL_F32(actual, expected, tol) \
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_F32(FOSSIL_TEST_EXPECT_AS, actual, expected, tol)
+#define EXPECT_ITS_LESS_THAN_F32(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_LESS_THAN_F32(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_MORE_THAN_F32(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_MORE_THAN_F32(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_LESS_OR_EQUAL_F32(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_F32(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_MORE_OR_EQUAL_F32(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_F32(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_EQUAL_F32(actual, expected, tol) \
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_F32(FOSSIL_TEST_EXPECT_AS, actual, expected, tol)
+#define EXPECT_NOT_LESS_THAN_F32(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_LESS_THAN_F32(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_MORE_THAN_F32(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_MORE_THAN_F32(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_LESS_OR_EQUAL_F32(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_F32(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_MORE_OR_EQUAL_F32(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_F32(FOSSIL_TEST_EXPECT_AS, actual, expected)
+
+// Float NaN and Infinity checks
+
+#define EXPECT_ITS_NAN_F32(actual) \
+    _FOSSIL_TEST_CHECK_ITS_NAN_F32(FOSSIL_TEST_EXPECT_AS, actual)
+#define EXPECT_ITS_INF_F32(actual) \
+    _FOSSIL_TEST_CHECK_ITS_INF_F32(FOSSIL_TEST_EXPECT_AS, actual)
+
+// Double NaN and Infinity checks
+
+#define EXPECT_ITS_NAN_F64(actual) \
+    _FOSSIL_TEST_CHECK_ITS_NAN_F64(FOSSIL_TEST_EXPECT_AS, actual)
+#define EXPECT_ITS_INF_F64(actual) \
+    _FOSSIL_TEST_CHECK_ITS_INF_F64(FOSSIL_TEST_EXPECT_AS, actual)
+
+// **************************************************
+//
+// Numaric expectations
+//
+// **************************************************
+
+#define EXPECT_ITS_EQUAL_O8(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_O8(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_LESS_THAN_O8(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_LESS_THAN_O8(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_MORE_THAN_O8(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_MORE_THAN_O8(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_LESS_OR_EQUAL_O8(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_O8(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_MORE_OR_EQUAL_O8(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_O8(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_EQUAL_O8(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_O8(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_LESS_THAN_O8(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_LESS_THAN_O8(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_MORE_THAN_O8(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_MORE_THAN_O8(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_LESS_OR_EQUAL_O8(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_O8(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_MORE_OR_EQUAL_O8(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_O8(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_EQUAL_O16(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_O16(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_LESS_THAN_O16(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_LESS_THAN_O16(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_MORE_THAN_O16(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_MORE_THAN_O16(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_LESS_OR_EQUAL_O16(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_O16(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_MORE_OR_EQUAL_O16(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_O16(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_EQUAL_O16(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_O16(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_LESS_THAN_O16(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_LESS_THAN_O16(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_MORE_THAN_O16(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_MORE_THAN_O16(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_LESS_OR_EQUAL_O16(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_O16(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_MORE_OR_EQUAL_O16(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_O16(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_EQUAL_O32(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_O32(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_LESS_THAN_O32(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_LESS_THAN_O32(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_MORE_THAN_O32(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_MORE_THAN_O32(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_LESS_OR_EQUAL_O32(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_O32(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_MORE_OR_EQUAL_O32(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_O32(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_EQUAL_O32(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_O32(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_LESS_THAN_O32(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_LESS_THAN_O32(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_MORE_THAN_O32(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_MORE_THAN_O32(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_LESS_OR_EQUAL_O32(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_O32(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_MORE_OR_EQUAL_O32(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_O32(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_EQUAL_O64(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_O64(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_LESS_THAN_O64(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_LESS_THAN_O64(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_MORE_THAN_O64(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_MORE_THAN_O64(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_LESS_OR_EQUAL_O64(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_O64(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_MORE_OR_EQUAL_O64(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_O64(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_EQUAL_O64(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_O64(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_LESS_THAN_O64(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_LESS_THAN_O64(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_MORE_THAN_O64(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_MORE_THAN_O64(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_LESS_OR_EQUAL_O64(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_O64(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_MORE_OR_EQUAL_O64(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_O64(FOSSIL_TEST_EXPECT_AS, actual, expected)
+
+// Hexadecimal expectations
+
+#define EXPECT_ITS_EQUAL_H8(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_H8(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_LESS_THAN_H8(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_LESS_THAN_H8(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_MORE_THAN_H8(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_MORE_THAN_H8(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_LESS_OR_EQUAL_H8(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_H8(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_MORE_OR_EQUAL_H8(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_H8(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_EQUAL_H8(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_H8(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_LESS_THAN_H8(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_LESS_THAN_H8(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_MORE_THAN_H8(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_MORE_THAN_H8(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_LESS_OR_EQUAL_H8(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_H8(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_MORE_OR_EQUAL_H8(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_H8(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_EQUAL_H16(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_H16(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_LESS_THAN_H16(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_LESS_THAN_H16(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_MORE_THAN_H16(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_MORE_THAN_H16(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_LESS_OR_EQUAL_H16(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_H16(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_MORE_OR_EQUAL_H16(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_H16(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_EQUAL_H16(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_H16(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_LESS_THAN_H16(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_LESS_THAN_H16(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_MORE_THAN_H16(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_MORE_THAN_H16(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_LESS_OR_EQUAL_H16(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_H16(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_MORE_OR_EQUAL_H16(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_H16(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_EQUAL_H32(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_H32(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_LESS_THAN_H32(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_LESS_THAN_H32(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_MORE_THAN_H32(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_MORE_THAN_H32(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_LESS_OR_EQUAL_H32(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_H32(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_MORE_OR_EQUAL_H32(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_H32(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_EQUAL_H32(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_H32(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_LESS_THAN_H32(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_LESS_THAN_H32(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_MORE_THAN_H32(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_MORE_THAN_H32(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_LESS_OR_EQUAL_H32(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_H32(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_MORE_OR_EQUAL_H32(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_H32(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_EQUAL_H64(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_H64(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_LESS_THAN_H64(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_LESS_THAN_H64(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_MORE_THAN_H64(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_MORE_THAN_H64(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_LESS_OR_EQUAL_H64(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_H64(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_MORE_OR_EQUAL_H64(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_H64(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_EQUAL_H64(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_H64(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_LESS_THAN_H64(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_LESS_THAN_H64(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_MORE_THAN_H64(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_MORE_THAN_H64(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_LESS_OR_EQUAL_H64(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_H64(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_MORE_OR_EQUAL_H64(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_H64(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_EQUAL_I8(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_I8(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_LESS_THAN_I8(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_LESS_THAN_I8(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_MORE_THAN_I8(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_MORE_THAN_I8(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_LESS_OR_EQUAL_I8(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_I8(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_MORE_OR_EQUAL_I8(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_I8(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_EQUAL_I8(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_I8(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_LESS_THAN_I8(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_LESS_THAN_I8(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_MORE_THAN_I8(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_MORE_THAN_I8(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_LESS_OR_EQUAL_I8(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_I8(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_MORE_OR_EQUAL_I8(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_I8(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_EQUAL_I16(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_I16(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_LESS_THAN_I16(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_LESS_THAN_I16(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_MORE_THAN_I16(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_MORE_THAN_I16(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_LESS_OR_EQUAL_I16(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_I16(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_MORE_OR_EQUAL_I16(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_I16(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_EQUAL_I16(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_I16(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_LESS_THAN_I16(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_LESS_THAN_I16(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_MORE_THAN_I16(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_MORE_THAN_I16(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_LESS_OR_EQUAL_I16(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_I16(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_MORE_OR_EQUAL_I16(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_I16(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_EQUAL_I32(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_I32(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_LESS_THAN_I32(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_LESS_THAN_I32(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_MORE_THAN_I32(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_MORE_THAN_I32(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_LESS_OR_EQUAL_I32(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_I32(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_MORE_OR_EQUAL_I32(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_I32(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_EQUAL_I32(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_I32(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_LESS_THAN_I32(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_LESS_THAN_I32(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_MORE_THAN_I32(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_MORE_THAN_I32(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_LESS_OR_EQUAL_I32(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_I32(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_MORE_OR_EQUAL_I32(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_I32(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_EQUAL_I64(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_I64(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_LESS_THAN_I64(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_LESS_THAN_I64(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_MORE_THAN_I64(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_MORE_THAN_I64(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_LESS_OR_EQUAL_I64(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_I64(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_MORE_OR_EQUAL_I64(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_I64(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_EQUAL_I64(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_I64(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_LESS_THAN_I64(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_LESS_THAN_I64(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_MORE_THAN_I64(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_MORE_THAN_I64(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_LESS_OR_EQUAL_I64(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_I64(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_MORE_OR_EQUAL_I64(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_I64(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_EQUAL_U8(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_U8(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_LESS_THAN_U8(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_LESS_THAN_U8(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_MORE_THAN_U8(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_MORE_THAN_U8(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_LESS_OR_EQUAL_U8(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_U8(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_MORE_OR_EQUAL_U8(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_U8(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_EQUAL_U8(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_U8(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_LESS_THAN_U8(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_LESS_THAN_U8(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_MORE_THAN_U8(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_MORE_THAN_U8(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_LESS_OR_EQUAL_U8(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_U8(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_MORE_OR_EQUAL_U8(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_U8(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_EQUAL_U16(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_U16(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_LESS_THAN_U16(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_LESS_THAN_U16(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_MORE_THAN_U16(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_MORE_THAN_U16(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_LESS_OR_EQUAL_U16(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_U16(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_MORE_OR_EQUAL_U16(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_U16(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_EQUAL_U16(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_U16(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_LESS_THAN_U16(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_LESS_THAN_U16(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_MORE_THAN_U16(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_MORE_THAN_U16(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_LESS_OR_EQUAL_U16(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_U16(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_MORE_OR_EQUAL_U16(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_U16(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_EQUAL_U32(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_U32(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_LESS_THAN_U32(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_LESS_THAN_U32(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_MORE_THAN_U32(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_MORE_THAN_U32(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_LESS_OR_EQUAL_U32(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_U32(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_MORE_OR_EQUAL_U32(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_U32(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_EQUAL_U32(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_U32(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_LESS_THAN_U32(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_LESS_THAN_U32(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_MORE_THAN_U32(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_MORE_THAN_U32(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_LESS_OR_EQUAL_U32(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_U32(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_MORE_OR_EQUAL_U32(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_U32(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_EQUAL_U64(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_U64(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_LESS_THAN_U64(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_LESS_THAN_U64(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_MORE_THAN_U64(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_MORE_THAN_U64(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_LESS_OR_EQUAL_U64(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_U64(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_MORE_OR_EQUAL_U64(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_U64(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_EQUAL_U64(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_U64(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_LESS_THAN_U64(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_LESS_THAN_U64(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_MORE_THAN_U64(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_MORE_THAN_U64(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_LESS_OR_EQUAL_U64(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_U64(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_MORE_OR_EQUAL_U64(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_U64(FOSSIL_TEST_EXPECT_AS, actual, expected)
+
+// **************************************************
+//
+// Memory allocation expectations
+//
+// **************************************************
+
+#define EXPECT_ITS_ZERO_MEMORY(ptr, size) \
+    _FOSSIL_TEST_CHECK_ITS_ZERO_MEMORY(FOSSIL_TEST_EXPECT_AS, ptr, size)
+#define EXPECT_NOT_ZERO_MEMORY(ptr, size) \
+    _FOSSIL_TEST_CHECK_NOT_ZERO_MEMORY(FOSSIL_TEST_EXPECT_AS, ptr, size)
+#define EXPECT_ITS_EQUAL_MEMORY(ptr1, ptr2, size) \
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_MEMORY(FOSSIL_TEST_EXPECT_AS, ptr1, ptr2, size)
+#define EXPECT_NOT_EQUAL_MEMORY(ptr1, ptr2, size) \
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_MEMORY(FOSSIL_TEST_EXPECT_AS, ptr1, ptr2, size)
+#define EXPECT_ITS_MORE_THAN_MEMORY(ptr1, ptr2, size) \
+    _FOSSIL_TEST_CHECK_ITS_MORE_THAN_MEMORY(FOSSIL_TEST_EXPECT_AS, ptr1, ptr2, size)
+#define EXPECT_ITS_LESS_THAN_MEMORY(ptr1, ptr2, size) \
+    _FOSSIL_TEST_CHECK_ITS_LESS_THAN_MEMORY(FOSSIL_TEST_EXPECT_AS, ptr1, ptr2, size)
+#define EXPECT_ITS_MORE_OR_EQUAL_MEMORY(ptr1, ptr2, size) \
+    _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_MEMORY(FOSSIL_TEST_EXPECT_AS, ptr1, ptr2, size)
+#define EXPECT_ITS_LESS_OR_EQUAL_MEMORY(ptr1, ptr2, size) \
+    _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_MEMORY(FOSSIL_TEST_EXPECT_AS, ptr1, ptr2, size)
+#define EXPECT_NOT_MORE_THAN_MEMORY(ptr1, ptr2, size) \
+    _FOSSIL_TEST_CHECK_NOT_MORE_THAN_MEMORY(FOSSIL_TEST_EXPECT_AS, ptr1, ptr2, size)
+#define EXPECT_NOT_LESS_THAN_MEMORY(ptr1, ptr2, size) \
+    _FOSSIL_TEST_CHECK_NOT_LESS_THAN_MEMORY(FOSSIL_TEST_EXPECT_AS, ptr1, ptr2, size)
+#define EXPECT_NOT_MORE_OR_EQUAL_MEMORY(ptr1, ptr2, size) \
+    _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_MEMORY(FOSSIL_TEST_EXPECT_AS, ptr1, ptr2, size)
+#define EXPECT_NOT_LESS_OR_EQUAL_MEMORY(ptr1, ptr2, size) \
+    _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_MEMORY(FOSSIL_TEST_EXPECT_AS, ptr1, ptr2, size)
+#define EXPECT_ITS_VALID_MEMORY(ptr) \
+    _FOSSIL_TEST_CHECK_ITS_VALID_MEMORY(FOSSIL_TEST_EXPECT_AS, ptr)
+#define EXPECT_NOT_VALID_MEMORY(ptr) \
+    _FOSSIL_TEST_CHECK_NOT_VALID_MEMORY(FOSSIL_TEST_EXPECT_AS, ptr)
+
+// **************************************************
+//
+// Null pointer expectations (_CNULL)
+//
+// **************************************************
+
+#define EXPECT_ITS_CNULL(actual) \
+    _FOSSIL_TEST_CHECK_ITS_CNULL(FOSSIL_TEST_EXPECT_AS, actual)
+#define EXPECT_NOT_CNULL(actual) \
+    _FOSSIL_TEST_CHECK_NOT_CNULL(FOSSIL_TEST_EXPECT_AS, actual)
+#define EXPECT_ITS_CNULLABLE(actual) \
+    _FOSSIL_TEST_CHECK_ITS_CNULLABLE(FOSSIL_TEST_EXPECT_AS, actual)
+#define EXPECT_NOT_CNULLABLE(actual) \
+    _FOSSIL_TEST_CHECK_NOT_CNULLABLE(FOSSIL_TEST_EXPECT_AS, actual)
+#define EXPECT_ITS_CNONNULL(actual) \
+    _FOSSIL_TEST_CHECK_ITS_CNONNULL(FOSSIL_TEST_EXPECT_AS, actual)
+#define EXPECT_NOT_CNONNULL(actual) \
+    _FOSSIL_TEST_CHECK_NOT_CNONNULL(FOSSIL_TEST_EXPECT_AS, actual)
+#define EXPECT_ITS_LIKELY(x) \
+    _FOSSIL_TEST_CHECK_ITS_LIKELY(FOSSIL_TEST_EXPECT_AS, x)
+#define EXPECT_NOT_LIKELY(x) \
+    _FOSSIL_TEST_CHECK_NOT_LIKELY(FOSSIL_TEST_EXPECT_AS, x)
+#define EXPECT_ITS_UNLIKELY(x) \
+    _FOSSIL_TEST_CHECK_ITS_UNLIKELY(FOSSIL_TEST_EXPECT_AS, x)
+#define EXPECT_NOT_UNLIKELY(x) \
+    _FOSSIL_TEST_CHECK_NOT_UNLIKELY(FOSSIL_TEST_EXPECT_AS, x)
+#define EXPECT_ITS_EQUAL_PTR(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_PTR(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_EQUAL_PTR(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_PTR(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_EQUAL_SIZE(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_SIZE(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_LESS_THAN_SIZE(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_LESS_THAN_SIZE(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_MORE_THAN_SIZE(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_MORE_THAN_SIZE(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_LESS_OR_EQUAL_SIZE(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_SIZE(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_MORE_OR_EQUAL_SIZE(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_SIZE(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_EQUAL_SIZE(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_SIZE(FOSSIL_TEST_EXPECT_AS, actual, expected)
+
+// **************************************************
+//
+// Range expectations
+//
+// **************************************************
+
+#define EXPECT_ITS_WITHIN_RANGE(value, min, max) \
+    _FOSSIL_TEST_CHECK_ITS_WITHIN_RANGE(FOSSIL_TEST_EXPECT_AS, value, min, max)
+#define EXPECT_NOT_WITHIN_RANGE(value, min, max) \
+    _FOSSIL_TEST_CHECK_NOT_WITHIN_RANGE(FOSSIL_TEST_EXPECT_AS, value, min, max)
+
+// Unsigned integer type expectations
+
+#define EXPECT_ITS_WITHIN_RANGE_U8(value, min, max) \
+    _FOSSIL_TEST_CHECK_ITS_WITHIN_RANGE_U8(FOSSIL_TEST_EXPECT_AS, value, min, max)
+#define EXPECT_NOT_WITHIN_RANGE_U8(value, min, max) \
+    _FOSSIL_TEST_CHECK_NOT_WITHIN_RANGE_U8(FOSSIL_TEST_EXPECT_AS, value, min, max)
+#define EXPECT_ITS_WITHIN_RANGE_U16(value, min, max) \
+    _FOSSIL_TEST_CHECK_ITS_WITHIN_RANGE_U16(FOSSIL_TEST_EXPECT_AS, value, min, max)
+#define EXPECT_NOT_WITHIN_RANGE_U16(value, min, max) \
+    _FOSSIL_TEST_CHECK_NOT_WITHIN_RANGE_U16(FOSSIL_TEST_EXPECT_AS, value, min, max)
+#define EXPECT_ITS_WITHIN_RANGE_U32(value, min, max) \
+    _FOSSIL_TEST_CHECK_ITS_WITHIN_RANGE_U32(FOSSIL_TEST_EXPECT_AS, value, min, max)
+#define EXPECT_NOT_WITHIN_RANGE_U32(value, min, max) \
+    _FOSSIL_TEST_CHECK_NOT_WITHIN_RANGE_U32(FOSSIL_TEST_EXPECT_AS, value, min, max)
+#define EXPECT_ITS_WITHIN_RANGE_U64(value, min, max) \
+    _FOSSIL_TEST_CHECK_ITS_WITHIN_RANGE_U64(FOSSIL_TEST_EXPECT_AS, value, min, max)
+#define EXPECT_NOT_WITHIN_RANGE_U64(value, min, max) \
+    _FOSSIL_TEST_CHECK_NOT_WITHIN_RANGE_U64(FOSSIL_TEST_EXPECT_AS, value, min, max)
+#define EXPECT_ITS_WITHIN_RANGE_I8(value, min, max) \
+    _FOSSIL_TEST_CHECK_ITS_WITHIN_RANGE_I8(FOSSIL_TEST_EXPECT_AS, value, min, max)
+#define EXPECT_NOT_WITHIN_RANGE_I8(value, min, max) \
+    _FOSSIL_TEST_CHECK_NOT_WITHIN_RANGE_I8(FOSSIL_TEST_EXPECT_AS, value, min, max)
+#define EXPECT_ITS_WITHIN_RANGE_I16(value, min, max) \
+    _FOSSIL_TEST_CHECK_ITS_WITHIN_RANGE_I16(FOSSIL_TEST_EXPECT_AS, value, min, max)
+#define EXPECT_NOT_WITHIN_RANGE_I16(value, min, max) \
+    _FOSSIL_TEST_CHECK_NOT_WITHIN_RANGE_I16(FOSSIL_TEST_EXPECT_AS, value, min, max)
+#define EXPECT_ITS_WITHIN_RANGE_I32(value, min, max) \
+    _FOSSIL_TEST_CHECK_ITS_WITHIN_RANGE_I32(FOSSIL_TEST_EXPECT_AS, value, min, max)
+#define EXPECT_NOT_WITHIN_RANGE_I32(value, min, max) \
+    _FOSSIL_TEST_CHECK_NOT_WITHIN_RANGE_I32(FOSSIL_TEST_EXPECT_AS, value, min, max)
+#define EXPECT_ITS_WITHIN_RANGE_I64(value, min, max) \
+    _FOSSIL_TEST_CHECK_ITS_WITHIN_RANGE_I64(FOSSIL_TEST_EXPECT_AS, value, min, max)
+#define EXPECT_NOT_WITHIN_RANGE_I64(value, min, max) \
+    _FOSSIL_TEST_CHECK_NOT_WITHIN_RANGE_I64(FOSSIL_TEST_EXPECT_AS, value, min, max)
+#define EXPECT_ITS_WITHIN_RANGE_F32(value, min, max) \
+    _FOSSIL_TEST_CHECK_ITS_WITHIN_RANGE_F32(FOSSIL_TEST_EXPECT_AS, value, min, max)
+#define EXPECT_NOT_WITHIN_RANGE_F32(value, min, max) \
+    _FOSSIL_TEST_CHECK_NOT_WITHIN_RANGE_F32(FOSSIL_TEST_EXPECT_AS, value, min, max)
+#define EXPECT_ITS_WITHIN_RANGE_F64(value, min, max) \
+    _FOSSIL_TEST_CHECK_ITS_WITHIN_RANGE_F64(FOSSIL_TEST_EXPECT_AS, value, min, max)
+#define EXPECT_NOT_WITHIN_RANGE_F64(value, min, max) \
+    _FOSSIL_TEST_CHECK_NOT_WITHIN_RANGE_F64(FOSSIL_TEST_EXPECT_AS, value, min, max)
+
+// Byte char type expectations (uint8_t)
+
+#define EXPECT_ITS_WITHIN_RANGE_BCHAR(value, min, max) \
+    _FOSSIL_TEST_CHECK_ITS_WITHIN_RANGE_BCHAR(FOSSIL_TEST_EXPECT_AS, value, min, max)
+#define EXPECT_NOT_WITHIN_RANGE_BCHAR(value, min, max) \
+    _FOSSIL_TEST_CHECK_NOT_WITHIN_RANGE_BCHAR(FOSSIL_TEST_EXPECT_AS, value, min, max)
+
+// Char type expectations (char)
+
+#define EXPECT_ITS_WITHIN_RANGE_CCHAR(value, min, max) \
+    _FOSSIL_TEST_CHECK_ITS_WITHIN_RANGE_CCHAR(FOSSIL_TEST_EXPECT_AS, value, min, max)
+#define EXPECT_NOT_WITHIN_RANGE_CCHAR(value, min, max) \
+    _FOSSIL_TEST_CHECK_NOT_WITHIN_RANGE_CCHAR(FOSSIL_TEST_EXPECT_AS, value, min, max)
+
+// **************************************************
+//
+// String expectations
+//
+// **************************************************
+
+#define EXPECT_ITS_EQUAL_CSTR(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_CSTR(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_EQUAL_CSTR(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_CSTR(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_LENGTH_EQUAL_CSTR(actual, expected_len) \
+    _FOSSIL_TEST_CHECK_ITS_LENGTH_EQUAL_CSTR(FOSSIL_TEST_EXPECT_AS, actual, expected_len)
+#define EXPECT_NOT_LENGTH_EQUAL_CSTR(actual, expected_len) \
+    _FOSSIL_TEST_CHECK_NOT_LENGTH_EQUAL_CSTR(FOSSIL_TEST_EXPECT_AS, actual, expected_len)
+#define EXPECT_ITS_CSTR_STARTS_WITH(str, prefix) \
+    _FOSSIL_TEST_CHECK_ITS_CSTR_STARTS_WITH(FOSSIL_TEST_EXPECT_AS, str, prefix)
+#define EXPECT_NOT_CSTR_STARTS_WITH(str, prefix) \
+    _FOSSIL_TEST_CHECK_NOT_CSTR_STARTS_WITH(FOSSIL_TEST_EXPECT_AS, str, prefix)
+#define EXPECT_ITS_CSTR_ENDS_WITH(str, suffix) \
+    _FOSSIL_TEST_CHECK_ITS_CSTR_ENDS_WITH(FOSSIL_TEST_EXPECT_AS, str, suffix)
+#define EXPECT_NOT_CSTR_ENDS_WITH(str, suffix) \
+    _FOSSIL_TEST_CHECK_NOT_CSTR_ENDS_WITH(FOSSIL_TEST_EXPECT_AS, str, suffix)
+#define EXPECT_ITS_CSTR_CONTAINS(str, substr) \
+    _FOSSIL_TEST_CHECK_ITS_CSTR_CONTAINS(FOSSIL_TEST_EXPECT_AS, str, substr)
+#define EXPECT_NOT_CSTR_CONTAINS(str, substr) \
+    _FOSSIL_TEST_CHECK_NOT_CSTR_CONTAINS(FOSSIL_TEST_EXPECT_AS, str, substr)
+#define EXPECT_ITS_CSTR_COUNT(str, substr, count) \
+    _FOSSIL_TEST_CHECK_ITS_CSTR_COUNT(FOSSIL_TEST_EXPECT_AS, str, substr, count)
+#define EXPECT_NOT_CSTR_COUNT(str, substr, count) \
+    _FOSSIL_TEST_CHECK_NOT_CSTR_COUNT(FOSSIL_TEST_EXPECT_AS, str, substr, count)
+
+// **************************************************
+//
+// Char expectations
+//
+// **************************************************
+
+#define EXPECT_ITS_EQUAL_CHAR(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_CHAR(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_EQUAL_CHAR(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_CHAR(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_LESS_THAN_CHAR(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_LESS_THAN_CHAR(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_MORE_THAN_CHAR(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_MORE_THAN_CHAR(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_LESS_OR_EQUAL_CHAR(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_LESS_OR_EQUAL_CHAR(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_MORE_OR_EQUAL_CHAR(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_MORE_OR_EQUAL_CHAR(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_LESS_THAN_CHAR(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_LESS_THAN_CHAR(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_MORE_THAN_CHAR(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_MORE_THAN_CHAR(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_LESS_OR_EQUAL_CHAR(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_LESS_OR_EQUAL_CHAR(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_MORE_OR_EQUAL_CHAR(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_MORE_OR_EQUAL_CHAR(FOSSIL_TEST_EXPECT_AS, actual, expected)
+
+// **************************************************
+// SOAP expectations
+// ************************************************
+
+#define EXPECT_NOT_SOAP_ROT_BRAIN(text) \
+    _FOSSIL_TEST_CHECK_NOT_SOAP_ROT_BRAIN(FOSSIL_TEST_EXPECT_AS, text)
+#define EXPECT_ITS_SOAP_ROT_BRAIN(text) \
+    _FOSSIL_TEST_CHECK_ITS_SOAP_ROT_BRAIN(FOSSIL_TEST_EXPECT_AS, text)
+#define EXPECT_ITS_SOAP_TONE_DETECTED(text, expected_tone) \
+    _FOSSIL_TEST_CHECK_ITS_SOAP_TONE_DETECTED(FOSSIL_TEST_EXPECT_AS, text, expected_tone)
+#define EXPECT_NOT_SOAP_TONE_DETECTED(text, expected_tone) \
+    _FOSSIL_TEST_CHECK_NOT_SOAP_TONE_DETECTED(FOSSIL_TEST_EXPECT_AS, text, expected_tone)
+
+// **************************************************
+// Time expectations
+// ************************************************
+
+#define EXPECT_ITS_TIME_WITHIN_TOLERANCE(elapsed_ns, expected_ns, tolerance_ns) \
+    _FOSSIL_TEST_CHECK_ITS_TIME_WITHIN_TOLERANCE(FOSSIL_TEST_EXPECT_AS, elapsed_ns, expected_ns, tolerance_ns)
+#define EXPECT_ITS_TIME_AT_LEAST(elapsed_ns, min_ns) \
+    _FOSSIL_TEST_CHECK_ITS_TIME_AT_LEAST(FOSSIL_TEST_EXPECT_AS, elapsed_ns, min_ns)
+#define EXPECT_ITS_TIME_AT_MOST(elapsed_ns, max_ns) \
+    _FOSSIL_TEST_CHECK_ITS_TIME_AT_MOST(FOSSIL_TEST_EXPECT_AS, elapsed_ns, max_ns)
+#define EXPECT_ITS_TIME_WITHIN_RANGE(elapsed_ns, min_ns, max_ns) \
+    _FOSSIL_TEST_CHECK_ITS_TIME_WITHIN_RANGE(FOSSIL_TEST_EXPECT_AS, elapsed_ns, min_ns, max_ns)
+#define EXPECT_ITS_TIME_FASTER_THAN(elapsed_ns_1, elapsed_ns_2) \
+    _FOSSIL_TEST_CHECK_ITS_TIME_FASTER_THAN(FOSSIL_TEST_EXPECT_AS, elapsed_ns_1, elapsed_ns_2)
+#define EXPECT_ITS_TIME_SLOWER_THAN(elapsed_ns_1, elapsed_ns_2) \
+    _FOSSIL_TEST_CHECK_ITS_TIME_SLOWER_THAN(FOSSIL_TEST_EXPECT_AS, elapsed_ns_1, elapsed_ns_2)
+#define EXPECT_ITS_TIME_EQUIVALENT(elapsed_ns_1, elapsed_ns_2, tolerance_ns) \
+    _FOSSIL_TEST_CHECK_ITS_TIME_EQUIVALENT(FOSSIL_TEST_EXPECT_AS, elapsed_ns_1, elapsed_ns_2, tolerance_ns)
+#define EXPECT_ITS_TIME_MONOTONIC(time_before_ns, time_after_ns) \
+    _FOSSIL_TEST_CHECK_ITS_TIME_MONOTONIC(FOSSIL_TEST_EXPECT_AS, time_before_ns, time_after_ns)
+#define EXPECT_ITS_DEADLINE_MET(elapsed_ns, deadline_ns) \
+    _FOSSIL_TEST_CHECK_ITS_DEADLINE_MET(FOSSIL_TEST_EXPECT_AS, elapsed_ns, deadline_ns)
+#define EXPECT_ITS_DEADLINE_MISSED(elapsed_ns, deadline_ns) \
+    _FOSSIL_TEST_CHECK_ITS_DEADLINE_MISSED(FOSSIL_TEST_EXPECT_AS, elapsed_ns, deadline_ns)
+
+// **************************************************
+// Hash expectations
+// ************************************************
+
+#define EXPECT_ITS_EQUAL_HASH(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_HASH(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_EQUAL_HASH(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_HASH(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_VALID_HASH(hash) \
+    _FOSSIL_TEST_CHECK_ITS_VALID_HASH(FOSSIL_TEST_EXPECT_AS, hash)
+#define EXPECT_NOT_VALID_HASH(hash) \
+    _FOSSIL_TEST_CHECK_NOT_VALID_HASH(FOSSIL_TEST_EXPECT_AS, hash)
+#define EXPECT_ITS_EQUAL_HASH_BYTES(actual, expected, size) \
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_HASH_BYTES(FOSSIL_TEST_EXPECT_AS, actual, expected, size)
+#define EXPECT_NOT_EQUAL_HASH_BYTES(actual, expected, size) \
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_HASH_BYTES(FOSSIL_TEST_EXPECT_AS, actual, expected, size)
+#define EXPECT_ITS_DETERMINISTIC_HASH(hash1, hash2) \
+    _FOSSIL_TEST_CHECK_ITS_DETERMINISTIC_HASH(FOSSIL_TEST_EXPECT_AS, hash1, hash2)
+#define EXPECT_ITS_HASH_COLLISION_RESISTANT(hash1, hash2) \
+    _FOSSIL_TEST_CHECK_ITS_HASH_COLLISION_RESISTANT(FOSSIL_TEST_EXPECT_AS, hash1, hash2)
+#define EXPECT_ITS_HASH_DISTRIBUTED(hash) \
+    _FOSSIL_TEST_CHECK_ITS_HASH_DISTRIBUTED(FOSSIL_TEST_EXPECT_AS, hash)
+
+// **************************************************
+// Bitwise expectations
+// ************************************************
+
+#define EXPECT_ITS_BIT_SET(value, flag) \
+    _FOSSIL_TEST_CHECK_ITS_BIT_SET(FOSSIL_TEST_EXPECT_AS, value, flag)
+#define EXPECT_NOT_BIT_SET(value, flag) \
+    _FOSSIL_TEST_CHECK_NOT_BIT_SET(FOSSIL_TEST_EXPECT_AS, value, flag)
+#define EXPECT_ITS_BITMASK_SET(value, mask) \
+    _FOSSIL_TEST_CHECK_ITS_BITMASK_SET(FOSSIL_TEST_EXPECT_AS, value, mask)
+#define EXPECT_NOT_BITMASK_SET(value, mask) \
+    _FOSSIL_TEST_CHECK_NOT_BITMASK_SET(FOSSIL_TEST_EXPECT_AS, value, mask)
+#define EXPECT_ITS_BIT_POSITION_SET(value, bit) \
+    _FOSSIL_TEST_CHECK_ITS_BIT_POSITION_SET(FOSSIL_TEST_EXPECT_AS, value, bit)
+#define EXPECT_NOT_BIT_POSITION_SET(value, bit) \
+    _FOSSIL_TEST_CHECK_NOT_BIT_POSITION_SET(FOSSIL_TEST_EXPECT_AS, value, bit)
+#define EXPECT_ITS_BIT_COUNT(value, expected_count) \
+    _FOSSIL_TEST_CHECK_ITS_BIT_COUNT(FOSSIL_TEST_EXPECT_AS, value, expected_count)
+#define EXPECT_NOT_BIT_COUNT(value, expected_count) \
+    _FOSSIL_TEST_CHECK_NOT_BIT_COUNT(FOSSIL_TEST_EXPECT_AS, value, expected_count)
+#define EXPECT_ITS_POWER_OF_TWO(value) \
+    _FOSSIL_TEST_CHECK_ITS_POWER_OF_TWO(FOSSIL_TEST_EXPECT_AS, value)
+#define EXPECT_NOT_POWER_OF_TWO(value) \
+    _FOSSIL_TEST_CHECK_NOT_POWER_OF_TWO(FOSSIL_TEST_EXPECT_AS, value)
+#define EXPECT_ITS_EQUAL_BITS(actual, expected) \
+    _FOSSIL_TEST_CHECK_ITS_EQUAL_BITS(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_NOT_EQUAL_BITS(actual, expected) \
+    _FOSSIL_TEST_CHECK_NOT_EQUAL_BITS(FOSSIL_TEST_EXPECT_AS, actual, expected)
+#define EXPECT_ITS_BITWISE_AND_EQUAL(value, mask, expected) \
+    _FOSSIL_TEST_CHECK_ITS_BITWISE_AND_EQUAL(FOSSIL_TEST_EXPECT_AS, value, mask, expected)
+#define EXPECT_ITS_BITWISE_OR_EQUAL(value, mask, expected) \
+    _FOSSIL_TEST_CHECK_ITS_BITWISE_OR_EQUAL(FOSSIL_TEST_EXPECT_AS, value, mask, expected)
+#define EXPECT_ITS_BITWISE_XOR_EQUAL(value, mask, expected) \
+    _FOSSIL_TEST_CHECK_ITS_BITWISE_XOR_EQUAL(FOSSIL_TEST_EXPECT_AS, value, mask, expected)
+#define EXPECT_ITS_SHIFT_LEFT_EQUAL(value, shift, expected) \
+    _FOSSIL_TEST_CHECK_ITS_SHIFT_LEFT_EQUAL(FOSSIL_TEST_EXPECT_AS, value, shift, expected)
+#define EXPECT_ITS_SHIFT_RIGHT_EQUAL(value, shift, expected) \
+    _FOSSIL_TEST_CHECK_ITS_SHIFT_RIGHT_EQUAL(FOSSIL_TEST_EXPECT_AS, value, shift, expected)
+#define EXPECT_ITS_ROTATE_LEFT_EQUAL(value, n, expected) \
+    _FOSSIL_TEST_CHECK_ITS_ROTATE_LEFT_EQUAL(FOSSIL_TEST_EXPECT_AS, value, n, expected)
+#define EXPECT_ITS_ROTATE_RIGHT_EQUAL(value, n, expected) \
+    _FOSSIL_TEST_CHECK_ITS_ROTATE_RIGHT_EQUAL(FOSSIL_TEST_EXPECT_AS, value, n, expected)
+
+// **************************************************
+// Security expectations
+// ************************************************
+
+#define EXPECT_ITS_BUFFER_OVERFLOW_SAFE(buffer_size, required_size) \
+    _FOSSIL_TEST_CHECK_ITS_BUFFER_OVERFLOW_SAFE(FOSSIL_TEST_EXPECT_AS, buffer_size, required_size)
+#define EXPECT_ITS_ALIGNED_PTR(ptr, alignment) \
+    _FOSSIL_TEST_CHECK_ITS_ALIGNED_PTR(FOSSIL_TEST_EXPECT_AS, ptr, alignment)
+#define EXPECT_ITS_INPUT_VALIDATED(value, min, max) \
+    _FOSSIL_TEST_CHECK_ITS_INPUT_VALIDATED(FOSSIL_TEST_EXPECT_AS, value, min, max)
+#define EXPECT_ITS_SAFE_CSTR(str, max_len) \
+    _FOSSIL_TEST_CHECK_ITS_SAFE_CSTR(FOSSIL_TEST_EXPECT_AS, str, max_len)
+#define EXPECT_NO_INTEGER_OVERFLOW_ADD(a, b, result) \
+    _FOSSIL_TEST_CHECK_NO_INTEGER_OVERFLOW_ADD(FOSSIL_TEST_EXPECT_AS, a, b, result)
+#define EXPECT_NO_INTEGER_UNDERFLOW_SUB(a, b, result) \
+    _FOSSIL_TEST_CHECK_NO_INTEGER_UNDERFLOW_SUB(FOSSIL_TEST_EXPECT_AS, a, b, result)
+#define EXPECT_NO_MULTIPLICATION_OVERFLOW(a, b) \
+    _FOSSIL_TEST_CHECK_NO_MULTIPLICATION_OVERFLOW(FOSSIL_TEST_EXPECT_AS, a, b)
+#define EXPECT_ITS_RANDOM_ENTROPY(random_value) \
+    _FOSSIL_TEST_CHECK_ITS_RANDOM_ENTROPY(FOSSIL_TEST_EXPECT_AS, random_value)
+#define EXPECT_ITS_SECURE_CLEARED(ptr, size) \
+    _FOSSIL_TEST_CHECK_ITS_SECURE_CLEARED(FOSSIL_TEST_EXPECT_AS, ptr, size)
+#define EXPECT_ITS_VALID_FD(fd) \
+    _FOSSIL_TEST_CHECK_ITS_VALID_FD(FOSSIL_TEST_EXPECT_AS, fd)
+#define EXPECT_ITS_VALID_KEY_LENGTH(key_len, expected_len) \
+    _FOSSIL_TEST_CHECK_ITS_VALID_KEY_LENGTH(FOSSIL_TEST_EXPECT_AS, key_len, expected_len)
+#define EXPECT_ITS_SESSION_VALID(current_time, expiry_time) \
+    _FOSSIL_TEST_CHECK_ITS_SESSION_VALID(FOSSIL_TEST_EXPECT_AS, current_time, expiry_time)
+#define EXPECT_ITS_BOUNDS_CHECKED(index, array_size) \
+    _FOSSIL_TEST_CHECK_ITS_BOUNDS_CHECKED(FOSSIL_TEST_EXPECT_AS, index, array_size)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
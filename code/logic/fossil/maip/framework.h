@@ -27,6 +27,7 @@
 
 #include "common.h"
 #include "assume.h"
+#include "expect.h"
 #include "sanity.h"
 #include "mark.h"
 #include "test.h"
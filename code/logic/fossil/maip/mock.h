@@ -172,6 +172,10 @@ FOSSIL_MAIP_API void fossil_mock_print_ai_context(const fossil_mock_ai_context_t
 /**
  * Captures the output of a function to a buffer for testing purposes.
  *
+ * Under `run --threads` the capturing case waits for the other runner
+ * threads to finish their cases and holds them off until the function
+ * returns, so no output of theirs lands in the buffer.
+ *
  * @param buffer The buffer to store the captured output.
  * @param size The size of the buffer.
  * @param function The function whose output is to be captured.
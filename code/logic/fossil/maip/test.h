@@ -26,6 +26,8 @@
 #define FOSSIL_TEST_H
 
 #include "common.h"
+#include <setjmp.h>
+#include <signal.h>
 
 #ifdef __cplusplus
 extern "C"
@@ -39,6 +41,9 @@ enum
     FOSSIL_MAIP_FAILURE = -1
 };
 
+#define FOSSIL_MAIP_MESSAGE_SIZE 256 // Longest failure message kept for a case
+#define FOSSIL_MAIP_EXPECT_MAX 16 // Failed expectations a case keeps for its report
+
 typedef enum
 {
     FOSSIL_MAIP_CASE_EMPTY = 0,
@@ -49,6 +54,41 @@ typedef enum
     FOSSIL_MAIP_CASE_UNEXPECTED
 } fossil_maip_state_t;
 
+// --- Assertion Classification ---
+// Root cause category and operator of an assertion. The assume.h macros pass
+// both as constants; free-form FOSSIL_TEST_ASSUME leaves them unknown and the
+// failure is classified from its message instead.
+typedef enum
+{
+    FOSSIL_MAIP_CAUSE_UNKNOWN = 0,
+    FOSSIL_MAIP_CAUSE_LOGIC,
+    FOSSIL_MAIP_CAUSE_TIMEOUT,
+    FOSSIL_MAIP_CAUSE_MEMORY,
+    FOSSIL_MAIP_CAUSE_IO,
+    FOSSIL_MAIP_CAUSE_COVERAGE,
+    FOSSIL_MAIP_CAUSE_RANGE,
+    FOSSIL_MAIP_CAUSE_FLOAT,
+    FOSSIL_MAIP_CAUSE_STRING,
+    FOSSIL_MAIP_CAUSE_TEXT
+} fossil_maip_cause_t;
+
+typedef enum
+{
+    FOSSIL_MAIP_OP_NONE = 0,
+    FOSSIL_MAIP_OP_TRUE,    // Value is true
+    FOSSIL_MAIP_OP_FALSE,   // Value is false
+    FOSSIL_MAIP_OP_EQ,      // actual == expected
+    FOSSIL_MAIP_OP_NE,      // actual != expected
+    FOSSIL_MAIP_OP_LT,      // actual < expected
+    FOSSIL_MAIP_OP_LE,      // actual <= expected
+    FOSSIL_MAIP_OP_GT,      // actual > expected
+    FOSSIL_MAIP_OP_GE,      // actual >= expected
+    FOSSIL_MAIP_OP_WITHIN,  // min <= actual <= max
+    FOSSIL_MAIP_OP_OUTSIDE, // actual outside [min, max]
+    FOSSIL_MAIP_OP_IS,      // Property named by the macro holds (NaN, zeroed, prefix, ...)
+    FOSSIL_MAIP_OP_IS_NOT   // Property named by the macro does not hold
+} fossil_maip_op_t;
+
 // --- Score Struct ---
 typedef struct
 {
@@ -60,6 +100,61 @@ typedef struct
     int empty;
 } fossil_maip_score_t;
 
+// --- Latency Histogram ---
+// Durations of every --repeat iteration of a case, in log-linear buckets:
+// below 2^FOSSIL_MAIP_LATENCY_SUB_BITS ns every value has its own bucket, above
+// that each power of two is split into 2^FOSSIL_MAIP_LATENCY_SUB_BITS buckets,
+// which bounds the error of a reported percentile to 1/16 of its value.
+#define FOSSIL_MAIP_LATENCY_SUB_BITS 4
+#define FOSSIL_MAIP_LATENCY_BUCKETS ((64 - FOSSIL_MAIP_LATENCY_SUB_BITS + 1) << FOSSIL_MAIP_LATENCY_SUB_BITS)
+
+typedef struct
+{
+    uint32_t runs;     // Iterations recorded
+    uint32_t failures; // Iterations that failed, timed out or crashed
+    uint64_t min_ns;
+    uint64_t max_ns;
+    uint32_t buckets[FOSSIL_MAIP_LATENCY_BUCKETS];
+} fossil_maip_latency_t;
+
+// --- Async Cases ---
+// A FOSSIL_TEST_ASYNC body is a continuation: it runs until it has to wait,
+// registers what it waits for and returns FOSSIL_MAIP_ASYNC_PENDING, and is
+// called again from the same point once the descriptor is ready or the timer
+// fires. The runner interleaves the waiting cases of a suite on one thread.
+#define FOSSIL_MAIP_ASYNC_DONE 0
+#define FOSSIL_MAIP_ASYNC_PENDING 1
+
+#define FOSSIL_MAIP_ASYNC_READ 0x1
+#define FOSSIL_MAIP_ASYNC_WRITE 0x2
+
+typedef struct fossil_maip_async
+{
+    int resume;       // Where the body continues (0 = from the top)
+    int fd;           // Descriptor the body waits on (-1 = none)
+    unsigned events;  // FOSSIL_MAIP_ASYNC_READ and/or FOSSIL_MAIP_ASYNC_WRITE
+    uint64_t wake_ns; // Monotonic time the wait gives up (0 = never)
+    unsigned ready;   // Events that ended the last wait (0 = it timed out)
+    void *data;       // Free for the body: locals do not survive a wait
+} fossil_maip_async_t;
+
+// --- Parameter Tables ---
+// A FOSSIL_TEST_PARAM case points at a static table of rows. When the run
+// starts the engine replaces it with one case per row, named "case/row", which
+// reads its row from the shared table through FOSSIL_TEST_PARAM_ROW.
+typedef struct
+{
+    const void *table; // Static rows (NULL = not parameterized)
+    size_t size;       // Bytes per row
+    size_t count;      // Rows still to expand (0 once the case is a single row)
+    size_t row;        // Row of an expanded case
+} fossil_maip_param_t;
+
+// Distinct tags the engine indexes; each case keeps one bit per tag. Fixed,
+// as it sizes fossil_maip_case_t, which user code and the library share.
+#define FOSSIL_MAIP_TAG_MAX 256
+#define FOSSIL_MAIP_TAG_WORDS ((FOSSIL_MAIP_TAG_MAX + 63) / 64)
+
 // --- Test Case ---
 typedef struct
 {
@@ -74,6 +169,23 @@ typedef struct
     uint64_t elapsed_ns;               // Timing in nanoseconds
     int64_t priority;                  // Priority level (lower = higher priority)
     fossil_maip_state_t state; // Outcome of the test case
+    uint64_t timeout_ns;               // Time budget (0 = inherit from suite/run)
+    int crash_signal;                  // Signal that ended the case (0 = none)
+    uintptr_t crash_address;           // Faulting address reported with crash_signal
+    int assert_count;                  // Assertions evaluated by the last run
+    char *message;                     // Failure message of the last run (NULL once it passes)
+    uint64_t cpu_ns;                   // Thread CPU time of the last run in nanoseconds
+    uint64_t expected_ns;              // Duration estimate from earlier runs (0 = unknown)
+    uint32_t shard;                    // Shard the case was assigned to by run --shard
+    char *site;                        // "file:line" of the assertion that failed the last run
+    bool failed_before;                // Failed, timed out or crashed in the last recorded run
+    uint64_t tag_bits[FOSSIL_MAIP_TAG_WORDS]; // Ids of the tags, indexed by the engine at run time
+    fossil_maip_latency_t *latency;    // Every --repeat iteration (NULL when run once)
+    int (*async)(fossil_maip_async_t *async); // Body of a FOSSIL_TEST_ASYNC case (NULL otherwise)
+    char *depends;                     // Comma-separated cases or suites that must pass first
+    fossil_maip_param_t param;         // Parameter table, see FOSSIL_TEST_PARAM
+    int cause;                         // fossil_maip_cause_t of the assertion that failed the last run
+    int op;                            // fossil_maip_op_t of that assertion
 } fossil_maip_case_t;
 
 // --- Test Suite ---
@@ -92,8 +204,18 @@ typedef struct
     int total_possible;
 
     fossil_maip_score_t score;
+    uint64_t timeout_ns; // Time budget for each case (0 = inherit from run)
 } fossil_maip_suite_t;
 
+// Case selection compiled from the pallet by fossil_maip_start (see test.c)
+typedef struct fossil_maip_filter fossil_maip_filter_t;
+
+// Dependency graph resolved by fossil_maip_run_all (see test.c)
+typedef struct fossil_maip_graph fossil_maip_graph_t;
+
+// Failures grouped by fingerprint at the end of fossil_maip_run_all (see test.c)
+typedef struct fossil_maip_clusters fossil_maip_clusters_t;
+
 // In fossil_maip_engine_t
 typedef struct
 {
@@ -107,8 +229,90 @@ typedef struct
     fossil_maip_score_t score;
 
     fossil_maip_pallet_t pallet; // CLI + config
+    fossil_maip_filter_t *filter; // Compiled filter, run --only and run --skip lists
+    fossil_maip_graph_t *graph;   // Case dependencies (NULL when no case declares any)
+    char *param_names;            // Names of the expanded parameter rows
+    fossil_maip_clusters_t *clusters; // Distinct assertion failures of the last run
 } fossil_maip_engine_t;
 
+// --- Static Registration ---
+// Descriptor emitted next to each FOSSIL_SUITE_TEST case. On ELF targets the
+// descriptors are laid out back to back in the fossil_maip_entries section and
+// walked by fossil_maip_start; elsewhere a constructor links them into a list.
+#if defined(__ELF__) && (defined(__GNUC__) || defined(__clang__))
+#define FOSSIL_MAIP_SECTION_REGISTRY 1
+#endif
+
+typedef struct fossil_maip_entry
+{
+    fossil_maip_suite_t *suite;      // Suite the case belongs to
+    fossil_maip_case_t *test_case;   // Case descriptor
+    struct fossil_maip_entry *next;  // Next entry (constructor registry only)
+} fossil_maip_entry_t;
+
+// --- Assertion Sites ---
+// Static descriptor of one assertion in the source, emitted by the assertion
+// macro itself. In C on ELF targets the descriptors are laid out back to back
+// in the fossil_maip_sites section, so the run knows every site before it
+// first executes. C++ keeps them out of the section, as a site in an inline
+// function or template is a COMDAT object whose section type would clash
+// with the plain ones; there, as on other targets, a site registers itself
+// the first time it runs.
+#if defined(FOSSIL_MAIP_SECTION_REGISTRY) && !defined(__cplusplus)
+#define FOSSIL_MAIP_SITE_SECTION 1
+#endif
+
+typedef struct
+{
+    const char *file; // Source file of the assertion
+    const char *func; // Function containing it
+    int line;         // Source line
+    int cause;        // fossil_maip_cause_t the macro passed
+    int op;           // fossil_maip_op_t the macro passed
+    uint32_t index;   // Slot of the site in the tally arrays, plus one (0 = not known yet)
+} fossil_maip_site_t;
+
+// --- Expectations ---
+// One failed EXPECT_* check, kept by the context until its case ends.
+typedef struct
+{
+    const char *file; // Source file of the expectation
+    const char *func; // Function containing it
+    int line;         // Source line
+    int cause;        // fossil_maip_cause_t the macro passed
+    int op;           // fossil_maip_op_t the macro passed
+    char message[FOSSIL_MAIP_MESSAGE_SIZE];
+} fossil_maip_expect_t;
+
+// --- Execution Context ---
+// Per-thread state of the case being executed. Assertions record into and jump
+// back through the context of the calling thread, so cases may run on threads.
+#if defined(_WIN32)
+typedef jmp_buf fossil_maip_jump_t;
+#else
+typedef sigjmp_buf fossil_maip_jump_t; // Restores the signal mask when a timeout unwinds a case
+#endif
+
+typedef struct
+{
+    fossil_maip_jump_t jump;                  // Landing point for failed assertions and timeouts
+    int assert_count;                         // Assertions evaluated by the current case
+    fossil_maip_case_t *current_case;         // Case being executed, or NULL
+    const char *last_file;                    // Site of the previous failed assertion
+    int last_line;                            // Its source line
+    int anomaly_count;                        // Repeats of that failed assertion
+    volatile sig_atomic_t guarded;            // Set while a crash may unwind the case body
+    int fault_signal;                         // Signal caught while the case body ran
+    void *fault_address;                      // Faulting address reported with fault_signal
+    const char *fail_file;                    // Source file of the assertion that failed the case
+    int fail_line;                            // Source line of that assertion
+    int fail_cause;                           // fossil_maip_cause_t of that assertion
+    int fail_op;                              // fossil_maip_op_t of that assertion
+    char message[FOSSIL_MAIP_MESSAGE_SIZE];   // Message of the assertion that failed the case
+    int expect_count;                         // Expectations that failed in the current case
+    fossil_maip_expect_t expects[FOSSIL_MAIP_EXPECT_MAX]; // The first of them, in order
+} fossil_maip_context_t;
+
 // --- Initialization ---
 
 /** * Initializes a new fossil_maip_engine_t instance.
@@ -135,6 +339,12 @@ FOSSIL_MAIP_API int fossil_maip_add_suite(fossil_maip_engine_t *engine, fossil_m
  */
 FOSSIL_MAIP_API int fossil_maip_add_case(fossil_maip_suite_t *suite, fossil_maip_case_t test_case);
 
+/** Registers a statically declared case before main runs.
+ * Used by FOSSIL_SUITE_TEST where the linker section registry is unavailable.
+ * @param entry Pointer to the entry, which must outlive the engine.
+ */
+FOSSIL_MAIP_API void fossil_maip_register(fossil_maip_entry_t *entry);
+
 // --- Execution ---
 
 /** Runs a single test suite.
@@ -156,11 +366,69 @@ FOSSIL_MAIP_API int fossil_maip_run_all(fossil_maip_engine_t *engine);
  */
 FOSSIL_MAIP_API void fossil_maip_summary(const fossil_maip_engine_t *engine);
 
+/**
+ * @brief Keeps the runner resident on a Unix domain socket (the serve command).
+ *
+ * Every suite is set up once; each request line, in the CLI syntax, is run by
+ * a child forked from the server, which streams the output back. The server
+ * re-executes itself when its executable is rebuilt, and stops on "quit".
+ * With serve --send it forwards one request to a running server instead.
+ *
+ * @param engine Pointer to the engine instance, with its cases registered.
+ * @return Does not return unless the server cannot start.
+ */
+FOSSIL_MAIP_API int fossil_maip_serve(fossil_maip_engine_t *engine);
+
 /** Cleans up and ends the test engine.
  * @param engine Pointer to the engine instance.
  */
 FOSSIL_MAIP_API int32_t fossil_maip_end(fossil_maip_engine_t *engine);
 
+/**
+ * @brief Registers what an async case waits for; used by FOSSIL_ASYNC_AWAIT_FD.
+ *
+ * @param async The waiting case's async state.
+ * @param fd Descriptor to wait on, or -1 for a plain timer.
+ * @param events FOSSIL_MAIP_ASYNC_READ and/or FOSSIL_MAIP_ASYNC_WRITE.
+ * @param timeout_ms Milliseconds until the wait gives up (0 = never, or at once
+ *                   for a plain timer).
+ */
+FOSSIL_MAIP_API void fossil_maip_async_wait(fossil_maip_async_t *async, int fd, unsigned events, uint64_t timeout_ms);
+
+/**
+ * @brief Returns the table row of the running parameterized case.
+ *
+ * @return The row, or NULL when the running case has no parameter table.
+ */
+FOSSIL_MAIP_API const void *fossil_maip_param_row(void);
+
+/**
+ * @brief Returns the row index of the running parameterized case (0 otherwise).
+ */
+FOSSIL_MAIP_API size_t fossil_maip_param_index(void);
+
+/**
+ * @brief Evaluates a tag expression against one tag list, as filter --tag
+ * does for each case.
+ *
+ * @param expression Tags joined by &, |, ! and parentheses; a tag may use the
+ *                   '*' and '?' globs and ',' lists alternatives.
+ * @param tags Comma-separated tags of a case.
+ * @return 1 when the tags match, 0 when they do not, and FOSSIL_MAIP_FAILURE
+ *         when the expression is malformed.
+ */
+FOSSIL_MAIP_API int fossil_maip_tag_match(const char *expression, const char *tags);
+
+/**
+ * @brief Returns the execution context of the calling thread.
+ *
+ * Each thread that runs test cases owns its own context, holding the assertion
+ * jump buffer, assertion count, current case and anomaly detection state.
+ *
+ * @return Pointer to the calling thread's context.
+ */
+FOSSIL_MAIP_API fossil_maip_context_t *fossil_maip_context(void);
+
 /**
  * @brief Internal function to handle assertions with anomaly detection.
  *
@@ -175,11 +443,91 @@ FOSSIL_MAIP_API int32_t fossil_maip_end(fossil_maip_engine_t *engine);
  */
 FOSSIL_MAIP_API void maip_test_assert_internal(bool condition, const char *message, const char *file, int line, const char *func);
 
+/**
+ * @brief Internal function counting an assertion that held.
+ *
+ * The assertion macros call it on their pass path instead of
+ * maip_test_assert_internal, whose message argument is then never evaluated.
+ */
+FOSSIL_MAIP_API void maip_test_assert_pass(void);
+
+/**
+ * @brief Internal function reporting an assertion that failed.
+ *
+ * The assertion macros call it on their failure branch with the root cause
+ * category and operator they know statically; FOSSIL_MAIP_CAUSE_UNKNOWN makes
+ * it classify the failure from its message. It does not return.
+ *
+ * @param cause The fossil_maip_cause_t of the assertion.
+ * @param op The fossil_maip_op_t of the assertion.
+ * @param message The message to display.
+ * @param file The file name where the assertion occurred.
+ * @param line The line number where the assertion occurred.
+ * @param func The function name where the assertion occurred.
+ */
+FOSSIL_MAIP_API void maip_test_assert_failed(int cause, int op, const char *message, const char *file, int line, const char *func);
+
+/**
+ * @brief Internal functions counting an assertion at its static site.
+ *
+ * The assertion macros call the first on their pass path and the second on
+ * their failure branch, which goes on to maip_test_assert_failed. Both bump
+ * the calling thread's counters of the site.
+ *
+ * @param site The site descriptor emitted by the macro.
+ * @param message The message to display (failure only).
+ */
+FOSSIL_MAIP_API void maip_test_assert_site_pass(fossil_maip_site_t *site);
+FOSSIL_MAIP_API void maip_test_assert_site_failed(fossil_maip_site_t *site, const char *message);
+
+/**
+ * @brief Internal function recording an expectation that failed.
+ *
+ * The EXPECT_* macros call it on their failure branch. Unlike
+ * maip_test_assert_failed it returns: the failure is kept in the calling
+ * thread's context, up to FOSSIL_MAIP_EXPECT_MAX of them, and the case is
+ * failed and its expectations reported together once the body returns.
+ *
+ * @param cause The fossil_maip_cause_t of the expectation.
+ * @param op The fossil_maip_op_t of the expectation.
+ * @param message The message to display.
+ * @param file The file name where the expectation occurred.
+ * @param line The line number where the expectation occurred.
+ * @param func The function name where the expectation occurred.
+ */
+FOSSIL_MAIP_API void maip_test_expect_failed(int cause, int op, const char *message, const char *file, int line, const char *func);
+
+/**
+ * @brief Internal function counting a failed expectation at its static site
+ * before recording it with maip_test_expect_failed.
+ *
+ * @param site The site descriptor emitted by the macro.
+ * @param message The message to display.
+ */
+FOSSIL_MAIP_API void maip_test_expect_site_failed(fossil_maip_site_t *site, const char *message);
+
+/**
+ * @brief Internal function running code that needs the process to itself.
+ *
+ * Under `run --threads` the calling case waits until no other runner thread
+ * is inside a case, and the others wait for it, while `body` runs; state
+ * shared by every thread, such as the stdout descriptor, can be swapped
+ * safely there. `cleanup` runs after `body` even when a failed assertion, a
+ * timeout or a fault unwinds it, before the unwind carries on to the case.
+ *
+ * @param body The function to run alone.
+ * @param cleanup The function undoing what `body` set up, or NULL.
+ * @param data Passed to both functions.
+ */
+FOSSIL_MAIP_API void maip_test_exclusive(void (*body)(void *), void (*cleanup)(void *), void *data);
+
 /**
  * @brief Internal function to handle assertions with message formatting.
  *
  * This function is used internally by the test framework to handle assertions
- * and format messages. It is not intended to be called directly.
+ * and format messages. It is not intended to be called directly. The message
+ * is formatted into a per-thread buffer that stays valid until the next call
+ * on the same thread, which is all an assertion that is failing needs.
  *
  * @param message The message to format.
  * @return A formatted message string.
@@ -279,7 +627,24 @@ FOSSIL_MAIP_API void _on_skip(const char *description);
         test_name##_run,                                 \
         0,                                               \
         0,                                               \
-        FOSSIL_MAIP_CASE_EMPTY};                        \
+        FOSSIL_MAIP_CASE_EMPTY,                         \
+        0,                                               \
+        0,                                               \
+        0,                                               \
+        0,                                               \
+        nullptr,                                         \
+        0,                                               \
+        0,                                               \
+        0,                                               \
+        nullptr,                                         \
+        false,                                           \
+        {0},                                             \
+        nullptr,                                         \
+        nullptr,                                         \
+        nullptr,                                         \
+        {nullptr, 0, 0, 0},                              \
+        0,                                               \
+        0};                                              \
     extern "C" void test_name##_run(void)
 #else
 #define _FOSSIL_TEST(test_name)                          \
@@ -293,28 +658,164 @@ FOSSIL_MAIP_API void _on_skip(const char *description);
         .run = test_name##_run,                          \
         .elapsed_ns = 0,                                 \
         .priority = 0,                                   \
-        .state = FOSSIL_MAIP_CASE_EMPTY};              \
+        .state = FOSSIL_MAIP_CASE_EMPTY,               \
+        .timeout_ns = 0,                                 \
+        .crash_signal = 0,                               \
+        .crash_address = 0,                              \
+        .assert_count = 0,                               \
+        .message = NULL,                                 \
+        .cpu_ns = 0,                                     \
+        .expected_ns = 0,                                \
+        .shard = 0,                                      \
+        .site = NULL,                                    \
+        .failed_before = false,                          \
+        .tag_bits = {0},                                 \
+        .latency = NULL,                                 \
+        .async = NULL,                                   \
+        .depends = NULL,                                 \
+        .param = {NULL, 0, 0, 0},                        \
+        .cause = 0,                                      \
+        .op = 0};                                        \
     void test_name##_run(void)
 #endif
 
-
+/** @brief Macro to define an asynchronous test case.
+ *
+ * The body receives `fossil_async` and runs between _FOSSIL_ASYNC_BEGIN and
+ * _FOSSIL_ASYNC_END; every wait returns to the runner and resumes after the
+ * wait once it is over.
+ *
+ * @param test_name The name of the test case to define.
+ */
 #ifdef __cplusplus
-#define _FOSSIL_TEST_DEPEND_ON(test_name, dep_cases)
-#define _FOSSIL_TEST_PARAM(test_name, params)
+#define _FOSSIL_TEST_ASYNC(test_name)                                 \
+    extern "C" int test_name##_async(fossil_maip_async_t *fossil_async); \
+    static fossil_maip_case_t test_case_##test_name = {              \
+        (char *)#test_name,                                           \
+        (char *)"fossil",                                             \
+        (char *)"name",                                               \
+        nullptr,                                                      \
+        nullptr,                                                      \
+        nullptr,                                                      \
+        0,                                                            \
+        0,                                                            \
+        FOSSIL_MAIP_CASE_EMPTY,                                       \
+        0,                                                            \
+        0,                                                            \
+        0,                                                            \
+        0,                                                            \
+        nullptr,                                                      \
+        0,                                                            \
+        0,                                                            \
+        0,                                                            \
+        nullptr,                                                      \
+        false,                                                        \
+        {0},                                                          \
+        nullptr,                                                      \
+        test_name##_async,                                            \
+        nullptr,                                                      \
+        {nullptr, 0, 0, 0},                                           \
+        0,                                                            \
+        0};                                                           \
+    extern "C" int test_name##_async(fossil_maip_async_t *fossil_async)
 #else
-
+#define _FOSSIL_TEST_ASYNC(test_name)                           \
+    int test_name##_async(fossil_maip_async_t *fossil_async);   \
+    static fossil_maip_case_t test_case_##test_name = {        \
+        .name = #test_name,                                     \
+        .tags = "fossil",                                       \
+        .criteria = "name",                                     \
+        .setup = NULL,                                          \
+        .teardown = NULL,                                       \
+        .run = NULL,                                            \
+        .elapsed_ns = 0,                                        \
+        .priority = 0,                                          \
+        .state = FOSSIL_MAIP_CASE_EMPTY,                        \
+        .timeout_ns = 0,                                        \
+        .crash_signal = 0,                                      \
+        .crash_address = 0,                                     \
+        .assert_count = 0,                                      \
+        .message = NULL,                                        \
+        .cpu_ns = 0,                                            \
+        .expected_ns = 0,                                       \
+        .shard = 0,                                             \
+        .site = NULL,                                           \
+        .failed_before = false,                                 \
+        .tag_bits = {0},                                        \
+        .latency = NULL,                                        \
+        .async = test_name##_async,                             \
+        .depends = NULL,                                        \
+        .param = {NULL, 0, 0, 0},                               \
+        .cause = 0,                                             \
+        .op = 0};                                               \
+    int test_name##_async(fossil_maip_async_t *fossil_async)
 #endif
 
+// The body is a switch on its resume point, so each wait can return to the
+// runner and later jump back in right after itself. Locals do not survive a
+// wait (keep such state in statics or fossil_async->data), and no wait may sit
+// inside another switch of the body.
+#define _FOSSIL_ASYNC_BEGIN() \
+    switch (fossil_async->resume) \
+    {                             \
+    case 0:
+
+#define _FOSSIL_ASYNC_AWAIT_FD(fd, events, timeout_ms)                        \
+    do                                                                        \
+    {                                                                         \
+        fossil_maip_async_wait(fossil_async, (fd), (events), (timeout_ms));   \
+        fossil_async->resume = __LINE__;                                      \
+        return FOSSIL_MAIP_ASYNC_PENDING;                                     \
+    case __LINE__:;                                                           \
+    } while (0)
+
+#define _FOSSIL_ASYNC_SLEEP(milliseconds) \
+    _FOSSIL_ASYNC_AWAIT_FD(-1, 0, milliseconds)
+
+#define _FOSSIL_ASYNC_END()    \
+    }                          \
+    fossil_async->resume = 0;  \
+    return FOSSIL_MAIP_ASYNC_DONE
+
+
+/** @brief Macro to attach a parameter table to a test case.
+ *
+ * The table must be an array (not a pointer) with static storage, so its row
+ * size and count are known here and its rows outlive the run.
+ *
+ * @param test_name The name of the test case.
+ * @param params The static array of rows.
+ */
+#define _FOSSIL_TEST_PARAM(test_name, params)                                     \
+    do                                                                            \
+    {                                                                             \
+        test_case_##test_name.param.table = (params);                             \
+        test_case_##test_name.param.size = sizeof((params)[0]);                   \
+        test_case_##test_name.param.count = sizeof(params) / sizeof((params)[0]); \
+    } while (0)
+
+/** @brief Macro to set the cases a test case depends on.
+ *
+ * Each comma-separated entry names a case, a suite (every other case of it) or
+ * suite.case. The case runs after all of them and is skipped when one did not
+ * pass; unknown names and cycles are rejected when the run starts.
+ *
+ * @param test_name The name of the test case.
+ * @param dep_cases The comma-separated prerequisites of the test case.
+ */
+#define _FOSSIL_TEST_DEPEND_ON(test_name, dep_cases) \
+    test_case_##test_name.depends = (char *)(dep_cases)
+
 /** @brief Macro to set a test case's tags.
  *
  * This macro is used to specify tags for a test case. Tags can be used to
  * categorize or filter test cases based on specific criteria.
  *
  * @param test_name The name of the test case.
- * @param tags The tags to assign to the test case.
+ * @param test_tags The comma-separated tags to assign to the test case.
  */
-#define _FOSSIL_TEST_SET_TAGS(test_name, tags) \
-    test_case_##test_name.tags = tags
+#define _FOSSIL_TEST_SET_TAGS(test_name, test_tags) \
+    test_case_##test_name.tags = (char *)(test_tags)
 
 /** @brief Macro to set a test case's skip message.
  *
@@ -366,6 +867,29 @@ FOSSIL_MAIP_API void _on_skip(const char *description);
 #define _FOSSIL_TEST_SET_AFTER(test_name, after) \
     test_case_##test_name.teardown = teardown_after_##after
 
+/** @brief Macro to set a test case's time budget.
+ *
+ * This macro is used to specify how long a test case may run before the
+ * watchdog interrupts it and records it as a timeout. It takes precedence over
+ * the suite budget and the run-wide `--timeout` value.
+ *
+ * @param test_name The name of the test case.
+ * @param milliseconds The time budget in milliseconds.
+ */
+#define _FOSSIL_TEST_SET_TIMEOUT(test_name, milliseconds) \
+    test_case_##test_name.timeout_ns = (uint64_t)(milliseconds) * 1000000ULL
+
+/** @brief Macro to set the time budget of every case in a suite.
+ *
+ * This macro is used to specify how long each test case of a suite may run
+ * before it is recorded as a timeout, unless the case sets its own budget.
+ *
+ * @param suite The name of the suite.
+ * @param milliseconds The time budget in milliseconds.
+ */
+#define _FOSSIL_SUITE_SET_TIMEOUT(suite, milliseconds) \
+    suite_##suite.timeout_ns = (uint64_t)(milliseconds) * 1000000ULL
+
 /** @brief Macro to define a test suite.
  *
  * This macro is used to define a test suite, which is a collection of test cases
@@ -389,7 +913,8 @@ FOSSIL_MAIP_API void _on_skip(const char *description);
             0,                                              \
             0,                                              \
             0,                                              \
-            {0, 0, 0, 0, 0, 0}}
+            {0, 0, 0, 0, 0, 0},                             \
+            0}
 #else
 #define _FOSSIL_SUITE(suite)                      \
     void setup_##suite(void);                     \
@@ -404,7 +929,8 @@ FOSSIL_MAIP_API void _on_skip(const char *description);
         .time_elapsed_ns = 0,                     \
         .total_score = 0,                         \
         .total_possible = 0,                      \
-        .score = {0, 0, 0, 0, 0, 0}}
+        .score = {0, 0, 0, 0, 0, 0},              \
+        .timeout_ns = 0}
 #endif
 
 /** @brief Macro to define a test setup function.
@@ -463,6 +989,54 @@ FOSSIL_MAIP_API void _on_skip(const char *description);
 #define _FOSSIL_ADD_TEST(suite, test_case) \
     fossil_maip_add_case(&suite_##suite, test_case_##test_case)
 
+/** @brief Macro to emit the registry entry of a test case.
+ *
+ * On ELF targets the entry is placed in the fossil_maip_entries section, so
+ * registering costs nothing at run time. Other GCC/Clang targets link the
+ * entry from a constructor instead.
+ *
+ * @param suite The name of the suite the case belongs to.
+ * @param test_name The name of the test case.
+ */
+#if defined(FOSSIL_MAIP_SECTION_REGISTRY)
+#define _FOSSIL_REGISTER_TEST(suite, test_name)                                  \
+    static fossil_maip_entry_t fossil_maip_entry_##suite##_##test_name          \
+        __attribute__((used, section("fossil_maip_entries"), aligned(sizeof(void *)))) = \
+        {&suite_##suite, &test_case_##test_name, 0}
+#elif defined(__GNUC__) || defined(__clang__)
+#define _FOSSIL_REGISTER_TEST(suite, test_name)                                  \
+    static fossil_maip_entry_t fossil_maip_entry_##suite##_##test_name =        \
+        {&suite_##suite, &test_case_##test_name, 0};                            \
+    __attribute__((constructor)) static void fossil_maip_register_##suite##_##test_name(void) \
+    {                                                                            \
+        fossil_maip_register(&fossil_maip_entry_##suite##_##test_name);          \
+    }                                                                            \
+    typedef int fossil_maip_registered_##suite##_##test_name
+#else
+#define _FOSSIL_REGISTER_TEST(suite, test_name) \
+    typedef char fossil_maip_static_registration_needs_gcc_or_clang_##test_name[-1]
+#endif
+
+/** @brief Macro to define a test case that registers itself with a suite.
+ *
+ * The case is discovered by fossil_maip_start, so it needs neither a
+ * FOSSIL_ADD_TEST call nor a test group.
+ *
+ * @param suite The name of the suite the case belongs to.
+ * @param test_name The name of the test case to define.
+ */
+#ifdef __cplusplus
+#define _FOSSIL_SUITE_TEST(suite, test_name) \
+    _FOSSIL_TEST(test_name);                 \
+    _FOSSIL_REGISTER_TEST(suite, test_name); \
+    extern "C" void test_name##_run(void)
+#else
+#define _FOSSIL_SUITE_TEST(suite, test_name) \
+    _FOSSIL_TEST(test_name);                 \
+    _FOSSIL_REGISTER_TEST(suite, test_name); \
+    void test_name##_run(void)
+#endif
+
 /** @brief Macro to run a specific test suite.
  *
  * This macro is used to run a specific test suite that has been defined in the
@@ -590,7 +1164,56 @@ FOSSIL_MAIP_API void _on_skip(const char *description);
  * message and may abort the execution of the test case or test suite.
  */
 #define _FOSSIL_TEST_ASSUME(condition, message) \
-    maip_test_assert_internal((condition), (message), __FILE__, __LINE__, __func__)
+    _FOSSIL_TEST_ASSUME_AS(FOSSIL_MAIP_CAUSE_UNKNOWN, FOSSIL_MAIP_OP_NONE, condition, message)
+
+/**
+ * @brief Macro to assume a condition whose root cause category and operator
+ * are known when it is written, as every assume.h macro does.
+ *
+ * The message is only evaluated when the condition is false, so the pass path
+ * costs the comparison and a counter increment; formatting, hashing and root
+ * cause detection happen on the failure branch alone.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#if defined(FOSSIL_MAIP_SITE_SECTION)
+#define FOSSIL_MAIP_SITE_ATTRIBUTES __attribute__((used, section("fossil_maip_sites"), aligned(sizeof(void *))))
+#else
+#define FOSSIL_MAIP_SITE_ATTRIBUTES
+#endif
+#define _FOSSIL_TEST_ASSUME_AS(cause, op, condition, message)                                      \
+    (__extension__({                                                                               \
+        static fossil_maip_site_t fossil_maip_site FOSSIL_MAIP_SITE_ATTRIBUTES =                   \
+            {__FILE__, __func__, __LINE__, (cause), (op), 0};                                      \
+        likely(condition) ? maip_test_assert_site_pass(&fossil_maip_site)                          \
+                          : maip_test_assert_site_failed(&fossil_maip_site, (message));            \
+    }))
+#else
+// Without statement expressions there is no site to count at
+#define _FOSSIL_TEST_ASSUME_AS(cause, op, condition, message) \
+    (likely(condition) ? maip_test_assert_pass() \
+                       : maip_test_assert_failed((cause), (op), (message), __FILE__, __LINE__, __func__))
+#endif
+
+/**
+ * @brief Macro to expect a condition whose root cause category and operator
+ * are known when it is written, as every expect.h macro does.
+ *
+ * Same as _FOSSIL_TEST_ASSUME_AS except that a failure is recorded and the
+ * case carries on; the pass path is shared with the assumptions.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define _FOSSIL_TEST_EXPECT_AS(cause, op, condition, message)                                      \
+    (__extension__({                                                                               \
+        static fossil_maip_site_t fossil_maip_site FOSSIL_MAIP_SITE_ATTRIBUTES =                   \
+            {__FILE__, __func__, __LINE__, (cause), (op), 0};                                      \
+        likely(condition) ? maip_test_assert_site_pass(&fossil_maip_site)                          \
+                          : maip_test_expect_site_failed(&fossil_maip_site, (message));            \
+    }))
+#else
+#define _FOSSIL_TEST_EXPECT_AS(cause, op, condition, message) \
+    (likely(condition) ? maip_test_assert_pass() \
+                       : maip_test_expect_failed((cause), (op), (message), __FILE__, __LINE__, __func__))
+#endif
 
 /**
  * @brief Macro to assume a condition in a test runner.
@@ -599,7 +1222,7 @@ FOSSIL_MAIP_API void _on_skip(const char *description);
  * message and may abort the execution of the test case or test suite.
  */
 #define _FOSSIL_TEST_ASSERT(condition, message) \
-    maip_test_assert_internal((condition), (message), __FILE__, __LINE__, __func__)
+    _FOSSIL_TEST_ASSUME_AS(FOSSIL_MAIP_CAUSE_UNKNOWN, FOSSIL_MAIP_OP_NONE, condition, message)
 
 /**
  * @brief Macro to assume a condition in a test runner.
@@ -703,16 +1326,110 @@ FOSSIL_MAIP_API void _on_skip(const char *description);
 #define FOSSIL_TEST(test_name) \
     _FOSSIL_TEST(test_name)
 
+/** @brief Macro to define an asynchronous test case.
+ *
+ * The body of an async case may wait on file descriptors and timers without
+ * blocking: the runner drives every async case of a suite from one event loop
+ * (epoll on Linux, poll elsewhere), with each case keeping its own time budget
+ * and assertions. Add it to a suite with FOSSIL_ADD_TEST like any other case.
+ *
+ * @code
+ * FOSSIL_TEST_ASYNC(reads_reply) {
+ *     FOSSIL_ASYNC_BEGIN();
+ *     send_request(sock);
+ *     FOSSIL_ASYNC_AWAIT_FD(sock, FOSSIL_MAIP_ASYNC_READ, 1000);
+ *     FOSSIL_TEST_ASSUME(FOSSIL_ASYNC_READY() != 0, "Reply should arrive within a second");
+ *     FOSSIL_ASYNC_END();
+ * }
+ * @endcode
+ *
+ * @param test_name The name of the test case to define.
+ */
+#define FOSSIL_TEST_ASYNC(test_name) \
+    _FOSSIL_TEST_ASYNC(test_name)
+
+/** @brief Starts the body of an asynchronous test case. */
+#define FOSSIL_ASYNC_BEGIN() \
+    _FOSSIL_ASYNC_BEGIN()
+
+/** @brief Waits until a descriptor is ready or the timeout passes.
+ *
+ * @param fd The descriptor to wait on.
+ * @param events FOSSIL_MAIP_ASYNC_READ and/or FOSSIL_MAIP_ASYNC_WRITE.
+ * @param timeout_ms Milliseconds to wait at most (0 = until ready).
+ */
+#define FOSSIL_ASYNC_AWAIT_FD(fd, events, timeout_ms) \
+    _FOSSIL_ASYNC_AWAIT_FD(fd, events, timeout_ms)
+
+/** @brief Waits for the given number of milliseconds (0 yields a turn). */
+#define FOSSIL_ASYNC_SLEEP(milliseconds) \
+    _FOSSIL_ASYNC_SLEEP(milliseconds)
+
+/** @brief Events that ended the last wait, 0 when it timed out. */
+#define FOSSIL_ASYNC_READY() \
+    (fossil_async->ready)
+
+/** @brief Ends the body of an asynchronous test case. */
+#define FOSSIL_ASYNC_END() \
+    _FOSSIL_ASYNC_END()
+
 /** @brief Macro to set a test case's tags.
  *
  * This macro is used to specify tags for a test case. Tags can be used to
- * categorize or filter test cases based on specific criteria.
+ * categorize or filter test cases based on specific criteria, see
+ * filter --tag and show --tag.
+ *
+ * @param test_name The name of the test case.
+ * @param test_tags The comma-separated tags to assign to the test case.
+ */
+#define FOSSIL_TEST_SET_TAGS(test_name, test_tags) \
+    _FOSSIL_TEST_SET_TAGS(test_name, test_tags)
+
+/** @brief Macro to run a test case once per row of a static table.
+ *
+ * Each row becomes a case of its own, named "test_name/row", with its own
+ * result and timing, so rows are filtered (e.g. run --only 'test_name/7'),
+ * sharded and run in parallel like any other case. The body reads its row
+ * with FOSSIL_TEST_PARAM_ROW. Call it before FOSSIL_ADD_TEST.
+ *
+ * @code
+ * static const codec_vector_t vectors[] = {{"", ""}, {"f", "Zg=="}};
+ *
+ * FOSSIL_TEST(test_encode) {
+ *     const codec_vector_t *vector = FOSSIL_TEST_PARAM_ROW(codec_vector_t);
+ *     FOSSIL_TEST_ASSUME(check_encode(vector), "Vector should encode");
+ * }
+ *
+ * FOSSIL_TEST_PARAM(test_encode, vectors);
+ * FOSSIL_ADD_TEST(codec_suite, test_encode);
+ * @endcode
+ *
+ * @param test_name The name of the test case.
+ * @param params The static array of rows.
+ */
+#define FOSSIL_TEST_PARAM(test_name, params) \
+    _FOSSIL_TEST_PARAM(test_name, params)
+
+/** @brief The row of the running parameterized case, as a pointer to type. */
+#define FOSSIL_TEST_PARAM_ROW(type) \
+    ((const type *)fossil_maip_param_row())
+
+/** @brief The index of the running parameterized case's row. */
+#define FOSSIL_TEST_PARAM_INDEX() \
+    (fossil_maip_param_index())
+
+/** @brief Macro to declare the prerequisites of a test case.
+ *
+ * The case waits for every listed case or suite (a comma-separated list of
+ * case, suite or suite.case names) and is skipped, with the prerequisite that
+ * did not pass as the reason, when one of them fails. Prerequisites left out of
+ * the run by filters or sharding count as met. Call it before FOSSIL_ADD_TEST.
  *
  * @param test_name The name of the test case.
- * @param tags The tags to assign to the test case.
+ * @param dep_cases The comma-separated prerequisites of the test case.
  */
-#define FOSSIL_TEST_SET_TAGS(test_name, tags) \
-    _FOSSIL_TEST_SET_TAGS(test_name, tags)
+#define FOSSIL_TEST_DEPEND_ON(test_name, dep_cases) \
+    _FOSSIL_TEST_DEPEND_ON(test_name, dep_cases)
 
 /** @brief Macro to set a test case's skip message.
  *
@@ -762,6 +1479,28 @@ FOSSIL_MAIP_API void _on_skip(const char *description);
 #define FOSSIL_TEST_SET_AFTER(test_name, after) \
     _FOSSIL_TEST_SET_AFTER(test_name, after)
 
+/** @brief Macro to set a test case's time budget.
+ *
+ * This macro is used to specify how long a test case may run before the
+ * watchdog interrupts it and records it as a timeout.
+ *
+ * @param test_name The name of the test case.
+ * @param milliseconds The time budget in milliseconds.
+ */
+#define FOSSIL_TEST_SET_TIMEOUT(test_name, milliseconds) \
+    _FOSSIL_TEST_SET_TIMEOUT(test_name, milliseconds)
+
+/** @brief Macro to set the time budget of every case in a suite.
+ *
+ * This macro is used to specify how long each test case of a suite may run
+ * before it is recorded as a timeout, unless the case sets its own budget.
+ *
+ * @param suite The name of the suite.
+ * @param milliseconds The time budget in milliseconds.
+ */
+#define FOSSIL_SUITE_SET_TIMEOUT(suite, milliseconds) \
+    _FOSSIL_SUITE_SET_TIMEOUT(suite, milliseconds)
+
 /** @brief Macro to define a test suite.
  *
  * This macro is used to define a test suite, which is a collection of test cases
@@ -829,6 +1568,18 @@ FOSSIL_MAIP_API void _on_skip(const char *description);
 #define FOSSIL_ADD_TEST(suite, test_case) \
     _FOSSIL_ADD_TEST(suite, test_case)
 
+/** @brief Macro to define a test case that registers itself with a suite.
+ *
+ * This macro is used in place of FOSSIL_TEST when the case should be found
+ * at startup without a FOSSIL_ADD_TEST call or a generated test runner. Both
+ * styles may be mixed, but a given suite should use only one of them.
+ *
+ * @param suite The name of the suite the case belongs to.
+ * @param test_name The name of the test case to define.
+ */
+#define FOSSIL_SUITE_TEST(suite, test_name) \
+    _FOSSIL_SUITE_TEST(suite, test_name)
+
 /** @brief Macro to run a specific test suite.
  *
  * This macro is used to run a specific test suite that has been defined in the
@@ -884,6 +1635,20 @@ FOSSIL_MAIP_API void _on_skip(const char *description);
 #define FOSSIL_END() \
     _FOSSIL_END()
 
+/** @brief Macro to define a main function for statically registered tests.
+ *
+ * This macro expands to a main function that starts the engine, runs every
+ * discovered suite, prints the summary and ends the engine.
+ */
+#define FOSSIL_TEST_MAIN()                  \
+    int main(int argc, char **argv)         \
+    {                                       \
+        FOSSIL_TEST_START(argc, argv);      \
+        FOSSIL_RUN_ALL();                   \
+        FOSSIL_SUMMARY();                   \
+        return FOSSIL_END();                \
+    }
+
 /**
  * @brief Macro to register a test suite with the engine.
  *
@@ -939,6 +1704,33 @@ FOSSIL_MAIP_API void _on_skip(const char *description);
 #define FOSSIL_TEST_ASSUME(condition, message) \
     _FOSSIL_TEST_ASSUME(condition, message)
 
+/**
+ * @brief Macro to assume a condition with its root cause category and
+ * operator given up front.
+ * Failures are reported and grouped under the given fossil_maip_cause_t and
+ * fossil_maip_op_t instead of a category guessed from the message.
+ *
+ *     FOSSIL_TEST_ASSUME_AS(FOSSIL_MAIP_CAUSE_IO, FOSSIL_MAIP_OP_IS, fd >= 0, "Expected the log to open");
+ */
+#define FOSSIL_TEST_ASSUME_AS(cause, op, condition, message) \
+    _FOSSIL_TEST_ASSUME_AS(cause, op, condition, message)
+
+/**
+ * @brief Macro to expect a condition in a test case.
+ * Unlike FOSSIL_TEST_ASSUME, a false condition does not stop the case: the
+ * failure is recorded, the body runs on, and the case fails at its end with
+ * every failed expectation reported together.
+ */
+#define FOSSIL_TEST_EXPECT(condition, message) \
+    _FOSSIL_TEST_EXPECT_AS(FOSSIL_MAIP_CAUSE_UNKNOWN, FOSSIL_MAIP_OP_NONE, condition, message)
+
+/**
+ * @brief Macro to expect a condition with its root cause category and
+ * operator given up front, as FOSSIL_TEST_ASSUME_AS does for assumptions.
+ */
+#define FOSSIL_TEST_EXPECT_AS(cause, op, condition, message) \
+    _FOSSIL_TEST_EXPECT_AS(cause, op, condition, message)
+
 /**
  * @brief Macro to assert a condition in a test runner.
  * This macro is used to assert that a specific condition is true within a test
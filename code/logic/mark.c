@@ -25,48 +25,14 @@
 #include "fossil/maip/mark.h"
 #include "fossil/maip/common.h"
 
-#if defined(_WIN32)
-static LARGE_INTEGER frequency;
-static LARGE_INTEGER start_time;
-#elif defined(__APPLE__)
-clock_t start_time;
-#else
-clock_t start_time;
-#endif
-
-#ifndef CLOCK_MONOTONIC
-#define CLOCK_MONOTONIC 1
-#endif
+static uint64_t start_time;
 
 void fossil_test_start_benchmark(void) {
-#if defined(_WIN32)
-    QueryPerformanceFrequency(&frequency);
-    QueryPerformanceCounter(&start_time);
-#elif defined(__APPLE__)
-    start_time = mach_absolute_time();
-#else
-    struct timeval tv;
-    gettimeofday(&tv, null);
-    start_time = (uint64_t)tv.tv_sec * 1e6 + tv.tv_usec;
-#endif
+    start_time = maip_time_now_ns();
 }
 
 uint64_t fossil_test_stop_benchmark(void) {
-#if defined(_WIN32)
-    LARGE_INTEGER end_time;
-    QueryPerformanceCounter(&end_time);
-    return (uint64_t)((end_time.QuadPart - start_time.QuadPart) * 1e9 / frequency.QuadPart);
-#elif defined(__APPLE__)
-    uint64_t end_time = mach_absolute_time();
-    mach_timebase_info_data_t timebase;
-    mach_timebase_info(&timebase);
-    return (end_time - start_time) * timebase.numer / timebase.denom;
-#else
-    struct timeval tv;
-    gettimeofday(&tv, null);
-    uint64_t end_time = (uint64_t)tv.tv_sec * 1e6 + tv.tv_usec;
-    return (end_time - start_time) * 1e3;
-#endif
+    return maip_time_interval_ns(start_time, maip_time_now_ns());
 }
 
 void assume_duration(double expected, double actual, double unit) {
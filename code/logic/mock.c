@@ -23,6 +23,7 @@
  * -----------------------------------------------------------------------------
  */
 #include "fossil/maip/mock.h"
+#include "fossil/maip/test.h"
 
 // *****************************************************************************
 // Function declarations
@@ -304,39 +305,66 @@ void fossil_mock_print_ai_context(const fossil_mock_ai_context_t *ai_context) {
     maip_io_printf("    {blue}Notes:{reset} %s\n", ai_context->ai_notes ? ai_context->ai_notes : "NULL");
 }
 
+typedef struct {
+    void (*function)(void);
+    FILE *temp_file;
+    int original_stdout_fd;
+    int redirected;
+    int finished;
+} fossil_mock_capture_t;
+
+static void fossil_mock_capture_body(void *data) {
+    fossil_mock_capture_t *capture = (fossil_mock_capture_t *)data;
+    fflush(stdout);
+    capture->redirected = dup2(fileno(capture->temp_file), STDOUT_FILENO) != -1;
+    if (capture->redirected) {
+        capture->function(); // no arguments passed
+    }
+    capture->finished = 1;
+}
+
+static void fossil_mock_capture_cleanup(void *data) {
+    fossil_mock_capture_t *capture = (fossil_mock_capture_t *)data;
+    if (capture->redirected) {
+        fflush(stdout);
+        dup2(capture->original_stdout_fd, STDOUT_FILENO);
+    }
+    close(capture->original_stdout_fd);
+    if (!capture->finished) {
+        fclose(capture->temp_file); // unwinding: the caller never reads it
+    }
+}
+
 int fossil_mock_capture_output(char *buffer, size_t size, void (*function)(void)) {
     if (!buffer || size == 0 || !function) {
         return -1;
     }
 
-    FILE *temp_file = tmpfile();
-    if (!temp_file) {
+    fossil_mock_capture_t capture = {function, tmpfile(), -1, 0, 0};
+    if (!capture.temp_file) {
         return -1;
     }
 
-    int original_stdout_fd = dup(STDOUT_FILENO);
-    if (original_stdout_fd == -1) {
-        fclose(temp_file);
+    capture.original_stdout_fd = dup(STDOUT_FILENO);
+    if (capture.original_stdout_fd == -1) {
+        fclose(capture.temp_file);
         return -1;
     }
-    fflush(stdout);
-    if (dup2(fileno(temp_file), STDOUT_FILENO) == -1) {
-        fclose(temp_file);
-        close(original_stdout_fd);
+
+    // stdout is one descriptor for every thread, so under runner threads the
+    // swap runs with no other case in flight; stdout is put back even when a
+    // failed assertion in the function unwinds the case
+    maip_test_exclusive(fossil_mock_capture_body, fossil_mock_capture_cleanup, &capture);
+    if (!capture.redirected) {
+        fclose(capture.temp_file);
         return -1;
     }
 
-    function(); // no arguments passed
-
-    fflush(stdout);
-    dup2(original_stdout_fd, STDOUT_FILENO);
-    close(original_stdout_fd);
-
-    rewind(temp_file);
-    size_t read_size = fread(buffer, 1, size - 1, temp_file);
+    rewind(capture.temp_file);
+    size_t read_size = fread(buffer, 1, size - 1, capture.temp_file);
     buffer[read_size] = '\0';
 
-    fclose(temp_file);
+    fclose(capture.temp_file);
     return (int)read_size;
 }
 
@@ -22,6 +22,10 @@
  * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
  * -----------------------------------------------------------------------------
  */
+#if !defined(_WIN32) && !defined(_XOPEN_SOURCE)
+#define _XOPEN_SOURCE 600 // sigaltstack, SA_ONSTACK
+#endif
+
 #include "fossil/maip/test.h"
 #include <stdlib.h>
 #include <string.h>
@@ -29,19 +33,53 @@
 #include <setjmp.h>
 #include <stdio.h>
 #include <time.h>
+#include <errno.h>
+#include <math.h>
 #include <sys/time.h>
 
-jmp_buf test_jump_buffer;     // This will hold the jump buffer for longjmp
-static int _ASSERT_COUNT = 0; // Counter for the number of assertions
+#if !defined(_WIN32)
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdatomic.h>
+#include <sys/wait.h>
+#include <sys/socket.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <fcntl.h>
+#include <limits.h>
+#endif
+
+#if defined(__linux__)
+#include <sys/epoll.h>
+#include <sys/inotify.h>
+#endif
+
+#if defined(_MSC_VER)
+#define FOSSIL_MAIP_THREAD_LOCAL __declspec(thread)
+#else
+#define FOSSIL_MAIP_THREAD_LOCAL _Thread_local
+#endif
+
+// Execution context of the calling thread (jump buffer, assertion count, ...)
+static FOSSIL_MAIP_THREAD_LOCAL fossil_maip_context_t maip_context;
+
+fossil_maip_context_t *fossil_maip_context(void)
+{
+    return &maip_context;
+}
 
 // --- Internal helper for timing ---
 static uint64_t fossil_maip_now_ns(void)
 {
-    struct timeval tv;
-    gettimeofday(&tv, null);
-    return (uint64_t)tv.tv_sec * 1000000000ULL + (uint64_t)tv.tv_usec * 1000ULL;
+    return maip_time_now_ns();
 }
 
+static int fossil_maip_discover(fossil_maip_engine_t *engine);
+static fossil_maip_filter_t *fossil_maip_filter_compile(const fossil_maip_pallet_t *pallet);
+static bool maip_test_expect_report(void);
+
 // --- Start ---
 int fossil_maip_start(fossil_maip_engine_t *engine, int argc, char **argv)
 {
@@ -60,7 +98,23 @@ int fossil_maip_start(fossil_maip_engine_t *engine, int argc, char **argv)
 
     engine->pallet = fossil_maip_pallet_create(argc, argv);
 
-    return FOSSIL_MAIP_SUCCESS;
+    // Pick the clock before any runner thread or worker exists
+    if (maip_time_use_clock(engine->pallet.run.clock) != 0)
+        maip_io_printf("{yellow}Clock '%s' is unavailable, using the monotonic clock{reset}\n", engine->pallet.run.clock);
+
+    // Always shown, so any shuffled order can be replayed
+    if (engine->pallet.shuffle.enabled)
+        maip_io_printf("{blue}Shuffle seed: %llu (replay with: shuffle --seed %llu){reset}\n",
+                       (unsigned long long)engine->pallet.shuffle.seed_value,
+                       (unsigned long long)engine->pallet.shuffle.seed_value);
+
+    // Compile the name lists once, rather than scanning them per case
+    engine->filter = fossil_maip_filter_compile(&engine->pallet);
+    if (!engine->filter)
+        return FOSSIL_MAIP_FAILURE;
+
+    // Statically registered cases need no test group
+    return fossil_maip_discover(engine);
 }
 
 // --- Add Suite ---
@@ -108,784 +162,6808 @@ int fossil_maip_add_case(fossil_maip_suite_t *suite, fossil_maip_case_t test_cas
     return FOSSIL_MAIP_SUCCESS;
 }
 
-// --- Update Score ---
-void fossil_maip_update_score(fossil_maip_case_t *test_case, fossil_maip_suite_t *suite)
+// --- Static Registration ---
+// FOSSIL_SUITE_TEST cases are found here rather than through test groups. The
+// entries are counted first, so every case array and the suite array are
+// allocated once at their final size.
+#if defined(FOSSIL_MAIP_SECTION_REGISTRY)
+// Bounds of the fossil_maip_entries section, provided by the linker. Weak, so
+// binaries without any statically registered case still link.
+extern fossil_maip_entry_t __start_fossil_maip_entries[] __attribute__((weak));
+extern fossil_maip_entry_t __stop_fossil_maip_entries[] __attribute__((weak));
+#endif
+
+static fossil_maip_entry_t *maip_registry_head = NULL;
+static fossil_maip_entry_t *maip_registry_tail = NULL;
+
+void fossil_maip_register(fossil_maip_entry_t *entry)
 {
-    if (!test_case || !suite)
+    if (!entry)
         return;
 
-    if (test_case->state != FOSSIL_MAIP_CASE_EMPTY)
+    // Appended, so cases keep the order they were declared in
+    entry->next = NULL;
+    if (maip_registry_tail)
+        maip_registry_tail->next = entry;
+    else
+        maip_registry_head = entry;
+    maip_registry_tail = entry;
+}
+
+static fossil_maip_entry_t *maip_registry_next(fossil_maip_entry_t *entry)
+{
+#if defined(FOSSIL_MAIP_SECTION_REGISTRY)
+    if (entry >= __start_fossil_maip_entries && entry < __stop_fossil_maip_entries)
     {
-        switch (test_case->state)
+        if (++entry < __stop_fossil_maip_entries)
+            return entry;
+        return maip_registry_head;
+    }
+#endif
+    return entry->next;
+}
+
+static fossil_maip_entry_t *maip_registry_first(void)
+{
+#if defined(FOSSIL_MAIP_SECTION_REGISTRY)
+    fossil_maip_entry_t *start = __start_fossil_maip_entries;
+    if (start && start != __stop_fossil_maip_entries)
+        return start;
+#endif
+    return maip_registry_head;
+}
+
+static int fossil_maip_discover(fossil_maip_engine_t *engine)
+{
+    // Pass 1: count the cases of each suite in its capacity field
+    size_t suites = 0;
+    for (fossil_maip_entry_t *entry = maip_registry_first(); entry; entry = maip_registry_next(entry))
+    {
+        if (!entry->suite || !entry->test_case)
+            continue;
+        if (entry->suite->capacity++ == 0)
+            suites++;
+    }
+    if (suites == 0)
+        return FOSSIL_MAIP_SUCCESS;
+
+    if (engine->capacity - engine->count < suites)
+    {
+        size_t new_cap = engine->count + suites;
+        fossil_maip_suite_t *resized = maip_sys_memory_realloc(engine->suites, new_cap * sizeof(*engine->suites));
+        if (!resized)
+            return FOSSIL_MAIP_FAILURE;
+        engine->suites = resized;
+        engine->capacity = new_cap;
+    }
+
+    // Pass 2: fill each case array; a suite joins the engine once it is full
+    int status = FOSSIL_MAIP_SUCCESS;
+    for (fossil_maip_entry_t *entry = maip_registry_first(); entry; entry = maip_registry_next(entry))
+    {
+        fossil_maip_suite_t *suite = entry->suite;
+        if (!suite || !entry->test_case || suite->capacity == 0)
+            continue;
+
+        if (!suite->cases)
         {
-        case FOSSIL_MAIP_CASE_PASS:
-            suite->score.passed++;
-            break;
-        case FOSSIL_MAIP_CASE_FAIL:
-            suite->score.failed++;
-            break;
-        case FOSSIL_MAIP_CASE_TIMEOUT:
-            suite->score.timeout++;
-            break;
-        case FOSSIL_MAIP_CASE_SKIPPED:
-            suite->score.skipped++;
-            break;
-        case FOSSIL_MAIP_CASE_UNEXPECTED:
-            suite->score.unexpected++;
-            break;
-        case FOSSIL_MAIP_CASE_EMPTY:
-        default:
-            suite->score.empty++;
+            suite->cases = maip_sys_memory_alloc(suite->capacity * sizeof(*suite->cases));
+            if (!suite->cases)
+            {
+                // Drop the suite; its remaining entries are skipped
+                suite->capacity = 0;
+                suite->count = 0;
+                status = FOSSIL_MAIP_FAILURE;
+                continue;
+            }
+        }
+        suite->cases[suite->count++] = *entry->test_case;
+
+        if (suite->count == suite->capacity)
+        {
+            engine->suites[engine->count++] = *suite;
+
+            // The engine owns the cases now; a later start rediscovers them
+            suite->cases = NULL;
+            suite->count = 0;
+            suite->capacity = 0;
+        }
+    }
+    return status;
+}
+
+// --- Assertion Sites ---
+// Every assertion macro owns a static fossil_maip_site_t. Each thread counts
+// the hits and failures of the sites it executes in a flat array of its own,
+// indexed by site, so an assertion neither locks nor hashes. The arrays are
+// folded into the run totals when a runner thread or forked child finishes and
+// when the run ends; the totals are shared memory, so forked children add to
+// them too. C sites on ELF binaries are known from the fossil_maip_sites
+// section, the ones that never ran included; elsewhere a site registers on
+// first use. Either way a site keeps its slot, and every array is allocated
+// at its full size on the thread's first hit, so once both exist a passing
+// assertion is one load and one increment. run --sites <file> lists them.
+#ifndef FOSSIL_MAIP_SITE_LATE_MAX
+#define FOSSIL_MAIP_SITE_LATE_MAX 4096 // Sites registered on first use
+#endif
+
+#if defined(FOSSIL_MAIP_SITE_SECTION)
+extern fossil_maip_site_t __start_fossil_maip_sites[] __attribute__((weak));
+extern fossil_maip_site_t __stop_fossil_maip_sites[] __attribute__((weak));
+#endif
+
+typedef struct
+{
+    uint64_t hits;
+    uint64_t fails;
+} maip_site_tally_t;
+
+static FOSSIL_MAIP_THREAD_LOCAL maip_site_tally_t *maip_site_local = NULL;
+
+// Sites registered on first use. Forked children register into the same
+// table, so it is shared memory; it outlives each run, as the sites keep
+// their slots.
+typedef struct
+{
+    size_t count;                                         // Slots handed out
+    fossil_maip_site_t *sites[FOSSIL_MAIP_SITE_LATE_MAX]; // Site of each slot (NULL = lost race)
+} maip_site_late_t;
+
+static maip_site_late_t *maip_site_late = NULL; // Mapped by the first run
+
+static maip_site_tally_t *maip_site_totals = NULL; // Run totals (NULL between runs)
+static size_t maip_site_total_count = 0;
+
+static size_t maip_site_static_count(void)
+{
+#if defined(FOSSIL_MAIP_SITE_SECTION)
+    if (__start_fossil_maip_sites)
+        return (size_t)(__stop_fossil_maip_sites - __start_fossil_maip_sites);
+#endif
+    return 0;
+}
+
+// Slots of every array: the section sites, then the ones registered late.
+static size_t maip_site_capacity(void)
+{
+    return maip_site_static_count() + FOSSIL_MAIP_SITE_LATE_MAX;
+}
+
+// Gives a site found outside the section a late slot, plus one (0 outside a
+// run, where nothing is counted, or once the slots run out). The slot of a
+// forked parent or sibling that registered the site first is reused. Two
+// threads may race to register the same site; the loser's slot stays empty,
+// and maip_site_end folds together what two processes registered at once.
+static uint32_t maip_site_register(fossil_maip_site_t *site)
+{
+    maip_site_late_t *late = maip_site_late;
+    if (!late)
+        return 0;
+
+#if !defined(_WIN32)
+    size_t taken = __atomic_load_n(&late->count, __ATOMIC_ACQUIRE);
+#else
+    size_t taken = late->count;
+#endif
+    size_t slot = FOSSIL_MAIP_SITE_LATE_MAX;
+    for (size_t i = 0; i < taken && i < FOSSIL_MAIP_SITE_LATE_MAX; ++i)
+    {
+#if !defined(_WIN32)
+        if (__atomic_load_n(&late->sites[i], __ATOMIC_ACQUIRE) == site)
+#else
+        if (late->sites[i] == site)
+#endif
+        {
+            slot = i;
             break;
         }
     }
 
-    // --- Recompute suite totals for safety ---
-    suite->total_score = suite->score.passed;
-    suite->total_possible = suite->score.passed +
-                            suite->score.failed +
-                            suite->score.timeout +
-                            suite->score.skipped +
-                            suite->score.unexpected +
-                            suite->score.empty;
+    bool fresh = slot == FOSSIL_MAIP_SITE_LATE_MAX;
+    if (fresh)
+    {
+#if !defined(_WIN32)
+        slot = __atomic_fetch_add(&late->count, 1, __ATOMIC_RELAXED);
+#else
+        slot = late->count++;
+#endif
+        if (slot >= FOSSIL_MAIP_SITE_LATE_MAX)
+            return 0;
+#if !defined(_WIN32)
+        __atomic_store_n(&late->sites[slot], site, __ATOMIC_RELEASE);
+#else
+        late->sites[slot] = site;
+#endif
+    }
+
+    uint32_t index = (uint32_t)(maip_site_static_count() + slot) + 1;
+    uint32_t expected = 0;
+#if !defined(_WIN32)
+    if (!__atomic_compare_exchange_n(&site->index, &expected, index, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+    {
+        if (fresh)
+            __atomic_store_n(&late->sites[slot], NULL, __ATOMIC_RELEASE);
+        return expected;
+    }
+#else
+    site->index = index;
+#endif
+    return index;
 }
 
-// --- Show Test Cases ---
+// Finds the slot of a site the first time it runs, plus one; 0 when it has none.
+static uint32_t maip_site_index(fossil_maip_site_t *site)
+{
+#if defined(FOSSIL_MAIP_SITE_SECTION)
+    if (site >= __start_fossil_maip_sites && site < __stop_fossil_maip_sites)
+    {
+        uint32_t index = (uint32_t)(site - __start_fossil_maip_sites) + 1;
+        __atomic_store_n(&site->index, index, __ATOMIC_RELAXED); // Same value from every thread
+        return index;
+    }
+#endif
+#if !defined(_WIN32)
+    uint32_t index = __atomic_load_n(&site->index, __ATOMIC_ACQUIRE);
+#else
+    uint32_t index = site->index;
+#endif
+    return index ? index : maip_site_register(site);
+}
 
-// Formats nanoseconds into a human-readable string and returns a heap-allocated string
-char *fossil_maip_format_ns(uint64_t ns)
+// The way to a site's counters when the site or the thread is new to them.
+static maip_site_tally_t *maip_site_tally(fossil_maip_site_t *site)
 {
-    uint64_t hours = ns / 3600000000000ULL;
-    uint64_t minutes = (ns % 3600000000000ULL) / 60000000000ULL;
-    uint64_t seconds = (ns % 60000000000ULL) / 1000000000ULL;
-    uint64_t microseconds = (ns % 1000000000ULL) / 1000ULL;
-    uint64_t nanoseconds = ns % 1000ULL;
-    char *buffer = (char *)maip_sys_memory_alloc(32);
+    uint32_t index = maip_site_index(site);
+    if (index == 0)
+        return NULL;
+
+    if (!maip_site_local)
+    {
+        maip_site_local = maip_sys_memory_calloc(maip_site_capacity(), sizeof(*maip_site_local));
+        if (!maip_site_local)
+            return NULL;
+    }
+    return &maip_site_local[index - 1];
+}
+
+void maip_test_assert_site_pass(fossil_maip_site_t *site)
+{
+    maip_context.assert_count++;
+
+#if !defined(_WIN32)
+    uint32_t index = __atomic_load_n(&site->index, __ATOMIC_RELAXED);
+#else
+    uint32_t index = site->index;
+#endif
+    if (likely(index != 0 && maip_site_local != NULL))
+    {
+        maip_site_local[index - 1].hits++;
+        return;
+    }
+
+    maip_site_tally_t *tally = maip_site_tally(site);
+    if (tally)
+        tally->hits++;
+}
 
-    if (buffer)
+void maip_test_assert_site_failed(fossil_maip_site_t *site, const char *message)
+{
+    maip_site_tally_t *tally = maip_site_tally(site);
+    if (tally)
     {
-        snprintf(buffer, 32, "%02lu:%02lu:%02lu.%06lu,%03lu",
-                 (unsigned long)hours,
-                 (unsigned long)minutes,
-                 (unsigned long)seconds,
-                 (unsigned long)microseconds,
-                 (unsigned long)nanoseconds);
+        tally->hits++;
+        tally->fails++;
     }
+    maip_test_assert_failed(site->cause, site->op, message, site->file, site->line, site->func);
+}
 
-    return buffer;
+void maip_test_expect_site_failed(fossil_maip_site_t *site, const char *message)
+{
+    maip_site_tally_t *tally = maip_site_tally(site);
+    if (tally)
+    {
+        tally->hits++;
+        tally->fails++;
+    }
+    maip_test_expect_failed(site->cause, site->op, message, site->file, site->line, site->func);
 }
 
-void fossil_maip_show_cases(const fossil_maip_suite_t *suite, const fossil_maip_case_t *test_case, const fossil_maip_engine_t *engine)
+// Folds the calling thread's counts into the run totals and drops them; runner
+// threads and forked children call it on their way out.
+static void maip_site_release(void)
 {
-    if (!test_case)
+    if (!maip_site_local)
         return;
 
-    // Determine mode (list, tree, graph), default to list
-    const char *mode = (engine && engine->pallet.show.mode) ? engine->pallet.show.mode : "list";
+    // Both span maip_site_capacity() slots while a run is open
+    for (size_t i = 0; maip_site_totals && i < maip_site_total_count; ++i)
+    {
+        if (maip_site_local[i].hits == 0)
+            continue;
+#if !defined(_WIN32)
+        __atomic_fetch_add(&maip_site_totals[i].hits, maip_site_local[i].hits, __ATOMIC_RELAXED);
+        __atomic_fetch_add(&maip_site_totals[i].fails, maip_site_local[i].fails, __ATOMIC_RELAXED);
+#else
+        maip_site_totals[i].hits += maip_site_local[i].hits;
+        maip_site_totals[i].fails += maip_site_local[i].fails;
+#endif
+    }
+    maip_sys_memory_free(maip_site_local);
+    maip_site_local = NULL;
+}
 
-    const char *result_str =
-        (test_case->state == FOSSIL_MAIP_CASE_EMPTY) ? "{cyan}empty{reset}" : (test_case->state == FOSSIL_MAIP_CASE_PASS)     ? "{green}pass{reset}"
-                                                                            : (test_case->state == FOSSIL_MAIP_CASE_FAIL)       ? "{red}fail{reset}"
-                                                                            : (test_case->state == FOSSIL_MAIP_CASE_TIMEOUT)    ? "{yellow}timeout{reset}"
-                                                                            : (test_case->state == FOSSIL_MAIP_CASE_SKIPPED)    ? "{yellow}skipped{reset}"
-                                                                            : (test_case->state == FOSSIL_MAIP_CASE_UNEXPECTED) ? "{magenta}unexpected{reset}"
-                                                                                                                                  : "{white}unknown{reset}";
+// A forked child starts with a copy of its parent's counts, which are still
+// the parent's to report.
+static void maip_site_after_fork(void)
+{
+    maip_site_local = NULL;
+}
 
-    // Filtering logic
-    // Apply filters only if they are set (not NULL)
-    if (engine && engine->pallet.show.test_name)
+// Zeroed memory that forked children write to as well.
+static void *maip_site_share(size_t size)
+{
+#if !defined(_WIN32)
+    // A shared mapping of /dev/zero, as strict POSIX has no MAP_ANONYMOUS
+    void *shared = MAP_FAILED;
+    int zero = open("/dev/zero", O_RDWR);
+    if (zero >= 0)
     {
-        if (maip_io_cstr_compare(test_case->name, engine->pallet.show.test_name) != 0)
-            return;
+        shared = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, zero, 0);
+        close(zero);
     }
+    return shared == MAP_FAILED ? NULL : shared;
+#else
+    return maip_sys_memory_calloc(1, size);
+#endif
+}
 
-    if (engine && engine->pallet.show.name)
+// Opens the run totals. Counts the calling thread gathered before the run do
+// not belong to it.
+static void maip_site_begin(void)
+{
+    maip_site_release();
+
+    if (!maip_site_late)
+        maip_site_late = maip_site_share(sizeof(*maip_site_late));
+
+    size_t count = maip_site_capacity();
+    maip_site_totals = maip_site_share(count * sizeof(maip_site_tally_t));
+    maip_site_total_count = maip_site_totals ? count : 0;
+}
+
+static const fossil_maip_site_t *maip_site_at(size_t index)
+{
+    size_t count = maip_site_static_count();
+#if defined(FOSSIL_MAIP_SITE_SECTION)
+    if (index < count)
+        return &__start_fossil_maip_sites[index];
+#endif
+    return maip_site_late && index - count < FOSSIL_MAIP_SITE_LATE_MAX ? maip_site_late->sites[index - count] : NULL;
+}
+
+static int maip_site_compare(const void *a, const void *b)
+{
+    const fossil_maip_site_t *left = maip_site_at(*(const size_t *)a);
+    const fossil_maip_site_t *right = maip_site_at(*(const size_t *)b);
+    int order = strcmp(left->file, right->file);
+    if (order != 0)
+        return order;
+    return (left->line > right->line) - (left->line < right->line);
+}
+
+static const char *maip_site_cause_name(int cause)
+{
+    static const char *names[] = {"unknown", "logic", "timeout", "memory", "io",
+                                  "coverage", "range", "float", "string", "text"};
+    return cause >= 0 && cause < (int)(sizeof(names) / sizeof(names[0])) ? names[cause] : "unknown";
+}
+
+static const char *maip_site_op_name(int op)
+{
+    static const char *names[] = {"-", "true", "false", "==", "!=", "<", "<=", ">", ">=",
+                                  "within", "outside", "is", "is-not"};
+    return op >= 0 && op < (int)(sizeof(names) / sizeof(names[0])) ? names[op] : "-";
+}
+
+// Writes one line per site, in source order, then closes the run totals.
+// Sites with no hits are assertions the run never reached.
+static void maip_site_end(const char *path)
+{
+    maip_site_release();
+    if (!maip_site_totals)
+        return;
+
+    size_t late = maip_site_late ? maip_site_late->count : 0;
+    if (late > FOSSIL_MAIP_SITE_LATE_MAX)
+        late = FOSSIL_MAIP_SITE_LATE_MAX;
+    size_t first = maip_site_static_count();
+    size_t *order = path ? maip_sys_memory_alloc((first + late) * sizeof(*order) + 1) : NULL;
+    size_t count = 0;
+    for (size_t i = 0; order && i < first + late; ++i)
     {
-        if (maip_io_cstr_compare(suite->name, engine->pallet.show.name) != 0)
-            return;
+        const fossil_maip_site_t *site = maip_site_at(i);
+        if (!site)
+            continue; // Slot of a lost registration race
+
+        // A site two processes registered at once counts in its first slot
+        size_t j = first;
+        while (j < i && maip_site_at(j) != site)
+            ++j;
+        if (j < i)
+        {
+            maip_site_totals[j].hits += maip_site_totals[i].hits;
+            maip_site_totals[j].fails += maip_site_totals[i].fails;
+            continue;
+        }
+        order[count++] = i;
     }
 
-    if (engine && engine->pallet.show.tag)
+    size_t ran = 0;
+    uint64_t hits = 0, fails = 0;
+    for (size_t i = 0; i < count; ++i)
     {
-        if (!test_case->tags || !strstr(test_case->tags, engine->pallet.show.tag))
-            return;
+        ran += maip_site_totals[order[i]].hits ? 1 : 0;
+        hits += maip_site_totals[order[i]].hits;
+        fails += maip_site_totals[order[i]].fails;
     }
 
-    // Result filtering: extract plain result value for comparison
-    if (engine && engine->pallet.show.result)
+    FILE *file = order ? fopen(path, "w") : NULL;
+    if (file)
     {
-        const char *result_plain = NULL;
-        if (test_case->state == FOSSIL_MAIP_CASE_EMPTY)
-            result_plain = "empty";
-        else if (test_case->state == FOSSIL_MAIP_CASE_PASS)
-            result_plain = "pass";
-        else if (test_case->state == FOSSIL_MAIP_CASE_FAIL)
-            result_plain = "fail";
-        else if (test_case->state == FOSSIL_MAIP_CASE_TIMEOUT)
-            result_plain = "timeout";
-        else if (test_case->state == FOSSIL_MAIP_CASE_SKIPPED)
-            result_plain = "skipped";
-        else if (test_case->state == FOSSIL_MAIP_CASE_UNEXPECTED)
-            result_plain = "unexpected";
+        qsort(order, count, sizeof(*order), maip_site_compare);
+        fprintf(file, "# %zu assertion sites, %zu ran, %zu never ran; %llu hits, %llu failed\n",
+                count, ran, count - ran, (unsigned long long)hits, (unsigned long long)fails);
+        fprintf(file, "# %10s %8s %-8s %-7s %s\n", "hits", "fails", "cause", "op", "site function");
+        for (size_t i = 0; i < count; ++i)
+        {
+            const fossil_maip_site_t *site = maip_site_at(order[i]);
+            const maip_site_tally_t *tally = &maip_site_totals[order[i]];
+            fprintf(file, "%12llu %8llu %-8s %-7s %s:%d %s\n",
+                    (unsigned long long)tally->hits, (unsigned long long)tally->fails,
+                    maip_site_cause_name(site->cause), maip_site_op_name(site->op),
+                    site->file, site->line, site->func);
+        }
+        fclose(file);
+    }
+    maip_sys_memory_free(order);
 
-        if (!result_plain || maip_io_cstr_compare(result_plain, engine->pallet.show.result) != 0)
-            return;
+#if !defined(_WIN32)
+    munmap(maip_site_totals, maip_site_total_count * sizeof(maip_site_tally_t));
+#else
+    maip_sys_memory_free(maip_site_totals);
+#endif
+    maip_site_totals = NULL;
+    maip_site_total_count = 0;
+}
+
+// --- Parameter Tables (FOSSIL_TEST_PARAM) ---
+// A parameterized case is registered once, pointing at its static table. When
+// the run starts it is replaced by one case per row, so every later stage
+// (filters, sharding, scheduling, history) handles rows like any other case.
+// The rows keep pointing into the table: a suite gets one new case array, and
+// the run one arena holding every row name.
+const void *fossil_maip_param_row(void)
+{
+    const fossil_maip_case_t *test_case = fossil_maip_context()->current_case;
+    if (!test_case || !test_case->param.table)
+        return NULL;
+    return (const char *)test_case->param.table + test_case->param.row * test_case->param.size;
+}
+
+size_t fossil_maip_param_index(void)
+{
+    const fossil_maip_case_t *test_case = fossil_maip_context()->current_case;
+    return test_case ? test_case->param.row : 0;
+}
+
+static int fossil_maip_expand_params(fossil_maip_engine_t *engine)
+{
+    // Each arena starts with a link to the previous one, for fossil_maip_end
+    size_t arena_size = sizeof(char *);
+    for (size_t i = 0; i < engine->count; ++i)
+    {
+        const fossil_maip_suite_t *suite = &engine->suites[i];
+        for (size_t j = 0; j < suite->count; ++j)
+        {
+            const fossil_maip_case_t *test_case = &suite->cases[j];
+            if (test_case->param.table && test_case->param.count)
+                arena_size += test_case->param.count * (strlen(test_case->name) + 22); // "/" + row + '\0'
+        }
     }
+    if (arena_size == sizeof(char *))
+        return FOSSIL_MAIP_SUCCESS;
 
-    // Output according to mode and theme
-    if (maip_io_cstr_compare(mode, "tree") == 0)
+    char *arena = maip_sys_memory_alloc(arena_size);
+    if (!arena)
+        return FOSSIL_MAIP_FAILURE;
+    memcpy(arena, &engine->param_names, sizeof(char *));
+    engine->param_names = arena;
+    char *names = arena + sizeof(char *);
+
+    for (size_t i = 0; i < engine->count; ++i)
     {
-        switch (engine ? engine->pallet.theme : MAIP_THEME_FOSSIL)
+        fossil_maip_suite_t *suite = &engine->suites[i];
+        size_t total = 0;
+        for (size_t j = 0; j < suite->count; ++j)
         {
-        case MAIP_THEME_FOSSIL:
-            if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "doge") == 0)
-            {
-                maip_io_printf("  {blue}├─{reset} {cyan}%s{reset} {blue}[test case]{reset}\n", test_case->name);
-                maip_io_printf("  {blue}│   ├─{reset} {cyan}Tags    {reset}: {gray}%s{reset} {orange}[with tag]{reset}\n", test_case->tags);
-                maip_io_printf("  {blue}│   ├─{reset} {cyan}Criteria{reset}: {gray}%s{reset} {orange}[given criteria]{reset}\n", test_case->criteria);
-                maip_io_printf("  {blue}│   ├─{reset} {cyan}Time    {reset}: {gray}%s{reset} {orange}[the time]{reset}\n", fossil_maip_format_ns(test_case->elapsed_ns));
-                maip_io_printf("  {blue}│   └─{reset} {cyan}Result  {reset}: {gray}%s{reset} {orange}[the result]{reset}\n", result_str);
-            }
-            else if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "ci") == 0)
+            const fossil_maip_param_t *param = &suite->cases[j].param;
+            total += param->table && param->count ? param->count : 1;
+        }
+        if (total == suite->count)
+            continue;
+
+        fossil_maip_case_t *cases = maip_sys_memory_alloc(total * sizeof(*cases));
+        if (!cases)
+            return FOSSIL_MAIP_FAILURE;
+
+        size_t count = 0;
+        for (size_t j = 0; j < suite->count; ++j)
+        {
+            const fossil_maip_case_t *test_case = &suite->cases[j];
+            if (!test_case->param.table || !test_case->param.count)
             {
-                maip_io_printf("  {blue}::TEST       :: %s{reset}\n", test_case->name);
-                maip_io_printf("    {blue}::TAGS     :: %s{reset}\n", test_case->tags);
-                maip_io_printf("    {blue}::CRITERIA :: %s{reset}\n", test_case->criteria);
-                maip_io_printf("    {blue}::TIME     :: %s{reset}\n", fossil_maip_format_ns(test_case->elapsed_ns));
-                maip_io_printf("    {blue}::RESULT   :: %s{reset}\n", result_str);
+                cases[count++] = *test_case;
+                continue;
             }
-            else
-            { // plain or default
-                maip_io_printf("  {blue}├─{reset} {cyan}%s{reset}\n", test_case->name);
-                maip_io_printf("  {blue}│   ├─{reset} {cyan}Tags    {reset}: {gray}%s{reset}\n", test_case->tags);
-                maip_io_printf("  {blue}│   ├─{reset} {cyan}Criteria{reset}: {gray}%s{reset}\n", test_case->criteria);
-                maip_io_printf("  {blue}│   ├─{reset} {cyan}Time    {reset}: {gray}%s{reset}\n", fossil_maip_format_ns(test_case->elapsed_ns));
-                maip_io_printf("  {blue}│   └─{reset} {cyan}Result  {reset}: {gray}%s{reset}\n", result_str);
+
+            for (size_t row = 0; row < test_case->param.count; ++row)
+            {
+                fossil_maip_case_t *expanded = &cases[count++];
+                *expanded = *test_case;
+                expanded->name = names;
+                expanded->param.count = 0;
+                expanded->param.row = row;
+                names += sprintf(names, "%s/%zu", test_case->name, row) + 1;
             }
-            break;
-        case MAIP_THEME_LIGHT:
-            if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "doge") == 0)
+        }
+
+        maip_sys_memory_free(suite->cases);
+        suite->cases = cases;
+        suite->count = total;
+        suite->capacity = total;
+    }
+    return FOSSIL_MAIP_SUCCESS;
+}
+
+// --- Compiled Filter ---
+// The name lists of the filter command and of run --only/--skip are compiled
+// once by fossil_maip_start. Plain names go into an open-addressing hash set;
+// names with '*' or '?' become globs, stored as the literal runs between the
+// '*'s. Selecting a case is then one hash probe plus a pass over the globs,
+// however long the lists are.
+typedef struct
+{
+    const char *text; // Not terminated; '?' matches any character in globs
+    size_t length;
+} maip_span_t;
+
+typedef struct
+{
+    maip_span_t *parts;   // Literal runs between '*', empty runs dropped
+    size_t part_count;
+    bool anchored_start;  // Pattern does not start with '*'
+    bool anchored_end;    // Pattern does not end with '*'
+} maip_glob_t;
+
+typedef struct
+{
+    maip_span_t *names;   // Exact names
+    size_t name_count;
+    uint32_t *buckets;    // Index + 1 into names, 0 = empty
+    size_t bucket_count;  // Power of two
+    maip_glob_t *globs;
+    size_t glob_count;
+    bool active;          // A list was given
+} maip_matcher_t;
+
+// A --tag expression compiled to postfix. Each tag operand is a mask of tag
+// ids; a case has it when its bitset shares a bit with the mask (globs and
+// comma lists widen the mask rather than adding operands).
+typedef enum
+{
+    MAIP_TAG_ANY, // Push whether the case has any tag of mask
+    MAIP_TAG_NOT,
+    MAIP_TAG_AND,
+    MAIP_TAG_OR
+} maip_tag_op_kind_t;
+
+typedef struct
+{
+    maip_tag_op_kind_t kind;
+    uint64_t mask[FOSSIL_MAIP_TAG_WORDS];
+} maip_tag_op_t;
+
+typedef struct
+{
+    maip_tag_op_t *ops;
+    size_t count;
+    bool active; // An expression was given
+} maip_tag_expr_t;
+
+struct fossil_maip_filter
+{
+    maip_matcher_t test_name;  // filter --test-name / --not-test-name
+    maip_matcher_t suite_name; // filter --suite-name
+    maip_matcher_t only;       // run --only
+    maip_matcher_t skip;       // run --skip
+    bool test_name_inverted;
+
+    maip_matcher_t tags;       // Tag dictionary, the index of a name is its tag id
+    bool tags_full;            // Some tag did not fit in FOSSIL_MAIP_TAG_MAX
+    maip_tag_expr_t tag;       // filter --tag
+    maip_tag_expr_t show_tag;  // show --tag
+};
+
+static uint64_t maip_span_hash(const char *text, size_t length)
+{
+    uint64_t hash = 0xcbf29ce484222325ULL; // FNV-1a
+    for (size_t i = 0; i < length; ++i)
+        hash = (hash ^ (uint8_t)text[i]) * 0x100000001b3ULL;
+    return hash;
+}
+
+// Whether a glob run matches at text, which has at least part->length bytes.
+static bool maip_glob_part_at(const maip_span_t *part, const char *text)
+{
+    for (size_t i = 0; i < part->length; ++i)
+    {
+        if (part->text[i] != '?' && part->text[i] != text[i])
+            return false;
+    }
+    return true;
+}
+
+static bool maip_glob_match(const maip_glob_t *glob, const char *text, size_t length)
+{
+    size_t first = 0;
+    size_t last = glob->part_count;
+    size_t begin = 0;
+    size_t end = length;
+
+    // No '*' at all: the single run must cover the whole text
+    if (glob->anchored_start && glob->anchored_end && last == 1)
+        return glob->parts[0].length == length && maip_glob_part_at(&glob->parts[0], text);
+
+    if (glob->anchored_start && first < last)
+    {
+        const maip_span_t *part = &glob->parts[first++];
+        if (part->length > end - begin || !maip_glob_part_at(part, text + begin))
+            return false;
+        begin += part->length;
+    }
+    if (glob->anchored_end && first < last)
+    {
+        const maip_span_t *part = &glob->parts[--last];
+        if (part->length > end - begin || !maip_glob_part_at(part, text + end - part->length))
+            return false;
+        end -= part->length;
+    }
+
+    // Runs between two '*' match at their leftmost position, in order
+    for (size_t i = first; i < last; ++i)
+    {
+        const maip_span_t *part = &glob->parts[i];
+        while (begin + part->length <= end && !maip_glob_part_at(part, text + begin))
+            begin++;
+        if (begin + part->length > end)
+            return false;
+        begin += part->length;
+    }
+    return true;
+}
+
+static int maip_glob_compile(maip_glob_t *glob, const char *pattern)
+{
+    size_t length = strlen(pattern);
+    size_t stars = 0;
+    for (size_t i = 0; i < length; ++i)
+        stars += pattern[i] == '*';
+
+    glob->parts = maip_sys_memory_alloc((stars + 1) * sizeof(*glob->parts));
+    if (!glob->parts)
+        return FOSSIL_MAIP_FAILURE;
+    glob->part_count = 0;
+    glob->anchored_start = length > 0 && pattern[0] != '*';
+    glob->anchored_end = length > 0 && pattern[length - 1] != '*';
+
+    size_t start = 0;
+    for (size_t i = 0; i <= length; ++i)
+    {
+        if (i < length && pattern[i] != '*')
+            continue;
+        if (i > start)
+        {
+            glob->parts[glob->part_count].text = pattern + start;
+            glob->parts[glob->part_count].length = i - start;
+            glob->part_count++;
+        }
+        start = i + 1;
+    }
+    return FOSSIL_MAIP_SUCCESS;
+}
+
+// Index + 1 of an exact name, or 0 when it is not in the set.
+static size_t maip_matcher_find(const maip_matcher_t *matcher, const char *text, size_t length)
+{
+    if (!matcher->bucket_count)
+        return 0;
+
+    size_t mask = matcher->bucket_count - 1;
+    for (size_t slot = maip_span_hash(text, length) & mask; matcher->buckets[slot]; slot = (slot + 1) & mask)
+    {
+        const maip_span_t *name = &matcher->names[matcher->buckets[slot] - 1];
+        if (name->length == length && maip_sys_memory_compare((void *)name->text, (void *)text, length) == 0)
+            return matcher->buckets[slot];
+    }
+    return 0;
+}
+
+// Adds a name that is not in the set yet; the caller keeps the text alive.
+static void maip_matcher_insert(maip_matcher_t *matcher, const char *text, size_t length)
+{
+    maip_span_t *name = &matcher->names[matcher->name_count];
+    name->text = text;
+    name->length = length;
+
+    size_t mask = matcher->bucket_count - 1;
+    size_t slot = maip_span_hash(text, length) & mask;
+    while (matcher->buckets[slot])
+        slot = (slot + 1) & mask;
+    matcher->buckets[slot] = (uint32_t)++matcher->name_count;
+}
+
+// Allocates room for count exact names, at most half filling the buckets.
+static int maip_matcher_reserve(maip_matcher_t *matcher, size_t count)
+{
+    size_t bucket_count = 8;
+    while (bucket_count < count * 2)
+        bucket_count <<= 1;
+
+    matcher->names = maip_sys_memory_alloc(count * sizeof(*matcher->names));
+    matcher->buckets = maip_sys_memory_calloc(bucket_count, sizeof(*matcher->buckets));
+    if (!matcher->names || !matcher->buckets)
+        return FOSSIL_MAIP_FAILURE;
+    matcher->bucket_count = bucket_count;
+    return FOSSIL_MAIP_SUCCESS;
+}
+
+static bool maip_matcher_test(const maip_matcher_t *matcher, const char *text, size_t length)
+{
+    if (maip_matcher_find(matcher, text, length))
+        return true;
+    for (size_t i = 0; i < matcher->glob_count; ++i)
+    {
+        if (maip_glob_match(&matcher->globs[i], text, length))
+            return true;
+    }
+    return false;
+}
+
+static bool maip_matcher_test_name(const maip_matcher_t *matcher, const char *name)
+{
+    return name && maip_matcher_test(matcher, name, strlen(name));
+}
+
+static void maip_matcher_free(maip_matcher_t *matcher)
+{
+    for (size_t i = 0; i < matcher->glob_count; ++i)
+        maip_sys_memory_free(matcher->globs[i].parts);
+    maip_sys_memory_free(matcher->globs);
+    maip_sys_memory_free(matcher->names);
+    maip_sys_memory_free(matcher->buckets);
+    maip_sys_memory_set(matcher, 0, sizeof(*matcher));
+}
+
+static int maip_matcher_compile(maip_matcher_t *matcher, cstr *list, size_t count)
+{
+    maip_sys_memory_set(matcher, 0, sizeof(*matcher));
+    if (!list || count == 0)
+        return FOSSIL_MAIP_SUCCESS;
+    matcher->active = true;
+
+    matcher->globs = maip_sys_memory_alloc(count * sizeof(*matcher->globs));
+    if (!matcher->globs || maip_matcher_reserve(matcher, count) != FOSSIL_MAIP_SUCCESS)
+    {
+        maip_matcher_free(matcher);
+        return FOSSIL_MAIP_FAILURE;
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        const char *pattern = list[i];
+        if (!pattern)
+            continue;
+
+        if (strpbrk(pattern, "*?"))
+        {
+            if (maip_glob_compile(&matcher->globs[matcher->glob_count], pattern) != FOSSIL_MAIP_SUCCESS)
             {
-                maip_io_printf("  {bright_blue}├─{reset} {bright_cyan}%s{reset} {bright_blue}[test case]{reset}\n", test_case->name);
-                maip_io_printf("  {bright_blue}│   ├─{reset} {bright_cyan}Tags    {reset}: {gray}%s{reset} {orange}[with tag]{reset}\n", test_case->tags);
-                maip_io_printf("  {bright_blue}│   ├─{reset} {bright_cyan}Criteria{reset}: {gray}%s{reset} {orange}[given criteria]{reset}\n", test_case->criteria);
-                maip_io_printf("  {bright_blue}│   ├─{reset} {bright_cyan}Time    {reset}: {gray}%s{reset} {orange}[the time]{reset}\n", fossil_maip_format_ns(test_case->elapsed_ns));
-                maip_io_printf("  {bright_blue}│   └─{reset} {bright_cyan}Result  {reset}: {gray}%s{reset} {orange}[the result]{reset}\n", result_str);
+                maip_matcher_free(matcher);
+                return FOSSIL_MAIP_FAILURE;
             }
-            else if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "ci") == 0)
+            matcher->glob_count++;
+            continue;
+        }
+
+        size_t length = strlen(pattern);
+        if (!maip_matcher_find(matcher, pattern, length)) // Unless listed twice
+            maip_matcher_insert(matcher, pattern, length);
+    }
+    return FOSSIL_MAIP_SUCCESS;
+}
+
+// --- Tag Index ---
+// Every distinct tag gets an id in the engine-wide dictionary, and each case
+// keeps the ids of its tags as a bitset. A --tag expression is compiled once
+// against the dictionary, so testing a case is a few AND/OR over its bitset:
+//   expr := term ('|' term)* ; term := unary ('&' unary)* ;
+//   unary := '!' unary | '(' expr ')' | tag [',' tag]*
+// A tag may use '*' and '?' globs; ',' lists alternatives as before.
+typedef struct
+{
+    const char *text;
+    size_t position;
+    const maip_matcher_t *tags;
+    maip_tag_expr_t *expr;
+    size_t depth;      // Values on the evaluation stack
+    bool failed;
+} maip_tag_parser_t;
+
+static bool maip_tag_expr_eval(const maip_tag_expr_t *expr, const uint64_t *bits)
+{
+    // The evaluation stack is one bit per value, top in bit 0
+    uint64_t stack = 0;
+    for (size_t i = 0; i < expr->count; ++i)
+    {
+        const maip_tag_op_t *op = &expr->ops[i];
+        uint64_t top;
+        switch (op->kind)
+        {
+        case MAIP_TAG_ANY:
+            top = 0;
+            for (size_t w = 0; w < FOSSIL_MAIP_TAG_WORDS; ++w)
+                top |= bits[w] & op->mask[w];
+            stack = (stack << 1) | (top != 0);
+            break;
+        case MAIP_TAG_NOT:
+            stack ^= 1;
+            break;
+        case MAIP_TAG_AND:
+            top = stack & 1;
+            stack = (stack >> 1) & (~1ULL | top);
+            break;
+        case MAIP_TAG_OR:
+            top = stack & 1;
+            stack = (stack >> 1) | top;
+            break;
+        }
+    }
+    return (stack & 1) != 0;
+}
+
+static void maip_tag_parser_skip(maip_tag_parser_t *parser)
+{
+    while (parser->text[parser->position] == ' ' || parser->text[parser->position] == '\t')
+        parser->position++;
+}
+
+static maip_tag_op_t *maip_tag_parser_emit(maip_tag_parser_t *parser, maip_tag_op_kind_t kind)
+{
+    maip_tag_op_t *op = &parser->expr->ops[parser->expr->count++];
+    maip_sys_memory_set(op, 0, sizeof(*op));
+    op->kind = kind;
+
+    if (kind == MAIP_TAG_ANY)
+        parser->depth++;
+    else if (kind != MAIP_TAG_NOT)
+        parser->depth--;
+    if (parser->depth > 64)
+        parser->failed = true; // Deeper than the bit stack of maip_tag_expr_eval
+    return op;
+}
+
+// Adds the ids of the tags a name or glob refers to. Tags no case carries
+// match nothing.
+static void maip_tag_parser_name(maip_tag_parser_t *parser, maip_tag_op_t *op, const char *name, size_t length)
+{
+    bool glob = false;
+    for (size_t i = 0; i < length; ++i)
+        glob |= name[i] == '*' || name[i] == '?';
+
+    if (!glob)
+    {
+        size_t id = maip_matcher_find(parser->tags, name, length);
+        if (id)
+            op->mask[(id - 1) / 64] |= 1ULL << ((id - 1) % 64);
+        return;
+    }
+
+    // maip_glob_compile takes a terminated pattern
+    char *pattern = maip_sys_memory_alloc(length + 1);
+    maip_glob_t compiled = {0};
+    if (pattern)
+    {
+        maip_sys_memory_copy(pattern, (void *)name, length);
+        pattern[length] = '\0';
+    }
+    if (!pattern || maip_glob_compile(&compiled, pattern) != FOSSIL_MAIP_SUCCESS)
+    {
+        parser->failed = true;
+        maip_sys_memory_free(pattern);
+        return;
+    }
+    for (size_t id = 0; id < parser->tags->name_count; ++id)
+    {
+        const maip_span_t *tag = &parser->tags->names[id];
+        if (maip_glob_match(&compiled, tag->text, tag->length))
+            op->mask[id / 64] |= 1ULL << (id % 64);
+    }
+    maip_sys_memory_free(compiled.parts);
+    maip_sys_memory_free(pattern);
+}
+
+static void maip_tag_parse_or(maip_tag_parser_t *parser);
+
+static void maip_tag_parse_unary(maip_tag_parser_t *parser)
+{
+    maip_tag_parser_skip(parser);
+    char c = parser->text[parser->position];
+
+    if (c == '!')
+    {
+        parser->position++;
+        maip_tag_parse_unary(parser);
+        maip_tag_parser_emit(parser, MAIP_TAG_NOT);
+        return;
+    }
+    if (c == '(')
+    {
+        parser->position++;
+        maip_tag_parse_or(parser);
+        maip_tag_parser_skip(parser);
+        if (parser->text[parser->position] != ')')
+        {
+            parser->failed = true;
+            return;
+        }
+        parser->position++;
+        return;
+    }
+
+    maip_tag_op_t *op = maip_tag_parser_emit(parser, MAIP_TAG_ANY);
+    for (;;)
+    {
+        maip_tag_parser_skip(parser);
+        const char *name = parser->text + parser->position;
+        size_t length = strcspn(name, "!&|(), \t");
+        if (length == 0)
+        {
+            parser->failed = true;
+            return;
+        }
+        maip_tag_parser_name(parser, op, name, length);
+        parser->position += length;
+
+        maip_tag_parser_skip(parser);
+        if (parser->text[parser->position] != ',')
+            return;
+        parser->position++;
+    }
+}
+
+static void maip_tag_parse_and(maip_tag_parser_t *parser)
+{
+    maip_tag_parse_unary(parser);
+    for (;;)
+    {
+        maip_tag_parser_skip(parser);
+        if (parser->failed || parser->text[parser->position] != '&')
+            return;
+        parser->position++;
+        maip_tag_parse_unary(parser);
+        maip_tag_parser_emit(parser, MAIP_TAG_AND);
+    }
+}
+
+static void maip_tag_parse_or(maip_tag_parser_t *parser)
+{
+    maip_tag_parse_and(parser);
+    for (;;)
+    {
+        maip_tag_parser_skip(parser);
+        if (parser->failed || parser->text[parser->position] != '|')
+            return;
+        parser->position++;
+        maip_tag_parse_and(parser);
+        maip_tag_parser_emit(parser, MAIP_TAG_OR);
+    }
+}
+
+static void maip_tag_expr_free(maip_tag_expr_t *expr)
+{
+    maip_sys_memory_free(expr->ops);
+    maip_sys_memory_set(expr, 0, sizeof(*expr));
+}
+
+// Parses a tag expression against the dictionary into ops, which has room
+// for one op per character of the text. Returns whether it is well formed.
+static bool maip_tag_expr_parse(maip_tag_expr_t *expr, const char *text, const maip_matcher_t *tags)
+{
+    expr->count = 0;
+    maip_tag_parser_t parser = {text, 0, tags, expr, 0, false};
+    maip_tag_parse_or(&parser);
+    maip_tag_parser_skip(&parser);
+    expr->active = !parser.failed && text[parser.position] == '\0';
+    return expr->active;
+}
+
+// Compiles a --tag expression against the dictionary. A malformed expression
+// is a command line error, so like the other option parsers it is fatal.
+static int maip_tag_expr_compile(maip_tag_expr_t *expr, const char *text, const maip_matcher_t *tags)
+{
+    maip_tag_expr_free(expr);
+    if (!text)
+        return FOSSIL_MAIP_SUCCESS;
+
+    // Every operand or operator emits at most one op per character
+    expr->ops = maip_sys_memory_alloc((strlen(text) + 1) * sizeof(*expr->ops));
+    if (!expr->ops)
+        return FOSSIL_MAIP_FAILURE;
+
+    if (!maip_tag_expr_parse(expr, text, tags))
+    {
+        maip_io_printf("{red}Invalid tag expression: %s (expected tags joined by &, |, ! and parentheses){reset}\n", text);
+        exit(EXIT_FAILURE);
+    }
+    return FOSSIL_MAIP_SUCCESS;
+}
+
+// Interns a comma-separated tag list into the dictionary and sets the bit of
+// each of its tags. Returns false when some tag no longer fits.
+static bool maip_tag_intern(maip_matcher_t *dictionary, const char *tag, uint64_t *bits)
+{
+    bool fits = true;
+    while (tag && *tag)
+    {
+        while (*tag == ' ' || *tag == ',')
+            tag++;
+        size_t length = strcspn(tag, ",");
+        size_t trimmed = length;
+        while (trimmed > 0 && tag[trimmed - 1] == ' ')
+            trimmed--;
+
+        if (trimmed > 0)
+        {
+            size_t id = maip_matcher_find(dictionary, tag, trimmed);
+            if (!id && dictionary->name_count < FOSSIL_MAIP_TAG_MAX)
             {
-                maip_io_printf("  {bright_blue}::TEST       :: %s{reset}\n", test_case->name);
-                maip_io_printf("    {bright_blue}::TAGS     :: %s{reset}\n", test_case->tags);
-                maip_io_printf("    {bright_blue}::CRITERIA :: %s{reset}\n", test_case->criteria);
-                maip_io_printf("    {bright_blue}::TIME     :: %s{reset}\n", fossil_maip_format_ns(test_case->elapsed_ns));
-                maip_io_printf("    {bright_blue}::RESULT   :: %s{reset}\n", result_str);
+                maip_matcher_insert(dictionary, tag, trimmed);
+                id = dictionary->name_count;
             }
+            if (id)
+                bits[(id - 1) / 64] |= 1ULL << ((id - 1) % 64);
             else
-            { // plain or default
-                maip_io_printf("  {bright_blue}├─{reset} {bright_cyan}%s{reset}\n", test_case->name);
-                maip_io_printf("  {bright_blue}│   ├─{reset} {bright_cyan}Tags    {reset}: {gray}%s{reset}\n", test_case->tags);
-                maip_io_printf("  {bright_blue}│   ├─{reset} {bright_cyan}Criteria{reset}: {gray}%s{reset}\n", test_case->criteria);
-                maip_io_printf("  {bright_blue}│   ├─{reset} {bright_cyan}Time    {reset}: {gray}%s{reset}\n", fossil_maip_format_ns(test_case->elapsed_ns));
-                maip_io_printf("  {bright_blue}│   └─{reset} {bright_cyan}Result  {reset}: {gray}%s{reset}\n", result_str);
+                fits = false;
+        }
+        tag += length;
+    }
+    return fits;
+}
+
+// Interns the tags of every registered case and compiles the --tag
+// expressions against them. Runs again on every run_all, so cases and tags
+// added in between are picked up; known tags keep their ids.
+static int fossil_maip_index_tags(fossil_maip_engine_t *engine)
+{
+    fossil_maip_filter_t *filter = engine->filter;
+    if (!filter)
+        return FOSSIL_MAIP_SUCCESS;
+
+    if (!filter->tags.bucket_count && maip_matcher_reserve(&filter->tags, FOSSIL_MAIP_TAG_MAX) != FOSSIL_MAIP_SUCCESS)
+        return FOSSIL_MAIP_FAILURE;
+
+    for (size_t i = 0; i < engine->count; ++i)
+    {
+        fossil_maip_suite_t *suite = &engine->suites[i];
+        for (size_t j = 0; j < suite->count; ++j)
+        {
+            fossil_maip_case_t *test_case = &suite->cases[j];
+            maip_sys_memory_set(test_case->tag_bits, 0, sizeof(test_case->tag_bits));
+            if (!maip_tag_intern(&filter->tags, test_case->tags, test_case->tag_bits) && !filter->tags_full)
+            {
+                filter->tags_full = true;
+                maip_io_printf("{yellow}More than %d distinct tags, later ones cannot be filtered on{reset}\n",
+                               FOSSIL_MAIP_TAG_MAX);
             }
-            break;
-        case MAIP_THEME_DARK:
-            if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "doge") == 0)
+        }
+    }
+
+    if (maip_tag_expr_compile(&filter->tag, engine->pallet.filter.tag, &filter->tags) != FOSSIL_MAIP_SUCCESS ||
+        maip_tag_expr_compile(&filter->show_tag, engine->pallet.show.tag, &filter->tags) != FOSSIL_MAIP_SUCCESS)
+        return FOSSIL_MAIP_FAILURE;
+    return FOSSIL_MAIP_SUCCESS;
+}
+
+static void fossil_maip_filter_free(fossil_maip_filter_t *filter)
+{
+    if (!filter)
+        return;
+    maip_matcher_free(&filter->test_name);
+    maip_matcher_free(&filter->suite_name);
+    maip_matcher_free(&filter->only);
+    maip_matcher_free(&filter->skip);
+    maip_matcher_free(&filter->tags);
+    maip_tag_expr_free(&filter->tag);
+    maip_tag_expr_free(&filter->show_tag);
+    maip_sys_memory_free(filter);
+}
+
+static fossil_maip_filter_t *fossil_maip_filter_compile(const fossil_maip_pallet_t *pallet)
+{
+    fossil_maip_filter_t *filter = maip_sys_memory_calloc(1, sizeof(*filter));
+    if (!filter)
+        return NULL;
+
+    filter->test_name_inverted = pallet->filter.test_name_inverted != 0;
+    if (maip_matcher_compile(&filter->test_name, pallet->filter.test_name_list, pallet->filter.test_name_count) != FOSSIL_MAIP_SUCCESS ||
+        maip_matcher_compile(&filter->suite_name, pallet->filter.name_list, pallet->filter.name_count) != FOSSIL_MAIP_SUCCESS ||
+        maip_matcher_compile(&filter->only, pallet->run.only_cases, pallet->run.only_count) != FOSSIL_MAIP_SUCCESS ||
+        maip_matcher_compile(&filter->skip, pallet->run.skip_cases, pallet->run.skip_count) != FOSSIL_MAIP_SUCCESS)
+    {
+        fossil_maip_filter_free(filter);
+        return NULL;
+    }
+    return filter;
+}
+
+int fossil_maip_tag_match(const char *expression, const char *tags)
+{
+    if (!expression)
+        return FOSSIL_MAIP_FAILURE;
+
+    maip_matcher_t dictionary = {0};
+    maip_tag_expr_t expr = {0};
+    uint64_t bits[FOSSIL_MAIP_TAG_WORDS] = {0};
+    int result = FOSSIL_MAIP_FAILURE;
+
+    expr.ops = maip_sys_memory_alloc((strlen(expression) + 1) * sizeof(*expr.ops));
+    if (expr.ops && maip_matcher_reserve(&dictionary, FOSSIL_MAIP_TAG_MAX) == FOSSIL_MAIP_SUCCESS)
+    {
+        maip_tag_intern(&dictionary, tags, bits);
+        if (maip_tag_expr_parse(&expr, expression, &dictionary))
+            result = maip_tag_expr_eval(&expr, bits) ? 1 : 0;
+    }
+    maip_tag_expr_free(&expr);
+    maip_matcher_free(&dictionary);
+    return result;
+}
+
+// --- Update Score ---
+void fossil_maip_update_score(fossil_maip_case_t *test_case, fossil_maip_suite_t *suite)
+{
+    if (!test_case || !suite)
+        return;
+
+    if (test_case->state != FOSSIL_MAIP_CASE_EMPTY)
+    {
+        switch (test_case->state)
+        {
+        case FOSSIL_MAIP_CASE_PASS:
+            suite->score.passed++;
+            break;
+        case FOSSIL_MAIP_CASE_FAIL:
+            suite->score.failed++;
+            break;
+        case FOSSIL_MAIP_CASE_TIMEOUT:
+            suite->score.timeout++;
+            break;
+        case FOSSIL_MAIP_CASE_SKIPPED:
+            suite->score.skipped++;
+            break;
+        case FOSSIL_MAIP_CASE_UNEXPECTED:
+            suite->score.unexpected++;
+            break;
+        case FOSSIL_MAIP_CASE_EMPTY:
+        default:
+            suite->score.empty++;
+            break;
+        }
+    }
+
+    // --- Recompute suite totals for safety ---
+    suite->total_score = suite->score.passed;
+    suite->total_possible = suite->score.passed +
+                            suite->score.failed +
+                            suite->score.timeout +
+                            suite->score.skipped +
+                            suite->score.unexpected +
+                            suite->score.empty;
+}
+
+// --- Latency Histogram (run --repeat) ---
+
+static size_t maip_latency_bucket(uint64_t ns)
+{
+    if (ns < (1ULL << FOSSIL_MAIP_LATENCY_SUB_BITS))
+        return (size_t)ns;
+
+    int exponent = 63;
+    while (!(ns >> exponent))
+        exponent--;
+    int shift = exponent - FOSSIL_MAIP_LATENCY_SUB_BITS;
+    size_t sub = (size_t)(ns >> shift) & ((1u << FOSSIL_MAIP_LATENCY_SUB_BITS) - 1);
+    return ((size_t)(shift + 1) << FOSSIL_MAIP_LATENCY_SUB_BITS) + sub;
+}
+
+// Midpoint of the values a bucket holds.
+static uint64_t maip_latency_bucket_value(size_t bucket)
+{
+    size_t per_octave = (size_t)1 << FOSSIL_MAIP_LATENCY_SUB_BITS;
+    if (bucket < per_octave)
+        return (uint64_t)bucket;
+
+    int shift = (int)(bucket / per_octave) - 1;
+    uint64_t low = (uint64_t)(per_octave + bucket % per_octave) << shift;
+    return low + (((uint64_t)1 << shift) >> 1);
+}
+
+static void maip_latency_record(fossil_maip_latency_t *latency, uint64_t ns, bool failed)
+{
+    if (latency->runs == 0 || ns < latency->min_ns)
+        latency->min_ns = ns;
+    if (ns > latency->max_ns)
+        latency->max_ns = ns;
+    latency->runs++;
+    if (failed)
+        latency->failures++;
+    latency->buckets[maip_latency_bucket(ns)]++;
+}
+
+// Value below which the given fraction of the iterations fell, kept within the
+// exact minimum and maximum.
+static uint64_t maip_latency_percentile(const fossil_maip_latency_t *latency, double fraction)
+{
+    if (latency->runs == 0)
+        return 0;
+
+    uint64_t rank = (uint64_t)ceil(fraction * latency->runs);
+    if (rank == 0)
+        rank = 1;
+
+    uint64_t seen = 0;
+    for (size_t b = 0; b < FOSSIL_MAIP_LATENCY_BUCKETS; ++b)
+    {
+        seen += latency->buckets[b];
+        if (seen >= rank)
+        {
+            uint64_t value = maip_latency_bucket_value(b);
+            if (value < latency->min_ns)
+                return latency->min_ns;
+            return value > latency->max_ns ? latency->max_ns : value;
+        }
+    }
+    return latency->max_ns;
+}
+
+// A case is flaky when its iterations disagree: some passed and some did not.
+static bool maip_latency_flaky(const fossil_maip_latency_t *latency)
+{
+    return latency && latency->failures > 0 && latency->failures < latency->runs;
+}
+
+// --- Show Test Cases ---
+
+// Formats nanoseconds into a human-readable string in the caller's buffer
+static void fossil_maip_format_ns(uint64_t ns, char *buffer, size_t size)
+{
+    uint64_t hours = ns / 3600000000000ULL;
+    uint64_t minutes = (ns % 3600000000000ULL) / 60000000000ULL;
+    uint64_t seconds = (ns % 60000000000ULL) / 1000000000ULL;
+    uint64_t microseconds = (ns % 1000000000ULL) / 1000ULL;
+    uint64_t nanoseconds = ns % 1000ULL;
+
+    snprintf(buffer, size, "%02lu:%02lu:%02lu.%06lu,%03lu",
+             (unsigned long)hours,
+             (unsigned long)minutes,
+             (unsigned long)seconds,
+             (unsigned long)microseconds,
+             (unsigned long)nanoseconds);
+}
+
+// Formats the wall time of a case followed by the CPU time its thread used
+static void fossil_maip_format_case_time(const fossil_maip_case_t *test_case, char *buffer, size_t size)
+{
+    char wall[32];
+    char cpu[32];
+    fossil_maip_format_ns(test_case->elapsed_ns, wall, sizeof(wall));
+    fossil_maip_format_ns(test_case->cpu_ns, cpu, sizeof(cpu));
+    snprintf(buffer, size, "%s (cpu %s)", wall, cpu);
+}
+
+// Name of a signal recorded by crash recovery.
+static const char *fossil_maip_signal_name(int sig)
+{
+    switch (sig)
+    {
+#if !defined(_WIN32)
+    case SIGBUS:
+        return "SIGBUS";
+#endif
+    case SIGSEGV:
+        return "SIGSEGV";
+    case SIGFPE:
+        return "SIGFPE";
+    case SIGILL:
+        return "SIGILL";
+    case SIGABRT:
+        return "SIGABRT";
+    default:
+        return "signal";
+    }
+}
+
+void fossil_maip_show_cases(const fossil_maip_suite_t *suite, const fossil_maip_case_t *test_case, const fossil_maip_engine_t *engine)
+{
+    if (!test_case)
+        return;
+
+    // Determine mode (list, tree, graph), default to list
+    const char *mode = (engine && engine->pallet.show.mode) ? engine->pallet.show.mode : "list";
+
+    const char *result_str =
+        (test_case->state == FOSSIL_MAIP_CASE_EMPTY) ? "{cyan}empty{reset}" : (test_case->state == FOSSIL_MAIP_CASE_PASS)     ? "{green}pass{reset}"
+                                                                            : (test_case->state == FOSSIL_MAIP_CASE_FAIL)       ? "{red}fail{reset}"
+                                                                            : (test_case->state == FOSSIL_MAIP_CASE_TIMEOUT)    ? "{yellow}timeout{reset}"
+                                                                            : (test_case->state == FOSSIL_MAIP_CASE_SKIPPED)    ? "{yellow}skipped{reset}"
+                                                                            : (test_case->state == FOSSIL_MAIP_CASE_UNEXPECTED) ? "{magenta}unexpected{reset}"
+                                                                                                                                  : "{white}unknown{reset}";
+
+    // Filtering logic
+    // Apply filters only if they are set (not NULL)
+    if (engine && engine->pallet.show.test_name)
+    {
+        if (maip_io_cstr_compare(test_case->name, engine->pallet.show.test_name) != 0)
+            return;
+    }
+
+    if (engine && engine->pallet.show.name)
+    {
+        if (maip_io_cstr_compare(suite->name, engine->pallet.show.name) != 0)
+            return;
+    }
+
+    if (engine && engine->filter && engine->filter->show_tag.active)
+    {
+        if (!maip_tag_expr_eval(&engine->filter->show_tag, test_case->tag_bits))
+            return;
+    }
+
+    // Result filtering: extract plain result value for comparison
+    if (engine && engine->pallet.show.result && maip_io_cstr_compare(engine->pallet.show.result, "all") != 0)
+    {
+        const char *result_plain = NULL;
+        if (test_case->state == FOSSIL_MAIP_CASE_EMPTY)
+            result_plain = "empty";
+        else if (test_case->state == FOSSIL_MAIP_CASE_PASS)
+            result_plain = "pass";
+        else if (test_case->state == FOSSIL_MAIP_CASE_FAIL)
+            result_plain = "fail";
+        else if (test_case->state == FOSSIL_MAIP_CASE_TIMEOUT)
+            result_plain = "timeout";
+        else if (test_case->state == FOSSIL_MAIP_CASE_SKIPPED)
+            result_plain = "skipped";
+        else if (test_case->state == FOSSIL_MAIP_CASE_UNEXPECTED)
+            result_plain = "unexpected";
+
+        if (!result_plain || maip_io_cstr_compare(result_plain, engine->pallet.show.result) != 0)
+            return;
+    }
+
+    char time_str[80];
+    fossil_maip_format_case_time(test_case, time_str, sizeof(time_str));
+
+    // Output according to mode and theme
+    if (maip_io_cstr_compare(mode, "tree") == 0)
+    {
+        switch (engine ? engine->pallet.theme : MAIP_THEME_FOSSIL)
+        {
+        case MAIP_THEME_FOSSIL:
+            if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "doge") == 0)
+            {
+                maip_io_printf("  {blue}├─{reset} {cyan}%s{reset} {blue}[test case]{reset}\n", test_case->name);
+                maip_io_printf("  {blue}│   ├─{reset} {cyan}Tags    {reset}: {gray}%s{reset} {orange}[with tag]{reset}\n", test_case->tags);
+                maip_io_printf("  {blue}│   ├─{reset} {cyan}Criteria{reset}: {gray}%s{reset} {orange}[given criteria]{reset}\n", test_case->criteria);
+                maip_io_printf("  {blue}│   ├─{reset} {cyan}Time    {reset}: {gray}%s{reset} {orange}[the time]{reset}\n", time_str);
+                maip_io_printf("  {blue}│   └─{reset} {cyan}Result  {reset}: {gray}%s{reset} {orange}[the result]{reset}\n", result_str);
+            }
+            else if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "ci") == 0)
+            {
+                maip_io_printf("  {blue}::TEST       :: %s{reset}\n", test_case->name);
+                maip_io_printf("    {blue}::TAGS     :: %s{reset}\n", test_case->tags);
+                maip_io_printf("    {blue}::CRITERIA :: %s{reset}\n", test_case->criteria);
+                maip_io_printf("    {blue}::TIME     :: %s{reset}\n", time_str);
+                maip_io_printf("    {blue}::RESULT   :: %s{reset}\n", result_str);
+            }
+            else
+            { // plain or default
+                maip_io_printf("  {blue}├─{reset} {cyan}%s{reset}\n", test_case->name);
+                maip_io_printf("  {blue}│   ├─{reset} {cyan}Tags    {reset}: {gray}%s{reset}\n", test_case->tags);
+                maip_io_printf("  {blue}│   ├─{reset} {cyan}Criteria{reset}: {gray}%s{reset}\n", test_case->criteria);
+                maip_io_printf("  {blue}│   ├─{reset} {cyan}Time    {reset}: {gray}%s{reset}\n", time_str);
+                maip_io_printf("  {blue}│   └─{reset} {cyan}Result  {reset}: {gray}%s{reset}\n", result_str);
+            }
+            break;
+        case MAIP_THEME_LIGHT:
+            if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "doge") == 0)
+            {
+                maip_io_printf("  {bright_blue}├─{reset} {bright_cyan}%s{reset} {bright_blue}[test case]{reset}\n", test_case->name);
+                maip_io_printf("  {bright_blue}│   ├─{reset} {bright_cyan}Tags    {reset}: {gray}%s{reset} {orange}[with tag]{reset}\n", test_case->tags);
+                maip_io_printf("  {bright_blue}│   ├─{reset} {bright_cyan}Criteria{reset}: {gray}%s{reset} {orange}[given criteria]{reset}\n", test_case->criteria);
+                maip_io_printf("  {bright_blue}│   ├─{reset} {bright_cyan}Time    {reset}: {gray}%s{reset} {orange}[the time]{reset}\n", time_str);
+                maip_io_printf("  {bright_blue}│   └─{reset} {bright_cyan}Result  {reset}: {gray}%s{reset} {orange}[the result]{reset}\n", result_str);
+            }
+            else if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "ci") == 0)
+            {
+                maip_io_printf("  {bright_blue}::TEST       :: %s{reset}\n", test_case->name);
+                maip_io_printf("    {bright_blue}::TAGS     :: %s{reset}\n", test_case->tags);
+                maip_io_printf("    {bright_blue}::CRITERIA :: %s{reset}\n", test_case->criteria);
+                maip_io_printf("    {bright_blue}::TIME     :: %s{reset}\n", time_str);
+                maip_io_printf("    {bright_blue}::RESULT   :: %s{reset}\n", result_str);
+            }
+            else
+            { // plain or default
+                maip_io_printf("  {bright_blue}├─{reset} {bright_cyan}%s{reset}\n", test_case->name);
+                maip_io_printf("  {bright_blue}│   ├─{reset} {bright_cyan}Tags    {reset}: {gray}%s{reset}\n", test_case->tags);
+                maip_io_printf("  {bright_blue}│   ├─{reset} {bright_cyan}Criteria{reset}: {gray}%s{reset}\n", test_case->criteria);
+                maip_io_printf("  {bright_blue}│   ├─{reset} {bright_cyan}Time    {reset}: {gray}%s{reset}\n", time_str);
+                maip_io_printf("  {bright_blue}│   └─{reset} {bright_cyan}Result  {reset}: {gray}%s{reset}\n", result_str);
+            }
+            break;
+        case MAIP_THEME_DARK:
+            if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "doge") == 0)
+            {
+                maip_io_printf("  {blue}├─{reset} {cyan}%s{reset} {blue}[test case]{reset}\n", test_case->name);
+                maip_io_printf("  {blue}│   ├─{reset} {cyan}Tags    {reset}: {gray}%s{reset} {orange}[with tag]{reset}\n", test_case->tags);
+                maip_io_printf("  {blue}│   ├─{reset} {cyan}Criteria{reset}: {gray}%s{reset} {orange}[given criteria]{reset}\n", test_case->criteria);
+                maip_io_printf("  {blue}│   ├─{reset} {cyan}Time    {reset}: {gray}%s{reset} {orange}[the time]{reset}\n", time_str);
+                maip_io_printf("  {blue}│   └─{reset} {cyan}Result  {reset}: {gray}%s{reset} {orange}[the result]{reset}\n", result_str);
+            }
+            else if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "ci") == 0)
+            {
+                maip_io_printf("  {blue}::TEST       :: %s{reset}\n", test_case->name);
+                maip_io_printf("    {blue}::TAGS     :: %s{reset}\n", test_case->tags);
+                maip_io_printf("    {blue}::CRITERIA :: %s{reset}\n", test_case->criteria);
+                maip_io_printf("    {blue}::TIME     :: %s{reset}\n", time_str);
+                maip_io_printf("    {blue}::RESULT   :: %s{reset}\n", result_str);
+            }
+            else
+            { // plain or default
+                maip_io_printf("  {blue}├─{reset} {cyan}%s{reset}\n", test_case->name);
+                maip_io_printf("  {blue}│   ├─{reset} {cyan}Tags    {reset}: {gray}%s{reset}\n", test_case->tags);
+                maip_io_printf("  {blue}│   ├─{reset} {cyan}Criteria{reset}: {gray}%s{reset}\n", test_case->criteria);
+                maip_io_printf("  {blue}│   ├─{reset} {cyan}Time    {reset}: {gray}%s{reset}\n", time_str);
+                maip_io_printf("  {blue}│   └─{reset} {cyan}Result  {reset}: {gray}%s{reset}\n", result_str);
+            }
+            break;
+        case MAIP_THEME_MAGA:
+            if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "doge") == 0)
+            {
+                maip_io_printf("  {blue}├─{reset} {white}%s{reset} {red}[test case]{reset}\n", test_case->name);
+                maip_io_printf("  {blue}│   ├─{reset} {white}Tags    {reset}: {blue}%s{reset} {white}[with tag]{reset}\n", test_case->tags);
+                maip_io_printf("  {blue}│   ├─{reset} {red}Criteria{reset}: {blue}%s{reset} {red}[given criteria]{reset}\n", test_case->criteria);
+                maip_io_printf("  {blue}│   ├─{reset} {white}Time    {reset}: {blue}%s{reset} {white}[the time]{reset}\n", time_str);
+                maip_io_printf("  {blue}│   └─{reset} {red}Result  {reset}: {blue}%s{reset} {red}[the result]{reset}\n", result_str);
+            }
+            else if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "ci") == 0)
+            {
+                maip_io_printf("  {blue}::TEST       :: %s{reset}\n", test_case->name);
+                maip_io_printf("    {blue}::TAGS     :: {white}%s{reset}\n", test_case->tags);
+                maip_io_printf("    {blue}::CRITERIA :: {red}%s{reset}\n", test_case->criteria);
+                maip_io_printf("    {blue}::TIME     :: {white}%s{reset}\n", time_str);
+                maip_io_printf("    {blue}::RESULT   :: {red}%s{reset}\n", result_str);
+            }
+            else
+            { // plain or default
+                maip_io_printf("  {blue}├─{reset} {white}%s{reset}\n", test_case->name);
+                maip_io_printf("  {blue}│   ├─{reset} {white}Tags    {reset}: {blue}%s{reset}\n", test_case->tags);
+                maip_io_printf("  {blue}│   ├─{reset} {red}Criteria{reset}: {blue}%s{reset}\n", test_case->criteria);
+                maip_io_printf("  {blue}│   ├─{reset} {white}Time    {reset}: {blue}%s{reset}\n", time_str);
+                maip_io_printf("  {blue}│   └─{reset} {red}Result  {reset}: {blue}%s{reset}\n", result_str);
+            }
+            break;
+        case MAIP_THEME_MINT:
+            if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "doge") == 0)
+            {
+                maip_io_printf("  {green}├─{white}%s{reset} {green}[test case]{reset}\n", test_case->name);
+                maip_io_printf("  {green}│   ├─{white}Tags    {reset}: {green}%s{white}[with tag]{reset}\n", test_case->tags);
+                maip_io_printf("  {green}│   ├─{white}Criteria{reset}: {green}%s{white}[given criteria]{reset}\n", test_case->criteria);
+                maip_io_printf("  {green}│   ├─{white}Time    {reset}: {green}%s{white}[the time]{reset}\n", time_str);
+                maip_io_printf("  {green}│   └─{white}Result  {reset}: {green}%s{white}[the result]{reset}\n", result_str);
+            }
+            else if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "ci") == 0)
+            {
+                maip_io_printf("  {green}::{white}TEST       :: %s{reset}\n", test_case->name);
+                maip_io_printf("    {green}::{white}TAGS     :: %s{reset}\n", test_case->tags);
+                maip_io_printf("    {green}::{white}CRITERIA :: %s{reset}\n", test_case->criteria);
+                maip_io_printf("    {green}::{white}TIME     :: %s{reset}\n", time_str);
+                maip_io_printf("    {green}::{white}RESULT   :: %s{reset}\n", result_str);
+            }
+            else
+            { // plain or default
+                maip_io_printf("  {green}├─{bright_green}%s{reset}\n", test_case->name);
+                maip_io_printf("  {green}│   ├─{white}Tags    {reset}: {green}%s{white}[with tag]{reset}\n", test_case->tags);
+                maip_io_printf("  {green}│   ├─{white}Criteria{reset}: {green}%s{white}[given criteria]{reset}\n", test_case->criteria);
+                maip_io_printf("  {green}│   ├─{white}Time    {reset}: {green}%s{white}[the time]{reset}\n", time_str);
+                maip_io_printf("  {green}│   └─{white}Result  {reset}: {green}%s{white}[the result]{reset}\n", result_str);
+            }
+            break;
+        default:
+            maip_io_printf("- %s (Tags: %s, Criteria: %s, Time: %s, Result: %s)\n",
+                            test_case->name, test_case->tags, test_case->criteria, time_str, result_str);
+            break;
+        }
+    }
+    else if (maip_io_cstr_compare(mode, "graph") == 0)
+    {
+        switch (engine ? engine->pallet.theme : MAIP_THEME_FOSSIL)
+        {
+        case MAIP_THEME_FOSSIL:
+            if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "doge") == 0)
+            {
+                maip_io_printf("{gray}[{cyan}CASE{gray}] {cyan}%s{reset} {blue}[test case]{reset} --[{orange}tags:{reset}{white}%s{reset} {orange}[with tag]{reset},{orange}criteria:{reset}{white}%s{reset} {orange}[given criteria]{reset},{orange}time:{reset}{white}%s{reset} {orange}[the time]{reset},{orange}result:{reset}%s {orange}[the result]{reset}]\n",
+                                test_case->name, test_case->tags, test_case->criteria, time_str, result_str);
+            }
+            else if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "ci") == 0)
+            {
+                maip_io_printf("{gray}::{cyan}CASE{gray}:: {cyan}%s{reset} --[{orange}::TAGS::{reset}{white} %s{reset},{orange}::CRITERIA::{reset}{white} %s{reset},{orange}::TIME::{reset}{white} %s{reset},{orange}::RESULT::{reset} %s]\n",
+                                test_case->name, test_case->tags, test_case->criteria, time_str, result_str);
+            }
+            else
+            { // plain or default
+                maip_io_printf("{gray}[{cyan}CASE{gray}] {cyan}%s{reset} --[{orange}tags:{reset}{white}%s{reset},{orange}criteria:{reset}{white}%s{reset},{orange}time:{reset}{white}%s{reset},{orange}result:{reset} %s]\n",
+                                test_case->name, test_case->tags, test_case->criteria, time_str, result_str);
+            }
+            break;
+        case MAIP_THEME_LIGHT:
+            if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "doge") == 0)
+            {
+                maip_io_printf("{gray}[{cyan}CASE{gray}] {bright_cyan}%s{reset} {bright_blue}[test case]{reset} --[{orange}tags:{reset}{white}%s{reset} {orange}[with tag]{reset},{orange}criteria:{reset}{white}%s{reset} {orange}[given criteria]{reset},{orange}time:{reset}{white}%s{reset} {orange}[the time]{reset},{orange}result:{reset}%s {orange}[the result]{reset}]\n",
+                                test_case->name, test_case->tags, test_case->criteria, time_str, result_str);
+            }
+            else if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "ci") == 0)
+            {
+                maip_io_printf("{gray}::{cyan}CASE{gray}:: {bright_cyan}%s{reset} --[{orange}::TAGS::{reset}{white} %s{reset},{orange}::CRITERIA::{reset}{white} %s{reset},{orange}::TIME::{reset}{white} %s{reset},{orange}::RESULT::{reset} %s]\n",
+                                test_case->name, test_case->tags, test_case->criteria, time_str, result_str);
+            }
+            else
+            { // plain or default
+                maip_io_printf("{gray}[{cyan}CASE{gray}] {bright_cyan}%s{reset} --[{orange}tags:{reset}{white}%s{reset},{orange}criteria:{reset}{white}%s{reset},{orange}time:{reset}{white}%s{reset},{orange}result:{reset} %s]\n",
+                                test_case->name, test_case->tags, test_case->criteria, time_str, result_str);
+            }
+            break;
+        case MAIP_THEME_DARK:
+            if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "doge") == 0)
+            {
+                maip_io_printf("{gray}[{cyan}CASE{gray}] {cyan}%s{reset} {blue}[test case]{reset} --[{orange}tags:{reset}{white}%s{reset} {orange}[with tag]{reset},{orange}criteria:{reset}{white}%s{reset} {orange}[given criteria]{reset},{orange}time:{reset}{white}%s{reset} {orange}[the time]{reset},{orange}result:{reset}%s {orange}[the result]{reset}]\n",
+                                test_case->name, test_case->tags, test_case->criteria, time_str, result_str);
+            }
+            else if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "ci") == 0)
+            {
+                maip_io_printf("{gray}::{cyan}CASE{gray}:: {cyan}%s{reset} --[{orange}::TAGS::{reset}{white} %s{reset},{orange}::CRITERIA::{reset}{white} %s{reset},{orange}::TIME::{reset}{white} %s{reset},{orange}::RESULT::{reset} %s]\n",
+                                test_case->name, test_case->tags, test_case->criteria, time_str, result_str);
+            }
+            else
+            { // plain or default
+                maip_io_printf("{gray}[{cyan}CASE{gray}] {cyan}%s{reset} --[{orange}tags:{reset}{white}%s{reset},{orange}criteria:{reset}{white}%s{reset},{orange}time:{reset}{white}%s{reset},{orange}result:{reset} %s]\n",
+                                test_case->name, test_case->tags, test_case->criteria, time_str, result_str);
+            }
+            break;
+        case MAIP_THEME_MAGA:
+            if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "doge") == 0)
+            {
+                maip_io_printf("{gray}[{red}CASE{gray}] {white}%s{reset} {red}[test case]{reset} --[{red}tags:{reset}{white}%s{reset} {red}[with tag]{reset},{red}criteria:{reset}{white}%s{reset} {red}[given criteria]{reset},{red}time:{reset}{white}%s{reset} {red}[the time]{reset},{red}result:{reset}%s {red}[the result]{reset}]\n",
+                                test_case->name, test_case->tags, test_case->criteria, time_str, result_str);
+            }
+            else if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "ci") == 0)
+            {
+                maip_io_printf("{gray}::{red}CASE{gray}:: {white}%s{reset} --[{red}::TAGS::{reset}{white} %s{reset},{red}::CRITERIA::{reset}{white} %s{reset},{red}::TIME::{reset}{white} %s{reset},{red}::RESULT::{reset} %s]\n",
+                                test_case->name, test_case->tags, test_case->criteria, time_str, result_str);
+            }
+            else
+            { // plain or default
+                maip_io_printf("{gray}[{red}CASE{gray}] {white}%s{reset} --[{red}tags:{reset}{white}%s{reset},{red}criteria:{reset}{white}%s{reset},{red}time:{reset}{white}%s{reset},{red}result:{reset} %s]\n",
+                                test_case->name, test_case->tags, test_case->criteria, time_str, result_str);
+            }
+            break;
+        case MAIP_THEME_MINT:
+            if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "doge") == 0)
+            {
+                maip_io_printf("{gray}[{green}CASE{gray}] {white}%s{reset} {green}[test case]{reset} --[{green}tags:{reset}{bright_green}%s{reset} {green}[with tag]{reset},{green}criteria:{reset}{bright_green}%s{reset} {green}[given criteria]{reset},{green}time:{reset}{bright_green}%s{reset} {green}[the time]{reset},{green}result:{reset}%s {green}[the result]{reset}]\n",
+                                test_case->name, test_case->tags, test_case->criteria, time_str, result_str);
+            }
+            else if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "ci") == 0)
+            {
+                maip_io_printf("{gray}::{green}CASE{gray}:: {white}%s{reset} --[{green}::TAGS::{reset}{bright_green} %s{reset},{green}::CRITERIA::{reset}{bright_green} %s{reset},{green}::TIME::{reset}{bright_green} %s{reset},{green}::RESULT::{reset} %s]\n",
+                                test_case->name, test_case->tags, test_case->criteria, time_str, result_str);
+            }
+            else
+            { // plain or default
+                maip_io_printf("{gray}[{green}CASE{gray}] {white}%s{reset} --[{green}tags:{reset}{bright_green}%s{reset},{green}criteria:{reset}{bright_green}%s{reset},{green}time:{reset}{bright_green}%s{reset},{green}result:{reset} %s]\n",
+                                test_case->name, test_case->tags, test_case->criteria, time_str, result_str);
+            }
+            break;
+        default:
+            maip_io_printf("- %s (Tags: %s, Criteria: %s, Time: %s, Result: %s)\n",
+                            test_case->name, test_case->tags, test_case->criteria, time_str, result_str);
+            break;
+        }
+    }
+    else
+    { // list (default)
+        switch (engine ? engine->pallet.theme : MAIP_THEME_FOSSIL)
+        {
+        case MAIP_THEME_FOSSIL:
+            if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "doge") == 0)
+            {
+                maip_io_printf("{gray}[{cyan}CASE{gray}] {cyan}%s{reset} {orange}[test case]{reset} ({orange}Tags:{reset} {white}%s{reset} {orange}[with tag]{reset}, {orange}Criteria:{reset} {white}%s{reset} {orange}[given criteria]{reset}, {orange}Time:{reset} {white}%s{reset} {orange}[the time]{reset}, {orange}Result:{reset} %s {orange}[the result]{reset})\n",
+                                test_case->name, test_case->tags, test_case->criteria, time_str, result_str);
+            }
+            else if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "ci") == 0)
+            {
+                maip_io_printf("{gray}::{cyan}CASE{gray}:: {cyan}%s{reset} ( {orange}::TAGS::{reset} {white}%s{reset}, {orange}::CRITERIA::{reset} {white}%s{reset}, {orange}::TIME::{reset} {white}%s{reset}, {orange}::RESULT::{reset} %s )\n",
+                                test_case->name, test_case->tags, test_case->criteria, time_str, result_str);
+            }
+            else
+            { // plain or default
+                maip_io_printf("{gray}[{blue}CASE{gray}] {cyan}%s{reset} ({orange}Tags:{reset} {white}%s{reset}, {orange}Criteria:{reset} {white}%s{reset}, {orange}Time:{reset} {white}%s{reset}, {orange}Result:{reset} %s)\n",
+                                test_case->name, test_case->tags, test_case->criteria, time_str, result_str);
+            }
+            break;
+        case MAIP_THEME_LIGHT:
+            if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "doge") == 0)
+            {
+                maip_io_printf("{gray}[{bright_blue}CASE{gray}] {cyan}%s{reset} {orange}[test case]{reset} ({orange}Tags:{reset} {white}%s{reset} {orange}[with tag]{reset}, {orange}Criteria:{reset} {white}%s{reset} {orange}[given criteria]{reset}, {orange}Time:{reset} {white}%s{reset} {orange}[the time]{reset}, {orange}Result:{reset} %s {orange}[the result]{reset})\n",
+                                test_case->name, test_case->tags, test_case->criteria, time_str, result_str);
+            }
+            else if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "ci") == 0)
+            {
+                maip_io_printf("{gray}::{bright_blue}CASE{gray}:: {cyan}%s{reset} ( {orange}::TAGS::{reset} {white}%s{reset}, {orange}::CRITERIA::{reset} {white}%s{reset}, {orange}::TIME::{reset} {white}%s{reset}, {orange}::RESULT::{reset} %s )\n",
+                                test_case->name, test_case->tags, test_case->criteria, time_str, result_str);
+            }
+            else
+            { // plain or default
+                maip_io_printf("{gray}[{bright_blue}CASE{gray}] {cyan}%s{reset} ({orange}Tags:{reset} {white}%s{reset}, {orange}Criteria:{reset} {white}%s{reset}, {orange}Time:{reset} {white}%s{reset}, {orange}Result:{reset} %s)\n",
+                                test_case->name, test_case->tags, test_case->criteria, time_str, result_str);
+            }
+            break;
+        case MAIP_THEME_DARK:
+            if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "doge") == 0)
+            {
+                maip_io_printf("{gray}[{blue}CASE{gray}] {cyan}%s{reset} {orange}[test case]{reset} ({orange}Tags:{reset} {white}%s{reset} {orange}[with tag]{reset}, {orange}Criteria:{reset} {white}%s{reset} {orange}[given criteria]{reset}, {orange}Time:{reset} {white}%s{reset} {orange}[the time]{reset}, {orange}Result:{reset} %s {orange}[the result]{reset})\n",
+                                test_case->name, test_case->tags, test_case->criteria, time_str, result_str);
+            }
+            else if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "ci") == 0)
+            {
+                maip_io_printf("{gray}::{blue}CASE{gray}:: {cyan}%s{reset} ( {orange}::TAGS::{reset} {white}%s{reset}, {orange}::CRITERIA::{reset} {white}%s{reset}, {orange}::TIME::{reset} {white}%s{reset}, {orange}::RESULT::{reset} %s )\n",
+                                test_case->name, test_case->tags, test_case->criteria, time_str, result_str);
+            }
+            else
+            { // plain or default
+                maip_io_printf("{gray}[{blue}CASE{gray}] {cyan}%s{reset} ({orange}Tags:{reset} {white}%s{reset}, {orange}Criteria:{reset} {white}%s{reset}, {orange}Time:{reset} {white}%s{reset}, {orange}Result:{reset} %s)\n",
+                                test_case->name, test_case->tags, test_case->criteria, time_str, result_str);
+            }
+            break;
+        case MAIP_THEME_MAGA:
+            if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "doge") == 0)
+            {
+                maip_io_printf("{gray}[{red}CASE{gray}] {white}%s{reset} {red}[test case]{reset} ({red}Tags:{reset} {white}%s{reset} {red}[with tag]{reset}, {red}Criteria:{reset} {white}%s{reset} {red}[given criteria]{reset}, {red}Time:{reset} {white}%s{reset} {red}[the time]{reset}, {red}Result:{reset} %s {red}[the result]{reset})\n",
+                                test_case->name, test_case->tags, test_case->criteria, time_str, result_str);
+            }
+            else if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "ci") == 0)
+            {
+                maip_io_printf("{gray}::{red}CASE{gray}:: {white}%s{reset} ( {red}::TAGS::{reset} {white}%s{reset}, {red}::CRITERIA::{reset} {white}%s{reset}, {red}::TIME::{reset} {white}%s{reset}, {red}::RESULT::{reset} %s )\n",
+                                test_case->name, test_case->tags, test_case->criteria, time_str, result_str);
+            }
+            else
+            { // plain or default
+                maip_io_printf("{gray}[{red}CASE{gray}] {white}%s{reset} ({red}Tags:{reset} {white}%s{reset}, {red}Criteria:{reset} {white}%s{reset}, {red}Time:{reset} {white}%s{reset}, {red}Result:{reset} %s)\n",
+                                test_case->name, test_case->tags, test_case->criteria, time_str, result_str);
+            }
+            break;
+        case MAIP_THEME_MINT:
+            if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "doge") == 0)
+            {
+                maip_io_printf("{gray}[{green}CASE{gray}] {white}%s{reset} {green}[test case]{reset} ({green}Tags:{reset} {white}%s{reset} {green}[with tag]{reset}, {green}Criteria:{reset} {white}%s{reset} {green}[given criteria]{reset}, {green}Time:{reset} {white}%s{reset} {green}[the time]{reset}, {green}Result:{reset} %s {green}[the result]{reset})\n",
+                                test_case->name, test_case->tags, test_case->criteria, time_str, result_str);
+            }
+            else if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "ci") == 0)
+            {
+                maip_io_printf("{gray}::{green}CASE{gray}:: {white}%s{reset} ( {green}::TAGS::{reset} {white}%s{reset}, {green}::CRITERIA::{reset} {white}%s{reset}, {green}::TIME::{reset} {white}%s{reset}, {green}::RESULT::{reset} %s )\n",
+                                test_case->name, test_case->tags, test_case->criteria, time_str, result_str);
+            }
+            else
+            { // plain or default
+                maip_io_printf("{gray}[{green}CASE{gray}] {white}%s{reset} ({green}Tags:{reset} {white}%s{reset}, {green}Criteria:{reset} {white}%s{reset}, {green}Time:{reset} {white}%s{reset}, {green}Result:{reset} %s)\n",
+                                test_case->name, test_case->tags, test_case->criteria, time_str, result_str);
+            }
+            break;
+        default:
+            maip_io_printf("- %s (Tags: %s, Criteria: %s, Time: %s, Result: %s)\n",
+                            test_case->name, test_case->tags, test_case->criteria, time_str, result_str);
+            break;
+        }
+    }
+
+    // Crash details follow the case in every mode
+    if (test_case->state == FOSSIL_MAIP_CASE_UNEXPECTED && test_case->crash_signal)
+    {
+        maip_io_printf("  {magenta}Crashed:{reset} {white}%s{reset} (signal %d) at address {white}%p{reset}\n",
+                        fossil_maip_signal_name(test_case->crash_signal), test_case->crash_signal,
+                        (void *)test_case->crash_address);
+    }
+
+    // And the reason a case was skipped without running
+    if (test_case->state == FOSSIL_MAIP_CASE_SKIPPED && test_case->message)
+        maip_io_printf("  {yellow}Skipped:{reset} %s\n", test_case->message);
+
+    // So does the spread of its --repeat iterations
+    const fossil_maip_latency_t *latency = test_case->latency;
+    if (latency && latency->runs > 1)
+    {
+        static const double fractions[] = {0.5, 0.9, 0.99};
+        char min_str[32], max_str[32], quantile_str[3][32];
+        fossil_maip_format_ns(latency->min_ns, min_str, sizeof(min_str));
+        fossil_maip_format_ns(latency->max_ns, max_str, sizeof(max_str));
+        for (size_t q = 0; q < 3; ++q)
+            fossil_maip_format_ns(maip_latency_percentile(latency, fractions[q]), quantile_str[q], sizeof(quantile_str[q]));
+
+        maip_io_printf("  {blue}Latency:{reset} min {white}%s{reset}, p50 {white}%s{reset}, p90 {white}%s{reset}, p99 {white}%s{reset}, max {white}%s{reset}\n",
+                        min_str, quantile_str[0], quantile_str[1], quantile_str[2], max_str);
+        maip_io_printf("  {blue}Runs:{reset} {white}%u{reset} passed, {white}%u{reset} failed of %u (flaky rate {white}%.2f%%{reset})\n",
+                        latency->runs - latency->failures, latency->failures, latency->runs,
+                        maip_latency_flaky(latency) ? 100.0 * latency->failures / latency->runs : 0.0);
+    }
+}
+
+// --- Run One Test ---
+
+// Utility function to convert seconds to nanoseconds
+static uint64_t seconds_to_nanoseconds(uint64_t seconds)
+{
+    return seconds * 1000000000ULL;
+}
+
+// --- Jump Codes ---
+// Values a case lands with when it unwinds through the context jump buffer.
+enum
+{
+    MAIP_JUMP_NONE = 0,
+    MAIP_JUMP_ASSERT,
+    MAIP_JUMP_TIMEOUT,
+    MAIP_JUMP_CRASH
+};
+
+#if defined(_WIN32)
+#define maip_setjmp(buffer) setjmp(buffer)
+#define maip_setjmp_nomask(buffer) setjmp(buffer)
+#define maip_longjmp(buffer, code) longjmp(buffer, code)
+#else
+#define maip_setjmp(buffer) sigsetjmp(buffer, 1)
+// Leaves the signal mask out of the jump buffer, which saves a system call per
+// case; a caller that lands from a signal handler restores the mask itself.
+#define maip_setjmp_nomask(buffer) sigsetjmp(buffer, 0)
+#define maip_longjmp(buffer, code) siglongjmp(buffer, code)
+#endif
+
+#ifndef FOSSIL_MAIP_TIMEOUT
+#define FOSSIL_MAIP_TIMEOUT 60 // Default time budget of a case, in seconds
+#endif
+
+// --- Timeout Watchdog ---
+// One watchdog thread tracks the deadline of every runner thread and signals
+// the thread whose case overran; the handler unwinds that case through the
+// context jump buffer. There is one deadline per runner thread, so a scan of
+// the short list for the earliest is all the scheduling the watchdog needs.
+
+#if !defined(_WIN32)
+
+typedef struct maip_watch
+{
+    pthread_t thread;
+    uint64_t deadline_ns;          // Monotonic deadline, 0 when disarmed
+    volatile sig_atomic_t expired; // Set by the watchdog before it signals
+    volatile sig_atomic_t live;    // Set while the case body may be interrupted
+    bool listed;
+    struct maip_watch *next;
+} maip_watch_t;
+
+static pthread_mutex_t maip_watch_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t maip_watch_cond = PTHREAD_COND_INITIALIZER;
+static maip_watch_t *maip_watch_list = NULL;
+static bool maip_watch_running = false;
+static FOSSIL_MAIP_THREAD_LOCAL maip_watch_t maip_watch;
+
+static uint64_t maip_watch_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static void maip_watch_on_alarm(int sig)
+{
+    (void)sig;
+
+    // Stale signals (the case already finished) are dropped here.
+    if (maip_watch.live && maip_watch.expired)
+    {
+        maip_watch.live = 0;
+        maip_longjmp(maip_context.jump, MAIP_JUMP_TIMEOUT);
+    }
+}
+
+static void *maip_watchdog_main(void *arg)
+{
+    (void)arg;
+    pthread_mutex_lock(&maip_watch_mutex);
+
+    for (;;)
+    {
+        uint64_t now = maip_watch_now_ns();
+        uint64_t earliest = 0;
+
+        for (maip_watch_t *watch = maip_watch_list; watch; watch = watch->next)
+        {
+            if (watch->deadline_ns == 0)
+                continue;
+
+            if (watch->deadline_ns <= now)
+            {
+                watch->deadline_ns = 0;
+                watch->expired = 1;
+                pthread_kill(watch->thread, SIGALRM);
+            }
+            else if (earliest == 0 || watch->deadline_ns < earliest)
+            {
+                earliest = watch->deadline_ns;
+            }
+        }
+
+        if (earliest == 0)
+        {
+            pthread_cond_wait(&maip_watch_cond, &maip_watch_mutex);
+            continue;
+        }
+
+        // Condition variables wait on the realtime clock, so the monotonic delay
+        // is converted here and the deadlines are re-checked on every wakeup.
+        uint64_t delay = earliest - now;
+        struct timespec until;
+        clock_gettime(CLOCK_REALTIME, &until);
+        uint64_t nsec = (uint64_t)until.tv_nsec + delay % 1000000000ULL;
+        until.tv_sec += (time_t)(delay / 1000000000ULL + nsec / 1000000000ULL);
+        until.tv_nsec = (long)(nsec % 1000000000ULL);
+        pthread_cond_timedwait(&maip_watch_cond, &maip_watch_mutex, &until);
+    }
+
+    return NULL;
+}
+
+// Arms the calling thread's deadline, starting the watchdog on first use.
+static void maip_watch_arm(uint64_t budget_ns)
+{
+    pthread_mutex_lock(&maip_watch_mutex);
+
+    if (!maip_watch_running)
+    {
+        struct sigaction action;
+        memset(&action, 0, sizeof(action));
+        action.sa_handler = maip_watch_on_alarm;
+        sigemptyset(&action.sa_mask);
+        sigaction(SIGALRM, &action, NULL);
+
+        pthread_t watchdog;
+        if (pthread_create(&watchdog, NULL, maip_watchdog_main, NULL) == 0)
+        {
+            pthread_detach(watchdog);
+            maip_watch_running = true;
+        }
+    }
+
+    if (!maip_watch.listed)
+    {
+        maip_watch.thread = pthread_self();
+        maip_watch.next = maip_watch_list;
+        maip_watch_list = &maip_watch;
+        maip_watch.listed = true;
+    }
+
+    maip_watch.expired = 0;
+    maip_watch.deadline_ns = maip_watch_now_ns() + budget_ns;
+    maip_watch.live = 1;
+
+    pthread_cond_signal(&maip_watch_cond);
+    pthread_mutex_unlock(&maip_watch_mutex);
+}
+
+static void maip_watch_disarm(void)
+{
+    maip_watch.live = 0;
+
+    pthread_mutex_lock(&maip_watch_mutex);
+    maip_watch.deadline_ns = 0;
+    maip_watch.expired = 0;
+    pthread_mutex_unlock(&maip_watch_mutex);
+}
+
+// Keeps the watchdog from unwinding the calling thread until the next arm;
+// used while a failing assertion reports under the output lock.
+static void maip_watch_hold(void)
+{
+    maip_watch.live = 0;
+}
+
+// Lets the watchdog unwind the calling thread again under the deadline already
+// armed, without taking the mutex; stress loops re-arm only now and then.
+static void maip_watch_resume(void)
+{
+    maip_watch.live = 1;
+}
+
+// Unlinks the calling thread's deadline; runner threads call this before exiting.
+static void maip_watch_release(void)
+{
+    pthread_mutex_lock(&maip_watch_mutex);
+    for (maip_watch_t **link = &maip_watch_list; *link; link = &(*link)->next)
+    {
+        if (*link == &maip_watch)
+        {
+            *link = maip_watch.next;
+            break;
+        }
+    }
+    maip_watch.listed = false;
+    pthread_mutex_unlock(&maip_watch_mutex);
+}
+
+// Worker processes inherit the watchdog state but not its thread.
+static void maip_watch_after_fork(void)
+{
+    pthread_mutex_init(&maip_watch_mutex, NULL);
+    pthread_cond_init(&maip_watch_cond, NULL);
+    maip_watch_list = NULL;
+    maip_watch_running = false;
+    maip_watch.listed = false;
+    maip_watch.deadline_ns = 0;
+    maip_watch.live = 0;
+}
+
+#else
+
+// No watchdog here: overruns are detected once the case returns.
+#define maip_watch_arm(budget_ns) ((void)(budget_ns))
+#define maip_watch_disarm() ((void)0)
+#define maip_watch_hold() ((void)0)
+#define maip_watch_resume() ((void)0)
+
+#endif
+
+// --- Exclusive Sections ---
+// Runner threads share a gate from the moment they take a case until it is
+// reported. A case entering maip_test_exclusive gives its share up and waits
+// until no other thread holds one; threads about to take a case wait while
+// such a section is pending or running, so nothing else prints meanwhile.
+
+#if !defined(_WIN32)
+
+enum
+{
+    MAIP_GATE_OUT = 0,
+    MAIP_GATE_SHARED,
+    MAIP_GATE_ALONE
+};
+
+static pthread_mutex_t maip_gate_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t maip_gate_cond = PTHREAD_COND_INITIALIZER;
+static size_t maip_gate_shared = 0;  // Runner threads working on a case
+static size_t maip_gate_pending = 0; // Sections waiting to run alone
+static bool maip_gate_alone = false; // A section is running alone
+static FOSSIL_MAIP_THREAD_LOCAL int maip_gate_state = MAIP_GATE_OUT;
+
+// Takes a share with the gate mutex held.
+static void maip_gate_share_locked(void)
+{
+    while (maip_gate_alone || maip_gate_pending > 0)
+        pthread_cond_wait(&maip_gate_cond, &maip_gate_mutex);
+    maip_gate_shared++;
+    maip_gate_state = MAIP_GATE_SHARED;
+}
+
+// Runner threads take a share before they start on a case...
+static void maip_gate_enter(void)
+{
+    pthread_mutex_lock(&maip_gate_mutex);
+    maip_gate_share_locked();
+    pthread_mutex_unlock(&maip_gate_mutex);
+}
+
+// ...and give it back once the case is reported.
+static void maip_gate_leave(void)
+{
+    pthread_mutex_lock(&maip_gate_mutex);
+    if (maip_gate_state == MAIP_GATE_SHARED)
+        maip_gate_shared--;
+    maip_gate_state = MAIP_GATE_OUT;
+    pthread_cond_broadcast(&maip_gate_cond);
+    pthread_mutex_unlock(&maip_gate_mutex);
+}
+
+// Trades the calling runner's share for the whole gate. Returns false outside
+// runner threads and inside a section already alone, where there is nothing to
+// wait for. The watchdog is held off while the gate mutex is taken.
+static bool maip_gate_take_alone(void)
+{
+    if (maip_gate_state != MAIP_GATE_SHARED)
+        return false;
+
+    maip_watch_hold();
+    pthread_mutex_lock(&maip_gate_mutex);
+    maip_gate_shared--;
+    maip_gate_pending++;
+    pthread_cond_broadcast(&maip_gate_cond);
+    while (maip_gate_alone || maip_gate_shared > 0)
+        pthread_cond_wait(&maip_gate_cond, &maip_gate_mutex);
+    maip_gate_pending--;
+    maip_gate_alone = true;
+    maip_gate_state = MAIP_GATE_ALONE;
+    pthread_mutex_unlock(&maip_gate_mutex);
+    maip_watch_resume();
+    return true;
+}
+
+// Gives the whole gate up and takes a share again, behind any pending section.
+static void maip_gate_give_alone(void)
+{
+    maip_watch_hold();
+    pthread_mutex_lock(&maip_gate_mutex);
+    maip_gate_alone = false;
+    pthread_cond_broadcast(&maip_gate_cond);
+    maip_gate_share_locked();
+    pthread_mutex_unlock(&maip_gate_mutex);
+    maip_watch_resume();
+}
+
+#else
+
+// No runner threads here: sections always run alone.
+#define maip_gate_enter() ((void)0)
+#define maip_gate_leave() ((void)0)
+#define maip_gate_take_alone() false
+#define maip_gate_give_alone() ((void)0)
+
+#endif
+
+void maip_test_exclusive(void (*body)(void *), void (*cleanup)(void *), void *data)
+{
+    if (!body)
+        return;
+
+    fossil_maip_context_t *ctx = &maip_context;
+    bool alone = maip_gate_take_alone();
+
+    // The section lands here first when it unwinds, so that cleanup runs and
+    // the gate is given up before the unwind carries on to the case
+    fossil_maip_jump_t outer;
+    memcpy(&outer, &ctx->jump, sizeof(outer));
+    int landing = maip_setjmp(ctx->jump);
+    if (landing == MAIP_JUMP_NONE)
+        body(data);
+    memcpy(&ctx->jump, &outer, sizeof(outer));
+
+    if (cleanup)
+        cleanup(data);
+    if (alone)
+        maip_gate_give_alone();
+    if (landing != MAIP_JUMP_NONE)
+        maip_longjmp(ctx->jump, landing);
+}
+
+// --- Crash Recovery ---
+// Fault signals raised while a case body runs are caught on a per-thread
+// alternate stack and unwound through the context jump buffer, so one crashing
+// case is recorded as unexpected instead of taking the whole run down. Faults
+// outside a case body keep their default action.
+
+#if !defined(_WIN32)
+
+#define FOSSIL_MAIP_ALTSTACK_SIZE (64 * 1024)
+
+static pthread_once_t maip_crash_once = PTHREAD_ONCE_INIT;
+static FOSSIL_MAIP_THREAD_LOCAL void *maip_altstack = NULL;
+
+static void maip_crash_on_signal(int sig, siginfo_t *info, void *ucontext)
+{
+    (void)ucontext;
+    fossil_maip_context_t *ctx = &maip_context;
+
+    if (!ctx->guarded)
+    {
+        signal(sig, SIG_DFL);
+        raise(sig);
+        return;
+    }
+
+    ctx->guarded = 0;
+    ctx->fault_signal = sig;
+    ctx->fault_address = info ? info->si_addr : NULL;
+    maip_longjmp(ctx->jump, MAIP_JUMP_CRASH);
+}
+
+static void maip_crash_install(void)
+{
+    static const int signals[] = {SIGSEGV, SIGBUS, SIGFPE, SIGILL};
+
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_sigaction = maip_crash_on_signal;
+    action.sa_flags = SA_SIGINFO | SA_ONSTACK;
+    sigemptyset(&action.sa_mask);
+
+    for (size_t i = 0; i < sizeof(signals) / sizeof(signals[0]); ++i)
+        sigaction(signals[i], &action, NULL);
+}
+
+// Installs the handlers once per process and an alternate stack once per
+// thread, so stack overflows can be caught as well.
+static void maip_crash_guard(void)
+{
+    pthread_once(&maip_crash_once, maip_crash_install);
+    if (maip_altstack)
+        return;
+
+    void *memory = maip_sys_memory_alloc(FOSSIL_MAIP_ALTSTACK_SIZE);
+    if (!memory)
+        return;
+
+    stack_t stack;
+    stack.ss_sp = memory;
+    stack.ss_size = FOSSIL_MAIP_ALTSTACK_SIZE;
+    stack.ss_flags = 0;
+    if (sigaltstack(&stack, NULL) != 0)
+    {
+        maip_sys_memory_free(memory);
+        return;
+    }
+    maip_altstack = memory;
+}
+
+// Drops the calling thread's alternate stack; runner threads call this before exiting.
+static void maip_crash_release(void)
+{
+    if (!maip_altstack)
+        return;
+
+    stack_t stack;
+    memset(&stack, 0, sizeof(stack));
+    stack.ss_flags = SS_DISABLE;
+    sigaltstack(&stack, NULL);
+
+    maip_sys_memory_free(maip_altstack);
+    maip_altstack = NULL;
+}
+
+#else
+
+#define maip_crash_guard() ((void)0)
+
+#endif
+
+// Resolves the time budget of a case: --timeout name rules first, then the
+// case and suite settings, then the run-wide --timeout and timeout= values.
+static uint64_t fossil_maip_case_budget(const fossil_maip_engine_t *engine,
+                                        const fossil_maip_suite_t *suite,
+                                        const fossil_maip_case_t *test_case)
+{
+    const fossil_maip_timeout_rule_t *rules = engine->pallet.run.timeout_rules;
+    size_t rule_count = engine->pallet.run.timeout_rule_count;
+
+    for (size_t i = 0; i < rule_count; ++i)
+    {
+        if (maip_io_cstr_compare(rules[i].name, test_case->name) == 0)
+            return rules[i].timeout_ns;
+    }
+    for (size_t i = 0; suite && i < rule_count; ++i)
+    {
+        if (maip_io_cstr_compare(rules[i].name, suite->name) == 0)
+            return rules[i].timeout_ns;
+    }
+
+    if (test_case->timeout_ns)
+        return test_case->timeout_ns;
+    if (suite && suite->timeout_ns)
+        return suite->timeout_ns;
+    if (engine->pallet.run.timeout_ns)
+        return engine->pallet.run.timeout_ns;
+    if (engine->pallet.timeout_ns)
+        return engine->pallet.timeout_ns;
+
+    return seconds_to_nanoseconds(FOSSIL_MAIP_TIMEOUT);
+}
+
+// from sanity, should be implemented and placed in common.c
+extern uint64_t get_maip_time_microseconds(void);
+
+// Applies the run --skip list to a case (--only is part of the selection).
+// Returns true when the case should be executed; skipped cases are scored here.
+static bool fossil_maip_run_gate(const fossil_maip_engine_t *engine,
+                                 fossil_maip_case_t *test_case,
+                                 fossil_maip_suite_t *suite)
+{
+    // --- Filter: --skip ---
+    if (engine->filter && engine->filter->skip.active &&
+        maip_matcher_test_name(&engine->filter->skip, test_case->name))
+    {
+        test_case->state = FOSSIL_MAIP_CASE_SKIPPED;
+        fossil_maip_update_score(test_case, suite);
+        return false;
+    }
+
+    return true;
+}
+
+// Keeps the failure message of the last run on the case (NULL once it passes).
+static void fossil_maip_case_text(char **slot, const char *text)
+{
+    if (*slot)
+    {
+        maip_sys_memory_free(*slot);
+        *slot = NULL;
+    }
+    if (text && text[0] != '\0')
+        *slot = maip_io_cstr_dup(text);
+}
+
+// Records the failure message and assertion site of the last run (NULL clears).
+static void fossil_maip_case_note(fossil_maip_case_t *test_case, const char *message, const char *site)
+{
+    fossil_maip_case_text(&test_case->message, message);
+    fossil_maip_case_text(&test_case->site, site);
+    test_case->cause = FOSSIL_MAIP_CAUSE_UNKNOWN;
+    test_case->op = FOSSIL_MAIP_OP_NONE;
+}
+
+// Records how the failing assertion classified itself, after the note.
+static void fossil_maip_case_classify(fossil_maip_case_t *test_case, int cause, int op)
+{
+    test_case->cause = cause;
+    test_case->op = op;
+}
+
+// --- Async Cases (FOSSIL_TEST_ASYNC) ---
+// Async cases are stepped from one event loop: a step runs the body up to its
+// next wait, under the case's own jump buffer landing, watchdog deadline and
+// assertion count, so failures, crashes and timeouts land on the case that
+// raised them. A case's time budget covers its waits as well.
+
+typedef struct
+{
+    fossil_maip_async_t async;
+    fossil_maip_case_t *test_case;
+    uint64_t start_ns;
+    uint64_t deadline_ns; // Start plus the case's time budget
+    uint64_t cpu_ns;      // Thread CPU time of all steps
+    int assert_count;     // Carried from one step to the next
+    int watch_fd;         // Duplicate of async.fd held by the poller (-1 = none)
+    bool waiting;
+    bool done;
+    bool expected;           // An expectation failed in an earlier step
+    const char *expect_file; // Site and classification of the first one
+    int expect_line;
+    int expect_cause;
+    int expect_op;
+    char expect_message[FOSSIL_MAIP_MESSAGE_SIZE];
+} maip_async_task_t;
+
+void fossil_maip_async_wait(fossil_maip_async_t *async, int fd, unsigned events, uint64_t timeout_ms)
+{
+    if (!async)
+        return;
+
+    async->fd = fd;
+    async->events = fd >= 0 ? events : 0;
+    async->ready = 0;
+    async->wake_ns = (timeout_ms || fd < 0) ? fossil_maip_now_ns() + timeout_ms * 1000000ULL : 0;
+}
+
+#if defined(__linux__)
+
+// epoll keys registrations on the descriptor, so every parked case registers
+// its own duplicate: two cases may then wait on the same descriptor.
+typedef struct
+{
+    int epoll_fd;
+    struct epoll_event *events;
+    size_t capacity;
+} maip_async_poller_t;
+
+static int maip_async_poller_open(maip_async_poller_t *poller, size_t count)
+{
+    poller->capacity = count;
+    poller->events = maip_sys_memory_alloc(count * sizeof(*poller->events));
+    poller->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (!poller->events || poller->epoll_fd < 0)
+    {
+        maip_sys_memory_free(poller->events);
+        if (poller->epoll_fd >= 0)
+            close(poller->epoll_fd);
+        return FOSSIL_MAIP_FAILURE;
+    }
+    return FOSSIL_MAIP_SUCCESS;
+}
+
+static void maip_async_poller_close(maip_async_poller_t *poller)
+{
+    close(poller->epoll_fd);
+    maip_sys_memory_free(poller->events);
+}
+
+static void maip_async_park(maip_async_poller_t *poller, maip_async_task_t *task, size_t index)
+{
+    task->waiting = true;
+    if (task->async.fd < 0)
+        return;
+
+    struct epoll_event event;
+    memset(&event, 0, sizeof(event));
+    event.events = ((task->async.events & FOSSIL_MAIP_ASYNC_READ) ? EPOLLIN : 0) |
+                   ((task->async.events & FOSSIL_MAIP_ASYNC_WRITE) ? EPOLLOUT : 0);
+    event.data.u64 = index;
+
+    task->watch_fd = dup(task->async.fd);
+    if (task->watch_fd < 0 || epoll_ctl(poller->epoll_fd, EPOLL_CTL_ADD, task->watch_fd, &event) != 0)
+    {
+        // Not pollable (a regular file, say): it is as ready as it will get
+        if (task->watch_fd >= 0)
+            close(task->watch_fd);
+        task->watch_fd = -1;
+        task->async.ready = task->async.events;
+        task->waiting = false;
+    }
+}
+
+static void maip_async_unpark(maip_async_poller_t *poller, maip_async_task_t *task)
+{
+    if (task->watch_fd >= 0)
+    {
+        epoll_ctl(poller->epoll_fd, EPOLL_CTL_DEL, task->watch_fd, NULL);
+        close(task->watch_fd);
+        task->watch_fd = -1;
+    }
+    task->waiting = false;
+}
+
+static void maip_async_poll(maip_async_poller_t *poller, maip_async_task_t *tasks, size_t count, int timeout_ms)
+{
+    (void)count;
+    int got = epoll_wait(poller->epoll_fd, poller->events, (int)poller->capacity, timeout_ms);
+    for (int i = 0; i < got; ++i)
+    {
+        maip_async_task_t *task = &tasks[poller->events[i].data.u64];
+        uint32_t events = poller->events[i].events;
+
+        // Errors and hangups wake the case for whatever it asked; the body
+        // finds out from its next read or write.
+        unsigned ready = 0;
+        if (events & (EPOLLIN | EPOLLHUP | EPOLLERR))
+            ready |= FOSSIL_MAIP_ASYNC_READ;
+        if (events & (EPOLLOUT | EPOLLHUP | EPOLLERR))
+            ready |= FOSSIL_MAIP_ASYNC_WRITE;
+        task->async.ready = ready & task->async.events;
+        maip_async_unpark(poller, task);
+    }
+}
+
+#elif !defined(_WIN32)
+
+// poll(2) fallback: the descriptors of the parked cases are gathered each turn.
+typedef struct
+{
+    struct pollfd *fds;
+    size_t *owners;
+} maip_async_poller_t;
+
+static int maip_async_poller_open(maip_async_poller_t *poller, size_t count)
+{
+    poller->fds = maip_sys_memory_alloc(count * sizeof(*poller->fds));
+    poller->owners = maip_sys_memory_alloc(count * sizeof(*poller->owners));
+    if (!poller->fds || !poller->owners)
+    {
+        maip_sys_memory_free(poller->fds);
+        maip_sys_memory_free(poller->owners);
+        return FOSSIL_MAIP_FAILURE;
+    }
+    return FOSSIL_MAIP_SUCCESS;
+}
+
+static void maip_async_poller_close(maip_async_poller_t *poller)
+{
+    maip_sys_memory_free(poller->fds);
+    maip_sys_memory_free(poller->owners);
+}
+
+static void maip_async_park(maip_async_poller_t *poller, maip_async_task_t *task, size_t index)
+{
+    (void)poller;
+    (void)index;
+    task->waiting = true;
+}
+
+static void maip_async_unpark(maip_async_poller_t *poller, maip_async_task_t *task)
+{
+    (void)poller;
+    task->waiting = false;
+}
+
+static void maip_async_poll(maip_async_poller_t *poller, maip_async_task_t *tasks, size_t count, int timeout_ms)
+{
+    nfds_t used = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (tasks[i].done || !tasks[i].waiting || tasks[i].async.fd < 0)
+            continue;
+        poller->fds[used].fd = tasks[i].async.fd;
+        poller->fds[used].events = (short)(((tasks[i].async.events & FOSSIL_MAIP_ASYNC_READ) ? POLLIN : 0) |
+                                           ((tasks[i].async.events & FOSSIL_MAIP_ASYNC_WRITE) ? POLLOUT : 0));
+        poller->fds[used].revents = 0;
+        poller->owners[used] = i;
+        used++;
+    }
+
+    if (poll(poller->fds, used, timeout_ms) <= 0)
+        return;
+
+    for (nfds_t k = 0; k < used; ++k)
+    {
+        short events = poller->fds[k].revents;
+        if (!events)
+            continue;
+
+        maip_async_task_t *task = &tasks[poller->owners[k]];
+        unsigned ready = 0;
+        if (events & (POLLIN | POLLHUP | POLLERR))
+            ready |= FOSSIL_MAIP_ASYNC_READ;
+        if (events & (POLLOUT | POLLHUP | POLLERR))
+            ready |= FOSSIL_MAIP_ASYNC_WRITE;
+        task->async.ready = ready & task->async.events;
+        task->waiting = false;
+    }
+}
+
+#else
+
+// No descriptor polling here: fd waits are reported ready at once, and only
+// timers actually wait.
+typedef struct
+{
+    int unused;
+} maip_async_poller_t;
+
+static int maip_async_poller_open(maip_async_poller_t *poller, size_t count)
+{
+    (void)poller;
+    (void)count;
+    return FOSSIL_MAIP_SUCCESS;
+}
+
+static void maip_async_poller_close(maip_async_poller_t *poller)
+{
+    (void)poller;
+}
+
+static void maip_async_park(maip_async_poller_t *poller, maip_async_task_t *task, size_t index)
+{
+    (void)poller;
+    (void)index;
+    task->waiting = task->async.fd < 0;
+    if (!task->waiting)
+        task->async.ready = task->async.events;
+}
+
+static void maip_async_unpark(maip_async_poller_t *poller, maip_async_task_t *task)
+{
+    (void)poller;
+    task->waiting = false;
+}
+
+static void maip_async_poll(maip_async_poller_t *poller, maip_async_task_t *tasks, size_t count, int timeout_ms)
+{
+    (void)poller;
+    (void)tasks;
+    (void)count;
+    if (timeout_ms > 0)
+        Sleep((DWORD)timeout_ms);
+}
+
+#endif
+
+static void maip_async_finish(maip_async_task_t *task, fossil_maip_state_t state, const char *message, const char *site)
+{
+    fossil_maip_case_t *test_case = task->test_case;
+    test_case->state = state;
+    test_case->elapsed_ns = maip_time_interval_ns(task->start_ns, fossil_maip_now_ns());
+    test_case->cpu_ns = task->cpu_ns;
+    test_case->assert_count = task->assert_count;
+    fossil_maip_case_note(test_case, message, site);
+    task->done = true;
+}
+
+// Runs the body of a case up to its next wait. Returns false once the case has
+// finished, one way or another.
+static bool maip_async_step(maip_async_task_t *task)
+{
+    fossil_maip_context_t *ctx = &maip_context;
+    fossil_maip_case_t *test_case = task->test_case;
+
+    uint64_t now = fossil_maip_now_ns();
+    if (now >= task->deadline_ns)
+    {
+        maip_async_finish(task, FOSSIL_MAIP_CASE_TIMEOUT, NULL, NULL);
+        return false;
+    }
+
+    ctx->current_case = test_case;
+    ctx->assert_count = task->assert_count;
+    ctx->message[0] = '\0';
+    ctx->fail_file = NULL;
+    ctx->fail_line = 0;
+    ctx->expect_count = 0;
+    uint64_t start_cpu = maip_time_thread_cpu_ns();
+
+    int result = FOSSIL_MAIP_ASYNC_DONE;
+    int landing = maip_setjmp(ctx->jump);
+    if (landing == MAIP_JUMP_NONE)
+    {
+        ctx->guarded = 1;
+        maip_watch_arm(task->deadline_ns - now);
+        result = test_case->async(&task->async);
+        maip_watch_disarm();
+        ctx->guarded = 0;
+    }
+    else
+    {
+        maip_watch_disarm();
+        ctx->guarded = 0;
+    }
+
+    task->cpu_ns += maip_time_thread_cpu_ns() - start_cpu;
+    task->assert_count = ctx->assert_count;
+
+    // Steps of other cases reuse the context, so expectations that failed in
+    // this one are reported now and the first is kept on the task
+    if (maip_test_expect_report() && !task->expected)
+    {
+        task->expected = true;
+        task->expect_file = ctx->fail_file;
+        task->expect_line = ctx->fail_line;
+        task->expect_cause = ctx->fail_cause;
+        task->expect_op = ctx->fail_op;
+        memcpy(task->expect_message, ctx->message, sizeof(task->expect_message));
+    }
+    else if (task->expected && landing == MAIP_JUMP_NONE)
+    {
+        // Callers read the outcome from the context, which later steps reset
+        ctx->fail_file = task->expect_file;
+        ctx->fail_line = task->expect_line;
+        ctx->fail_cause = task->expect_cause;
+        ctx->fail_op = task->expect_op;
+        memcpy(ctx->message, task->expect_message, sizeof(ctx->message));
+    }
+
+    if (landing == MAIP_JUMP_CRASH)
+    {
+        test_case->crash_signal = ctx->fault_signal;
+        test_case->crash_address = (uintptr_t)ctx->fault_address;
+        maip_async_finish(task, FOSSIL_MAIP_CASE_UNEXPECTED, NULL, NULL);
+    }
+    else if (landing == MAIP_JUMP_TIMEOUT)
+    {
+        maip_async_finish(task, FOSSIL_MAIP_CASE_TIMEOUT, NULL, NULL);
+    }
+    else if (landing != MAIP_JUMP_NONE)
+    {
+        char site[FOSSIL_MAIP_MESSAGE_SIZE] = "";
+        if (ctx->fail_file)
+            snprintf(site, sizeof(site), "%s:%d", ctx->fail_file, ctx->fail_line);
+        maip_async_finish(task, FOSSIL_MAIP_CASE_FAIL, ctx->message, site);
+        fossil_maip_case_classify(test_case, ctx->fail_cause, ctx->fail_op);
+    }
+    else if (result == FOSSIL_MAIP_ASYNC_DONE && task->expected)
+    {
+        char site[FOSSIL_MAIP_MESSAGE_SIZE] = "";
+        snprintf(site, sizeof(site), "%s:%d", ctx->fail_file, ctx->fail_line);
+        maip_async_finish(task, FOSSIL_MAIP_CASE_FAIL, ctx->message, site);
+        fossil_maip_case_classify(test_case, ctx->fail_cause, ctx->fail_op);
+    }
+    else if (result == FOSSIL_MAIP_ASYNC_DONE)
+    {
+        maip_async_finish(task, task->assert_count ? FOSSIL_MAIP_CASE_PASS : FOSSIL_MAIP_CASE_EMPTY, NULL, NULL);
+    }
+
+    ctx->current_case = NULL;
+    return !task->done;
+}
+
+// Drives async cases to completion together on the calling thread, recording
+// the outcome of each on the case. Case setup and teardown are left to the
+// caller.
+static void fossil_maip_async_run(const fossil_maip_engine_t *engine,
+                                  const fossil_maip_suite_t *suite,
+                                  fossil_maip_case_t **cases, size_t count)
+{
+    if (count == 0)
+        return;
+
+    maip_async_poller_t poller;
+    maip_async_task_t *tasks = maip_sys_memory_calloc(count, sizeof(*tasks));
+    if (!tasks || maip_async_poller_open(&poller, count) != FOSSIL_MAIP_SUCCESS)
+    {
+        maip_sys_memory_free(tasks);
+        for (size_t i = 0; i < count; ++i)
+        {
+            cases[i]->state = FOSSIL_MAIP_CASE_UNEXPECTED;
+            fossil_maip_case_note(cases[i], "Could not start the async event loop", NULL);
+        }
+        return;
+    }
+
+    maip_crash_guard();
+    for (size_t i = 0; i < count; ++i)
+    {
+        maip_async_task_t *task = &tasks[i];
+        task->test_case = cases[i];
+        task->async.fd = -1;
+        task->watch_fd = -1;
+        task->start_ns = fossil_maip_now_ns();
+        task->deadline_ns = task->start_ns + fossil_maip_case_budget(engine, suite, cases[i]);
+        cases[i]->crash_signal = 0;
+        cases[i]->crash_address = 0;
+    }
+
+    size_t live = count;
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (maip_async_step(&tasks[i]))
+            maip_async_park(&poller, &tasks[i], i);
+        else
+            live--;
+    }
+
+    while (live > 0)
+    {
+        // Sleep until the nearest timer or case deadline, or a descriptor
+        uint64_t now = fossil_maip_now_ns();
+        uint64_t earliest = UINT64_MAX;
+        for (size_t i = 0; i < count; ++i)
+        {
+            const maip_async_task_t *task = &tasks[i];
+            if (task->done)
+                continue;
+            if (!task->waiting)
+            {
+                earliest = now;
+                break;
+            }
+            if (task->deadline_ns < earliest)
+                earliest = task->deadline_ns;
+            if (task->async.wake_ns && task->async.wake_ns < earliest)
+                earliest = task->async.wake_ns;
+        }
+
+        uint64_t delay_ms = earliest > now ? (earliest - now + 999999ULL) / 1000000ULL : 0;
+        maip_async_poll(&poller, tasks, count, delay_ms > INT_MAX ? INT_MAX : (int)delay_ms);
+
+        now = fossil_maip_now_ns();
+        for (size_t i = 0; i < count; ++i)
+        {
+            maip_async_task_t *task = &tasks[i];
+            if (task->done)
+                continue;
+
+            if (task->waiting)
+            {
+                if (now < task->deadline_ns && (!task->async.wake_ns || now < task->async.wake_ns))
+                    continue;
+                maip_async_unpark(&poller, task);
+                task->async.ready = 0;
+            }
+
+            if (maip_async_step(task))
+                maip_async_park(&poller, task, i);
+            else
+                live--;
+        }
+    }
+
+    maip_async_poller_close(&poller);
+    maip_sys_memory_free(tasks);
+}
+
+// Executes a case (every --repeat iteration) and records its state and timing.
+// Scoring and output are left to the caller so the same path serves both the
+// in-process runner and the worker processes of --jobs.
+static void fossil_maip_execute_case(const fossil_maip_engine_t *engine,
+                                     const fossil_maip_suite_t *suite,
+                                     fossil_maip_case_t *test_case)
+{
+    fossil_maip_context_t *ctx = &maip_context;
+    ctx->current_case = test_case;
+
+    size_t repeat_count =
+        (size_t)(engine->pallet.run.repeat > 0 ? engine->pallet.run.repeat : 1);
+    uint64_t budget_ns = fossil_maip_case_budget(engine, suite, test_case);
+    maip_crash_guard();
+
+    // Repeated cases keep every iteration in a histogram allocated once per case
+    fossil_maip_latency_t *latency = NULL;
+    if (repeat_count > 1)
+    {
+        if (!test_case->latency)
+            test_case->latency = maip_sys_memory_alloc(sizeof(*test_case->latency));
+        latency = test_case->latency;
+        if (latency)
+            maip_sys_memory_set(latency, 0, sizeof(*latency));
+    }
+
+    // The first iteration that fails decides the outcome of a repeated case
+    bool broken = false;
+    fossil_maip_state_t broken_state = FOSSIL_MAIP_CASE_EMPTY;
+    int broken_signal = 0;
+    uintptr_t broken_address = 0;
+
+    for (size_t i = 0; i < repeat_count; ++i)
+    {
+        if (test_case->setup)
+            test_case->setup();
+
+        test_case->state = FOSSIL_MAIP_CASE_EMPTY;
+        test_case->crash_signal = 0;
+        test_case->crash_address = 0;
+        ctx->assert_count = 0; // Reset before running test
+        ctx->message[0] = '\0';
+        ctx->fail_file = NULL;
+        ctx->fail_line = 0;
+        ctx->expect_count = 0;
+        uint64_t start_cpu = maip_time_thread_cpu_ns();
+        uint64_t start_time = fossil_maip_now_ns();
+
+        if (test_case->run)
+        {
+            int landing = maip_setjmp(ctx->jump);
+            if (landing == MAIP_JUMP_NONE)
+            {
+                ctx->guarded = 1;
+                maip_watch_arm(budget_ns);
+                test_case->run();
+                maip_watch_disarm();
+                ctx->guarded = 0;
+
+                uint64_t end_time = fossil_maip_now_ns();
+                uint64_t elapsed = maip_time_interval_ns(start_time, end_time);
+                test_case->elapsed_ns = elapsed;
+                test_case->cpu_ns = maip_time_thread_cpu_ns() - start_cpu;
+                bool expected = maip_test_expect_report();
+
+                if (elapsed > budget_ns)
+                {
+                    test_case->state = FOSSIL_MAIP_CASE_TIMEOUT;
+                }
+                else if (expected)
+                {
+                    test_case->state = FOSSIL_MAIP_CASE_FAIL;
+                }
+                else if (ctx->assert_count == 0)
+                {
+                    test_case->state = FOSSIL_MAIP_CASE_EMPTY;
+                }
+                else
+                {
+                    test_case->state = FOSSIL_MAIP_CASE_PASS;
+                }
+            }
+            else
+            {
+                maip_watch_disarm();
+                ctx->guarded = 0;
+                test_case->elapsed_ns = maip_time_interval_ns(start_time, fossil_maip_now_ns());
+                test_case->cpu_ns = maip_time_thread_cpu_ns() - start_cpu;
+                maip_test_expect_report();
+
+                if (landing == MAIP_JUMP_CRASH)
+                {
+                    test_case->state = FOSSIL_MAIP_CASE_UNEXPECTED;
+                    test_case->crash_signal = ctx->fault_signal;
+                    test_case->crash_address = (uintptr_t)ctx->fault_address;
+                }
+                else if (landing == MAIP_JUMP_TIMEOUT)
+                {
+                    test_case->state = FOSSIL_MAIP_CASE_TIMEOUT;
+                }
+                else
+                {
+                    test_case->state = FOSSIL_MAIP_CASE_FAIL;
+                }
+            }
+        }
+        else if (test_case->async)
+        {
+            fossil_maip_async_run(engine, suite, &test_case, 1);
+        }
+        else
+        {
+            test_case->state = FOSSIL_MAIP_CASE_EMPTY;
+            test_case->elapsed_ns = 0;
+            test_case->cpu_ns = 0;
+        }
+
+        test_case->assert_count = ctx->assert_count;
+        bool failed = test_case->state == FOSSIL_MAIP_CASE_FAIL;
+        bool broke = failed || test_case->state == FOSSIL_MAIP_CASE_TIMEOUT ||
+                     test_case->state == FOSSIL_MAIP_CASE_UNEXPECTED;
+        if (latency)
+            maip_latency_record(latency, test_case->elapsed_ns, broke);
+
+        if (!broken)
+        {
+            char site[FOSSIL_MAIP_MESSAGE_SIZE] = "";
+            if (failed && ctx->fail_file)
+                snprintf(site, sizeof(site), "%s:%d", ctx->fail_file, ctx->fail_line);
+            fossil_maip_case_note(test_case, failed ? ctx->message : NULL, site);
+            if (failed)
+                fossil_maip_case_classify(test_case, ctx->fail_cause, ctx->fail_op);
+
+            if (broke)
+            {
+                broken = true;
+                broken_state = test_case->state;
+                broken_signal = test_case->crash_signal;
+                broken_address = test_case->crash_address;
+            }
+        }
+
+        if (engine->pallet.run.fail_fast && test_case->state == FOSSIL_MAIP_CASE_FAIL)
+            break;
+
+        if (test_case->teardown)
+            test_case->teardown();
+    }
+
+    if (broken)
+    {
+        test_case->state = broken_state;
+        test_case->crash_signal = broken_signal;
+        test_case->crash_address = broken_address;
+    }
+    if (latency && latency->runs > 1)
+        test_case->elapsed_ns = maip_latency_percentile(latency, 0.5);
+
+    ctx->current_case = NULL;
+}
+
+void fossil_maip_run_test(const fossil_maip_engine_t *engine,
+                           fossil_maip_case_t *test_case,
+                           fossil_maip_suite_t *suite)
+{
+    if (!test_case || !suite || !engine)
+        return;
+
+    if (!fossil_maip_run_gate(engine, test_case, suite))
+        return;
+
+    fossil_maip_execute_case(engine, suite, test_case);
+
+    fossil_maip_update_score(test_case, suite);
+    fossil_maip_show_cases(suite, test_case, engine);
+}
+
+// Runs the selected async cases of a suite together on one event loop, then
+// scores and shows them. Under --repeat they are left to fossil_maip_run_test
+// one at a time, so that every iteration lands in the case's histogram.
+static bool fossil_maip_run_async_cases(const fossil_maip_engine_t *engine,
+                                        fossil_maip_suite_t *suite,
+                                        fossil_maip_case_t **cases, size_t count)
+{
+    if (engine->pallet.run.repeat > 1)
+        return false;
+
+    size_t async_count = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (cases[i]->async)
+            async_count++;
+    }
+    if (async_count == 0)
+        return true;
+
+    fossil_maip_case_t **batch = maip_sys_memory_alloc(async_count * sizeof(*batch));
+    if (!batch)
+        return false;
+
+    size_t used = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (cases[i]->async && fossil_maip_run_gate(engine, cases[i], suite))
+            batch[used++] = cases[i];
+    }
+
+    for (size_t i = 0; i < used; ++i)
+    {
+        if (batch[i]->setup)
+            batch[i]->setup();
+    }
+    fossil_maip_async_run(engine, suite, batch, used);
+    for (size_t i = 0; i < used; ++i)
+    {
+        if (batch[i]->teardown)
+            batch[i]->teardown();
+        fossil_maip_update_score(batch[i], suite);
+        fossil_maip_show_cases(suite, batch[i], engine);
+    }
+
+    maip_sys_memory_free(batch);
+    return true;
+}
+
+// --- Algorithmic modifications ---
+
+// --- Sorting Test Cases ---
+// sort --by <key> --order <asc|desc> --then-by <key[:asc|:desc],...>
+// Each key is extracted once per case into a flat uint64_t, mapped so that
+// unsigned order is the wanted order. The cases are then ordered by a stable
+// LSD radix sort, last key first, one byte per pass; bytes every case shares
+// are skipped. As every pass is stable, the --then-by keys only break ties
+// of the keys before them.
+typedef enum
+{
+    MAIP_SORT_NAME,
+    MAIP_SORT_RESULT,
+    MAIP_SORT_TIME,     // Expected duration from the history, as nothing ran yet
+    MAIP_SORT_PRIORITY,
+    MAIP_SORT_HASH      // Hash of the name: stable, but unrelated to the name order
+} maip_sort_key_t;
+
+#define FOSSIL_MAIP_SORT_KEYS 8
+
+typedef struct
+{
+    maip_sort_key_t key;
+    bool descending;
+} maip_sort_spec_t;
+
+typedef struct
+{
+    uint64_t key;
+    uint32_t index; // Position in suite->cases
+} maip_sort_item_t;
+
+static bool maip_sort_key_parse(const char *text, size_t length, maip_sort_key_t *key)
+{
+    static const struct
+    {
+        const char *name;
+        maip_sort_key_t key;
+    } keys[] = {
+        {"name", MAIP_SORT_NAME},
+        {"result", MAIP_SORT_RESULT},
+        {"time", MAIP_SORT_TIME},
+        {"priority", MAIP_SORT_PRIORITY},
+        {"hash", MAIP_SORT_HASH},
+    };
+
+    for (size_t i = 0; i < sizeof(keys) / sizeof(keys[0]); ++i)
+    {
+        if (strlen(keys[i].name) == length && strncmp(keys[i].name, text, length) == 0)
+        {
+            *key = keys[i].key;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Collects --by and the --then-by list, which the sort parser validated.
+static size_t maip_sort_specs(const fossil_maip_pallet_t *pallet, maip_sort_spec_t *specs)
+{
+    size_t count = 0;
+    if (!pallet->sort.by || !maip_sort_key_parse(pallet->sort.by, strlen(pallet->sort.by), &specs[0].key))
+        return 0;
+    specs[count++].descending = maip_io_cstr_compare(pallet->sort.order, "desc") == 0;
+
+    const char *item = pallet->sort.then_by;
+    while (item && *item && count < FOSSIL_MAIP_SORT_KEYS)
+    {
+        size_t length = strcspn(item, ",");
+        size_t name_length = strcspn(item, ":,");
+        if (maip_sort_key_parse(item, name_length, &specs[count].key))
+        {
+            specs[count].descending = name_length < length && strncmp(item + name_length, ":desc", length - name_length) == 0;
+            count++;
+        }
+        item += length + (item[length] == ',');
+    }
+    return count;
+}
+
+static int maip_sort_name_compare(const void *a, const void *b)
+{
+    const fossil_maip_case_t *case_a = *(const fossil_maip_case_t *const *)a;
+    const fossil_maip_case_t *case_b = *(const fossil_maip_case_t *const *)b;
+    int order = strcmp(case_a->name ? case_a->name : "", case_b->name ? case_b->name : "");
+    if (order != 0)
+        return order;
+    return (case_a > case_b) - (case_a < case_b);
+}
+
+// Names are not fixed width, so they are replaced by their rank (equal names
+// share one) through a single comparison sort.
+static uint64_t *maip_sort_name_ranks(const fossil_maip_suite_t *suite)
+{
+    uint64_t *ranks = maip_sys_memory_alloc(suite->count * sizeof(*ranks));
+    const fossil_maip_case_t **by_name = maip_sys_memory_alloc(suite->count * sizeof(*by_name));
+    if (!ranks || !by_name)
+    {
+        maip_sys_memory_free(ranks);
+        maip_sys_memory_free((void *)by_name);
+        return NULL;
+    }
+
+    for (size_t i = 0; i < suite->count; ++i)
+        by_name[i] = &suite->cases[i];
+    qsort(by_name, suite->count, sizeof(*by_name), maip_sort_name_compare);
+
+    uint64_t rank = 0;
+    for (size_t i = 0; i < suite->count; ++i)
+    {
+        if (i > 0 && strcmp(by_name[i - 1]->name ? by_name[i - 1]->name : "", by_name[i]->name ? by_name[i]->name : "") != 0)
+            rank++;
+        ranks[by_name[i] - suite->cases] = rank;
+    }
+    maip_sys_memory_free((void *)by_name);
+    return ranks;
+}
+
+static uint64_t maip_sort_key_value(const fossil_maip_case_t *test_case, size_t index, maip_sort_spec_t spec,
+                                    const uint64_t *name_ranks)
+{
+    uint64_t key = 0;
+    switch (spec.key)
+    {
+    case MAIP_SORT_NAME:
+        key = name_ranks[index];
+        break;
+    case MAIP_SORT_RESULT:
+        key = (uint64_t)test_case->state;
+        break;
+    case MAIP_SORT_TIME:
+        key = test_case->expected_ns;
+        break;
+    case MAIP_SORT_PRIORITY:
+        key = (uint64_t)test_case->priority ^ (1ULL << 63); // Signed to unsigned order
+        break;
+    case MAIP_SORT_HASH:
+        key = test_case->name ? maip_span_hash(test_case->name, strlen(test_case->name)) : 0;
+        break;
+    }
+    return spec.descending ? ~key : key;
+}
+
+// Stable LSD radix sort on the 64-bit keys. Returns whichever of the two
+// buffers holds the result.
+static maip_sort_item_t *maip_sort_radix(maip_sort_item_t *items, maip_sort_item_t *scratch, size_t count)
+{
+    for (unsigned shift = 0; shift < 64; shift += 8)
+    {
+        size_t histogram[256] = {0};
+        for (size_t i = 0; i < count; ++i)
+            histogram[(items[i].key >> shift) & 0xff]++;
+        if (histogram[(items[0].key >> shift) & 0xff] == count)
+            continue; // Every key has this byte
+
+        size_t offset = 0;
+        for (size_t digit = 0; digit < 256; ++digit)
+        {
+            size_t bucket = histogram[digit];
+            histogram[digit] = offset;
+            offset += bucket;
+        }
+        for (size_t i = 0; i < count; ++i)
+            scratch[histogram[(items[i].key >> shift) & 0xff]++] = items[i];
+
+        maip_sort_item_t *swap = items;
+        items = scratch;
+        scratch = swap;
+    }
+    return items;
+}
+
+static void maip_sort_cases_by(fossil_maip_suite_t *suite, const maip_sort_spec_t *specs, size_t spec_count)
+{
+    size_t count = suite->count;
+    uint64_t *name_ranks = NULL;
+    for (size_t k = 0; k < spec_count && !name_ranks; ++k)
+    {
+        if (specs[k].key == MAIP_SORT_NAME && !(name_ranks = maip_sort_name_ranks(suite)))
+            return;
+    }
+
+    uint32_t *order = maip_sys_memory_alloc(count * sizeof(*order));
+    maip_sort_item_t *items = maip_sys_memory_alloc(2 * count * sizeof(*items));
+    fossil_maip_case_t *ordered = maip_sys_memory_alloc(count * sizeof(*ordered));
+    if (order && items && ordered)
+    {
+        for (size_t i = 0; i < count; ++i)
+            order[i] = (uint32_t)i;
+
+        // Least significant key first
+        for (size_t k = spec_count; k-- > 0;)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                items[i].index = order[i];
+                items[i].key = maip_sort_key_value(&suite->cases[order[i]], order[i], specs[k], name_ranks);
+            }
+            const maip_sort_item_t *sorted = maip_sort_radix(items, items + count, count);
+            for (size_t i = 0; i < count; ++i)
+                order[i] = sorted[i].index;
+        }
+
+        for (size_t i = 0; i < count; ++i)
+            ordered[i] = suite->cases[order[i]];
+        memcpy(suite->cases, ordered, count * sizeof(*ordered));
+    }
+
+    maip_sys_memory_free(ordered);
+    maip_sys_memory_free(items);
+    maip_sys_memory_free(order);
+    maip_sys_memory_free(name_ranks);
+}
+
+void fossil_maip_sort_cases(fossil_maip_suite_t *suite, const fossil_maip_engine_t *engine)
+{
+    if (!suite || !suite->cases || suite->count <= 1 || !engine)
+        return;
+
+    maip_sort_spec_t specs[FOSSIL_MAIP_SORT_KEYS];
+    size_t spec_count = maip_sort_specs(&engine->pallet, specs);
+    if (spec_count > 0)
+        maip_sort_cases_by(suite, specs, spec_count);
+}
+
+// --failed-first: moves the selected cases that failed in the last recorded
+// run to the front, keeping the order within both groups.
+static void fossil_maip_failed_first(const fossil_maip_engine_t *engine, fossil_maip_case_t **cases, size_t count)
+{
+    if (!engine->pallet.run.failed_first || count < 2)
+        return;
+
+    fossil_maip_case_t **ordered = maip_sys_memory_alloc(count * sizeof(*ordered));
+    if (!ordered)
+        return;
+
+    size_t placed = 0;
+    for (size_t pass = 0; pass < 2; ++pass)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (cases[i]->failed_before == (pass == 0))
+                ordered[placed++] = cases[i];
+        }
+    }
+
+    memcpy(cases, ordered, count * sizeof(*ordered));
+    maip_sys_memory_free(ordered);
+}
+
+// --- Filtering Test Cases ---
+
+// Stable identity of a case across runs and machines.
+static uint64_t fossil_maip_case_hash(const char *suite_name, const char *case_name)
+{
+    uint64_t hash = 0xcbf29ce484222325ULL; // FNV-1a
+    for (const char *c = suite_name; *c; ++c)
+        hash = (hash ^ (uint8_t)*c) * 0x100000001b3ULL;
+    hash = (hash ^ 0xff) * 0x100000001b3ULL; // Separator, so "a"+"bc" != "ab"+"c"
+    for (const char *c = case_name; *c; ++c)
+        hash = (hash ^ (uint8_t)*c) * 0x100000001b3ULL;
+    return hash;
+}
+
+// Whether a case is selected by the filter command and run --only, regardless
+// of sharding.
+static bool fossil_maip_case_matches(const fossil_maip_suite_t *suite, const fossil_maip_engine_t *engine,
+                                     const fossil_maip_case_t *test_case)
+{
+    const fossil_maip_filter_t *filter = engine->filter;
+    if (filter)
+    {
+        if (filter->test_name.active &&
+            maip_matcher_test_name(&filter->test_name, test_case->name) == filter->test_name_inverted)
+        {
+            return false;
+        }
+        if (filter->suite_name.active && !maip_matcher_test_name(&filter->suite_name, suite->name))
+        {
+            return false;
+        }
+        if (filter->tag.active && !maip_tag_expr_eval(&filter->tag, test_case->tag_bits))
+        {
+            return false;
+        }
+        if (filter->only.active && !maip_matcher_test_name(&filter->only, test_case->name))
+        {
+            return false;
+        }
+    }
+    if (engine->pallet.run.last_failed && !test_case->failed_before)
+    {
+        return false;
+    }
+    return true;
+}
+
+size_t fossil_maip_filter_cases(fossil_maip_suite_t *suite, const fossil_maip_engine_t *engine, fossil_maip_case_t **filtered_cases)
+{
+    if (!suite || !suite->cases || !filtered_cases || !engine)
+        return 0;
+
+    bool sharded = engine->pallet.run.shard_total > 1;
+    size_t count = 0;
+    for (size_t i = 0; i < suite->count; ++i)
+    {
+        fossil_maip_case_t *test_case = &suite->cases[i];
+
+        if (!fossil_maip_case_matches(suite, engine, test_case))
+            continue;
+        if (sharded && test_case->shard != (uint32_t)engine->pallet.run.shard_index)
+            continue;
+
+        filtered_cases[count++] = test_case;
+    }
+    return count;
+}
+
+// --- Sharding (run --shard) ---
+
+// Every machine computes the same assignment from the same inputs, so the
+// shards of one run cover each selected case exactly once.
+typedef struct
+{
+    fossil_maip_case_t *test_case;
+    uint64_t weight;
+    uint64_t hash;
+} maip_shard_item_t;
+
+static int maip_shard_compare(const void *a, const void *b)
+{
+    const maip_shard_item_t *ia = (const maip_shard_item_t *)a;
+    const maip_shard_item_t *ib = (const maip_shard_item_t *)b;
+    if (ia->weight != ib->weight)
+        return ia->weight < ib->weight ? 1 : -1;
+    return (ia->hash > ib->hash) - (ia->hash < ib->hash);
+}
+
+// Balanced mode deals the cases longest first, each to the shard with the least
+// expected work so far. It needs the same duration history on every machine;
+// cases without history count as the average known duration.
+static int maip_shard_balance(fossil_maip_engine_t *engine, size_t selected)
+{
+    uint32_t total = (uint32_t)engine->pallet.run.shard_total;
+    maip_shard_item_t *items = maip_sys_memory_alloc(selected * sizeof(*items));
+    uint64_t *load = maip_sys_memory_calloc(total, sizeof(*load));
+    if (!items || !load)
+    {
+        maip_sys_memory_free(items);
+        maip_sys_memory_free(load);
+        return FOSSIL_MAIP_FAILURE;
+    }
+
+    size_t count = 0;
+    uint64_t known_total = 0;
+    size_t known = 0;
+    for (size_t i = 0; i < engine->count; ++i)
+    {
+        fossil_maip_suite_t *suite = &engine->suites[i];
+        for (size_t j = 0; j < suite->count; ++j)
+        {
+            fossil_maip_case_t *test_case = &suite->cases[j];
+            if (!fossil_maip_case_matches(suite, engine, test_case))
+                continue;
+
+            items[count].test_case = test_case;
+            items[count].weight = test_case->expected_ns;
+            items[count].hash = fossil_maip_case_hash(suite->name, test_case->name);
+            if (test_case->expected_ns)
+            {
+                known_total += test_case->expected_ns;
+                known++;
+            }
+            count++;
+        }
+    }
+
+    uint64_t average = known ? known_total / known : 1;
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (!items[i].weight)
+            items[i].weight = average;
+    }
+    qsort(items, count, sizeof(*items), maip_shard_compare);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        uint32_t lightest = 0;
+        for (uint32_t k = 1; k < total; ++k)
+        {
+            if (load[k] < load[lightest])
+                lightest = k;
+        }
+        items[i].test_case->shard = lightest;
+        load[lightest] += items[i].weight;
+    }
+
+    maip_sys_memory_free(items);
+    maip_sys_memory_free(load);
+    return FOSSIL_MAIP_SUCCESS;
+}
+
+// Assigns every selected case to a shard before anything is set up, so suites
+// without local cases are skipped entirely.
+static void fossil_maip_shard_cases(fossil_maip_engine_t *engine)
+{
+    if (engine->pallet.run.shard_total <= 1)
+        return;
+
+    uint32_t total = (uint32_t)engine->pallet.run.shard_total;
+    size_t selected = 0;
+    for (size_t i = 0; i < engine->count; ++i)
+    {
+        fossil_maip_suite_t *suite = &engine->suites[i];
+        for (size_t j = 0; j < suite->count; ++j)
+        {
+            fossil_maip_case_t *test_case = &suite->cases[j];
+            test_case->shard = (uint32_t)(fossil_maip_case_hash(suite->name, test_case->name) % total);
+            if (fossil_maip_case_matches(suite, engine, test_case))
+                selected++;
+        }
+    }
+
+    if (selected > 0 && engine->pallet.run.shard_mode &&
+        maip_io_cstr_compare(engine->pallet.run.shard_mode, "balanced") == 0)
+    {
+        // On failure the hash assignment above still partitions the cases.
+        maip_shard_balance(engine, selected);
+    }
+}
+
+// --- Shuffling Test Cases ---
+// shuffle [--seed S] [--mode uniform|weighted] [--count K]
+// Only the shuffle command shuffles. Each suite draws from its own xoshiro
+// stream, derived from the master seed and the suite name, so the order of
+// a suite depends on the seed and its own cases alone, not on the suites
+// before it or on the runner. The master seed is printed at start.
+
+// --mode weighted: cases that failed in the last recorded run weigh four
+// times as much, and cases without a recorded duration (new or renamed, so
+// likely just changed) twice as much.
+static double maip_shuffle_weight(const fossil_maip_case_t *test_case)
+{
+    double weight = 1.0;
+    if (test_case->failed_before)
+        weight += 3.0;
+    if (test_case->expected_ns == 0)
+        weight += 1.0;
+    return weight;
+}
+
+// Weighted order without replacement (Efraimidis-Spirakis): each case draws
+// the key -ln(u) / weight and the cases run by increasing key, so heavier
+// cases tend to come first. Positive doubles order like their bit patterns,
+// which lets the radix sort of the sort command order them. Every case needs
+// its key, but with --count K only the K smallest are kept, in a bounded
+// max-heap, so a sample costs O(n log K) and only the K drawn are sorted.
+static void maip_shuffle_heap_down(maip_sort_item_t *heap, size_t count, size_t i)
+{
+    for (;;)
+    {
+        size_t largest = i;
+        size_t left = 2 * i + 1;
+        size_t right = left + 1;
+        if (left < count && heap[left].key > heap[largest].key)
+            largest = left;
+        if (right < count && heap[right].key > heap[largest].key)
+            largest = right;
+        if (largest == i)
+            return;
+        maip_sort_item_t temp = heap[i];
+        heap[i] = heap[largest];
+        heap[largest] = temp;
+        i = largest;
+    }
+}
+
+static void maip_shuffle_heap_up(maip_sort_item_t *heap, size_t i)
+{
+    while (i > 0 && heap[(i - 1) / 2].key < heap[i].key)
+    {
+        maip_sort_item_t temp = heap[i];
+        heap[i] = heap[(i - 1) / 2];
+        heap[(i - 1) / 2] = temp;
+        i = (i - 1) / 2;
+    }
+}
+
+static void maip_shuffle_weighted(fossil_maip_case_t **cases, size_t count, size_t keep, maip_rand_t *rng)
+{
+    maip_sort_item_t *items = maip_sys_memory_alloc(2 * keep * sizeof(*items));
+    fossil_maip_case_t **ordered = maip_sys_memory_alloc(keep * sizeof(*ordered));
+    if (items && ordered)
+    {
+        size_t held = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            double key = (0.0 - log(maip_rand_unit(rng))) / maip_shuffle_weight(cases[i]); // +0.0, never -0.0
+            maip_sort_item_t item = {0, (uint32_t)i};
+            memcpy(&item.key, &key, sizeof(key));
+
+            if (keep == count)
+            {
+                items[held++] = item; // Everything is kept, no heap needed
+            }
+            else if (held < keep)
+            {
+                items[held] = item;
+                maip_shuffle_heap_up(items, held++);
+            }
+            else if (item.key < items[0].key)
+            {
+                items[0] = item;
+                maip_shuffle_heap_down(items, keep, 0);
+            }
+        }
+        const maip_sort_item_t *sorted = maip_sort_radix(items, items + keep, keep);
+        for (size_t i = 0; i < keep; ++i)
+            ordered[i] = cases[sorted[i].index];
+        memcpy(cases, ordered, keep * sizeof(*ordered));
+    }
+    maip_sys_memory_free(ordered);
+    maip_sys_memory_free(items);
+}
+
+// Shuffles the selected cases of a suite and returns how many of them run:
+// all of them, or the --count K drawn by a partial Fisher-Yates in O(K) in
+// uniform mode, and by the bounded heap above in weighted mode.
+static size_t fossil_maip_shuffle_cases(const fossil_maip_suite_t *suite, const fossil_maip_engine_t *engine,
+                                        fossil_maip_case_t **cases, size_t count)
+{
+    if (!engine->pallet.shuffle.enabled || count == 0)
+        return count;
+
+    maip_rand_t rng;
+    const char *name = suite->name ? suite->name : "";
+    maip_rand_seed(&rng, engine->pallet.shuffle.seed_value, maip_span_hash(name, strlen(name)));
+
+    size_t keep = count;
+    if (engine->pallet.shuffle.count > 0 && (size_t)engine->pallet.shuffle.count < count)
+        keep = (size_t)engine->pallet.shuffle.count;
+
+    if (maip_io_cstr_compare(engine->pallet.shuffle.mode, "weighted") == 0)
+    {
+        maip_shuffle_weighted(cases, count, keep, &rng);
+        return keep;
+    }
+
+    for (size_t i = 0; i < keep && i + 1 < count; ++i)
+    {
+        size_t j = i + (size_t)maip_rand_below(&rng, count - i);
+        fossil_maip_case_t *temp = cases[i];
+        cases[i] = cases[j];
+        cases[j] = temp;
+    }
+    return keep;
+}
+
+// --- Run One Suite ---
+// --- Result Records ---
+// Processes that run cases for the parent (--jobs workers, --isolate zygotes
+// and their children) stream back one compact record per case: a fixed header
+// followed by message_length bytes of failure message.
+
+#if !defined(_WIN32)
+
+typedef struct
+{
+    uint32_t index; // Position of the case in the sender's work list
+    int32_t state;  // fossil_maip_state_t
+    uint64_t elapsed_ns;
+    uint64_t cpu_ns;
+    int32_t assert_count;
+    int32_t crash_signal;
+    uint64_t crash_address;
+    int32_t cause;           // fossil_maip_cause_t of the failed assertion
+    int32_t op;              // fossil_maip_op_t of the failed assertion
+    uint32_t message_length; // Message bytes follow the record
+    uint32_t site_length;    // Then the failure site bytes
+    uint32_t latency_length; // Then the --repeat histogram (0 or its size)
+} maip_wire_result_t;
+
+// Text that follows a record on the wire.
+typedef struct
+{
+    char message[FOSSIL_MAIP_MESSAGE_SIZE];
+    char site[FOSSIL_MAIP_MESSAGE_SIZE];
+    bool has_latency;
+    fossil_maip_latency_t latency;
+} maip_wire_text_t;
+
+static int maip_write_full(int fd, const void *buffer, size_t length)
+{
+    const uint8_t *cursor = (const uint8_t *)buffer;
+    while (length > 0)
+    {
+        ssize_t written = write(fd, cursor, length);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return FOSSIL_MAIP_FAILURE;
+        }
+        cursor += written;
+        length -= (size_t)written;
+    }
+    return FOSSIL_MAIP_SUCCESS;
+}
+
+// Returns 1 when the buffer was filled, 0 on end of stream and -1 on error.
+static int maip_read_full(int fd, void *buffer, size_t length)
+{
+    uint8_t *cursor = (uint8_t *)buffer;
+    size_t total = 0;
+    while (total < length)
+    {
+        ssize_t got = read(fd, cursor + total, length - total);
+        if (got < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return -1;
+        }
+        if (got == 0)
+            return total == 0 ? 0 : -1;
+        total += (size_t)got;
+    }
+    return 1;
+}
+
+static size_t maip_wire_text_length(const char *text)
+{
+    size_t length = text ? strlen(text) : 0;
+    return length < FOSSIL_MAIP_MESSAGE_SIZE ? length : FOSSIL_MAIP_MESSAGE_SIZE - 1;
+}
+
+static int maip_wire_send(int fd, uint32_t index, const fossil_maip_case_t *test_case)
+{
+    size_t length = maip_wire_text_length(test_case->message);
+    size_t site_length = maip_wire_text_length(test_case->site);
+
+    maip_wire_result_t record;
+    maip_sys_memory_set(&record, 0, sizeof(record));
+    record.index = index;
+    record.state = (int32_t)test_case->state;
+    record.elapsed_ns = test_case->elapsed_ns;
+    record.cpu_ns = test_case->cpu_ns;
+    record.assert_count = (int32_t)test_case->assert_count;
+    record.crash_signal = (int32_t)test_case->crash_signal;
+    record.crash_address = (uint64_t)test_case->crash_address;
+    record.cause = (int32_t)test_case->cause;
+    record.op = (int32_t)test_case->op;
+    record.message_length = (uint32_t)length;
+    record.site_length = (uint32_t)site_length;
+    record.latency_length = test_case->latency ? (uint32_t)sizeof(*test_case->latency) : 0;
+
+    if (maip_write_full(fd, &record, sizeof(record)) != FOSSIL_MAIP_SUCCESS)
+        return FOSSIL_MAIP_FAILURE;
+    if (length && maip_write_full(fd, test_case->message, length) != FOSSIL_MAIP_SUCCESS)
+        return FOSSIL_MAIP_FAILURE;
+    if (site_length && maip_write_full(fd, test_case->site, site_length) != FOSSIL_MAIP_SUCCESS)
+        return FOSSIL_MAIP_FAILURE;
+    return record.latency_length ? maip_write_full(fd, test_case->latency, record.latency_length) : FOSSIL_MAIP_SUCCESS;
+}
+
+// Reads one record; text receives its NUL-terminated failure message and site.
+// Returns 1 on success, 0 on end of stream and -1 on error.
+static int maip_wire_recv(int fd, maip_wire_result_t *record, maip_wire_text_t *text)
+{
+    int got = maip_read_full(fd, record, sizeof(*record));
+    if (got != 1)
+        return got;
+    if (record->message_length >= FOSSIL_MAIP_MESSAGE_SIZE || record->site_length >= FOSSIL_MAIP_MESSAGE_SIZE)
+        return -1;
+    if (record->latency_length != 0 && record->latency_length != sizeof(text->latency))
+        return -1;
+    if (record->message_length > 0 && maip_read_full(fd, text->message, record->message_length) != 1)
+        return -1;
+    if (record->site_length > 0 && maip_read_full(fd, text->site, record->site_length) != 1)
+        return -1;
+    if (record->latency_length > 0 && maip_read_full(fd, &text->latency, record->latency_length) != 1)
+        return -1;
+
+    text->has_latency = record->latency_length > 0;
+
+    text->message[record->message_length] = '\0';
+    text->site[record->site_length] = '\0';
+    return 1;
+}
+
+static void maip_wire_apply(const maip_wire_result_t *record, const maip_wire_text_t *text, fossil_maip_case_t *test_case)
+{
+    test_case->state = (fossil_maip_state_t)record->state;
+    test_case->elapsed_ns = record->elapsed_ns;
+    test_case->cpu_ns = record->cpu_ns;
+    test_case->assert_count = (int)record->assert_count;
+    test_case->crash_signal = (int)record->crash_signal;
+    test_case->crash_address = (uintptr_t)record->crash_address;
+    fossil_maip_case_note(test_case, text->message, text->site);
+    fossil_maip_case_classify(test_case, (int)record->cause, (int)record->op);
+
+    if (text->has_latency)
+    {
+        if (!test_case->latency)
+            test_case->latency = maip_sys_memory_alloc(sizeof(*test_case->latency));
+        if (test_case->latency)
+            memcpy(test_case->latency, &text->latency, sizeof(*test_case->latency));
+    }
+}
+
+// --- Process Isolation (run --isolate) ---
+
+// Runs one case in a forked child of the calling process and collects its
+// record. The child starts from the caller's memory copy-on-write, so anything
+// the case corrupts is thrown away with it.
+static void maip_isolate_case(const fossil_maip_engine_t *engine,
+                              const fossil_maip_suite_t *suite,
+                              fossil_maip_case_t *test_case)
+{
+    uint64_t start_time = fossil_maip_now_ns();
+    int fds[2];
+    pid_t pid = -1;
+
+    if (pipe(fds) == 0)
+    {
+        fflush(stdout); // Do not let the child inherit pending output
+        pid = fork();
+        if (pid < 0)
+        {
+            close(fds[0]);
+            close(fds[1]);
+        }
+    }
+
+    if (pid < 0)
+    {
+        test_case->state = FOSSIL_MAIP_CASE_UNEXPECTED;
+        test_case->elapsed_ns = 0;
+        test_case->cpu_ns = 0;
+        fossil_maip_case_note(test_case, "Could not fork an isolated process", NULL);
+        return;
+    }
+
+    if (pid == 0)
+    {
+        close(fds[0]);
+        maip_watch_after_fork();
+        maip_site_after_fork();
+        fossil_maip_execute_case(engine, suite, test_case);
+        fflush(stdout);
+        maip_wire_send(fds[1], 0, test_case);
+        maip_site_release();
+        _exit(EXIT_SUCCESS);
+    }
+
+    close(fds[1]);
+    maip_wire_result_t record;
+    maip_wire_text_t text;
+    int got = maip_wire_recv(fds[0], &record, &text);
+    close(fds[0]);
+
+    int status = 0;
+    while (waitpid(pid, &status, 0) < 0 && errno == EINTR)
+    {
+    }
+
+    if (got == 1)
+    {
+        maip_wire_apply(&record, &text, test_case);
+        return;
+    }
+
+    // The child ended without reporting (abort, exit, or a signal we do not catch).
+    test_case->state = FOSSIL_MAIP_CASE_UNEXPECTED;
+    test_case->elapsed_ns = fossil_maip_now_ns() - start_time;
+    test_case->cpu_ns = 0; // Spent in another process
+    test_case->assert_count = 0;
+    test_case->crash_signal = WIFSIGNALED(status) ? WTERMSIG(status) : 0;
+    test_case->crash_address = 0;
+    fossil_maip_case_note(test_case, WIFSIGNALED(status) ? NULL : "Isolated process exited without a result", NULL);
+}
+
+typedef struct
+{
+    pid_t pid;
+    int cmd_fd; // parent -> zygote: case indices
+    int res_fd; // zygote -> parent: result records
+} maip_zygote_t;
+
+// Forks a zygote that runs the suite setup once, then forks a child per case it
+// is handed, so cases start from the prepared state without re-running setup.
+static int maip_zygote_spawn(const fossil_maip_engine_t *engine, fossil_maip_suite_t *suite,
+                             fossil_maip_case_t **cases, size_t count, maip_zygote_t *zygote)
+{
+    int cmd[2], res[2];
+    if (pipe(cmd) != 0)
+        return FOSSIL_MAIP_FAILURE;
+    if (pipe(res) != 0)
+    {
+        close(cmd[0]);
+        close(cmd[1]);
+        return FOSSIL_MAIP_FAILURE;
+    }
+
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid < 0)
+    {
+        close(cmd[0]);
+        close(cmd[1]);
+        close(res[0]);
+        close(res[1]);
+        return FOSSIL_MAIP_FAILURE;
+    }
+
+    if (pid == 0)
+    {
+        close(cmd[1]);
+        close(res[0]);
+        maip_watch_after_fork();
+        maip_site_after_fork();
+
+        if (suite->setup)
+            suite->setup();
+
+        uint32_t index;
+        while (maip_read_full(cmd[0], &index, sizeof(index)) == 1 && index < count)
+        {
+            maip_isolate_case(engine, suite, cases[index]);
+            if (maip_wire_send(res[1], index, cases[index]) != FOSSIL_MAIP_SUCCESS)
+                break;
+        }
+
+        if (suite->teardown)
+            suite->teardown();
+
+        fflush(stdout);
+        maip_site_release();
+        _exit(EXIT_SUCCESS);
+    }
+
+    close(cmd[0]);
+    close(res[1]);
+    zygote->pid = pid;
+    zygote->cmd_fd = cmd[1];
+    zygote->res_fd = res[0];
+    return FOSSIL_MAIP_SUCCESS;
+}
+
+static void maip_zygote_retire(maip_zygote_t *zygote)
+{
+    if (zygote->pid <= 0)
+        return;
+
+    close(zygote->cmd_fd);
+    close(zygote->res_fd);
+    while (waitpid(zygote->pid, NULL, 0) < 0 && errno == EINTR)
+    {
+    }
+    zygote->pid = 0;
+}
+
+// Runs the selected cases of a suite through a zygote, scoring each record as it
+// arrives. A zygote lost mid-run (e.g. a crashing suite setup) charges the case
+// it held as unexpected and is replaced for the remaining cases.
+static void maip_zygote_run(const fossil_maip_engine_t *engine, fossil_maip_suite_t *suite,
+                            fossil_maip_case_t **cases, size_t count)
+{
+    struct sigaction ignore, previous;
+    maip_sys_memory_set(&ignore, 0, sizeof(ignore));
+    ignore.sa_handler = SIG_IGN;
+    sigemptyset(&ignore.sa_mask);
+    sigaction(SIGPIPE, &ignore, &previous);
+
+    maip_zygote_t zygote = {0, -1, -1};
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        fossil_maip_case_t *test_case = cases[i];
+        if (!fossil_maip_run_gate(engine, test_case, suite))
+            continue;
+
+        uint32_t index = (uint32_t)i;
+        maip_wire_result_t record;
+        maip_wire_text_t text;
+
+        if ((zygote.pid > 0 || maip_zygote_spawn(engine, suite, cases, count, &zygote) == FOSSIL_MAIP_SUCCESS) &&
+            maip_write_full(zygote.cmd_fd, &index, sizeof(index)) == FOSSIL_MAIP_SUCCESS &&
+            maip_wire_recv(zygote.res_fd, &record, &text) == 1 && record.index == index)
+        {
+            maip_wire_apply(&record, &text, test_case);
+        }
+        else
+        {
+            test_case->state = FOSSIL_MAIP_CASE_UNEXPECTED;
+            test_case->elapsed_ns = 0;
+            test_case->cpu_ns = 0;
+            test_case->crash_signal = 0;
+            fossil_maip_case_note(test_case, "Suite zygote was lost", NULL);
+            maip_zygote_retire(&zygote);
+        }
+
+        fossil_maip_update_score(test_case, suite);
+        fossil_maip_show_cases(suite, test_case, engine);
+
+        if (engine->pallet.run.fail_fast && test_case->state == FOSSIL_MAIP_CASE_FAIL)
+            break;
+    }
+
+    maip_zygote_retire(&zygote);
+    sigaction(SIGPIPE, &previous, NULL);
+}
+
+#endif
+
+int fossil_maip_run_suite(const fossil_maip_engine_t *engine, fossil_maip_suite_t *suite)
+{
+    if (!suite || !suite->cases)
+        return FOSSIL_MAIP_FAILURE;
+
+    // Under --isolate the suite zygote owns setup and teardown
+#if !defined(_WIN32)
+    bool isolate = engine->pallet.run.isolate != 0;
+#else
+    bool isolate = false;
+#endif
+
+    // --- Reset suite stats ---
+    suite->time_elapsed_ns = 0;
+    suite->total_score = 0;
+    suite->total_possible = 0;
+    maip_sys_memory_set(&suite->score, 0, sizeof(suite->score));
+
+    // --- Ordering and filtering ---
+    // Sorting reorders the cases in place; the shuffle and --failed-first then
+    // reorder (or sample) only the selected ones.
+    fossil_maip_sort_cases(suite, engine);
+
+    // On the heap: suites may hold far more cases than fit on the stack
+    fossil_maip_case_t **filtered_cases = maip_sys_memory_alloc(suite->count * sizeof(*filtered_cases));
+    if (!filtered_cases)
+        return FOSSIL_MAIP_FAILURE;
+    size_t filtered_count = fossil_maip_filter_cases(suite, engine, filtered_cases);
+    filtered_count = fossil_maip_shuffle_cases(suite, engine, filtered_cases, filtered_count);
+    fossil_maip_failed_first(engine, filtered_cases, filtered_count);
+
+    // Nothing selected here (filtered out, or on another shard): skip setup too.
+    if (filtered_count == 0)
+    {
+        maip_sys_memory_free(filtered_cases);
+        return FOSSIL_MAIP_SUCCESS;
+    }
+
+    if (suite->setup && !isolate)
+        suite->setup();
+
+    suite->time_elapsed_ns = fossil_maip_now_ns();
+
+#if !defined(_WIN32)
+    if (isolate)
+        maip_zygote_run(engine, suite, filtered_cases, filtered_count);
+    else
+#endif
+    {
+        bool batched = fossil_maip_run_async_cases(engine, suite, filtered_cases, filtered_count);
+        for (size_t i = 0; i < filtered_count; ++i)
+        {
+            fossil_maip_case_t *test_case = filtered_cases[i];
+            if (batched && test_case->async)
+                continue;
+            fossil_maip_run_test(engine, test_case, suite);
+        }
+    }
+
+    suite->time_elapsed_ns = fossil_maip_now_ns() - suite->time_elapsed_ns;
+
+    if (suite->teardown && !isolate)
+        suite->teardown();
+
+    maip_sys_memory_free(filtered_cases);
+    return FOSSIL_MAIP_SUCCESS;
+}
+
+// --- Run Plan ---
+
+// A plan is the flat, ordered list of cases a run will execute, built once up
+// front so that work can be handed out to parallel workers by index.
+typedef struct
+{
+    fossil_maip_suite_t *suite;
+    fossil_maip_case_t *test_case;
+    uint64_t weight; // Expected duration used for scheduling
+} maip_plan_item_t;
+
+typedef struct
+{
+    maip_plan_item_t *items;
+    size_t count;
+    size_t capacity;
+} maip_plan_t;
+
+static int maip_plan_push(maip_plan_t *plan, fossil_maip_suite_t *suite, fossil_maip_case_t *test_case)
+{
+    if (plan->count >= plan->capacity)
+    {
+        size_t new_cap = plan->capacity ? plan->capacity * 2 : 64;
+        maip_plan_item_t *resized = maip_sys_memory_realloc(plan->items, new_cap * sizeof(*plan->items));
+        if (!resized)
+            return FOSSIL_MAIP_FAILURE;
+        plan->items = resized;
+        plan->capacity = new_cap;
+    }
+
+    plan->items[plan->count].suite = suite;
+    plan->items[plan->count].test_case = test_case;
+    plan->items[plan->count].weight = test_case->expected_ns;
+    plan->count++;
+    return FOSSIL_MAIP_SUCCESS;
+}
+
+// Longest first, ties in plan order (cases live in per-suite arrays, and the
+// suites in one array, so their addresses follow that order).
+static int maip_plan_compare_weight(const void *a, const void *b)
+{
+    const maip_plan_item_t *ia = (const maip_plan_item_t *)a;
+    const maip_plan_item_t *ib = (const maip_plan_item_t *)b;
+    if (ia->weight != ib->weight)
+        return ia->weight < ib->weight ? 1 : -1;
+    if (ia->suite != ib->suite)
+        return ia->suite < ib->suite ? -1 : 1;
+    return (ia->test_case > ib->test_case) - (ia->test_case < ib->test_case);
+}
+
+// Longest-processing-time-first: starting the slowest cases early keeps one
+// slow case from being the last thing a run waits on. Cases without history
+// are scheduled as if they took the average known duration.
+static void maip_plan_order_longest_first(maip_plan_t *plan)
+{
+    uint64_t known_total = 0;
+    size_t known = 0;
+    for (size_t i = 0; i < plan->count; ++i)
+    {
+        if (plan->items[i].weight)
+        {
+            known_total += plan->items[i].weight;
+            known++;
+        }
+    }
+    if (known == 0)
+        return;
+
+    uint64_t average = known_total / known;
+    for (size_t i = 0; i < plan->count; ++i)
+    {
+        if (!plan->items[i].weight)
+            plan->items[i].weight = average;
+    }
+
+    qsort(plan->items, plan->count, sizeof(*plan->items), maip_plan_compare_weight);
+}
+
+// --failed-first across the whole plan, keeping the order within both groups.
+static void maip_plan_failed_first(maip_plan_t *plan)
+{
+    maip_plan_item_t *ordered = maip_sys_memory_alloc(plan->count * sizeof(*ordered));
+    if (!ordered)
+        return;
+
+    size_t count = 0;
+    for (size_t pass = 0; pass < 2; ++pass)
+    {
+        for (size_t i = 0; i < plan->count; ++i)
+        {
+            if (plan->items[i].test_case->failed_before == (pass == 0))
+                ordered[count++] = plan->items[i];
+        }
+    }
+
+    memcpy(plan->items, ordered, plan->count * sizeof(*ordered));
+    maip_sys_memory_free(ordered);
+}
+
+// Orders and filters every suite, appending the selected cases to the plan.
+static int maip_plan_build(const fossil_maip_engine_t *engine, maip_plan_t *plan)
+{
+    for (size_t i = 0; i < engine->count; ++i)
+    {
+        fossil_maip_suite_t *suite = &engine->suites[i];
+
+        suite->time_elapsed_ns = 0;
+        suite->total_score = 0;
+        suite->total_possible = 0;
+        maip_sys_memory_set(&suite->score, 0, sizeof(suite->score));
+
+        if (!suite->cases || suite->count == 0)
+            continue;
+
+        fossil_maip_sort_cases(suite, engine);
+
+        fossil_maip_case_t **filtered_cases = maip_sys_memory_alloc(suite->count * sizeof(*filtered_cases));
+        if (!filtered_cases)
+            return FOSSIL_MAIP_FAILURE;
+
+        size_t filtered_count = fossil_maip_filter_cases(suite, engine, filtered_cases);
+        filtered_count = fossil_maip_shuffle_cases(suite, engine, filtered_cases, filtered_count);
+        for (size_t j = 0; j < filtered_count; ++j)
+        {
+            if (maip_plan_push(plan, suite, filtered_cases[j]) != FOSSIL_MAIP_SUCCESS)
+            {
+                maip_sys_memory_free(filtered_cases);
+                return FOSSIL_MAIP_FAILURE;
+            }
+        }
+        maip_sys_memory_free(filtered_cases);
+    }
+
+    // A requested order wins over packing the longest cases first, which only
+    // pays off with several runners
+    bool parallel = engine->pallet.run.jobs > 1 || engine->pallet.run.threads > 1;
+    if (parallel && !engine->pallet.sort.by && !engine->pallet.shuffle.enabled)
+        maip_plan_order_longest_first(plan);
+    if (engine->pallet.run.failed_first)
+        maip_plan_failed_first(plan);
+
+    return FOSSIL_MAIP_SUCCESS;
+}
+
+// Suites are prepared up front when their cases may run on any thread; ready
+// marks the ones set up, for maip_plan_teardown.
+static void maip_plan_setup(const fossil_maip_engine_t *engine, const maip_plan_t *plan, bool *ready)
+{
+    for (size_t i = 0; i < plan->count; ++i)
+    {
+        size_t suite_index = (size_t)(plan->items[i].suite - engine->suites);
+        if (!ready[suite_index])
+        {
+            ready[suite_index] = true;
+            if (plan->items[i].suite->setup)
+                plan->items[i].suite->setup();
+        }
+    }
+}
+
+static void maip_plan_teardown(const fossil_maip_engine_t *engine, const bool *ready)
+{
+    for (size_t i = 0; i < engine->count; ++i)
+    {
+        if (ready[i] && engine->suites[i].teardown)
+            engine->suites[i].teardown();
+    }
+}
+
+// Records a finished case in the engine. Returns true when --fail-fast asks the
+// run to stop handing out work.
+static bool maip_plan_merge(const fossil_maip_engine_t *engine, const maip_plan_item_t *item,
+                            fossil_maip_state_t state, uint64_t elapsed_ns)
+{
+    item->test_case->state = state;
+    item->test_case->elapsed_ns = elapsed_ns;
+    item->suite->time_elapsed_ns += elapsed_ns;
+
+    fossil_maip_update_score(item->test_case, item->suite);
+    fossil_maip_show_cases(item->suite, item->test_case, engine);
+
+    return engine->pallet.run.fail_fast && state == FOSSIL_MAIP_CASE_FAIL;
+}
+
+// --- Case Dependencies (FOSSIL_TEST_DEPEND_ON) ---
+// fossil_maip_run_all resolves the prerequisite lists of every case into a
+// graph once, before anything runs, rejecting unknown names and cycles. Nodes
+// are numbered suite by suite and found again by suite and case name, since
+// sorting moves cases around inside their suite. Edges are stored both ways in
+// compressed rows: what a node needs, and what it feeds.
+struct fossil_maip_graph
+{
+    size_t node_count;
+    size_t *suite_of;     // Suite index of each node
+    const char **name_of; // Case name of each node
+    uint32_t *buckets;    // Node + 1 by case name hash, 0 = empty
+    size_t bucket_count;  // Power of two
+    size_t *needs_start;  // Prerequisites of n: needs[needs_start[n] .. needs_start[n + 1])
+    size_t *needs;
+    size_t *feeds_start;  // Dependents of n, laid out the same way
+    size_t *feeds;
+};
+
+static void fossil_maip_graph_free(fossil_maip_graph_t *graph)
+{
+    if (!graph)
+        return;
+    maip_sys_memory_free(graph->suite_of);
+    maip_sys_memory_free(graph->name_of);
+    maip_sys_memory_free(graph->buckets);
+    maip_sys_memory_free(graph->needs_start);
+    maip_sys_memory_free(graph->needs);
+    maip_sys_memory_free(graph->feeds_start);
+    maip_sys_memory_free(graph->feeds);
+    maip_sys_memory_free(graph);
+}
+
+// Next node named name (in suite, or in any suite when suite is SIZE_MAX) from
+// the probe position *slot, which starts at the hash of the name. SIZE_MAX once
+// the probe runs out.
+static size_t maip_graph_next(const fossil_maip_graph_t *graph, size_t *slot, size_t suite,
+                              const char *name, size_t length)
+{
+    size_t mask = graph->bucket_count - 1;
+    for (; graph->buckets[*slot]; *slot = (*slot + 1) & mask)
+    {
+        size_t node = graph->buckets[*slot] - 1;
+        const char *candidate = graph->name_of[node];
+        if ((suite == SIZE_MAX || graph->suite_of[node] == suite) &&
+            strncmp(candidate, name, length) == 0 && candidate[length] == '\0')
+        {
+            *slot = (*slot + 1) & mask;
+            return node;
+        }
+    }
+    return SIZE_MAX;
+}
+
+static size_t maip_graph_find(const fossil_maip_graph_t *graph, size_t suite, const char *name)
+{
+    size_t length = strlen(name);
+    size_t slot = maip_span_hash(name, length) & (graph->bucket_count - 1);
+    return maip_graph_next(graph, &slot, suite, name, length);
+}
+
+static size_t maip_graph_suite(const fossil_maip_engine_t *engine, const char *name, size_t length)
+{
+    for (size_t i = 0; i < engine->count; ++i)
+    {
+        const char *suite_name = engine->suites[i].name;
+        if (suite_name && strncmp(suite_name, name, length) == 0 && suite_name[length] == '\0')
+            return i;
+    }
+    return SIZE_MAX;
+}
+
+// Resolves the prerequisite list of node into out (when given) and returns how
+// many edges it has, or SIZE_MAX after reporting a name that matches nothing.
+// Every entry is a case name (in any suite), a suite name (every other case of
+// the suite), or suite.case.
+static size_t maip_graph_resolve(const fossil_maip_engine_t *engine, const fossil_maip_graph_t *graph,
+                                 const size_t *suite_first, size_t node, const char *list, size_t *out)
+{
+    size_t count = 0;
+    const char *entry = list;
+
+    while (entry && *entry)
+    {
+        while (*entry == ' ' || *entry == ',')
+            entry++;
+        size_t length = strcspn(entry, ",");
+        size_t trimmed = length;
+        while (trimmed > 0 && entry[trimmed - 1] == ' ')
+            trimmed--;
+        if (trimmed == 0)
+        {
+            entry += length;
+            continue;
+        }
+
+        size_t matched = 0;
+        const char *dot = memchr(entry, '.', trimmed);
+        size_t suite = dot ? maip_graph_suite(engine, entry, (size_t)(dot - entry)) : SIZE_MAX;
+        const char *name = dot ? dot + 1 : entry;
+        size_t name_length = dot ? trimmed - (size_t)(name - entry) : trimmed;
+
+        if (!dot || suite != SIZE_MAX)
+        {
+            size_t slot = maip_span_hash(name, name_length) & (graph->bucket_count - 1);
+            size_t found;
+            while ((found = maip_graph_next(graph, &slot, suite, name, name_length)) != SIZE_MAX)
+            {
+                if (out)
+                    out[count] = found;
+                count++;
+                matched++;
+            }
+            bool matched_name = matched > 0;
+
+            // A FOSSIL_TEST_PARAM case stands for all of its rows
+            for (found = 0; !matched_name && found < graph->node_count; ++found)
+            {
+                const char *row_name = graph->name_of[found];
+                if ((suite == SIZE_MAX || graph->suite_of[found] == suite) &&
+                    strncmp(row_name, name, name_length) == 0 && row_name[name_length] == '/')
+                {
+                    if (out)
+                        out[count] = found;
+                    count++;
+                    matched++;
+                }
+            }
+        }
+        if (!dot && matched == 0 && (suite = maip_graph_suite(engine, entry, trimmed)) != SIZE_MAX)
+        {
+            for (size_t found = suite_first[suite]; found < suite_first[suite + 1]; ++found)
+            {
+                if (found == node)
+                    continue;
+                if (out)
+                    out[count] = found;
+                count++;
+            }
+            matched = 1;
+        }
+
+        if (matched == 0)
+        {
+            if (!out)
+                maip_io_printf("{red}Unknown dependency '%.*s' of case %s.%s{reset}\n", (int)trimmed, entry,
+                               engine->suites[graph->suite_of[node]].name, graph->name_of[node]);
+            return SIZE_MAX;
+        }
+        entry += length;
+    }
+    return count;
+}
+
+// Kahn's algorithm: whatever never loses all its prerequisites sits on a cycle.
+// Walking prerequisites from such a node stays among those nodes, so the walk
+// comes back to a node it has seen, and the nodes since then are the cycle.
+static int maip_graph_check(const fossil_maip_engine_t *engine, const fossil_maip_graph_t *graph)
+{
+    size_t n = graph->node_count;
+    size_t *waiting = maip_sys_memory_alloc(n * sizeof(*waiting));
+    size_t *queue = maip_sys_memory_alloc(n * sizeof(*queue));
+    if (!waiting || !queue)
+    {
+        maip_sys_memory_free(waiting);
+        maip_sys_memory_free(queue);
+        return FOSSIL_MAIP_FAILURE;
+    }
+
+    size_t tail = 0;
+    for (size_t i = 0; i < n; ++i)
+    {
+        waiting[i] = graph->needs_start[i + 1] - graph->needs_start[i];
+        if (waiting[i] == 0)
+            queue[tail++] = i;
+    }
+    for (size_t head = 0; head < tail; ++head)
+    {
+        size_t node = queue[head];
+        for (size_t e = graph->feeds_start[node]; e < graph->feeds_start[node + 1]; ++e)
+        {
+            if (--waiting[graph->feeds[e]] == 0)
+                queue[tail++] = graph->feeds[e];
+        }
+    }
+
+    int status = FOSSIL_MAIP_SUCCESS;
+    if (tail < n)
+    {
+        // queue is free again: it holds the walk, waiting the step (+1) of each node on it
+        size_t node = 0;
+        while (waiting[node] == 0)
+            node++;
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (waiting[i])
+                waiting[i] = SIZE_MAX;
+        }
+
+        size_t steps = 0;
+        while (waiting[node] == SIZE_MAX)
+        {
+            waiting[node] = steps + 1;
+            queue[steps++] = node;
+            size_t e = graph->needs_start[node];
+            while (waiting[graph->needs[e]] == 0)
+                e++;
+            node = graph->needs[e];
+        }
+
+        maip_io_printf("{red}Dependency cycle:");
+        for (size_t i = waiting[node] - 1; i < steps; ++i)
+            maip_io_printf(" %s.%s ->", engine->suites[graph->suite_of[queue[i]]].name, graph->name_of[queue[i]]);
+        maip_io_printf(" %s.%s{reset}\n", engine->suites[graph->suite_of[node]].name, graph->name_of[node]);
+        status = FOSSIL_MAIP_FAILURE;
+    }
+
+    maip_sys_memory_free(waiting);
+    maip_sys_memory_free(queue);
+    return status;
+}
+
+// Builds engine->graph, or leaves it NULL when no case declares prerequisites.
+static int fossil_maip_graph_build(fossil_maip_engine_t *engine)
+{
+    fossil_maip_graph_free(engine->graph);
+    engine->graph = NULL;
+
+    size_t n = 0;
+    bool declared = false;
+    for (size_t i = 0; i < engine->count; ++i)
+    {
+        n += engine->suites[i].count;
+        for (size_t j = 0; j < engine->suites[i].count && !declared; ++j)
+            declared = engine->suites[i].cases[j].depends != NULL;
+    }
+    if (!declared)
+        return FOSSIL_MAIP_SUCCESS;
+
+    fossil_maip_graph_t *graph = maip_sys_memory_calloc(1, sizeof(*graph));
+    size_t *suite_first = maip_sys_memory_alloc((engine->count + 1) * sizeof(*suite_first));
+    if (!graph || !suite_first)
+    {
+        maip_sys_memory_free(graph);
+        maip_sys_memory_free(suite_first);
+        return FOSSIL_MAIP_FAILURE;
+    }
+
+    graph->node_count = n;
+    graph->bucket_count = 8;
+    while (graph->bucket_count < n * 2)
+        graph->bucket_count <<= 1;
+    graph->suite_of = maip_sys_memory_alloc(n * sizeof(*graph->suite_of));
+    graph->name_of = maip_sys_memory_alloc(n * sizeof(*graph->name_of));
+    graph->buckets = maip_sys_memory_calloc(graph->bucket_count, sizeof(*graph->buckets));
+    graph->needs_start = maip_sys_memory_calloc(n + 1, sizeof(*graph->needs_start));
+    graph->feeds_start = maip_sys_memory_calloc(n + 2, sizeof(*graph->feeds_start));
+    int status = (graph->suite_of && graph->name_of && graph->buckets && graph->needs_start && graph->feeds_start)
+                     ? FOSSIL_MAIP_SUCCESS
+                     : FOSSIL_MAIP_FAILURE;
+
+    // --- Nodes, hashed by case name ---
+    size_t node = 0;
+    for (size_t i = 0; i < engine->count && status == FOSSIL_MAIP_SUCCESS; ++i)
+    {
+        suite_first[i] = node;
+        for (size_t j = 0; j < engine->suites[i].count; ++j, ++node)
+        {
+            const char *name = engine->suites[i].cases[j].name ? engine->suites[i].cases[j].name : "";
+            graph->suite_of[node] = i;
+            graph->name_of[node] = name;
+
+            size_t mask = graph->bucket_count - 1;
+            size_t slot = maip_span_hash(name, strlen(name)) & mask;
+            while (graph->buckets[slot])
+                slot = (slot + 1) & mask;
+            graph->buckets[slot] = (uint32_t)(node + 1);
+        }
+    }
+    suite_first[engine->count] = node;
+
+    // --- Edges: count, then fill ---
+    size_t edges = 0;
+    for (node = 0; node < n && status == FOSSIL_MAIP_SUCCESS; ++node)
+    {
+        const fossil_maip_suite_t *suite = &engine->suites[graph->suite_of[node]];
+        const char *list = suite->cases[node - suite_first[graph->suite_of[node]]].depends;
+        size_t count = maip_graph_resolve(engine, graph, suite_first, node, list, NULL);
+        if (count == SIZE_MAX)
+            status = FOSSIL_MAIP_FAILURE;
+        else
+            edges += count;
+        graph->needs_start[node + 1] = edges;
+    }
+
+    if (status == FOSSIL_MAIP_SUCCESS)
+    {
+        graph->needs = maip_sys_memory_alloc((edges ? edges : 1) * sizeof(*graph->needs));
+        graph->feeds = maip_sys_memory_alloc((edges ? edges : 1) * sizeof(*graph->feeds));
+        if (!graph->needs || !graph->feeds)
+            status = FOSSIL_MAIP_FAILURE;
+    }
+    for (node = 0; node < n && status == FOSSIL_MAIP_SUCCESS; ++node)
+    {
+        const fossil_maip_suite_t *suite = &engine->suites[graph->suite_of[node]];
+        const char *list = suite->cases[node - suite_first[graph->suite_of[node]]].depends;
+        maip_graph_resolve(engine, graph, suite_first, node, list, graph->needs + graph->needs_start[node]);
+    }
+
+    // The reverse rows, by counting sort on the prerequisite
+    if (status == FOSSIL_MAIP_SUCCESS)
+    {
+        for (size_t e = 0; e < edges; ++e)
+            graph->feeds_start[graph->needs[e] + 2]++;
+        for (node = 0; node < n; ++node)
+            graph->feeds_start[node + 2] += graph->feeds_start[node + 1];
+        for (node = 0; node < n; ++node)
+        {
+            for (size_t e = graph->needs_start[node]; e < graph->needs_start[node + 1]; ++e)
+                graph->feeds[graph->feeds_start[graph->needs[e] + 1]++] = node;
+        }
+        status = maip_graph_check(engine, graph);
+    }
+
+    maip_sys_memory_free(suite_first);
+    if (status != FOSSIL_MAIP_SUCCESS)
+    {
+        fossil_maip_graph_free(graph);
+        return FOSSIL_MAIP_FAILURE;
+    }
+    engine->graph = graph;
+    return FOSSIL_MAIP_SUCCESS;
+}
+
+// --- Dependency Order ---
+// The per-run view of the graph over a plan. A plan item is released once every
+// prerequisite in the plan has finished; released items are handed out in plan
+// order, so sorting, shuffling and LPT still decide among the ready ones. An
+// item whose prerequisite did not pass is skipped as soon as it would have been
+// released, which cascades to its own dependents. Prerequisites outside the
+// plan (filtered out, or on another shard) count as met. Not thread-safe: the
+// runners call it under their own lock.
+typedef struct
+{
+    const fossil_maip_graph_t *graph;
+    const maip_plan_t *plan;
+    size_t *item_of; // Plan index of each node, SIZE_MAX when it is not in the plan
+    size_t *node_of; // Node of each plan index
+    size_t *waiting; // Unfinished prerequisites of each plan index
+    size_t *blocker; // Plan index of a prerequisite that did not pass, SIZE_MAX = none
+    size_t *ready;   // Min-heap of released plan indices
+    size_t ready_count;
+    size_t *cascade; // Finished items whose dependents are still to be visited
+    size_t unfinished;
+} maip_dag_t;
+
+static void maip_dag_free(maip_dag_t *dag)
+{
+    maip_sys_memory_free(dag->item_of);
+    maip_sys_memory_free(dag->node_of);
+    maip_sys_memory_free(dag->waiting);
+    maip_sys_memory_free(dag->blocker);
+    maip_sys_memory_free(dag->ready);
+    maip_sys_memory_free(dag->cascade);
+    maip_sys_memory_set(dag, 0, sizeof(*dag));
+}
+
+static void maip_dag_push(maip_dag_t *dag, size_t index)
+{
+    size_t at = dag->ready_count++;
+    while (at > 0 && dag->ready[(at - 1) / 2] > index)
+    {
+        dag->ready[at] = dag->ready[(at - 1) / 2];
+        at = (at - 1) / 2;
+    }
+    dag->ready[at] = index;
+}
+
+// Takes the earliest released item in plan order.
+static bool maip_dag_take(maip_dag_t *dag, size_t *index)
+{
+    if (dag->ready_count == 0)
+        return false;
+    *index = dag->ready[0];
+
+    size_t last = dag->ready[--dag->ready_count];
+    size_t at = 0;
+    for (;;)
+    {
+        size_t child = at * 2 + 1;
+        if (child >= dag->ready_count)
+            break;
+        if (child + 1 < dag->ready_count && dag->ready[child + 1] < dag->ready[child])
+            child++;
+        if (last <= dag->ready[child])
+            break;
+        dag->ready[at] = dag->ready[child];
+        at = child;
+    }
+    if (dag->ready_count)
+        dag->ready[at] = last;
+    return true;
+}
+
+static int maip_dag_init(maip_dag_t *dag, const fossil_maip_engine_t *engine, const maip_plan_t *plan)
+{
+    const fossil_maip_graph_t *graph = engine->graph;
+    size_t count = plan->count ? plan->count : 1;
+
+    maip_sys_memory_set(dag, 0, sizeof(*dag));
+    dag->graph = graph;
+    dag->plan = plan;
+    dag->item_of = maip_sys_memory_alloc((graph->node_count ? graph->node_count : 1) * sizeof(*dag->item_of));
+    dag->node_of = maip_sys_memory_alloc(count * sizeof(*dag->node_of));
+    dag->waiting = maip_sys_memory_calloc(count, sizeof(*dag->waiting));
+    dag->blocker = maip_sys_memory_alloc(count * sizeof(*dag->blocker));
+    dag->ready = maip_sys_memory_alloc(count * sizeof(*dag->ready));
+    dag->cascade = maip_sys_memory_alloc(count * sizeof(*dag->cascade));
+    if (!dag->item_of || !dag->node_of || !dag->waiting || !dag->blocker || !dag->ready || !dag->cascade)
+    {
+        maip_dag_free(dag);
+        return FOSSIL_MAIP_FAILURE;
+    }
+
+    for (size_t node = 0; node < graph->node_count; ++node)
+        dag->item_of[node] = SIZE_MAX;
+    for (size_t i = 0; i < plan->count; ++i)
+    {
+        const maip_plan_item_t *item = &plan->items[i];
+        size_t node = maip_graph_find(graph, (size_t)(item->suite - engine->suites),
+                                      item->test_case->name ? item->test_case->name : "");
+        dag->node_of[i] = node;
+        dag->blocker[i] = SIZE_MAX;
+        if (node != SIZE_MAX)
+            dag->item_of[node] = i;
+    }
+
+    for (size_t i = 0; i < plan->count; ++i)
+    {
+        size_t node = dag->node_of[i];
+        for (size_t e = node == SIZE_MAX ? 0 : graph->needs_start[node]; node != SIZE_MAX && e < graph->needs_start[node + 1]; ++e)
+        {
+            if (dag->item_of[graph->needs[e]] != SIZE_MAX)
+                dag->waiting[i]++;
+        }
+        if (dag->waiting[i] == 0)
+            maip_dag_push(dag, i);
+    }
+    dag->unfinished = plan->count;
+    return FOSSIL_MAIP_SUCCESS;
+}
+
+// Records that plan item index finished in state, releasing its dependents or
+// skipping them (and theirs) when it did not pass. Returns true when a skipped
+// dependent asks --fail-fast to stop the run.
+static bool maip_dag_finish(maip_dag_t *dag, const fossil_maip_engine_t *engine, size_t index, fossil_maip_state_t state)
+{
+    const fossil_maip_graph_t *graph = dag->graph;
+    bool stop = false;
+    bool met = state == FOSSIL_MAIP_CASE_PASS || state == FOSSIL_MAIP_CASE_EMPTY;
+    size_t pending = 0;
+
+    dag->cascade[pending++] = index;
+    while (pending > 0)
+    {
+        size_t done = dag->cascade[--pending];
+        size_t node = dag->node_of[done];
+        dag->unfinished--;
+        if (node == SIZE_MAX)
+            continue;
+
+        for (size_t e = graph->feeds_start[node]; e < graph->feeds_start[node + 1]; ++e)
+        {
+            size_t next = dag->item_of[graph->feeds[e]];
+            if (next == SIZE_MAX)
+                continue;
+            if ((!met || done != index) && dag->blocker[next] == SIZE_MAX)
+                dag->blocker[next] = done;
+            if (--dag->waiting[next] > 0)
+                continue;
+
+            if (dag->blocker[next] == SIZE_MAX)
             {
-                maip_io_printf("  {blue}├─{reset} {cyan}%s{reset} {blue}[test case]{reset}\n", test_case->name);
-                maip_io_printf("  {blue}│   ├─{reset} {cyan}Tags    {reset}: {gray}%s{reset} {orange}[with tag]{reset}\n", test_case->tags);
-                maip_io_printf("  {blue}│   ├─{reset} {cyan}Criteria{reset}: {gray}%s{reset} {orange}[given criteria]{reset}\n", test_case->criteria);
-                maip_io_printf("  {blue}│   ├─{reset} {cyan}Time    {reset}: {gray}%s{reset} {orange}[the time]{reset}\n", fossil_maip_format_ns(test_case->elapsed_ns));
-                maip_io_printf("  {blue}│   └─{reset} {cyan}Result  {reset}: {gray}%s{reset} {orange}[the result]{reset}\n", result_str);
+                maip_dag_push(dag, next);
+                continue;
             }
-            else if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "ci") == 0)
+
+            // Never runs: say which prerequisite held it back
+            const maip_plan_item_t *item = &dag->plan->items[next];
+            const maip_plan_item_t *cause = &dag->plan->items[dag->blocker[next]];
+            char reason[256];
+            snprintf(reason, sizeof(reason), "prerequisite %s.%s did not pass", cause->suite->name, cause->test_case->name);
+            fossil_maip_case_note(item->test_case, reason, NULL);
+            if (maip_plan_merge(engine, item, FOSSIL_MAIP_CASE_SKIPPED, 0))
+                stop = true;
+            dag->cascade[pending++] = next;
+        }
+    }
+    return stop;
+}
+
+// --- Parallel Execution (run --jobs) ---
+
+#if !defined(_WIN32)
+
+#define FOSSIL_MAIP_POOL_DEPTH 2 // Work items kept in flight per worker
+
+typedef struct
+{
+    pid_t pid;
+    int cmd_fd; // parent -> worker: plan indices
+    int res_fd; // worker -> parent: result records
+    size_t inflight[FOSSIL_MAIP_POOL_DEPTH];
+    size_t inflight_count;
+} maip_worker_t;
+
+// Worker loop: runs the plan items it is handed until the command pipe closes.
+// Suite setup runs the first time a worker meets a suite, teardown on exit.
+static void maip_worker_main(const fossil_maip_engine_t *engine, const maip_plan_t *plan, int cmd_fd, int res_fd)
+{
+    bool *ready = maip_sys_memory_calloc(engine->count ? engine->count : 1, sizeof(bool));
+    uint32_t index;
+
+    while (maip_read_full(cmd_fd, &index, sizeof(index)) == 1 && index < plan->count)
+    {
+        const maip_plan_item_t *item = &plan->items[index];
+        size_t suite_index = (size_t)(item->suite - engine->suites);
+
+        if (ready && !ready[suite_index])
+        {
+            ready[suite_index] = true;
+            if (item->suite->setup)
+                item->suite->setup();
+        }
+
+        if (engine->pallet.run.isolate)
+            maip_isolate_case(engine, item->suite, item->test_case);
+        else
+            fossil_maip_execute_case(engine, item->suite, item->test_case);
+        fflush(stdout);
+
+        if (maip_wire_send(res_fd, index, item->test_case) != FOSSIL_MAIP_SUCCESS)
+            break;
+    }
+
+    for (size_t i = 0; ready && i < engine->count; ++i)
+    {
+        if (ready[i] && engine->suites[i].teardown)
+            engine->suites[i].teardown();
+    }
+
+    fflush(stdout);
+    maip_site_release();
+    _exit(EXIT_SUCCESS);
+}
+
+static int maip_pool_spawn(const fossil_maip_engine_t *engine, const maip_plan_t *plan,
+                           maip_worker_t *workers, size_t worker_count, size_t slot)
+{
+    int cmd[2], res[2];
+    if (pipe(cmd) != 0)
+        return FOSSIL_MAIP_FAILURE;
+    if (pipe(res) != 0)
+    {
+        close(cmd[0]);
+        close(cmd[1]);
+        return FOSSIL_MAIP_FAILURE;
+    }
+
+    fflush(stdout); // Do not let the child inherit pending output
+    pid_t pid = fork();
+    if (pid < 0)
+    {
+        close(cmd[0]);
+        close(cmd[1]);
+        close(res[0]);
+        close(res[1]);
+        return FOSSIL_MAIP_FAILURE;
+    }
+
+    if (pid == 0)
+    {
+        maip_watch_after_fork();
+        maip_site_after_fork();
+
+        // Drop the pipe ends of sibling workers so their EOFs stay observable.
+        for (size_t i = 0; i < worker_count; ++i)
+        {
+            if (i != slot && workers[i].pid > 0)
             {
-                maip_io_printf("  {blue}::TEST       :: %s{reset}\n", test_case->name);
-                maip_io_printf("    {blue}::TAGS     :: %s{reset}\n", test_case->tags);
-                maip_io_printf("    {blue}::CRITERIA :: %s{reset}\n", test_case->criteria);
-                maip_io_printf("    {blue}::TIME     :: %s{reset}\n", fossil_maip_format_ns(test_case->elapsed_ns));
-                maip_io_printf("    {blue}::RESULT   :: %s{reset}\n", result_str);
-            }
-            else
-            { // plain or default
-                maip_io_printf("  {blue}├─{reset} {cyan}%s{reset}\n", test_case->name);
-                maip_io_printf("  {blue}│   ├─{reset} {cyan}Tags    {reset}: {gray}%s{reset}\n", test_case->tags);
-                maip_io_printf("  {blue}│   ├─{reset} {cyan}Criteria{reset}: {gray}%s{reset}\n", test_case->criteria);
-                maip_io_printf("  {blue}│   ├─{reset} {cyan}Time    {reset}: {gray}%s{reset}\n", fossil_maip_format_ns(test_case->elapsed_ns));
-                maip_io_printf("  {blue}│   └─{reset} {cyan}Result  {reset}: {gray}%s{reset}\n", result_str);
+                close(workers[i].cmd_fd);
+                close(workers[i].res_fd);
             }
+        }
+        close(cmd[1]);
+        close(res[0]);
+        maip_worker_main(engine, plan, cmd[0], res[1]);
+    }
+
+    close(cmd[0]);
+    close(res[1]);
+    workers[slot].pid = pid;
+    workers[slot].cmd_fd = cmd[1];
+    workers[slot].res_fd = res[0];
+    workers[slot].inflight_count = 0;
+    return FOSSIL_MAIP_SUCCESS;
+}
+
+static void maip_pool_retire(maip_worker_t *worker)
+{
+    if (worker->pid <= 0)
+        return;
+
+    close(worker->cmd_fd);
+    close(worker->res_fd);
+    while (waitpid(worker->pid, NULL, 0) < 0 && errno == EINTR)
+    {
+    }
+    worker->pid = 0;
+}
+
+// Where the pool takes work from: the plan front to back, or the items a
+// dependency order has released so far.
+typedef struct
+{
+    size_t next;
+    maip_dag_t *dag; // NULL when no case has prerequisites
+} maip_feed_t;
+
+static bool maip_feed_take(maip_feed_t *feed, const maip_plan_t *plan, size_t *index)
+{
+    if (feed->dag)
+        return maip_dag_take(feed->dag, index);
+    if (feed->next >= plan->count)
+        return false;
+    *index = feed->next++;
+    return true;
+}
+
+// Nothing to hand out right now; with a dependency order, in-flight items may
+// still release more.
+static bool maip_feed_empty(const maip_feed_t *feed, const maip_plan_t *plan)
+{
+    return feed->dag ? feed->dag->ready_count == 0 : feed->next >= plan->count;
+}
+
+static void maip_feed_return(maip_feed_t *feed, size_t index)
+{
+    if (feed->dag)
+        maip_dag_push(feed->dag, index);
+    else
+        feed->next--;
+}
+
+// Records a merged result in the engine and the dependency order. Returns true
+// when --fail-fast asks the run to stop handing out work.
+static bool maip_feed_merge(maip_feed_t *feed, const fossil_maip_engine_t *engine, const maip_plan_t *plan,
+                            size_t index, fossil_maip_state_t state, uint64_t elapsed_ns)
+{
+    bool stop = maip_plan_merge(engine, &plan->items[index], state, elapsed_ns);
+    if (feed->dag && maip_dag_finish(feed->dag, engine, index, state))
+        stop = true;
+    return stop;
+}
+
+static void maip_pool_dispatch(const fossil_maip_engine_t *engine, const maip_plan_t *plan,
+                               maip_worker_t *worker, maip_feed_t *feed, bool *stop)
+{
+    size_t index;
+    while (!*stop && worker->pid > 0 && worker->inflight_count < FOSSIL_MAIP_POOL_DEPTH &&
+           maip_feed_take(feed, plan, &index))
+    {
+        const maip_plan_item_t *item = &plan->items[index];
+
+        if (!fossil_maip_run_gate(engine, item->test_case, item->suite))
+        {
+            if (item->test_case->state == FOSSIL_MAIP_CASE_SKIPPED)
+                fossil_maip_show_cases(item->suite, item->test_case, engine);
+            if (feed->dag && maip_dag_finish(feed->dag, engine, index, item->test_case->state))
+                *stop = true;
+            continue;
+        }
+
+        uint32_t wire_index = (uint32_t)index;
+        if (maip_write_full(worker->cmd_fd, &wire_index, sizeof(wire_index)) != FOSSIL_MAIP_SUCCESS)
+        {
+            maip_feed_return(feed, index); // Hand the item to whoever replaces this worker
+            return;
+        }
+        worker->inflight[worker->inflight_count++] = index;
+    }
+}
+
+static int maip_pool_run(const fossil_maip_engine_t *engine, const maip_plan_t *plan, maip_dag_t *dag, size_t jobs)
+{
+    size_t worker_count = jobs < plan->count ? jobs : plan->count;
+    if (worker_count == 0)
+        return FOSSIL_MAIP_SUCCESS;
+
+    maip_worker_t *workers = maip_sys_memory_calloc(worker_count, sizeof(*workers));
+    struct pollfd *fds = maip_sys_memory_calloc(worker_count, sizeof(*fds));
+    size_t *slots = maip_sys_memory_calloc(worker_count, sizeof(*slots));
+    if (!workers || !fds || !slots)
+    {
+        maip_sys_memory_free(workers);
+        maip_sys_memory_free(fds);
+        maip_sys_memory_free(slots);
+        return FOSSIL_MAIP_FAILURE;
+    }
+
+    // A worker that dies leaves its pipes broken; writes must fail, not kill us.
+    struct sigaction ignore, previous;
+    maip_sys_memory_set(&ignore, 0, sizeof(ignore));
+    ignore.sa_handler = SIG_IGN;
+    sigemptyset(&ignore.sa_mask);
+    sigaction(SIGPIPE, &ignore, &previous);
+
+    maip_feed_t feed = {0, dag};
+    bool stop = false;
+
+    for (size_t i = 0; i < worker_count; ++i)
+    {
+        if (maip_pool_spawn(engine, plan, workers, worker_count, i) != FOSSIL_MAIP_SUCCESS)
             break;
-        case MAIP_THEME_MAGA:
-            if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "doge") == 0)
+        maip_pool_dispatch(engine, plan, &workers[i], &feed, &stop);
+    }
+
+    for (;;)
+    {
+        size_t watched = 0;
+        for (size_t i = 0; i < worker_count; ++i)
+        {
+            if (workers[i].pid > 0 && workers[i].inflight_count > 0)
             {
-                maip_io_printf("  {blue}├─{reset} {white}%s{reset} {red}[test case]{reset}\n", test_case->name);
-                maip_io_printf("  {blue}│   ├─{reset} {white}Tags    {reset}: {blue}%s{reset} {white}[with tag]{reset}\n", test_case->tags);
-                maip_io_printf("  {blue}│   ├─{reset} {red}Criteria{reset}: {blue}%s{reset} {red}[given criteria]{reset}\n", test_case->criteria);
-                maip_io_printf("  {blue}│   ├─{reset} {white}Time    {reset}: {blue}%s{reset} {white}[the time]{reset}\n", fossil_maip_format_ns(test_case->elapsed_ns));
-                maip_io_printf("  {blue}│   └─{reset} {red}Result  {reset}: {blue}%s{reset} {red}[the result]{reset}\n", result_str);
+                fds[watched].fd = workers[i].res_fd;
+                fds[watched].events = POLLIN;
+                fds[watched].revents = 0;
+                slots[watched++] = i;
             }
-            else if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "ci") == 0)
+        }
+
+        if (watched == 0)
+        {
+            // Nothing in flight: either done, or every worker is gone.
+            if (stop || maip_feed_empty(&feed, plan))
+                break;
+
+            bool spawned = false;
+            for (size_t i = 0; i < worker_count && !spawned; ++i)
             {
-                maip_io_printf("  {blue}::TEST       :: %s{reset}\n", test_case->name);
-                maip_io_printf("    {blue}::TAGS     :: {white}%s{reset}\n", test_case->tags);
-                maip_io_printf("    {blue}::CRITERIA :: {red}%s{reset}\n", test_case->criteria);
-                maip_io_printf("    {blue}::TIME     :: {white}%s{reset}\n", fossil_maip_format_ns(test_case->elapsed_ns));
-                maip_io_printf("    {blue}::RESULT   :: {red}%s{reset}\n", result_str);
-            }
-            else
-            { // plain or default
-                maip_io_printf("  {blue}├─{reset} {white}%s{reset}\n", test_case->name);
-                maip_io_printf("  {blue}│   ├─{reset} {white}Tags    {reset}: {blue}%s{reset}\n", test_case->tags);
-                maip_io_printf("  {blue}│   ├─{reset} {red}Criteria{reset}: {blue}%s{reset}\n", test_case->criteria);
-                maip_io_printf("  {blue}│   ├─{reset} {white}Time    {reset}: {blue}%s{reset}\n", fossil_maip_format_ns(test_case->elapsed_ns));
-                maip_io_printf("  {blue}│   └─{reset} {red}Result  {reset}: {blue}%s{reset}\n", result_str);
+                if (workers[i].pid <= 0 && maip_pool_spawn(engine, plan, workers, worker_count, i) == FOSSIL_MAIP_SUCCESS)
+                {
+                    maip_pool_dispatch(engine, plan, &workers[i], &feed, &stop);
+                    spawned = true;
+                }
             }
+            if (!spawned)
+                break;
+            continue;
+        }
+
+        if (poll(fds, (nfds_t)watched, -1) < 0)
+        {
+            if (errno == EINTR)
+                continue;
             break;
-        case MAIP_THEME_MINT:
-            if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "doge") == 0)
+        }
+
+        for (size_t k = 0; k < watched; ++k)
+        {
+            if (!fds[k].revents)
+                continue;
+
+            maip_worker_t *worker = &workers[slots[k]];
+            maip_wire_result_t result;
+            maip_wire_text_t text;
+
+            if (maip_wire_recv(worker->res_fd, &result, &text) == 1 &&
+                worker->inflight_count > 0 && result.index == worker->inflight[0])
             {
-                maip_io_printf("  {green}├─{white}%s{reset} {green}[test case]{reset}\n", test_case->name);
-                maip_io_printf("  {green}│   ├─{white}Tags    {reset}: {green}%s{white}[with tag]{reset}\n", test_case->tags);
-                maip_io_printf("  {green}│   ├─{white}Criteria{reset}: {green}%s{white}[given criteria]{reset}\n", test_case->criteria);
-                maip_io_printf("  {green}│   ├─{white}Time    {reset}: {green}%s{white}[the time]{reset}\n", fossil_maip_format_ns(test_case->elapsed_ns));
-                maip_io_printf("  {green}│   └─{white}Result  {reset}: {green}%s{white}[the result]{reset}\n", result_str);
+                worker->inflight_count--;
+                memmove(worker->inflight, worker->inflight + 1, worker->inflight_count * sizeof(worker->inflight[0]));
+
+                maip_wire_apply(&result, &text, plan->items[result.index].test_case);
+                if (maip_feed_merge(&feed, engine, plan, result.index, (fossil_maip_state_t)result.state, result.elapsed_ns))
+                    stop = true;
+                maip_pool_dispatch(engine, plan, worker, &feed, &stop);
+                continue;
             }
-            else if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "ci") == 0)
+
+            // The worker died mid-case: charge what it held and start a replacement.
+            for (size_t j = 0; j < worker->inflight_count; ++j)
             {
-                maip_io_printf("  {green}::{white}TEST       :: %s{reset}\n", test_case->name);
-                maip_io_printf("    {green}::{white}TAGS     :: %s{reset}\n", test_case->tags);
-                maip_io_printf("    {green}::{white}CRITERIA :: %s{reset}\n", test_case->criteria);
-                maip_io_printf("    {green}::{white}TIME     :: %s{reset}\n", fossil_maip_format_ns(test_case->elapsed_ns));
-                maip_io_printf("    {green}::{white}RESULT   :: %s{reset}\n", result_str);
+                if (maip_feed_merge(&feed, engine, plan, worker->inflight[j], FOSSIL_MAIP_CASE_UNEXPECTED, 0))
+                    stop = true;
             }
-            else
-            { // plain or default
-                maip_io_printf("  {green}├─{bright_green}%s{reset}\n", test_case->name);
-                maip_io_printf("  {green}│   ├─{white}Tags    {reset}: {green}%s{white}[with tag]{reset}\n", test_case->tags);
-                maip_io_printf("  {green}│   ├─{white}Criteria{reset}: {green}%s{white}[given criteria]{reset}\n", test_case->criteria);
-                maip_io_printf("  {green}│   ├─{white}Time    {reset}: {green}%s{white}[the time]{reset}\n", fossil_maip_format_ns(test_case->elapsed_ns));
-                maip_io_printf("  {green}│   └─{white}Result  {reset}: {green}%s{white}[the result]{reset}\n", result_str);
+            worker->inflight_count = 0;
+            maip_pool_retire(worker);
+
+            if (!stop && !maip_feed_empty(&feed, plan) &&
+                maip_pool_spawn(engine, plan, workers, worker_count, slots[k]) == FOSSIL_MAIP_SUCCESS)
+            {
+                maip_pool_dispatch(engine, plan, worker, &feed, &stop);
             }
+        }
+
+        // A result may have released items beyond what its own worker can take
+        for (size_t i = 0; dag && i < worker_count; ++i)
+            maip_pool_dispatch(engine, plan, &workers[i], &feed, &stop);
+    }
+
+    for (size_t i = 0; i < worker_count; ++i)
+        maip_pool_retire(&workers[i]);
+
+    sigaction(SIGPIPE, &previous, NULL);
+
+    maip_sys_memory_free(workers);
+    maip_sys_memory_free(fds);
+    maip_sys_memory_free(slots);
+    return FOSSIL_MAIP_SUCCESS;
+}
+
+#endif
+
+// --- Parallel Execution (run --threads) ---
+
+#if !defined(_WIN32)
+
+// Work-stealing deque over a fixed slice of the plan. All work is known before
+// the pool starts, so the owner only pops from the bottom and thieves only take
+// from the top; the slot array itself is never written while the pool runs.
+typedef struct
+{
+    atomic_size_t top;
+    atomic_size_t bottom;
+    const size_t *slots;
+} maip_deque_t;
+
+typedef enum
+{
+    MAIP_STEAL_EMPTY,
+    MAIP_STEAL_LOST,
+    MAIP_STEAL_TAKEN
+} maip_steal_t;
+
+struct maip_thread_pool;
+
+typedef struct
+{
+    pthread_t thread;
+    size_t id;
+    maip_deque_t deque;
+    struct maip_thread_pool *pool;
+} maip_runner_thread_t;
+
+typedef struct maip_thread_pool
+{
+    const fossil_maip_engine_t *engine;
+    const maip_plan_t *plan;
+    maip_runner_thread_t *threads;
+    size_t thread_count;
+    atomic_bool stop;
+} maip_thread_pool_t;
+
+static bool maip_deque_pop(maip_deque_t *deque, size_t *out)
+{
+    size_t bottom = atomic_load(&deque->bottom);
+    size_t top = atomic_load(&deque->top);
+    if (top >= bottom)
+        return false;
+
+    bottom--;
+    atomic_store(&deque->bottom, bottom);
+    atomic_thread_fence(memory_order_seq_cst);
+    top = atomic_load(&deque->top);
+
+    if (top < bottom)
+    {
+        *out = deque->slots[bottom];
+        return true;
+    }
+
+    // Last item (or none left): race the thieves for it through top.
+    bool taken = false;
+    if (top == bottom)
+    {
+        taken = atomic_compare_exchange_strong(&deque->top, &top, top + 1);
+        *out = deque->slots[bottom];
+    }
+    atomic_store(&deque->bottom, bottom + 1);
+    return taken;
+}
+
+static maip_steal_t maip_deque_steal(maip_deque_t *deque, size_t *out)
+{
+    size_t top = atomic_load(&deque->top);
+    atomic_thread_fence(memory_order_seq_cst);
+    size_t bottom = atomic_load(&deque->bottom);
+
+    if (top >= bottom)
+        return MAIP_STEAL_EMPTY;
+
+    size_t slot = deque->slots[top];
+    if (!atomic_compare_exchange_strong(&deque->top, &top, top + 1))
+        return MAIP_STEAL_LOST;
+
+    *out = slot;
+    return MAIP_STEAL_TAKEN;
+}
+
+static bool maip_thread_next(maip_runner_thread_t *self, size_t *out)
+{
+    if (maip_deque_pop(&self->deque, out))
+        return true;
+
+    // Own slice drained: steal from siblings until every deque reports empty.
+    maip_thread_pool_t *pool = self->pool;
+    for (;;)
+    {
+        bool contended = false;
+        for (size_t k = 1; k < pool->thread_count; ++k)
+        {
+            maip_runner_thread_t *victim = &pool->threads[(self->id + k) % pool->thread_count];
+            maip_steal_t result = maip_deque_steal(&victim->deque, out);
+            if (result == MAIP_STEAL_TAKEN)
+                return true;
+            if (result == MAIP_STEAL_LOST)
+                contended = true;
+        }
+        if (!contended)
+            return false;
+    }
+}
+
+static void *maip_thread_main(void *arg)
+{
+    maip_runner_thread_t *self = (maip_runner_thread_t *)arg;
+    maip_thread_pool_t *pool = self->pool;
+    size_t index;
+
+    while (!atomic_load(&pool->stop) && maip_thread_next(self, &index))
+    {
+        const maip_plan_item_t *item = &pool->plan->items[index];
+
+        maip_gate_enter();
+        maip_io_lock();
+        bool selected = fossil_maip_run_gate(pool->engine, item->test_case, item->suite);
+        if (!selected && item->test_case->state == FOSSIL_MAIP_CASE_SKIPPED)
+            fossil_maip_show_cases(item->suite, item->test_case, pool->engine);
+        maip_io_unlock();
+
+        if (selected)
+        {
+            fossil_maip_execute_case(pool->engine, item->suite, item->test_case);
+
+            maip_io_lock();
+            if (maip_plan_merge(pool->engine, item, item->test_case->state, item->test_case->elapsed_ns))
+                atomic_store(&pool->stop, true);
+            maip_io_unlock();
+        }
+        maip_gate_leave();
+    }
+
+    maip_watch_release();
+    maip_crash_release();
+    maip_site_release();
+    return NULL;
+}
+
+static int maip_thread_pool_run(const fossil_maip_engine_t *engine, const maip_plan_t *plan, size_t thread_count)
+{
+    if (thread_count == 0)
+        thread_count = 1; // A pallet without run options still has one runner
+    if (thread_count > plan->count)
+        thread_count = plan->count;
+    if (thread_count == 0)
+        return FOSSIL_MAIP_SUCCESS;
+
+    maip_thread_pool_t pool;
+    pool.engine = engine;
+    pool.plan = plan;
+    pool.thread_count = thread_count;
+    atomic_init(&pool.stop, false);
+
+    pool.threads = maip_sys_memory_calloc(thread_count, sizeof(*pool.threads));
+    size_t *slots = maip_sys_memory_alloc(plan->count * sizeof(*slots));
+    bool *ready = maip_sys_memory_calloc(engine->count ? engine->count : 1, sizeof(bool));
+    if (!pool.threads || !slots || !ready)
+    {
+        maip_sys_memory_free(pool.threads);
+        maip_sys_memory_free(slots);
+        maip_sys_memory_free(ready);
+        return FOSSIL_MAIP_FAILURE;
+    }
+
+    maip_plan_setup(engine, plan, ready);
+
+    // Deal the plan round-robin so every thread starts on its own work. Owners
+    // pop from the bottom, so each slice is stored in reverse: threads then run
+    // the plan front to back together (longest cases first after LPT ordering).
+    size_t share = plan->count / thread_count;
+    size_t extra = plan->count % thread_count;
+    size_t begin = 0;
+    for (size_t i = 0; i < thread_count; ++i)
+    {
+        size_t length = share + (i < extra ? 1 : 0);
+        for (size_t k = 0; k < length; ++k)
+            slots[begin + length - 1 - k] = i + k * thread_count;
+
+        pool.threads[i].id = i;
+        pool.threads[i].pool = &pool;
+        pool.threads[i].deque.slots = slots;
+        atomic_init(&pool.threads[i].deque.top, begin);
+        atomic_init(&pool.threads[i].deque.bottom, begin + length);
+        begin += length;
+    }
+
+    // The calling thread works as runner zero.
+    size_t started = 1;
+    for (; started < thread_count; ++started)
+    {
+        if (pthread_create(&pool.threads[started].thread, NULL, maip_thread_main, &pool.threads[started]) != 0)
             break;
-        default:
-            maip_io_printf("- %s (Tags: %s, Criteria: %s, Time: %s, Result: %s)\n",
-                            test_case->name, test_case->tags, test_case->criteria, fossil_maip_format_ns(test_case->elapsed_ns), result_str);
+    }
+    maip_thread_main(&pool.threads[0]);
+
+    // Runners that failed to start leave their slices to be stolen by runner zero.
+    if (started < thread_count)
+        maip_thread_main(&pool.threads[0]);
+
+    for (size_t i = 1; i < started; ++i)
+        pthread_join(pool.threads[i].thread, NULL);
+
+    maip_plan_teardown(engine, ready);
+
+    maip_sys_memory_free(pool.threads);
+    maip_sys_memory_free(slots);
+    maip_sys_memory_free(ready);
+    return FOSSIL_MAIP_SUCCESS;
+}
+
+#endif
+
+// --- Dependency Order Runner ---
+// Runs a plan with prerequisites on --threads runner threads (the calling
+// thread alone without --threads, or under --isolate). Runners share the
+// released items under one lock, and wait for more while a prerequisite of
+// everything left is still running.
+typedef struct
+{
+    const fossil_maip_engine_t *engine;
+    maip_dag_t *dag;
+    size_t running; // Items taken and not yet finished
+    bool stop;
+#if !defined(_WIN32)
+    pthread_mutex_t lock;
+    pthread_cond_t released;
+#endif
+} maip_dag_pool_t;
+
+#if !defined(_WIN32)
+#define maip_dag_lock(pool) pthread_mutex_lock(&(pool)->lock)
+#define maip_dag_unlock(pool) pthread_mutex_unlock(&(pool)->lock)
+#define maip_dag_wait(pool) pthread_cond_wait(&(pool)->released, &(pool)->lock)
+#define maip_dag_wake(pool) pthread_cond_broadcast(&(pool)->released)
+#else
+#define maip_dag_lock(pool) ((void)(pool))
+#define maip_dag_unlock(pool) ((void)(pool))
+#define maip_dag_wait(pool) ((void)(pool))
+#define maip_dag_wake(pool) ((void)(pool))
+#endif
+
+static void *maip_dag_main(void *arg)
+{
+    maip_dag_pool_t *pool = (maip_dag_pool_t *)arg;
+    const fossil_maip_engine_t *engine = pool->engine;
+    maip_dag_t *dag = pool->dag;
+    size_t index;
+
+    maip_dag_lock(pool);
+    while (!pool->stop && dag->unfinished > 0)
+    {
+        if (!maip_dag_take(dag, &index))
+        {
+            if (pool->running == 0)
+                break; // Nothing left that could release more
+            maip_dag_wait(pool);
+            continue;
+        }
+        pool->running++;
+        maip_dag_unlock(pool);
+
+        const maip_plan_item_t *item = &dag->plan->items[index];
+
+        maip_gate_enter();
+        maip_io_lock();
+        bool selected = fossil_maip_run_gate(engine, item->test_case, item->suite);
+        if (!selected && item->test_case->state == FOSSIL_MAIP_CASE_SKIPPED)
+            fossil_maip_show_cases(item->suite, item->test_case, engine);
+        maip_io_unlock();
+
+        if (selected)
+        {
+#if !defined(_WIN32)
+            if (engine->pallet.run.isolate)
+                maip_isolate_case(engine, item->suite, item->test_case);
+            else
+#endif
+                fossil_maip_execute_case(engine, item->suite, item->test_case);
+        }
+
+        maip_dag_lock(pool);
+        maip_io_lock();
+        if (selected && maip_plan_merge(engine, item, item->test_case->state, item->test_case->elapsed_ns))
+            pool->stop = true;
+        if (maip_dag_finish(dag, engine, index, item->test_case->state))
+            pool->stop = true;
+        maip_io_unlock();
+        maip_gate_leave();
+        pool->running--;
+        maip_dag_wake(pool);
+    }
+    maip_dag_wake(pool);
+    maip_dag_unlock(pool);
+
+#if !defined(_WIN32)
+    maip_watch_release();
+    maip_crash_release();
+    maip_site_release();
+#endif
+    return NULL;
+}
+
+static int maip_dag_run(const fossil_maip_engine_t *engine, maip_dag_t *dag, size_t thread_count)
+{
+    const maip_plan_t *plan = dag->plan;
+#if !defined(_WIN32)
+    // Isolated cases are forked, which does not mix with runner threads
+    if (engine->pallet.run.isolate)
+        thread_count = 1;
+#else
+    thread_count = 1;
+#endif
+    if (thread_count == 0)
+        thread_count = 1; // A pallet without run options still has one runner
+    if (thread_count > plan->count)
+        thread_count = plan->count;
+    if (thread_count == 0)
+        return FOSSIL_MAIP_SUCCESS;
+
+    maip_dag_pool_t pool;
+    maip_sys_memory_set(&pool, 0, sizeof(pool));
+    pool.engine = engine;
+    pool.dag = dag;
+
+    bool *ready = maip_sys_memory_calloc(engine->count ? engine->count : 1, sizeof(bool));
+    if (!ready)
+        return FOSSIL_MAIP_FAILURE;
+    maip_plan_setup(engine, plan, ready);
+
+#if !defined(_WIN32)
+    pthread_t *threads = maip_sys_memory_calloc(thread_count, sizeof(*threads));
+    if (!threads)
+        thread_count = 1;
+    pthread_mutex_init(&pool.lock, NULL);
+    pthread_cond_init(&pool.released, NULL);
+
+    // The calling thread works as runner zero.
+    size_t started = 1;
+    for (; started < thread_count; ++started)
+    {
+        if (pthread_create(&threads[started], NULL, maip_dag_main, &pool) != 0)
             break;
+    }
+    maip_dag_main(&pool);
+    for (size_t i = 1; i < started; ++i)
+        pthread_join(threads[i], NULL);
+
+    pthread_cond_destroy(&pool.released);
+    pthread_mutex_destroy(&pool.lock);
+    maip_sys_memory_free(threads);
+#else
+    maip_dag_main(&pool);
+#endif
+
+    maip_plan_teardown(engine, ready);
+    maip_sys_memory_free(ready);
+    return FOSSIL_MAIP_SUCCESS;
+}
+
+// Runs the whole plan across --jobs worker processes or --threads runner
+// threads, or in dependency order, merging every result back into the engine.
+static int fossil_maip_run_parallel(fossil_maip_engine_t *engine)
+{
+#if defined(_WIN32)
+    if (!engine->graph)
+    {
+        for (size_t i = 0; i < engine->count; ++i)
+            fossil_maip_run_suite(engine, &engine->suites[i]);
+        return FOSSIL_MAIP_SUCCESS;
+    }
+#endif
+    maip_plan_t plan = {0};
+    maip_dag_t dag = {0};
+    int status = maip_plan_build(engine, &plan);
+    if (status == FOSSIL_MAIP_SUCCESS && engine->graph)
+        status = maip_dag_init(&dag, engine, &plan);
+
+    if (status == FOSSIL_MAIP_SUCCESS)
+    {
+#if !defined(_WIN32)
+        if (engine->pallet.run.jobs > 1)
+            status = maip_pool_run(engine, &plan, engine->graph ? &dag : NULL, (size_t)engine->pallet.run.jobs);
+        else if (!engine->graph)
+            status = maip_thread_pool_run(engine, &plan, (size_t)engine->pallet.run.threads);
+        else
+#endif
+            status = maip_dag_run(engine, &dag, (size_t)engine->pallet.run.threads);
+    }
+
+    maip_dag_free(&dag);
+    maip_sys_memory_free(plan.items);
+    return status;
+}
+
+// --- Stress Mode (run --until-fail) ---
+
+// --until-fail runs the selected cases over and over until one of them fails,
+// the --repeat cap is reached or the run is interrupted. Everything a case
+// needs is prepared before the loop starts: the loop itself does not print,
+// allocate, show or score anything, takes no locks, and re-arms the watchdog
+// only now and then. With --threads every runner thread hammers the whole
+// selection at once, which also shakes out races between the cases.
+
+// What one runner saw of one case, merged into the case once the loop ends.
+typedef struct
+{
+    uint64_t spent_ns; // Time spent in the case body
+    uint64_t runs;     // Finished runs
+    bool asserted;     // At least one run made an assertion
+} maip_stress_tally_t;
+
+struct maip_stress;
+
+typedef struct
+{
+#if !defined(_WIN32)
+    pthread_t thread;
+#endif
+    size_t id;
+    uint64_t limit;             // Iterations to run, 0 = until a failure
+    uint64_t iterations;        // Completed passes over the selection
+    maip_stress_tally_t *tally; // One per selected case
+    struct maip_stress *stress;
+} maip_stress_runner_t;
+
+typedef struct maip_stress
+{
+    const maip_plan_t *plan;
+    const uint64_t *budgets; // Time budget of each selected case
+#if !defined(_WIN32)
+    atomic_bool stop;
+    pthread_mutex_t lock; // Taken only to record the first failure
+#else
+    bool stop;
+#endif
+    // The first failure, across all runners
+    bool failed;
+    size_t runner;
+    uint64_t iteration;
+    size_t item;
+    fossil_maip_state_t state;
+    uint64_t elapsed_ns;
+    int crash_signal;
+    uintptr_t crash_address;
+    char message[FOSSIL_MAIP_MESSAGE_SIZE];
+    char site[FOSSIL_MAIP_MESSAGE_SIZE];
+    int cause;
+    int op;
+} maip_stress_t;
+
+static volatile sig_atomic_t maip_stress_interrupted = 0;
+
+#if !defined(_WIN32)
+static void maip_stress_on_interrupt(int sig)
+{
+    (void)sig;
+    maip_stress_interrupted = 1;
+}
+#endif
+
+static bool maip_stress_stopped(maip_stress_t *stress)
+{
+    if (maip_stress_interrupted)
+        return true;
+#if !defined(_WIN32)
+    return atomic_load_explicit(&stress->stop, memory_order_relaxed);
+#else
+    return stress->stop;
+#endif
+}
+
+// Keeps the first failure (later ones on other runners are dropped) and stops
+// every runner.
+static void maip_stress_fail(maip_stress_runner_t *self, size_t item,
+                             fossil_maip_state_t state, uint64_t elapsed_ns)
+{
+    maip_stress_t *stress = self->stress;
+    fossil_maip_context_t *ctx = &maip_context;
+
+#if !defined(_WIN32)
+    pthread_mutex_lock(&stress->lock);
+#endif
+    if (!stress->failed)
+    {
+        stress->failed = true;
+        stress->runner = self->id;
+        stress->iteration = self->iterations + 1;
+        stress->item = item;
+        stress->state = state;
+        stress->elapsed_ns = elapsed_ns;
+        stress->crash_signal = state == FOSSIL_MAIP_CASE_UNEXPECTED ? ctx->fault_signal : 0;
+        stress->crash_address = state == FOSSIL_MAIP_CASE_UNEXPECTED ? (uintptr_t)ctx->fault_address : 0;
+        stress->message[0] = '\0';
+        stress->site[0] = '\0';
+        stress->cause = FOSSIL_MAIP_CAUSE_UNKNOWN;
+        stress->op = FOSSIL_MAIP_OP_NONE;
+        if (state == FOSSIL_MAIP_CASE_FAIL)
+        {
+            stress->cause = ctx->fail_cause;
+            stress->op = ctx->fail_op;
+            memcpy(stress->message, ctx->message, sizeof(stress->message));
+            stress->message[sizeof(stress->message) - 1] = '\0';
+            if (ctx->fail_file)
+                snprintf(stress->site, sizeof(stress->site), "%s:%d", ctx->fail_file, ctx->fail_line);
         }
     }
-    else if (maip_io_cstr_compare(mode, "graph") == 0)
+#if !defined(_WIN32)
+    atomic_store(&stress->stop, true);
+    pthread_mutex_unlock(&stress->lock);
+#else
+    stress->stop = true;
+#endif
+}
+
+// Runs one case body under the context jump buffer and returns how it landed.
+// Apart from the loop, so none of the loop's locals live across the jump.
+static int maip_stress_body(fossil_maip_case_t *test_case)
+{
+    fossil_maip_context_t *ctx = &maip_context;
+    int landing = maip_setjmp_nomask(ctx->jump);
+    if (landing == MAIP_JUMP_NONE)
     {
-        switch (engine ? engine->pallet.theme : MAIP_THEME_FOSSIL)
+        ctx->guarded = 1;
+        maip_watch_resume();
+        test_case->run();
+    }
+    maip_watch_hold();
+    ctx->guarded = 0;
+    return landing;
+}
+
+static void maip_stress_loop(maip_stress_runner_t *self)
+{
+    maip_stress_t *stress = self->stress;
+    const maip_plan_t *plan = stress->plan;
+    fossil_maip_context_t *ctx = &maip_context;
+    uint64_t armed_at = 0;
+    uint64_t armed_budget = 0;
+
+#if !defined(_WIN32)
+    sigset_t mask;
+    pthread_sigmask(SIG_SETMASK, NULL, &mask);
+#endif
+    maip_crash_guard();
+
+    while (!maip_stress_stopped(stress) && (!self->limit || self->iterations < self->limit))
+    {
+        for (size_t k = 0; k < plan->count; ++k)
         {
-        case MAIP_THEME_FOSSIL:
-            if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "doge") == 0)
-            {
-                maip_io_printf("{gray}[{cyan}CASE{gray}] {cyan}%s{reset} {blue}[test case]{reset} --[{orange}tags:{reset}{white}%s{reset} {orange}[with tag]{reset},{orange}criteria:{reset}{white}%s{reset} {orange}[given criteria]{reset},{orange}time:{reset}{white}%s{reset} {orange}[the time]{reset},{orange}result:{reset}%s {orange}[the result]{reset}]\n",
-                                test_case->name, test_case->tags, test_case->criteria, fossil_maip_format_ns(test_case->elapsed_ns), result_str);
-            }
-            else if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "ci") == 0)
-            {
-                maip_io_printf("{gray}::{cyan}CASE{gray}:: {cyan}%s{reset} --[{orange}::TAGS::{reset}{white} %s{reset},{orange}::CRITERIA::{reset}{white} %s{reset},{orange}::TIME::{reset}{white} %s{reset},{orange}::RESULT::{reset} %s]\n",
-                                test_case->name, test_case->tags, test_case->criteria, fossil_maip_format_ns(test_case->elapsed_ns), result_str);
-            }
-            else
-            { // plain or default
-                maip_io_printf("{gray}[{cyan}CASE{gray}] {cyan}%s{reset} --[{orange}tags:{reset}{white}%s{reset},{orange}criteria:{reset}{white}%s{reset},{orange}time:{reset}{white}%s{reset},{orange}result:{reset} %s]\n",
-                                test_case->name, test_case->tags, test_case->criteria, fossil_maip_format_ns(test_case->elapsed_ns), result_str);
-            }
-            break;
-        case MAIP_THEME_LIGHT:
-            if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "doge") == 0)
-            {
-                maip_io_printf("{gray}[{cyan}CASE{gray}] {bright_cyan}%s{reset} {bright_blue}[test case]{reset} --[{orange}tags:{reset}{white}%s{reset} {orange}[with tag]{reset},{orange}criteria:{reset}{white}%s{reset} {orange}[given criteria]{reset},{orange}time:{reset}{white}%s{reset} {orange}[the time]{reset},{orange}result:{reset}%s {orange}[the result]{reset}]\n",
-                                test_case->name, test_case->tags, test_case->criteria, fossil_maip_format_ns(test_case->elapsed_ns), result_str);
-            }
-            else if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "ci") == 0)
-            {
-                maip_io_printf("{gray}::{cyan}CASE{gray}:: {bright_cyan}%s{reset} --[{orange}::TAGS::{reset}{white} %s{reset},{orange}::CRITERIA::{reset}{white} %s{reset},{orange}::TIME::{reset}{white} %s{reset},{orange}::RESULT::{reset} %s]\n",
-                                test_case->name, test_case->tags, test_case->criteria, fossil_maip_format_ns(test_case->elapsed_ns), result_str);
-            }
-            else
-            { // plain or default
-                maip_io_printf("{gray}[{cyan}CASE{gray}] {bright_cyan}%s{reset} --[{orange}tags:{reset}{white}%s{reset},{orange}criteria:{reset}{white}%s{reset},{orange}time:{reset}{white}%s{reset},{orange}result:{reset} %s]\n",
-                                test_case->name, test_case->tags, test_case->criteria, fossil_maip_format_ns(test_case->elapsed_ns), result_str);
-            }
-            break;
-        case MAIP_THEME_DARK:
-            if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "doge") == 0)
-            {
-                maip_io_printf("{gray}[{cyan}CASE{gray}] {cyan}%s{reset} {blue}[test case]{reset} --[{orange}tags:{reset}{white}%s{reset} {orange}[with tag]{reset},{orange}criteria:{reset}{white}%s{reset} {orange}[given criteria]{reset},{orange}time:{reset}{white}%s{reset} {orange}[the time]{reset},{orange}result:{reset}%s {orange}[the result]{reset}]\n",
-                                test_case->name, test_case->tags, test_case->criteria, fossil_maip_format_ns(test_case->elapsed_ns), result_str);
-            }
-            else if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "ci") == 0)
-            {
-                maip_io_printf("{gray}::{cyan}CASE{gray}:: {cyan}%s{reset} --[{orange}::TAGS::{reset}{white} %s{reset},{orange}::CRITERIA::{reset}{white} %s{reset},{orange}::TIME::{reset}{white} %s{reset},{orange}::RESULT::{reset} %s]\n",
-                                test_case->name, test_case->tags, test_case->criteria, fossil_maip_format_ns(test_case->elapsed_ns), result_str);
-            }
-            else
-            { // plain or default
-                maip_io_printf("{gray}[{cyan}CASE{gray}] {cyan}%s{reset} --[{orange}tags:{reset}{white}%s{reset},{orange}criteria:{reset}{white}%s{reset},{orange}time:{reset}{white}%s{reset},{orange}result:{reset} %s]\n",
-                                test_case->name, test_case->tags, test_case->criteria, fossil_maip_format_ns(test_case->elapsed_ns), result_str);
-            }
-            break;
-        case MAIP_THEME_MAGA:
-            if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "doge") == 0)
+            fossil_maip_case_t *test_case = plan->items[k].test_case;
+            uint64_t budget_ns = stress->budgets[k];
+            if (!test_case->run)
+                continue;
+
+            if (test_case->setup)
+                test_case->setup();
+
+            ctx->current_case = test_case;
+            ctx->assert_count = 0;
+            ctx->fail_file = NULL;
+            ctx->fail_line = 0;
+            ctx->expect_count = 0;
+            uint64_t start_time = fossil_maip_now_ns();
+
+            // The deadline is armed with half a budget of slack and renewed once
+            // that slack is used up, so a case is interrupted between one and
+            // one and a half budgets after it starts.
+            if (budget_ns != armed_budget || start_time - armed_at > budget_ns / 2)
             {
-                maip_io_printf("{gray}[{red}CASE{gray}] {white}%s{reset} {red}[test case]{reset} --[{red}tags:{reset}{white}%s{reset} {red}[with tag]{reset},{red}criteria:{reset}{white}%s{reset} {red}[given criteria]{reset},{red}time:{reset}{white}%s{reset} {red}[the time]{reset},{red}result:{reset}%s {red}[the result]{reset}]\n",
-                                test_case->name, test_case->tags, test_case->criteria, fossil_maip_format_ns(test_case->elapsed_ns), result_str);
+                maip_watch_arm(budget_ns + budget_ns / 2);
+                armed_at = start_time;
+                armed_budget = budget_ns;
             }
-            else if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "ci") == 0)
+
+            fossil_maip_state_t state = FOSSIL_MAIP_CASE_PASS;
+            uint64_t elapsed = 0;
+            int landing = maip_stress_body(test_case);
+            if (landing == MAIP_JUMP_NONE)
             {
-                maip_io_printf("{gray}::{red}CASE{gray}:: {white}%s{reset} --[{red}::TAGS::{reset}{white} %s{reset},{red}::CRITERIA::{reset}{white} %s{reset},{red}::TIME::{reset}{white} %s{reset},{red}::RESULT::{reset} %s]\n",
-                                test_case->name, test_case->tags, test_case->criteria, fossil_maip_format_ns(test_case->elapsed_ns), result_str);
+                elapsed = maip_time_interval_ns(start_time, fossil_maip_now_ns());
+                self->tally[k].spent_ns += elapsed;
+                self->tally[k].runs++;
+                if (ctx->assert_count)
+                    self->tally[k].asserted = true;
+                if (elapsed > budget_ns)
+                    state = FOSSIL_MAIP_CASE_TIMEOUT;
+                else if (maip_test_expect_report())
+                    state = FOSSIL_MAIP_CASE_FAIL;
             }
             else
-            { // plain or default
-                maip_io_printf("{gray}[{red}CASE{gray}] {white}%s{reset} --[{red}tags:{reset}{white}%s{reset},{red}criteria:{reset}{white}%s{reset},{red}time:{reset}{white}%s{reset},{red}result:{reset} %s]\n",
-                                test_case->name, test_case->tags, test_case->criteria, fossil_maip_format_ns(test_case->elapsed_ns), result_str);
-            }
-            break;
-        case MAIP_THEME_MINT:
-            if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "doge") == 0)
             {
-                maip_io_printf("{gray}[{green}CASE{gray}] {white}%s{reset} {green}[test case]{reset} --[{green}tags:{reset}{bright_green}%s{reset} {green}[with tag]{reset},{green}criteria:{reset}{bright_green}%s{reset} {green}[given criteria]{reset},{green}time:{reset}{bright_green}%s{reset} {green}[the time]{reset},{green}result:{reset}%s {green}[the result]{reset}]\n",
-                                test_case->name, test_case->tags, test_case->criteria, fossil_maip_format_ns(test_case->elapsed_ns), result_str);
+#if !defined(_WIN32)
+                pthread_sigmask(SIG_SETMASK, &mask, NULL);
+#endif
+                maip_test_expect_report();
+                elapsed = maip_time_interval_ns(start_time, fossil_maip_now_ns());
+                if (landing == MAIP_JUMP_CRASH)
+                    state = FOSSIL_MAIP_CASE_UNEXPECTED;
+                else if (landing == MAIP_JUMP_TIMEOUT)
+                    state = FOSSIL_MAIP_CASE_TIMEOUT;
+                else
+                    state = FOSSIL_MAIP_CASE_FAIL;
             }
-            else if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "ci") == 0)
+
+            if (test_case->teardown)
+                test_case->teardown();
+
+            if (state != FOSSIL_MAIP_CASE_PASS)
             {
-                maip_io_printf("{gray}::{green}CASE{gray}:: {white}%s{reset} --[{green}::TAGS::{reset}{bright_green} %s{reset},{green}::CRITERIA::{reset}{bright_green} %s{reset},{green}::TIME::{reset}{bright_green} %s{reset},{green}::RESULT::{reset} %s]\n",
-                                test_case->name, test_case->tags, test_case->criteria, fossil_maip_format_ns(test_case->elapsed_ns), result_str);
+                maip_stress_fail(self, k, state, elapsed);
+                maip_watch_disarm();
+                ctx->current_case = NULL;
+                return;
             }
-            else
-            { // plain or default
-                maip_io_printf("{gray}[{green}CASE{gray}] {white}%s{reset} --[{green}tags:{reset}{bright_green}%s{reset},{green}criteria:{reset}{bright_green}%s{reset},{green}time:{reset}{bright_green}%s{reset},{green}result:{reset} %s]\n",
-                                test_case->name, test_case->tags, test_case->criteria, fossil_maip_format_ns(test_case->elapsed_ns), result_str);
-            }
-            break;
-        default:
-            maip_io_printf("- %s (Tags: %s, Criteria: %s, Time: %s, Result: %s)\n",
-                            test_case->name, test_case->tags, test_case->criteria, fossil_maip_format_ns(test_case->elapsed_ns), result_str);
-            break;
         }
+        self->iterations++;
     }
-    else
-    { // list (default)
-        switch (engine ? engine->pallet.theme : MAIP_THEME_FOSSIL)
+
+    maip_watch_disarm();
+    ctx->current_case = NULL;
+}
+
+#if !defined(_WIN32)
+static void *maip_stress_main(void *arg)
+{
+    maip_stress_loop((maip_stress_runner_t *)arg);
+    maip_watch_release();
+    maip_crash_release();
+    maip_site_release();
+    return NULL;
+}
+#endif
+
+// Prepares the selection, runs the loop on every runner and records one result
+// per case: the failure that stopped the loop, or the average of its passes.
+static int fossil_maip_run_stress(fossil_maip_engine_t *engine)
+{
+    maip_plan_t plan = {0};
+    if (maip_plan_build(engine, &plan) != FOSSIL_MAIP_SUCCESS)
+    {
+        maip_sys_memory_free(plan.items);
+        return FOSSIL_MAIP_FAILURE;
+    }
+
+    // --skip is settled once, up front
+    size_t kept = 0;
+    for (size_t i = 0; i < plan.count; ++i)
+    {
+        if (fossil_maip_run_gate(engine, plan.items[i].test_case, plan.items[i].suite))
+            plan.items[kept++] = plan.items[i];
+        else
+            fossil_maip_show_cases(plan.items[i].suite, plan.items[i].test_case, engine);
+    }
+    plan.count = kept;
+    if (plan.count == 0)
+    {
+        maip_io_printf("{yellow}Until-fail: no cases selected{reset}\n");
+        maip_sys_memory_free(plan.items);
+        return FOSSIL_MAIP_SUCCESS;
+    }
+
+    size_t runner_count = 1;
+#if !defined(_WIN32)
+    if (engine->pallet.run.threads > 1)
+        runner_count = (size_t)engine->pallet.run.threads;
+#endif
+
+    maip_stress_t stress;
+    maip_sys_memory_set(&stress, 0, sizeof(stress));
+    stress.plan = &plan;
+
+    uint64_t *budgets = maip_sys_memory_alloc(plan.count * sizeof(*budgets));
+    maip_stress_runner_t *runners = maip_sys_memory_calloc(runner_count, sizeof(*runners));
+    maip_stress_tally_t *tallies = maip_sys_memory_calloc(runner_count * plan.count, sizeof(*tallies));
+    bool *ready = maip_sys_memory_calloc(engine->count ? engine->count : 1, sizeof(bool));
+    if (!budgets || !runners || !tallies || !ready)
+    {
+        maip_sys_memory_free(budgets);
+        maip_sys_memory_free(runners);
+        maip_sys_memory_free(tallies);
+        maip_sys_memory_free(ready);
+        maip_sys_memory_free(plan.items);
+        return FOSSIL_MAIP_FAILURE;
+    }
+    for (size_t i = 0; i < plan.count; ++i)
+        budgets[i] = fossil_maip_case_budget(engine, plan.items[i].suite, plan.items[i].test_case);
+    stress.budgets = budgets;
+
+    // A --repeat cap is shared out between the runners
+    uint64_t cap = engine->pallet.run.repeat > 1 ? (uint64_t)engine->pallet.run.repeat : 0;
+    for (size_t i = 0; i < runner_count; ++i)
+    {
+        runners[i].id = i;
+        runners[i].stress = &stress;
+        runners[i].tally = tallies + i * plan.count;
+        runners[i].limit = cap ? cap / runner_count + (i < cap % runner_count ? 1 : 0) : 0;
+    }
+
+    // Cases that call rand() see the same sequence when the seed is replayed
+    uint64_t seed = engine->pallet.shuffle.enabled ? engine->pallet.shuffle.seed_value : maip_rand_entropy();
+    srand((unsigned int)seed);
+
+    for (size_t i = 0; i < plan.count; ++i)
+    {
+        size_t suite_index = (size_t)(plan.items[i].suite - engine->suites);
+        if (!ready[suite_index])
         {
-        case MAIP_THEME_FOSSIL:
-            if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "doge") == 0)
-            {
-                maip_io_printf("{gray}[{cyan}CASE{gray}] {cyan}%s{reset} {orange}[test case]{reset} ({orange}Tags:{reset} {white}%s{reset} {orange}[with tag]{reset}, {orange}Criteria:{reset} {white}%s{reset} {orange}[given criteria]{reset}, {orange}Time:{reset} {white}%s{reset} {orange}[the time]{reset}, {orange}Result:{reset} %s {orange}[the result]{reset})\n",
-                                test_case->name, test_case->tags, test_case->criteria, fossil_maip_format_ns(test_case->elapsed_ns), result_str);
-            }
-            else if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "ci") == 0)
-            {
-                maip_io_printf("{gray}::{cyan}CASE{gray}:: {cyan}%s{reset} ( {orange}::TAGS::{reset} {white}%s{reset}, {orange}::CRITERIA::{reset} {white}%s{reset}, {orange}::TIME::{reset} {white}%s{reset}, {orange}::RESULT::{reset} %s )\n",
-                                test_case->name, test_case->tags, test_case->criteria, fossil_maip_format_ns(test_case->elapsed_ns), result_str);
-            }
-            else
-            { // plain or default
-                maip_io_printf("{gray}[{blue}CASE{gray}] {cyan}%s{reset} ({orange}Tags:{reset} {white}%s{reset}, {orange}Criteria:{reset} {white}%s{reset}, {orange}Time:{reset} {white}%s{reset}, {orange}Result:{reset} %s)\n",
-                                test_case->name, test_case->tags, test_case->criteria, fossil_maip_format_ns(test_case->elapsed_ns), result_str);
-            }
-            break;
-        case MAIP_THEME_LIGHT:
-            if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "doge") == 0)
-            {
-                maip_io_printf("{gray}[{bright_blue}CASE{gray}] {cyan}%s{reset} {orange}[test case]{reset} ({orange}Tags:{reset} {white}%s{reset} {orange}[with tag]{reset}, {orange}Criteria:{reset} {white}%s{reset} {orange}[given criteria]{reset}, {orange}Time:{reset} {white}%s{reset} {orange}[the time]{reset}, {orange}Result:{reset} %s {orange}[the result]{reset})\n",
-                                test_case->name, test_case->tags, test_case->criteria, fossil_maip_format_ns(test_case->elapsed_ns), result_str);
-            }
-            else if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "ci") == 0)
-            {
-                maip_io_printf("{gray}::{bright_blue}CASE{gray}:: {cyan}%s{reset} ( {orange}::TAGS::{reset} {white}%s{reset}, {orange}::CRITERIA::{reset} {white}%s{reset}, {orange}::TIME::{reset} {white}%s{reset}, {orange}::RESULT::{reset} %s )\n",
-                                test_case->name, test_case->tags, test_case->criteria, fossil_maip_format_ns(test_case->elapsed_ns), result_str);
-            }
-            else
-            { // plain or default
-                maip_io_printf("{gray}[{bright_blue}CASE{gray}] {cyan}%s{reset} ({orange}Tags:{reset} {white}%s{reset}, {orange}Criteria:{reset} {white}%s{reset}, {orange}Time:{reset} {white}%s{reset}, {orange}Result:{reset} %s)\n",
-                                test_case->name, test_case->tags, test_case->criteria, fossil_maip_format_ns(test_case->elapsed_ns), result_str);
-            }
-            break;
-        case MAIP_THEME_DARK:
-            if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "doge") == 0)
-            {
-                maip_io_printf("{gray}[{blue}CASE{gray}] {cyan}%s{reset} {orange}[test case]{reset} ({orange}Tags:{reset} {white}%s{reset} {orange}[with tag]{reset}, {orange}Criteria:{reset} {white}%s{reset} {orange}[given criteria]{reset}, {orange}Time:{reset} {white}%s{reset} {orange}[the time]{reset}, {orange}Result:{reset} %s {orange}[the result]{reset})\n",
-                                test_case->name, test_case->tags, test_case->criteria, fossil_maip_format_ns(test_case->elapsed_ns), result_str);
-            }
-            else if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "ci") == 0)
-            {
-                maip_io_printf("{gray}::{blue}CASE{gray}:: {cyan}%s{reset} ( {orange}::TAGS::{reset} {white}%s{reset}, {orange}::CRITERIA::{reset} {white}%s{reset}, {orange}::TIME::{reset} {white}%s{reset}, {orange}::RESULT::{reset} %s )\n",
-                                test_case->name, test_case->tags, test_case->criteria, fossil_maip_format_ns(test_case->elapsed_ns), result_str);
-            }
-            else
-            { // plain or default
-                maip_io_printf("{gray}[{blue}CASE{gray}] {cyan}%s{reset} ({orange}Tags:{reset} {white}%s{reset}, {orange}Criteria:{reset} {white}%s{reset}, {orange}Time:{reset} {white}%s{reset}, {orange}Result:{reset} %s)\n",
-                                test_case->name, test_case->tags, test_case->criteria, fossil_maip_format_ns(test_case->elapsed_ns), result_str);
-            }
-            break;
-        case MAIP_THEME_MAGA:
-            if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "doge") == 0)
-            {
-                maip_io_printf("{gray}[{red}CASE{gray}] {white}%s{reset} {red}[test case]{reset} ({red}Tags:{reset} {white}%s{reset} {red}[with tag]{reset}, {red}Criteria:{reset} {white}%s{reset} {red}[given criteria]{reset}, {red}Time:{reset} {white}%s{reset} {red}[the time]{reset}, {red}Result:{reset} %s {red}[the result]{reset})\n",
-                                test_case->name, test_case->tags, test_case->criteria, fossil_maip_format_ns(test_case->elapsed_ns), result_str);
-            }
-            else if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "ci") == 0)
-            {
-                maip_io_printf("{gray}::{red}CASE{gray}:: {white}%s{reset} ( {red}::TAGS::{reset} {white}%s{reset}, {red}::CRITERIA::{reset} {white}%s{reset}, {red}::TIME::{reset} {white}%s{reset}, {red}::RESULT::{reset} %s )\n",
-                                test_case->name, test_case->tags, test_case->criteria, fossil_maip_format_ns(test_case->elapsed_ns), result_str);
-            }
-            else
-            { // plain or default
-                maip_io_printf("{gray}[{red}CASE{gray}] {white}%s{reset} ({red}Tags:{reset} {white}%s{reset}, {red}Criteria:{reset} {white}%s{reset}, {red}Time:{reset} {white}%s{reset}, {red}Result:{reset} %s)\n",
-                                test_case->name, test_case->tags, test_case->criteria, fossil_maip_format_ns(test_case->elapsed_ns), result_str);
-            }
+            ready[suite_index] = true;
+            if (plan.items[i].suite->setup)
+                plan.items[i].suite->setup();
+        }
+    }
+
+    maip_stress_interrupted = 0;
+    uint64_t start_time = fossil_maip_now_ns();
+#if !defined(_WIN32)
+    atomic_init(&stress.stop, false);
+    pthread_mutex_init(&stress.lock, NULL);
+
+    // Ctrl-C ends the loop and still reports
+    struct sigaction action, previous;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = maip_stress_on_interrupt;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGINT, &action, &previous);
+
+    size_t started = 1;
+    for (; started < runner_count; ++started)
+    {
+        if (pthread_create(&runners[started].thread, NULL, maip_stress_main, &runners[started]) != 0)
             break;
-        case MAIP_THEME_MINT:
-            if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "doge") == 0)
-            {
-                maip_io_printf("{gray}[{green}CASE{gray}] {white}%s{reset} {green}[test case]{reset} ({green}Tags:{reset} {white}%s{reset} {green}[with tag]{reset}, {green}Criteria:{reset} {white}%s{reset} {green}[given criteria]{reset}, {green}Time:{reset} {white}%s{reset} {green}[the time]{reset}, {green}Result:{reset} %s {green}[the result]{reset})\n",
-                                test_case->name, test_case->tags, test_case->criteria, fossil_maip_format_ns(test_case->elapsed_ns), result_str);
-            }
-            else if (engine && engine->pallet.show.verbose && maip_io_cstr_compare(engine->pallet.show.verbose, "ci") == 0)
-            {
-                maip_io_printf("{gray}::{green}CASE{gray}:: {white}%s{reset} ( {green}::TAGS::{reset} {white}%s{reset}, {green}::CRITERIA::{reset} {white}%s{reset}, {green}::TIME::{reset} {white}%s{reset}, {green}::RESULT::{reset} %s )\n",
-                                test_case->name, test_case->tags, test_case->criteria, fossil_maip_format_ns(test_case->elapsed_ns), result_str);
-            }
+    }
+    maip_stress_loop(&runners[0]);
+    for (size_t i = 1; i < started; ++i)
+        pthread_join(runners[i].thread, NULL);
+    runner_count = started;
+
+    sigaction(SIGINT, &previous, NULL);
+    pthread_mutex_destroy(&stress.lock);
+#else
+    maip_stress_loop(&runners[0]);
+#endif
+    uint64_t wall_ns = maip_time_interval_ns(start_time, fossil_maip_now_ns());
+
+    for (size_t i = 0; i < engine->count; ++i)
+    {
+        if (ready[i] && engine->suites[i].teardown)
+            engine->suites[i].teardown();
+    }
+
+    // --- One result per case ---
+    uint64_t total = 0;
+    for (size_t r = 0; r < runner_count; ++r)
+        total += runners[r].iterations;
+
+    for (size_t i = 0; i < plan.count; ++i)
+    {
+        fossil_maip_case_t *test_case = plan.items[i].test_case;
+        fossil_maip_suite_t *suite = plan.items[i].suite;
+        maip_stress_tally_t sum = {0, 0, false};
+        for (size_t r = 0; r < runner_count; ++r)
+        {
+            sum.spent_ns += runners[r].tally[i].spent_ns;
+            sum.runs += runners[r].tally[i].runs;
+            sum.asserted = sum.asserted || runners[r].tally[i].asserted;
+        }
+
+        test_case->crash_signal = 0;
+        test_case->crash_address = 0;
+        test_case->cpu_ns = 0;
+        if (stress.failed && stress.item == i)
+        {
+            test_case->state = stress.state;
+            test_case->elapsed_ns = stress.elapsed_ns;
+            test_case->crash_signal = stress.crash_signal;
+            test_case->crash_address = stress.crash_address;
+            fossil_maip_case_note(test_case, stress.message, stress.site);
+            fossil_maip_case_classify(test_case, stress.cause, stress.op);
+        }
+        else
+        {
+            // Cases the loop never reached before it stopped count as skipped
+            if (test_case->run && sum.runs == 0)
+                test_case->state = FOSSIL_MAIP_CASE_SKIPPED;
             else
-            { // plain or default
-                maip_io_printf("{gray}[{green}CASE{gray}] {white}%s{reset} ({green}Tags:{reset} {white}%s{reset}, {green}Criteria:{reset} {white}%s{reset}, {green}Time:{reset} {white}%s{reset}, {green}Result:{reset} %s)\n",
-                                test_case->name, test_case->tags, test_case->criteria, fossil_maip_format_ns(test_case->elapsed_ns), result_str);
-            }
-            break;
-        default:
-            maip_io_printf("- %s (Tags: %s, Criteria: %s, Time: %s, Result: %s)\n",
-                            test_case->name, test_case->tags, test_case->criteria, fossil_maip_format_ns(test_case->elapsed_ns), result_str);
-            break;
+                test_case->state = sum.asserted ? FOSSIL_MAIP_CASE_PASS : FOSSIL_MAIP_CASE_EMPTY;
+            test_case->elapsed_ns = sum.runs ? sum.spent_ns / sum.runs : 0;
+            fossil_maip_case_note(test_case, NULL, NULL);
         }
+
+        suite->time_elapsed_ns += sum.spent_ns;
+        fossil_maip_update_score(test_case, suite);
+        fossil_maip_show_cases(suite, test_case, engine);
+    }
+
+    // --- Report ---
+    double seconds = (double)wall_ns / 1e9;
+    maip_io_printf("{blue}Until-fail: %llu iterations in %.3f s (%.1f iterations/s) on %zu thread%s, seed %llu{reset}\n",
+                   (unsigned long long)total, seconds, seconds > 0.0 ? (double)total / seconds : 0.0,
+                   runner_count, runner_count == 1 ? "" : "s", (unsigned long long)seed);
+    if (stress.failed)
+    {
+        const maip_plan_item_t *item = &plan.items[stress.item];
+        maip_io_printf("{red}Until-fail: first failure on iteration %llu (thread %zu): %s.%s{reset}\n",
+                       (unsigned long long)stress.iteration, stress.runner,
+                       item->suite->name, item->test_case->name);
+    }
+    else
+    {
+        maip_io_printf("{green}Until-fail: no failure (%s){reset}\n",
+                       maip_stress_interrupted ? "interrupted" : "iteration cap reached");
     }
+
+    maip_sys_memory_free(budgets);
+    maip_sys_memory_free(runners);
+    maip_sys_memory_free(tallies);
+    maip_sys_memory_free(ready);
+    maip_sys_memory_free(plan.items);
+    return FOSSIL_MAIP_SUCCESS;
 }
 
-// --- Run One Test ---
+// --- Duration History and Results Database ---
+
+// What earlier runs learned about each case is kept in two files, loaded into
+// one table keyed by suite and case name. Neither is written unless its run
+// option names it, so consumers' working directories stay clean:
+// - the duration history, a small text file with one "<suite> <case> <ns>"
+//   line per case. The value is an exponentially weighted moving average, so
+//   one noisy run only moves it part of the way.
+// - the results database, a binary file with the last outcome of each case,
+//   its duration and where it failed, used by --last-failed/--failed-first.
+#define MAIP_HISTORY_HEADER "fossil-maip-history 1"
+#define MAIP_HISTORY_NAME_SIZE 256
+#define MAIP_HISTORY_WEIGHT 4 // A new sample moves the average by 1/4
+#define MAIP_RESULTS_MAGIC "MAIPRES1"
+#define MAIP_RESULTS_MAGIC_SIZE 8
 
-// Utility function to convert seconds to nanoseconds
-static uint64_t seconds_to_nanoseconds(uint64_t seconds)
+typedef struct
 {
-    return seconds * 1000000000ULL;
+    char *suite;
+    char *name;
+    uint64_t ewma_ns;
+    int32_t state;       // Last recorded outcome (-1 = none)
+    uint64_t elapsed_ns; // Duration of that run
+    char *site;          // "file:line" where it failed, or NULL
+} maip_history_entry_t;
+
+// One results database record, in host byte order; the suite name, case name
+// and failure site follow it without terminators.
+typedef struct
+{
+    uint32_t suite_length;
+    uint32_t name_length;
+    uint32_t site_length;
+    int32_t state;
+    uint64_t elapsed_ns;
+} maip_results_record_t;
+
+typedef struct
+{
+    maip_history_entry_t *entries;
+    size_t count;
+    size_t capacity;
+    size_t *buckets;     // Open addressing on entry index + 1 (0 = empty)
+    size_t bucket_count; // Power of two
+} maip_history_t;
+
+static maip_history_entry_t *maip_history_find(const maip_history_t *history, const char *suite, const char *name)
+{
+    if (!history->bucket_count)
+        return NULL;
+
+    size_t mask = history->bucket_count - 1;
+    for (size_t b = (size_t)fossil_maip_case_hash(suite, name) & mask; history->buckets[b]; b = (b + 1) & mask)
+    {
+        maip_history_entry_t *entry = &history->entries[history->buckets[b] - 1];
+        if (strcmp(entry->suite, suite) == 0 && strcmp(entry->name, name) == 0)
+            return entry;
+    }
+    return NULL;
 }
 
-// from sanity, should be implemented and placed in common.c
-extern uint64_t get_maip_time_microseconds(void);
+static int maip_history_rehash(maip_history_t *history, size_t bucket_count)
+{
+    size_t *buckets = maip_sys_memory_calloc(bucket_count, sizeof(*buckets));
+    if (!buckets)
+        return FOSSIL_MAIP_FAILURE;
 
-void fossil_maip_run_test(const fossil_maip_engine_t *engine,
-                           fossil_maip_case_t *test_case,
-                           fossil_maip_suite_t *suite)
+    for (size_t i = 0; i < history->count; ++i)
+    {
+        const maip_history_entry_t *entry = &history->entries[i];
+        size_t b = (size_t)fossil_maip_case_hash(entry->suite, entry->name) & (bucket_count - 1);
+        while (buckets[b])
+            b = (b + 1) & (bucket_count - 1);
+        buckets[b] = i + 1;
+    }
+
+    maip_sys_memory_free(history->buckets);
+    history->buckets = buckets;
+    history->bucket_count = bucket_count;
+    return FOSSIL_MAIP_SUCCESS;
+}
+
+static maip_history_entry_t *maip_history_insert(maip_history_t *history, const char *suite, const char *name)
 {
-    if (!test_case || !suite || !engine)
+    if (history->count >= history->capacity)
+    {
+        size_t new_cap = history->capacity ? history->capacity * 2 : 64;
+        maip_history_entry_t *resized = maip_sys_memory_realloc(history->entries, new_cap * sizeof(*resized));
+        if (!resized)
+            return NULL;
+        history->entries = resized;
+        history->capacity = new_cap;
+    }
+
+    maip_history_entry_t *entry = &history->entries[history->count];
+    entry->suite = maip_io_cstr_dup(suite);
+    entry->name = maip_io_cstr_dup(name);
+    entry->ewma_ns = 0;
+    entry->state = -1;
+    entry->elapsed_ns = 0;
+    entry->site = NULL;
+    if (!entry->suite || !entry->name)
+    {
+        maip_io_cstr_free(entry->suite);
+        maip_io_cstr_free(entry->name);
+        return NULL;
+    }
+    history->count++;
+
+    // Keep the table at most half full.
+    if (history->count * 2 > history->bucket_count)
+    {
+        if (maip_history_rehash(history, history->bucket_count ? history->bucket_count * 2 : 128) != FOSSIL_MAIP_SUCCESS)
+        {
+            history->count--;
+            maip_io_cstr_free(entry->suite);
+            maip_io_cstr_free(entry->name);
+            return NULL;
+        }
+        return entry;
+    }
+
+    size_t mask = history->bucket_count - 1;
+    size_t b = (size_t)fossil_maip_case_hash(suite, name) & mask;
+    while (history->buckets[b])
+        b = (b + 1) & mask;
+    history->buckets[b] = history->count;
+    return entry;
+}
+
+static void maip_history_free(maip_history_t *history)
+{
+    for (size_t i = 0; i < history->count; ++i)
+    {
+        maip_io_cstr_free(history->entries[i].suite);
+        maip_io_cstr_free(history->entries[i].name);
+        maip_io_cstr_free(history->entries[i].site);
+    }
+    maip_sys_memory_free(history->entries);
+    maip_sys_memory_free(history->buckets);
+    maip_sys_memory_set(history, 0, sizeof(*history));
+}
+
+// A path option naming a file, or NULL when it was left unset or set to "none".
+static const char *maip_history_option_path(const char *option)
+{
+    if (!option || maip_io_cstr_compare(option, "none") == 0 || option[0] == '\0')
+        return NULL;
+    return option;
+}
+
+static maip_history_entry_t *maip_history_lookup(maip_history_t *history, const char *suite, const char *name)
+{
+    maip_history_entry_t *entry = maip_history_find(history, suite, name);
+    return entry ? entry : maip_history_insert(history, suite, name);
+}
+
+// A missing or unreadable file is just an empty history.
+static void maip_history_load(maip_history_t *history, const char *path)
+{
+    FILE *file = fopen(path, "r");
+    if (!file)
         return;
 
-    // --- Filter: --only ---
-    if (engine->pallet.run.only &&
-        maip_io_cstr_compare(engine->pallet.run.only, test_case->name) != 0)
+    char line[2 * MAIP_HISTORY_NAME_SIZE + 32];
+    if (fgets(line, sizeof(line), file) && strncmp(line, MAIP_HISTORY_HEADER, strlen(MAIP_HISTORY_HEADER)) == 0)
     {
+        char suite[MAIP_HISTORY_NAME_SIZE];
+        char name[MAIP_HISTORY_NAME_SIZE];
+        uint64_t ewma_ns;
+
+        while (fgets(line, sizeof(line), file))
+        {
+            if (sscanf(line, "%255s %255s %" SCNu64, suite, name, &ewma_ns) != 3)
+                continue;
+
+            maip_history_entry_t *entry = maip_history_lookup(history, suite, name);
+            if (entry)
+                entry->ewma_ns = ewma_ns;
+        }
+    }
+    fclose(file);
+}
+
+// Reads the results database; a missing, foreign or truncated file stops at
+// the last complete record.
+static void maip_results_load(maip_history_t *history, const char *path)
+{
+    FILE *file = fopen(path, "rb");
+    if (!file)
         return;
+
+    char magic[MAIP_RESULTS_MAGIC_SIZE];
+    if (fread(magic, 1, sizeof(magic), file) == sizeof(magic) && memcmp(magic, MAIP_RESULTS_MAGIC, sizeof(magic)) == 0)
+    {
+        maip_results_record_t record;
+        char suite[MAIP_HISTORY_NAME_SIZE];
+        char name[MAIP_HISTORY_NAME_SIZE];
+        char site[FOSSIL_MAIP_MESSAGE_SIZE];
+
+        while (fread(&record, sizeof(record), 1, file) == 1)
+        {
+            if (record.suite_length >= sizeof(suite) || record.name_length >= sizeof(name) ||
+                record.site_length >= sizeof(site) ||
+                fread(suite, 1, record.suite_length, file) != record.suite_length ||
+                fread(name, 1, record.name_length, file) != record.name_length ||
+                fread(site, 1, record.site_length, file) != record.site_length)
+                break;
+            suite[record.suite_length] = '\0';
+            name[record.name_length] = '\0';
+            site[record.site_length] = '\0';
+
+            maip_history_entry_t *entry = maip_history_lookup(history, suite, name);
+            if (!entry)
+                continue;
+            entry->state = record.state;
+            entry->elapsed_ns = record.elapsed_ns;
+            fossil_maip_case_text(&entry->site, site);
+        }
     }
+    fclose(file);
+}
 
-    // --- Filter: --skip ---
-    if (engine->pallet.run.skip &&
-        maip_io_cstr_compare(engine->pallet.run.skip, test_case->name) == 0)
+// Files are written next to their target and renamed over it, so a run that
+// dies halfway never leaves a truncated one behind.
+static FILE *maip_history_create(const char *path, char **temp)
+{
+    size_t size = strlen(path) + 5;
+    *temp = maip_sys_memory_alloc(size);
+    if (!*temp)
+        return NULL;
+    snprintf(*temp, size, "%s.tmp", path);
+
+    FILE *file = fopen(*temp, "wb");
+    if (!file)
     {
-        test_case->state = FOSSIL_MAIP_CASE_SKIPPED;
-        fossil_maip_update_score(test_case, suite);
+        maip_sys_memory_free(*temp);
+        *temp = NULL;
+    }
+    return file;
+}
+
+static void maip_history_commit(FILE *file, char *temp, const char *path, bool ok)
+{
+    if (fclose(file) == 0 && ok)
+        rename(temp, path);
+    else
+        remove(temp);
+    maip_sys_memory_free(temp);
+}
+
+static void maip_history_save(const maip_history_t *history, const char *path)
+{
+    char *temp;
+    FILE *file = maip_history_create(path, &temp);
+    if (!file)
         return;
+
+    bool ok = fprintf(file, "%s\n", MAIP_HISTORY_HEADER) > 0;
+    for (size_t i = 0; ok && i < history->count; ++i)
+    {
+        const maip_history_entry_t *entry = &history->entries[i];
+        if (entry->ewma_ns)
+            ok = fprintf(file, "%s %s %" PRIu64 "\n", entry->suite, entry->name, entry->ewma_ns) > 0;
     }
+    maip_history_commit(file, temp, path, ok);
+}
 
-    size_t repeat_count =
-        (size_t)(engine->pallet.run.repeat > 0 ? engine->pallet.run.repeat : 1);
+static void maip_results_save(const maip_history_t *history, const char *path)
+{
+    char *temp;
+    FILE *file = maip_history_create(path, &temp);
+    if (!file)
+        return;
 
-    for (size_t i = 0; i < repeat_count; ++i)
+    bool ok = fwrite(MAIP_RESULTS_MAGIC, 1, MAIP_RESULTS_MAGIC_SIZE, file) == MAIP_RESULTS_MAGIC_SIZE;
+    for (size_t i = 0; ok && i < history->count; ++i)
     {
-        if (test_case->setup)
-            test_case->setup();
+        const maip_history_entry_t *entry = &history->entries[i];
+        if (entry->state < 0)
+            continue;
 
-        test_case->state = FOSSIL_MAIP_CASE_EMPTY;
-        _ASSERT_COUNT = 0; // Reset before running test
-        uint64_t start_time = fossil_maip_now_ns();
+        maip_results_record_t record;
+        maip_sys_memory_set(&record, 0, sizeof(record));
+        record.suite_length = (uint32_t)strlen(entry->suite);
+        record.name_length = (uint32_t)strlen(entry->name);
+        record.site_length = entry->site ? (uint32_t)strlen(entry->site) : 0;
+        record.state = entry->state;
+        record.elapsed_ns = entry->elapsed_ns;
+
+        ok = fwrite(&record, sizeof(record), 1, file) == 1 &&
+             fwrite(entry->suite, 1, record.suite_length, file) == record.suite_length &&
+             fwrite(entry->name, 1, record.name_length, file) == record.name_length &&
+             (record.site_length == 0 || fwrite(entry->site, 1, record.site_length, file) == record.site_length);
+    }
+    maip_history_commit(file, temp, path, ok);
+}
 
-        if (test_case->run)
+static bool fossil_maip_state_failed(int32_t state)
+{
+    return state == FOSSIL_MAIP_CASE_FAIL || state == FOSSIL_MAIP_CASE_TIMEOUT || state == FOSSIL_MAIP_CASE_UNEXPECTED;
+}
+
+static void fossil_maip_history_apply(fossil_maip_engine_t *engine, const maip_history_t *history)
+{
+    for (size_t i = 0; i < engine->count; ++i)
+    {
+        fossil_maip_suite_t *suite = &engine->suites[i];
+        for (size_t j = 0; j < suite->count; ++j)
+        {
+            fossil_maip_case_t *test_case = &suite->cases[j];
+            const maip_history_entry_t *entry = maip_history_find(history, suite->name, test_case->name);
+            test_case->expected_ns = entry ? entry->ewma_ns : 0;
+            test_case->failed_before = entry && fossil_maip_state_failed(entry->state);
+        }
+    }
+}
+
+// Folds every case that ran into the table: its duration into the moving
+// average, and its outcome over the previous one.
+static void fossil_maip_history_record(const fossil_maip_engine_t *engine, maip_history_t *history)
+{
+    for (size_t i = 0; i < engine->count; ++i)
+    {
+        const fossil_maip_suite_t *suite = &engine->suites[i];
+        for (size_t j = 0; j < suite->count; ++j)
         {
-            if (setjmp(test_jump_buffer) == 0)
+            const fossil_maip_case_t *test_case = &suite->cases[j];
+            bool ran = test_case->state != FOSSIL_MAIP_CASE_EMPTY || test_case->elapsed_ns > 0;
+            if (!ran || test_case->state == FOSSIL_MAIP_CASE_SKIPPED)
+                continue;
+            if (strlen(suite->name) >= MAIP_HISTORY_NAME_SIZE || strlen(test_case->name) >= MAIP_HISTORY_NAME_SIZE)
+                continue;
+
+            maip_history_entry_t *entry = maip_history_lookup(history, suite->name, test_case->name);
+            if (!entry)
+                continue;
+
+            if (entry->ewma_ns)
             {
-                test_case->run();
+                entry->ewma_ns = entry->ewma_ns - entry->ewma_ns / MAIP_HISTORY_WEIGHT +
+                                 test_case->elapsed_ns / MAIP_HISTORY_WEIGHT;
+            }
+            else
+            {
+                entry->ewma_ns = test_case->elapsed_ns;
+            }
+            entry->state = (int32_t)test_case->state;
+            entry->elapsed_ns = test_case->elapsed_ns;
+            fossil_maip_case_text(&entry->site, test_case->site);
+        }
+    }
+}
 
-                uint64_t end_time = fossil_maip_now_ns();
-                uint64_t elapsed = end_time - start_time;
-                test_case->elapsed_ns = elapsed;
+// --last-failed with nothing recorded as failing runs everything, like a
+// first run would.
+static void fossil_maip_check_last_failed(fossil_maip_engine_t *engine)
+{
+    if (!engine->pallet.run.last_failed)
+        return;
 
-#ifndef FOSSIL_MAIP_TIMEOUT
-#define FOSSIL_MAIP_TIMEOUT 60
+    for (size_t i = 0; i < engine->count; ++i)
+    {
+        const fossil_maip_suite_t *suite = &engine->suites[i];
+        for (size_t j = 0; j < suite->count; ++j)
+        {
+            if (suite->cases[j].failed_before)
+                return;
+        }
+    }
+
+    maip_io_printf("{yellow}No previously failed cases recorded (see --results), running all cases{reset}\n");
+    engine->pallet.run.last_failed = 0;
+}
+
+// --- Failure Clusters ---
+// Every case that failed an assertion gets a deterministic 64-bit fingerprint
+// of its failure site, root cause category and message, with the numbers in
+// the message folded away so "got 17" and "got 18" agree. An open-addressing
+// table maps each fingerprint to its occurrence count and the first case that
+// showed it, so the summary can report distinct failures instead of repeating
+// the same one for every case.
+#ifndef FOSSIL_MAIP_CLUSTER_SHOWN
+#define FOSSIL_MAIP_CLUSTER_SHOWN 10 // Largest clusters listed in the summary
 #endif
 
-                if (elapsed > seconds_to_nanoseconds(FOSSIL_MAIP_TIMEOUT))
-                {
-                    test_case->state = FOSSIL_MAIP_CASE_TIMEOUT;
-                }
-                else if (_ASSERT_COUNT == 0)
-                {
-                    test_case->state = FOSSIL_MAIP_CASE_EMPTY;
-                }
-                else
-                {
-                    test_case->state = FOSSIL_MAIP_CASE_PASS;
-                }
+typedef struct
+{
+    uint64_t fingerprint;
+    size_t count;
+    const fossil_maip_suite_t *suite;   // Suite of the first case in the cluster
+    const fossil_maip_case_t *first;    // First case that failed this way
+} maip_cluster_t;
+
+struct fossil_maip_clusters
+{
+    maip_cluster_t *items; // Clusters in order of first appearance
+    size_t count;
+    uint32_t *slots;       // Item index plus one (0 = empty)
+    size_t slot_count;     // Power of two
+    size_t failures;       // Cases clustered
+};
+
+static void fossil_maip_clusters_free(fossil_maip_clusters_t *clusters)
+{
+    if (!clusters)
+        return;
+    maip_sys_memory_free(clusters->items);
+    maip_sys_memory_free(clusters->slots);
+    maip_sys_memory_free(clusters);
+}
+
+static uint64_t maip_fingerprint_byte(uint64_t hash, unsigned char byte)
+{
+    return (hash ^ byte) * 0x100000001b3ULL; // FNV-1a
+}
+
+static uint64_t maip_fingerprint_text(uint64_t hash, const char *text)
+{
+    for (const char *cursor = text ? text : ""; *cursor; ++cursor)
+        hash = maip_fingerprint_byte(hash, (unsigned char)*cursor);
+    return maip_fingerprint_byte(hash, 0);
+}
+
+// Numbers (decimal, hexadecimal, with sign and fraction) count as one '#'.
+static uint64_t maip_fingerprint_message(uint64_t hash, const char *message)
+{
+    const char *cursor = message ? message : "";
+    while (*cursor)
+    {
+        bool sign = (*cursor == '-' || *cursor == '+') && isdigit((unsigned char)cursor[1]);
+        if (!isdigit((unsigned char)*cursor) && !sign)
+        {
+            hash = maip_fingerprint_byte(hash, (unsigned char)*cursor++);
+            continue;
+        }
+
+        cursor += sign;
+        if (cursor[0] == '0' && (cursor[1] == 'x' || cursor[1] == 'X'))
+        {
+            cursor += 2;
+            while (isxdigit((unsigned char)*cursor))
+                cursor++;
+        }
+        while (isdigit((unsigned char)*cursor) || (*cursor == '.' && isdigit((unsigned char)cursor[1])))
+            cursor++;
+        hash = maip_fingerprint_byte(hash, '#');
+    }
+    return maip_fingerprint_byte(hash, 0);
+}
+
+static uint64_t maip_fingerprint(const fossil_maip_case_t *test_case)
+{
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    hash = maip_fingerprint_text(hash, test_case->site);
+    hash = maip_fingerprint_byte(hash, (unsigned char)test_case->cause);
+    hash = maip_fingerprint_message(hash, test_case->message);
+    return hash ? hash : 1;
+}
+
+// Builds engine->clusters from the cases that failed an assertion.
+static int fossil_maip_cluster_failures(fossil_maip_engine_t *engine)
+{
+    fossil_maip_clusters_free(engine->clusters);
+    engine->clusters = NULL;
+
+    size_t failures = 0;
+    for (size_t i = 0; i < engine->count; ++i)
+    {
+        for (size_t j = 0; j < engine->suites[i].count; ++j)
+            failures += engine->suites[i].cases[j].state == FOSSIL_MAIP_CASE_FAIL;
+    }
+    if (failures == 0)
+        return FOSSIL_MAIP_SUCCESS;
+
+    fossil_maip_clusters_t *clusters = maip_sys_memory_calloc(1, sizeof(*clusters));
+    if (!clusters)
+        return FOSSIL_MAIP_FAILURE;
+    clusters->slot_count = 16;
+    while (clusters->slot_count < failures * 2)
+        clusters->slot_count *= 2;
+    clusters->items = maip_sys_memory_alloc(failures * sizeof(*clusters->items));
+    clusters->slots = maip_sys_memory_calloc(clusters->slot_count, sizeof(*clusters->slots));
+    if (!clusters->items || !clusters->slots)
+    {
+        fossil_maip_clusters_free(clusters);
+        return FOSSIL_MAIP_FAILURE;
+    }
+
+    size_t mask = clusters->slot_count - 1;
+    for (size_t i = 0; i < engine->count; ++i)
+    {
+        const fossil_maip_suite_t *suite = &engine->suites[i];
+        for (size_t j = 0; j < suite->count; ++j)
+        {
+            const fossil_maip_case_t *test_case = &suite->cases[j];
+            if (test_case->state != FOSSIL_MAIP_CASE_FAIL)
+                continue;
+
+            uint64_t fingerprint = maip_fingerprint(test_case);
+            size_t slot = (size_t)fingerprint & mask;
+            while (clusters->slots[slot] && clusters->items[clusters->slots[slot] - 1].fingerprint != fingerprint)
+                slot = (slot + 1) & mask;
+
+            if (clusters->slots[slot])
+            {
+                clusters->items[clusters->slots[slot] - 1].count++;
             }
             else
             {
-                test_case->state = FOSSIL_MAIP_CASE_FAIL;
-                test_case->elapsed_ns = fossil_maip_now_ns() - start_time;
-
-                if (engine->pallet.run.fail_fast)
-                {
-                    fossil_maip_update_score(test_case, suite);
-                    fossil_maip_show_cases(suite, test_case, engine);
-                    return;
-                }
+                maip_cluster_t *cluster = &clusters->items[clusters->count++];
+                cluster->fingerprint = fingerprint;
+                cluster->count = 1;
+                cluster->suite = suite;
+                cluster->first = test_case;
+                clusters->slots[slot] = (uint32_t)clusters->count;
             }
+            clusters->failures++;
         }
-        else
+    }
+
+    engine->clusters = clusters;
+    return FOSSIL_MAIP_SUCCESS;
+}
+
+static int maip_cluster_compare(const void *a, const void *b)
+{
+    const maip_cluster_t *left = *(const maip_cluster_t *const *)a;
+    const maip_cluster_t *right = *(const maip_cluster_t *const *)b;
+    if (left->count != right->count)
+        return left->count < right->count ? 1 : -1;
+    return (left > right) - (left < right); // First appearance breaks ties
+}
+
+// --- Run All Suites ---
+int fossil_maip_run_all(fossil_maip_engine_t *engine)
+{
+    if (!engine)
+        return FOSSIL_MAIP_FAILURE;
+
+    // --- Reset global engine score ---
+    maip_sys_memory_set(&engine->score, 0, sizeof(engine->score));
+    engine->score_total = 0;
+    engine->score_possible = 0;
+
+    // --- One case per row of every parameter table ---
+    if (fossil_maip_expand_params(engine) != FOSSIL_MAIP_SUCCESS)
+        return FOSSIL_MAIP_FAILURE;
+
+    // --- Tag bitsets of every case, for --tag ---
+    if (fossil_maip_index_tags(engine) != FOSSIL_MAIP_SUCCESS)
+        return FOSSIL_MAIP_FAILURE;
+
+    // --- Prerequisites of every case, rejected before anything runs ---
+    if (fossil_maip_graph_build(engine) != FOSSIL_MAIP_SUCCESS)
+        return FOSSIL_MAIP_FAILURE;
+
+    // --- Stay resident and run requests instead ---
+    if (engine->pallet.serve.enabled)
+        return fossil_maip_serve(engine);
+
+    // --- Load what earlier runs recorded ---
+    maip_history_t history = {0};
+    const char *history_path = maip_history_option_path(engine->pallet.run.history);
+    const char *results_path = maip_history_option_path(engine->pallet.run.results);
+    if (history_path)
+        maip_history_load(&history, history_path);
+    if (results_path)
+        maip_results_load(&history, results_path);
+    fossil_maip_history_apply(engine, &history);
+    fossil_maip_check_last_failed(engine);
+    fossil_maip_shard_cases(engine);
+    maip_site_begin();
+
+    // --- Run all test suites ---
+    if (engine->pallet.run.until_fail)
+    {
+        if (fossil_maip_run_stress(engine) != FOSSIL_MAIP_SUCCESS)
         {
-            test_case->state = FOSSIL_MAIP_CASE_EMPTY;
-            test_case->elapsed_ns = 0;
+            maip_site_end(NULL);
+            maip_history_free(&history);
+            return FOSSIL_MAIP_FAILURE;
+        }
+    }
+    // Isolated cases are forked, which does not mix with runner threads;
+    // prerequisites need the plan-wide scheduler even on one thread
+    else if (engine->pallet.run.jobs > 1 || (engine->pallet.run.threads > 1 && !engine->pallet.run.isolate) ||
+             engine->graph)
+    {
+        if (fossil_maip_run_parallel(engine) != FOSSIL_MAIP_SUCCESS)
+        {
+            maip_site_end(NULL);
+            maip_history_free(&history);
+            return FOSSIL_MAIP_FAILURE;
         }
+    }
+    else
+    {
+        for (size_t i = 0; i < engine->count; ++i)
+            fossil_maip_run_suite(engine, &engine->suites[i]);
+    }
+
+    // --- Remember this run's durations and outcomes ---
+    fossil_maip_history_record(engine, &history);
+    if (history_path)
+        maip_history_save(&history, history_path);
+    if (results_path)
+        maip_results_save(&history, results_path);
+    maip_history_free(&history);
+    maip_site_end(maip_history_option_path(engine->pallet.run.sites));
+
+    // --- Merge suite results into the engine ---
+    for (size_t i = 0; i < engine->count; ++i)
+    {
+        engine->score_total += engine->suites[i].total_score;
+        engine->score_possible += engine->suites[i].total_possible;
 
-        if (test_case->teardown)
-            test_case->teardown();
+        const fossil_maip_score_t *src = &engine->suites[i].score;
+        engine->score.passed += src->passed;
+        engine->score.failed += src->failed;
+        engine->score.skipped += src->skipped;
+        engine->score.timeout += src->timeout;
+        engine->score.unexpected += src->unexpected;
+        engine->score.empty += src->empty;
     }
 
-    fossil_maip_update_score(test_case, suite);
-    fossil_maip_show_cases(suite, test_case, engine);
+    // --- Group identical failures ---
+    return fossil_maip_cluster_failures(engine);
 }
 
-// --- Algorithmic modifications ---
+// --- Resident Runner (serve) ---
+// serve keeps the binary resident on a Unix domain socket with every suite set
+// up once. Each connection sends one request line in the CLI syntax ("run
+// --only my_case --repeat 20"). A child forked from the server parses it, runs
+// it with the suites still set up, and streams its output back over the
+// connection, so a request costs a fork rather than process startup and
+// fixtures. The child ends the stream with a status line for serve --send.
+// The server re-executes itself when its executable is rebuilt.
+#ifndef FOSSIL_MAIP_SERVE_SOCKET
+#define FOSSIL_MAIP_SERVE_SOCKET ".fossil_maip_serve"
+#endif
 
-// --- Sorting Test Cases ---
-static int compare_name_asc(const void *a, const void *b)
-{
-    return maip_io_cstr_compare(((fossil_maip_case_t *)a)->name, ((fossil_maip_case_t *)b)->name);
-}
+#define FOSSIL_MAIP_SERVE_STATUS "fossil-maip-serve: exit "
+#define FOSSIL_MAIP_SERVE_REQUEST_MAX 4096
+#define FOSSIL_MAIP_SERVE_ARGS_MAX 256
 
-static int compare_name_desc(const void *a, const void *b)
-{
-    return maip_io_cstr_compare(((fossil_maip_case_t *)b)->name, ((fossil_maip_case_t *)a)->name);
-}
+#if !defined(_WIN32)
 
-static int compare_result_asc(const void *a, const void *b)
+static int maip_serve_address(struct sockaddr_un *address, const char *path)
 {
-    return ((fossil_maip_case_t *)a)->state - ((fossil_maip_case_t *)b)->state;
+    maip_sys_memory_set(address, 0, sizeof(*address));
+    address->sun_family = AF_UNIX;
+    if (strlen(path) >= sizeof(address->sun_path))
+    {
+        maip_io_printf("{red}Socket path too long: %s{reset}\n", path);
+        return FOSSIL_MAIP_FAILURE;
+    }
+    strcpy(address->sun_path, path);
+    return FOSSIL_MAIP_SUCCESS;
 }
 
-static int compare_result_desc(const void *a, const void *b)
+// serve --send: forwards one request to a running server and prints what comes
+// back, leaving with the status the request ended with.
+static int maip_serve_send(const char *path, const char *request)
 {
-    return ((fossil_maip_case_t *)b)->state - ((fossil_maip_case_t *)a)->state;
+    struct sockaddr_un address;
+    if (maip_serve_address(&address, path) != FOSSIL_MAIP_SUCCESS)
+        return EXIT_FAILURE;
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || connect(fd, (struct sockaddr *)&address, sizeof(address)) != 0)
+    {
+        maip_io_printf("{red}No server on %s (start one with: serve --socket %s){reset}\n", path, path);
+        if (fd >= 0)
+            close(fd);
+        return EXIT_FAILURE;
+    }
+    if (maip_write_full(fd, request, strlen(request)) != FOSSIL_MAIP_SUCCESS ||
+        maip_write_full(fd, "\n", 1) != FOSSIL_MAIP_SUCCESS)
+    {
+        close(fd);
+        return EXIT_FAILURE;
+    }
+
+    // Output passes through a line at a time so the status line can be held back
+    char line[FOSSIL_MAIP_SERVE_REQUEST_MAX];
+    size_t length = 0;
+    int status = EXIT_FAILURE; // Unless the stream ends properly
+    for (;;)
+    {
+        ssize_t got = read(fd, line + length, sizeof(line) - length);
+        if (got < 0 && errno == EINTR)
+            continue;
+        if (got <= 0)
+            break;
+        length += (size_t)got;
+
+        size_t start = 0;
+        for (size_t i = 0; i < length; ++i)
+        {
+            if (line[i] != '\n')
+                continue;
+            size_t prefix = sizeof(FOSSIL_MAIP_SERVE_STATUS) - 1;
+            if (i - start >= prefix && memcmp(line + start, FOSSIL_MAIP_SERVE_STATUS, prefix) == 0)
+                status = atoi(line + start + prefix);
+            else
+                fwrite(line + start, 1, i + 1 - start, stdout);
+            start = i + 1;
+        }
+        if (start == 0 && length == sizeof(line))
+        {
+            fwrite(line, 1, length, stdout); // One overlong line: pass it on as it is
+            start = length;
+        }
+        memmove(line, line + start, length - start);
+        length -= start;
+        fflush(stdout);
+    }
+    fwrite(line, 1, length, stdout);
+    fflush(stdout);
+    close(fd);
+    return status;
 }
 
-static int compare_time_asc(const void *a, const void *b)
+// Splits a request line in place; double quotes keep spaces inside one argument.
+static int maip_serve_split(char *line, char **argv, int max)
 {
-    return ((fossil_maip_case_t *)a)->elapsed_ns - ((fossil_maip_case_t *)b)->elapsed_ns;
+    int argc = 0;
+    char *cursor = line;
+    while (*cursor && argc < max)
+    {
+        while (*cursor == ' ' || *cursor == '\t')
+            cursor++;
+        if (*cursor == '\0')
+            break;
+
+        char quote = (*cursor == '"') ? *cursor++ : '\0';
+        argv[argc++] = cursor;
+        while (*cursor && (quote ? *cursor != quote : (*cursor != ' ' && *cursor != '\t')))
+            cursor++;
+        if (*cursor)
+            *cursor++ = '\0';
+    }
+    return argc;
 }
 
-static int compare_time_desc(const void *a, const void *b)
+// Child side of a request: stdout and stderr go to the client.
+static void maip_serve_run(fossil_maip_engine_t *engine, int client, char *request)
 {
-    return ((fossil_maip_case_t *)b)->elapsed_ns - ((fossil_maip_case_t *)a)->elapsed_ns;
+    maip_watch_after_fork();
+    maip_site_after_fork();
+    dup2(client, STDOUT_FILENO);
+    dup2(client, STDERR_FILENO);
+    close(client);
+    setvbuf(stdout, NULL, _IOLBF, 0);
+
+    char *argv[FOSSIL_MAIP_SERVE_ARGS_MAX + 1];
+    argv[0] = engine->pallet.serve.argv[0];
+    int argc = 1 + maip_serve_split(request, argv + 1, FOSSIL_MAIP_SERVE_ARGS_MAX - 1);
+    argv[argc] = NULL;
+
+    // The suites stay set up: the server tears them down when it stops
+    for (size_t i = 0; i < engine->count; ++i)
+    {
+        engine->suites[i].setup = NULL;
+        engine->suites[i].teardown = NULL;
+    }
+
+    engine->pallet = fossil_maip_pallet_create(argc, argv);
+    engine->pallet.serve.enabled = 0;
+    maip_time_use_clock(engine->pallet.run.clock);
+    engine->filter = fossil_maip_filter_compile(&engine->pallet);
+
+    int status = engine->filter ? fossil_maip_run_all(engine) : FOSSIL_MAIP_FAILURE;
+    if (status == FOSSIL_MAIP_SUCCESS)
+        fossil_maip_summary(engine);
+
+    bool failed = status != FOSSIL_MAIP_SUCCESS || engine->score.failed || engine->score.timeout || engine->score.unexpected;
+    printf(FOSSIL_MAIP_SERVE_STATUS "%d\n", failed ? EXIT_FAILURE : EXIT_SUCCESS);
+    fflush(stdout);
+    _exit(EXIT_SUCCESS);
 }
 
-static int compare_priority_asc(const void *a, const void *b)
+// Reads the request line, giving up on clients that stay silent.
+static bool maip_serve_read(int client, char *request, size_t size)
 {
-    return ((fossil_maip_case_t *)a)->priority - ((fossil_maip_case_t *)b)->priority;
+    struct timeval wait = {5, 0};
+    setsockopt(client, SOL_SOCKET, SO_RCVTIMEO, &wait, sizeof(wait));
+
+    size_t length = 0;
+    while (length + 1 < size)
+    {
+        ssize_t got = read(client, request + length, size - 1 - length);
+        if (got < 0 && errno == EINTR)
+            continue;
+        if (got <= 0)
+            break;
+        length += (size_t)got;
+        if (memchr(request + length - (size_t)got, '\n', (size_t)got))
+            break;
+    }
+    request[length] = '\0';
+    request[strcspn(request, "\r\n")] = '\0';
+    return length > 0;
 }
 
-static int compare_priority_desc(const void *a, const void *b)
+// Watches the executable: inotify on its directory where available, otherwise
+// its modification time, checked whenever the server wakes up.
+typedef struct
 {
-    return ((fossil_maip_case_t *)b)->priority - ((fossil_maip_case_t *)a)->priority;
-}
+    char path[PATH_MAX];
+    const char *base;
+    int fd;             // inotify descriptor (-1 = none)
+    time_t modified;
+} maip_serve_watch_t;
 
-void fossil_maip_sort_cases(fossil_maip_suite_t *suite, const fossil_maip_engine_t *engine)
+static void maip_serve_watch_open(maip_serve_watch_t *watch, const char *argv0)
 {
-    if (!suite || !suite->cases || suite->count <= 1 || !engine)
+    maip_sys_memory_set(watch, 0, sizeof(*watch));
+    watch->fd = -1;
+
+#if defined(__linux__)
+    ssize_t length = readlink("/proc/self/exe", watch->path, sizeof(watch->path) - 1);
+    if (length <= 0)
+        watch->path[0] = '\0';
+    else
+        watch->path[length] = '\0';
+#endif
+    if (!watch->path[0] && (!argv0 || !realpath(argv0, watch->path)))
+    {
+        watch->path[0] = '\0';
         return;
+    }
+
+    char *slash = strrchr(watch->path, '/');
+    watch->base = slash ? slash + 1 : watch->path;
 
-    int (*compare)(const void *, const void *) = NULL;
+    struct stat info;
+    if (stat(watch->path, &info) == 0)
+        watch->modified = info.st_mtime;
 
-    if (engine->pallet.sort.by)
+#if defined(__linux__)
+    // The directory, since a rebuild may replace the file rather than rewrite it
+    watch->fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (watch->fd >= 0 && slash)
     {
-        if (maip_io_cstr_compare(engine->pallet.sort.by, "name") == 0)
-        {
-            compare = (maip_io_cstr_compare(engine->pallet.sort.order, "desc") == 0) ? compare_name_desc : compare_name_asc;
-        }
-        else if (maip_io_cstr_compare(engine->pallet.sort.by, "result") == 0)
-        {
-            compare = (maip_io_cstr_compare(engine->pallet.sort.order, "desc") == 0) ? compare_result_desc : compare_result_asc;
-        }
-        else if (maip_io_cstr_compare(engine->pallet.sort.by, "time") == 0)
-        {
-            compare = (maip_io_cstr_compare(engine->pallet.sort.order, "desc") == 0) ? compare_time_desc : compare_time_asc;
-        }
-        else if (maip_io_cstr_compare(engine->pallet.sort.by, "priority") == 0)
+        *slash = '\0';
+        if (inotify_add_watch(watch->fd, watch->path[0] ? watch->path : "/", IN_CLOSE_WRITE | IN_MOVED_TO) < 0)
         {
-            compare = (maip_io_cstr_compare(engine->pallet.sort.order, "desc") == 0) ? compare_priority_desc : compare_priority_asc;
-        }
-        else
-        {
-            // Invalid sort criteria
-            return;
+            close(watch->fd);
+            watch->fd = -1;
         }
+        *slash = '/';
     }
-
-    if (compare)
-    {
-        qsort(suite->cases, suite->count, sizeof(fossil_maip_case_t), compare);
-    }
+#endif
 }
 
-// --- Filtering Test Cases ---
-size_t fossil_maip_filter_cases(fossil_maip_suite_t *suite, const fossil_maip_engine_t *engine, fossil_maip_case_t **filtered_cases)
+// Whether the executable was rewritten since the last call.
+static bool maip_serve_watch_changed(maip_serve_watch_t *watch)
 {
-    if (!suite || !suite->cases || !filtered_cases || !engine)
-        return 0;
+    if (!watch->path[0])
+        return false;
 
-    size_t count = 0;
-    for (size_t i = 0; i < suite->count; ++i)
+#if defined(__linux__)
+    if (watch->fd >= 0)
     {
-        fossil_maip_case_t *test_case = &suite->cases[i];
-
-        // Apply filters based on engine->pallet.filter
-        if (engine->pallet.filter.test_name && maip_io_cstr_compare(test_case->name, engine->pallet.filter.test_name) != 0)
+        bool changed = false;
+        char events[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+        ssize_t got;
+        while ((got = read(watch->fd, events, sizeof(events))) > 0)
         {
-            continue;
-        }
-        if (engine->pallet.filter.name && maip_io_cstr_compare(suite->name, engine->pallet.filter.name) != 0)
-        {
-            continue;
-        }
-        if (engine->pallet.filter.tag && (!test_case->tags || !strstr(test_case->tags, engine->pallet.filter.tag)))
-        {
-            continue;
+            for (char *cursor = events; cursor < events + got;)
+            {
+                const struct inotify_event *event = (const struct inotify_event *)cursor;
+                if (event->len && strcmp(event->name, watch->base) == 0)
+                    changed = true;
+                cursor += sizeof(*event) + event->len;
+            }
         }
+        return changed;
+    }
+#endif
 
-        filtered_cases[count++] = test_case;
+    struct stat info;
+    if (stat(watch->path, &info) != 0)
+        return false;
+    if (info.st_mtime == watch->modified)
+        return false;
+    watch->modified = info.st_mtime;
+    return true;
+}
+
+static void maip_serve_teardown(const fossil_maip_engine_t *engine, int listener, const char *path)
+{
+    for (size_t i = 0; i < engine->count; ++i)
+    {
+        if (engine->suites[i].count && engine->suites[i].teardown)
+            engine->suites[i].teardown();
     }
-    return count;
+    close(listener);
+    unlink(path);
+    fflush(stdout);
 }
 
-// --- Shuffling Test Cases ---
-void fossil_maip_shuffle_cases(fossil_maip_suite_t *suite, const fossil_maip_engine_t *engine)
+#endif
+
+int fossil_maip_serve(fossil_maip_engine_t *engine)
 {
-    if (!suite || !suite->cases || suite->count < 2)
-        return;
+    if (!engine)
+        return FOSSIL_MAIP_FAILURE;
 
-    unsigned int seed = (engine && engine->pallet.shuffle.seed)
-                            ? (unsigned int)atoi(engine->pallet.shuffle.seed)
-                            : (unsigned int)time(NULL);
-    srand(seed);
+#if defined(_WIN32)
+    maip_io_printf("{red}serve needs Unix domain sockets, which this platform does not offer{reset}\n");
+    return FOSSIL_MAIP_FAILURE;
+#else
+    const char *path = engine->pallet.serve.socket ? engine->pallet.serve.socket : FOSSIL_MAIP_SERVE_SOCKET;
+    if (engine->pallet.serve.send)
+        exit(maip_serve_send(path, engine->pallet.serve.send));
 
-    // Fisher-Yates shuffle
-    for (size_t i = suite->count - 1; i > 0; --i)
+    struct sockaddr_un address;
+    if (maip_serve_address(&address, path) != FOSSIL_MAIP_SUCCESS)
+        return FOSSIL_MAIP_FAILURE;
+
+    // A socket left behind by a server that is gone would block the bind
+    int probe = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (probe >= 0 && connect(probe, (struct sockaddr *)&address, sizeof(address)) == 0)
     {
-        size_t j = rand() % (i + 1);
-        fossil_maip_case_t temp = suite->cases[i];
-        suite->cases[i] = suite->cases[j];
-        suite->cases[j] = temp;
+        maip_io_printf("{red}A server is already listening on %s{reset}\n", path);
+        close(probe);
+        return FOSSIL_MAIP_FAILURE;
     }
+    if (probe >= 0)
+        close(probe);
+    unlink(path);
 
-    // Optional secondary shuffle/sort by field
-    if (engine && engine->pallet.shuffle.by)
+    int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listener < 0 || bind(listener, (struct sockaddr *)&address, sizeof(address)) != 0 || listen(listener, 16) != 0)
     {
-        if (maip_io_cstr_compare(engine->pallet.shuffle.by, "name") == 0)
-        {
-            qsort(suite->cases, suite->count, sizeof(fossil_maip_case_t), compare_name_asc);
-        }
-        else if (maip_io_cstr_compare(engine->pallet.shuffle.by, "result") == 0)
-        {
-            qsort(suite->cases, suite->count, sizeof(fossil_maip_case_t), compare_result_asc);
-        }
-        else if (maip_io_cstr_compare(engine->pallet.shuffle.by, "time") == 0)
-        {
-            qsort(suite->cases, suite->count, sizeof(fossil_maip_case_t), compare_time_asc);
-        }
-        else if (maip_io_cstr_compare(engine->pallet.shuffle.by, "priority") == 0)
-        {
-            qsort(suite->cases, suite->count, sizeof(fossil_maip_case_t), compare_priority_asc);
-        }
+        maip_io_printf("{red}Cannot listen on %s: %s{reset}\n", path, strerror(errno));
+        if (listener >= 0)
+            close(listener);
+        return FOSSIL_MAIP_FAILURE;
     }
-}
+    fcntl(listener, F_SETFD, FD_CLOEXEC);
 
-// --- Run One Suite ---
-int fossil_maip_run_suite(const fossil_maip_engine_t *engine, fossil_maip_suite_t *suite)
-{
-    if (!suite || !suite->cases)
-        return FOSSIL_MAIP_FAILURE;
+    // Clients that hang up early must not take the server down
+    signal(SIGPIPE, SIG_IGN);
 
-    if (suite->setup)
-        suite->setup();
+    maip_serve_watch_t watch;
+    maip_serve_watch_open(&watch, engine->pallet.serve.argv ? engine->pallet.serve.argv[0] : NULL);
 
-    // --- Reset suite stats ---
-    suite->time_elapsed_ns = fossil_maip_now_ns();
-    suite->total_score = 0;
-    suite->total_possible = 0;
-    maip_sys_memory_set(&suite->score, 0, sizeof(suite->score));
+    for (size_t i = 0; i < engine->count; ++i)
+    {
+        if (engine->suites[i].count && engine->suites[i].setup)
+            engine->suites[i].setup();
+    }
 
-    // --- Filtering ---
-    fossil_maip_case_t *filtered_cases[suite->count];
-    size_t filtered_count = fossil_maip_filter_cases(suite, engine, filtered_cases);
+    maip_io_printf("{blue}Serving %zu suites on %s (pid %d){reset}\n", engine->count, path, (int)getpid());
+    maip_io_printf("{blue}Send requests with: %s serve --socket %s --send \"run --only <case>\" (\"quit\" stops the server){reset}\n",
+                   engine->pallet.serve.argv ? engine->pallet.serve.argv[0] : "maip", path);
+    fflush(stdout);
 
-    if (filtered_count > 0)
+    for (;;)
     {
-        fossil_maip_sort_cases(suite, engine);
-        fossil_maip_shuffle_cases(suite, engine);
-
-        for (size_t i = 0; i < filtered_count; ++i)
+        while (waitpid(-1, NULL, WNOHANG) > 0)
         {
-            fossil_maip_case_t *test_case = filtered_cases[i];
-            fossil_maip_run_test(engine, test_case, suite);
         }
-    }
 
-    suite->time_elapsed_ns = fossil_maip_now_ns() - suite->time_elapsed_ns;
+        struct pollfd fds[2];
+        nfds_t count = 0;
+        fds[count].fd = listener;
+        fds[count].events = POLLIN;
+        fds[count++].revents = 0;
+        if (watch.fd >= 0)
+        {
+            fds[count].fd = watch.fd;
+            fds[count].events = POLLIN;
+            fds[count++].revents = 0;
+        }
 
-    if (suite->teardown)
-        suite->teardown();
+        int ready = poll(fds, count, 1000);
+        if (ready < 0 && errno != EINTR)
+            break;
 
-    return FOSSIL_MAIP_SUCCESS;
-}
+        if (maip_serve_watch_changed(&watch) && access(watch.path, X_OK) == 0)
+        {
+            maip_io_printf("{blue}%s was rebuilt, restarting{reset}\n", watch.path);
+            maip_serve_teardown(engine, listener, path);
+            execv(watch.path, engine->pallet.serve.argv);
+            maip_io_printf("{red}Restart failed: %s{reset}\n", strerror(errno));
+            return FOSSIL_MAIP_FAILURE;
+        }
 
-// --- Run All Suites ---
-int fossil_maip_run_all(fossil_maip_engine_t *engine)
-{
-    if (!engine)
-        return FOSSIL_MAIP_FAILURE;
+        if (ready <= 0 || !(fds[0].revents & POLLIN))
+            continue;
 
-    // --- Reset global engine score ---
-    maip_sys_memory_set(&engine->score, 0, sizeof(engine->score));
-    engine->score_total = 0;
-    engine->score_possible = 0;
+        int client = accept(listener, NULL, NULL);
+        if (client < 0)
+            continue;
 
-    // --- Run all test suites ---
-    for (size_t i = 0; i < engine->count; ++i)
-    {
-        fossil_maip_run_suite(engine, &engine->suites[i]);
+        char request[FOSSIL_MAIP_SERVE_REQUEST_MAX];
+        if (!maip_serve_read(client, request, sizeof(request)))
+        {
+            close(client);
+            continue;
+        }
 
-        engine->score_total += engine->suites[i].total_score;
-        engine->score_possible += engine->suites[i].total_possible;
+        if (maip_io_cstr_compare(request, "quit") == 0)
+        {
+            maip_write_full(client, FOSSIL_MAIP_SERVE_STATUS "0\n", sizeof(FOSSIL_MAIP_SERVE_STATUS "0\n") - 1);
+            close(client);
+            break;
+        }
 
-        const fossil_maip_score_t *src = &engine->suites[i].score;
-        engine->score.passed += src->passed;
-        engine->score.failed += src->failed;
-        engine->score.skipped += src->skipped;
-        engine->score.timeout += src->timeout;
-        engine->score.unexpected += src->unexpected;
-        engine->score.empty += src->empty;
+        fflush(stdout);
+        pid_t pid = fork();
+        if (pid == 0)
+        {
+            close(listener);
+            if (watch.fd >= 0)
+                close(watch.fd);
+            maip_serve_run(engine, client, request);
+        }
+        close(client);
     }
 
-    return FOSSIL_MAIP_SUCCESS;
+    maip_io_printf("{blue}Server on %s stopped{reset}\n", path);
+    maip_serve_teardown(engine, listener, path);
+    if (watch.fd >= 0)
+        close(watch.fd);
+    exit(EXIT_SUCCESS);
+#endif
 }
 
 // --- Summary Report ---
@@ -1343,8 +7421,8 @@ void fossil_maip_summary_timestamp(const fossil_maip_engine_t *engine)
     }
 
     // --- Format elapsed time using helper ---
-    char *formatted_time = fossil_maip_format_ns(total_elapsed_ns);
-    const char *elapsed_time_display = formatted_time ? formatted_time : "unknown";
+    char elapsed_time_display[32];
+    fossil_maip_format_ns(total_elapsed_ns, elapsed_time_display, sizeof(elapsed_time_display));
     const char *elapsed_insight = fossil_maip_elapsed_timer_ai_message(total_elapsed_ns);
 
     // --- Theme-Aware Elapsed Time Display ---
@@ -1613,6 +7691,77 @@ void fossil_maip_ai_feedback(const fossil_maip_engine_t *engine)
     }
 }
 
+// Flakiness of the cases run with --repeat: how many disagreed with themselves,
+// and which ones, with the share of their iterations that failed.
+static void fossil_maip_summary_repeat(const fossil_maip_engine_t *engine)
+{
+    size_t repeated = 0;
+    size_t flaky = 0;
+    for (size_t i = 0; i < engine->count; ++i)
+    {
+        for (size_t j = 0; j < engine->suites[i].count; ++j)
+        {
+            const fossil_maip_latency_t *latency = engine->suites[i].cases[j].latency;
+            if (!latency || latency->runs < 2)
+                continue;
+            repeated++;
+            if (maip_latency_flaky(latency))
+                flaky++;
+        }
+    }
+    if (repeated == 0)
+        return;
+
+    maip_io_printf("{bright_black}[{cyan}::{bright_black}] {blue}Repeated     {reset}: {cyan}%zu{reset}  {blue}Flaky        {reset}: {cyan}%zu{reset} ({cyan}%06.2f%%{reset})\n",
+                   repeated, flaky, 100.0 * (double)flaky / (double)repeated);
+
+    for (size_t i = 0; i < engine->count; ++i)
+    {
+        const fossil_maip_suite_t *suite = &engine->suites[i];
+        for (size_t j = 0; j < suite->count; ++j)
+        {
+            const fossil_maip_latency_t *latency = suite->cases[j].latency;
+            if (!maip_latency_flaky(latency))
+                continue;
+            maip_io_printf("    {yellow}%s.%s{reset}: %u of %u iterations failed ({yellow}%.2f%%{reset})\n",
+                           suite->name, suite->cases[j].name, latency->failures, latency->runs,
+                           100.0 * latency->failures / latency->runs);
+        }
+    }
+}
+
+// Distinct assertion failures, largest clusters first, each with the first
+// case that failed that way.
+static void fossil_maip_summary_clusters(const fossil_maip_engine_t *engine)
+{
+    const fossil_maip_clusters_t *clusters = engine->clusters;
+    if (!clusters || clusters->count == 0)
+        return;
+
+    maip_io_printf("{bright_black}[{cyan}::{bright_black}] {blue}Failures     {reset}: {cyan}%zu{reset}  {blue}Distinct     {reset}: {cyan}%zu{reset} failure cluster%s\n",
+                   clusters->failures, clusters->count, clusters->count == 1 ? "" : "s");
+
+    const maip_cluster_t **order = maip_sys_memory_alloc(clusters->count * sizeof(*order));
+    if (!order)
+        return;
+    for (size_t i = 0; i < clusters->count; ++i)
+        order[i] = &clusters->items[i];
+    qsort(order, clusters->count, sizeof(*order), maip_cluster_compare);
+
+    size_t shown = clusters->count < FOSSIL_MAIP_CLUSTER_SHOWN ? clusters->count : FOSSIL_MAIP_CLUSTER_SHOWN;
+    for (size_t i = 0; i < shown; ++i)
+    {
+        const fossil_maip_case_t *first = order[i]->first;
+        maip_io_printf("    {red}%zux{reset} {yellow}%s.%s{reset}%s%s (%s): %s\n",
+                       order[i]->count, order[i]->suite->name, first->name,
+                       first->site ? " at " : "", first->site ? first->site : "",
+                       maip_site_cause_name(first->cause), first->message ? first->message : "");
+    }
+    if (clusters->count > shown)
+        maip_io_printf("    ... and %zu more\n", clusters->count - shown);
+    maip_sys_memory_free(order);
+}
+
 void fossil_maip_summary(const fossil_maip_engine_t *engine)
 {
     if (!engine)
@@ -1621,6 +7770,8 @@ void fossil_maip_summary(const fossil_maip_engine_t *engine)
     // Classic Summary Components
     fossil_maip_summary_heading(engine);
     fossil_maip_summary_scoreboard(engine);
+    fossil_maip_summary_repeat(engine);
+    fossil_maip_summary_clusters(engine);
     fossil_maip_summary_timestamp(engine);
 
     // AI-Generated Feedback
@@ -1644,29 +7795,35 @@ int32_t fossil_maip_end(fossil_maip_engine_t *engine)
                 {
                     test_case->teardown();
                 }
+                fossil_maip_case_note(test_case, NULL, NULL);
+                maip_sys_memory_free(test_case->latency);
+                test_case->latency = NULL;
             }
             maip_sys_memory_free(suite->cases);
         }
     }
     maip_sys_memory_free(engine->suites);
+    fossil_maip_filter_free(engine->filter);
+    engine->filter = NULL;
+    fossil_maip_graph_free(engine->graph);
+    engine->graph = NULL;
+    fossil_maip_clusters_free(engine->clusters);
+    engine->clusters = NULL;
+    while (engine->param_names)
+    {
+        char *arena = engine->param_names;
+        memcpy(&engine->param_names, arena, sizeof(char *));
+        maip_sys_memory_free(arena);
+    }
     return FOSSIL_MAIP_SUCCESS;
 }
 
 // -- Assume --
 
-// --- AI Result Struct ---
-typedef struct
-{
-    char *message;
-    uint8_t hash[FOSSIL_MAIP_HASH_SIZE];
-    uint64_t timestamp;
-    int root_cause_code; // 0: unknown, 1: logic, 2: timeout, 3: memory, 4: io, 5: coverage, 6: range, 7: float, 8: string, 9: soap/text
-} maip_assert_ti_result;
-
-extern uint64_t get_maip_time_microseconds(void); // from common utilities
-
 // --- Root Cause Detection Helper ---
 // Enhanced to support assumption macros and their message patterns
+// Codes: 0 unknown, 1 logic, 2 timeout, 3 memory, 4 io, 5 coverage, 6 range,
+// 7 float, 8 string, 9 soap/text; several causes come back as a bitmask.
 static int maip_test_detect_root_cause(const char *message)
 {
     if (!message)
@@ -1791,35 +7948,50 @@ static int maip_test_detect_root_cause(const char *message)
 
 char *maip_test_assert_messagef(const char *message, ...)
 {
+    // Only reached on the failure branch of an assertion, which copies the
+    // text into the context before jumping out, so one buffer per thread will do
+    static FOSSIL_MAIP_THREAD_LOCAL char formatted_message[1024];
+
     va_list args;
     va_start(args, message);
+    maip_io_vsnprintf(formatted_message, sizeof(formatted_message), message, args);
+    va_end(args);
+    formatted_message[sizeof(formatted_message) - 1] = '\0'; // Ensure null-termination
+    return formatted_message;
+}
 
-    size_t buffer_size = 1024;
-    char *formatted_message = (char *)maip_sys_memory_alloc(buffer_size);
-
-    maip_assert_ti_result result = {0};
-
-    if (formatted_message)
+// Hint for the operator of a classified assertion; NULL leaves the choice to
+// the message, for operators that only the macro's name spells out.
+static const char *maip_test_op_hint(int op)
+{
+    switch (op)
     {
-        maip_io_vsnprintf(formatted_message, buffer_size, message, args);
-        formatted_message[buffer_size - 1] = '\0'; // Ensure null-termination
-
-        // TI upgrade: compute hash and timestamp
-        result.message = formatted_message;
-        result.timestamp = get_maip_time_microseconds();
-
-        // Hash both format string and final message to detect templating vs content errors
-        fossil_maip_hash(message, formatted_message, result.hash);
-
-        // Root cause detection
-        result.root_cause_code = maip_test_detect_root_cause(formatted_message);
+    case FOSSIL_MAIP_OP_TRUE:
+        return "Check your logic or expected condition. Ensure the value is true.";
+    case FOSSIL_MAIP_OP_FALSE:
+        return "Check your logic or expected condition. Ensure the value is false.";
+    case FOSSIL_MAIP_OP_EQ:
+        return "Check the actual and expected values. Actual should be equal to expected.";
+    case FOSSIL_MAIP_OP_NE:
+        return "Check the actual and expected values. Actual should differ from expected.";
+    case FOSSIL_MAIP_OP_LT:
+        return "Check the actual and expected values. Actual should be < expected.";
+    case FOSSIL_MAIP_OP_LE:
+        return "Check the actual and expected values. Actual should be <= expected.";
+    case FOSSIL_MAIP_OP_GT:
+        return "Check the actual and expected values. Actual should be > expected.";
+    case FOSSIL_MAIP_OP_GE:
+        return "Check the actual and expected values. Actual should be >= expected.";
+    case FOSSIL_MAIP_OP_WITHIN:
+        return "Check the value and range boundaries. Ensure value is within [min, max].";
+    case FOSSIL_MAIP_OP_OUTSIDE:
+        return "Check the value and range boundaries. Ensure value is outside [min, max].";
+    default:
+        return NULL;
     }
-
-    va_end(args);
-    return formatted_message;
 }
 
-void maip_test_assert_internal_output(const char *message, const char *file, int line, const char *func, int anomaly_count, int root_cause_code)
+void maip_test_assert_internal_output(const char *message, const char *file, int line, const char *func, int anomaly_count, int root_cause_code, int op)
 {
     // Advanced root cause analysis and suggestion hints
 
@@ -1961,8 +8133,8 @@ void maip_test_assert_internal_output(const char *message, const char *file, int
     }
 
     // --- Suggestion hints for assumption failures ---
-    const char *hint_str = NULL;
-    if (message)
+    const char *hint_str = maip_test_op_hint(op);
+    if (!hint_str && message)
     {
         // Context-aware: suggest checking source location if message includes file/func/line
         if (file && func && strstr(message, file) && strstr(message, func))
@@ -2250,55 +8422,119 @@ void maip_test_assert_internal_output(const char *message, const char *file, int
     }
 }
 
-static int maip_test_assert_internal_detect_ti(const char *message, const char *file, int line, const char *func)
+// Counts back-to-back failures of the same assertion site.
+static int maip_test_assert_internal_detect_ti(const char *file, int line)
 {
-    static uint8_t last_hash[FOSSIL_MAIP_HASH_SIZE] = {0};
-    static int anomaly_count = 0;
-
-    char input_buf[512], output_buf[64];
-    snprintf(input_buf, sizeof(input_buf), "%s:%d:%s", file, line, func);
-    snprintf(output_buf, sizeof(output_buf), "%s", message);
+    fossil_maip_context_t *ctx = &maip_context;
 
-    uint8_t current_hash[FOSSIL_MAIP_HASH_SIZE];
-    fossil_maip_hash(input_buf, output_buf, current_hash);
-
-    bool same_hash = memcmp(last_hash, current_hash, FOSSIL_MAIP_HASH_SIZE) == 0;
-
-    if (same_hash)
+    bool same_site = ctx->last_file && file && ctx->last_line == line &&
+                     (ctx->last_file == file || strcmp(ctx->last_file, file) == 0);
+    if (same_site)
     {
-        anomaly_count++;
+        ctx->anomaly_count++;
     }
     else
     {
-        anomaly_count = 0;
-        memcpy(last_hash, current_hash, FOSSIL_MAIP_HASH_SIZE);
+        ctx->anomaly_count = 0;
+        ctx->last_file = file;
+        ctx->last_line = line;
     }
 
-    return anomaly_count;
+    return ctx->anomaly_count;
 }
 
-void maip_test_assert_internal(bool condition, const char *message, const char *file, int line, const char *func)
+void maip_test_assert_pass(void)
 {
-    _ASSERT_COUNT++;
+    maip_context.assert_count++;
+}
 
-    if (!condition)
-    {
-        int anomaly_count = maip_test_assert_internal_detect_ti(message, file, line, func);
+void maip_test_assert_failed(int cause, int op, const char *message, const char *file, int line, const char *func)
+{
+    fossil_maip_context_t *ctx = &maip_context;
+    ctx->assert_count++;
+
+    int anomaly_count = maip_test_assert_internal_detect_ti(file, line);
+
+    // The macro's own category when it has one, the message scan otherwise
+    int root_cause_code = cause != FOSSIL_MAIP_CAUSE_UNKNOWN ? cause : maip_test_detect_root_cause(message);
+    snprintf(ctx->message, sizeof(ctx->message), "%s", message ? message : "");
+    ctx->fail_file = file;
+    ctx->fail_line = line;
+    ctx->fail_cause = cause;
+    ctx->fail_op = op;
+
+    // Enhanced output includes anomaly count and root cause
+    maip_watch_hold();
+    maip_io_lock();
+    maip_test_assert_internal_output(message, file, line, func, anomaly_count, root_cause_code, op);
+    maip_io_unlock();
+
+    maip_longjmp(ctx->jump, MAIP_JUMP_ASSERT);
+}
 
-        // Compute hash for clustering
-        char input_buf[512], output_buf[64];
-        snprintf(input_buf, sizeof(input_buf), "%s:%d:%s", file, line, func);
-        snprintf(output_buf, sizeof(output_buf), "%s", message);
-        uint8_t hash[FOSSIL_MAIP_HASH_SIZE];
-        fossil_maip_hash(input_buf, output_buf, hash);
+void maip_test_expect_failed(int cause, int op, const char *message, const char *file, int line, const char *func)
+{
+    fossil_maip_context_t *ctx = &maip_context;
+    ctx->assert_count++;
 
-        int root_cause_code = maip_test_detect_root_cause(message);
+    // The first failure of the case, expectation or assumption, is the one the
+    // case records; a later failed assumption still overrides it
+    if (!ctx->fail_file)
+    {
+        snprintf(ctx->message, sizeof(ctx->message), "%s", message ? message : "");
+        ctx->fail_file = file;
+        ctx->fail_line = line;
+        ctx->fail_cause = cause;
+        ctx->fail_op = op;
+    }
 
-        // Enhanced output includes anomaly count and root cause
-        maip_test_assert_internal_output(message, file, line, func, anomaly_count, root_cause_code);
+    if (ctx->expect_count < FOSSIL_MAIP_EXPECT_MAX)
+    {
+        fossil_maip_expect_t *expect = &ctx->expects[ctx->expect_count];
+        expect->file = file;
+        expect->func = func;
+        expect->line = line;
+        expect->cause = cause;
+        expect->op = op;
+        snprintf(expect->message, sizeof(expect->message), "%s", message ? message : "");
+    }
+    ctx->expect_count++;
+}
 
-        longjmp(test_jump_buffer, 1);
+// Prints the expectations the current case failed as one report once its body
+// is done, and clears them. Returns whether there were any.
+static bool maip_test_expect_report(void)
+{
+    fossil_maip_context_t *ctx = &maip_context;
+    int count = ctx->expect_count;
+    if (count == 0)
+        return false;
+    ctx->expect_count = 0;
+
+    int kept = count < FOSSIL_MAIP_EXPECT_MAX ? count : FOSSIL_MAIP_EXPECT_MAX;
+    const char *name = ctx->current_case ? ctx->current_case->name : NULL;
+
+    maip_io_lock();
+    maip_io_printf("{red,bold}%d expectation%s failed{reset}%s%s\n",
+                   count, count == 1 ? "" : "s", name ? " in " : "", name ? name : "");
+    for (int i = 0; i < kept; ++i)
+    {
+        const fossil_maip_expect_t *expect = &ctx->expects[i];
+        int root_cause_code = expect->cause != FOSSIL_MAIP_CAUSE_UNKNOWN ? expect->cause : maip_test_detect_root_cause(expect->message);
+        maip_test_assert_internal_output(expect->message, expect->file, expect->line, expect->func, 0, root_cause_code, expect->op);
     }
+    if (count > kept)
+        maip_io_printf("... and %d more past the first %d\n", count - kept, kept);
+    maip_io_unlock();
+    return true;
+}
+
+void maip_test_assert_internal(bool condition, const char *message, const char *file, int line, const char *func)
+{
+    if (condition)
+        maip_test_assert_pass();
+    else
+        maip_test_assert_failed(FOSSIL_MAIP_CAUSE_UNKNOWN, FOSSIL_MAIP_OP_NONE, message, file, line, func);
 }
 
 // *********************************************************************************************
@@ -97,14 +97,349 @@ FOSSIL_TEST(objc_test_input_equal) {
     FOSSIL_TEST_ASSUME(actual_output == data.expected_output, "Equality test failed");
 }
 
+// A test case that runs under its own time budget
+FOSSIL_TEST(objc_test_timeout_budget) {
+    fossil_maip_case_t *current = fossil_maip_context()->current_case;
+
+    FOSSIL_TEST_ASSUME(current != NULL, "Current case should be tracked");
+    FOSSIL_TEST_ASSUME(current->timeout_ns == 5000ULL * 1000000ULL, "Case budget should be 5000 ms");
+}
+
+// A test case body runs with crash recovery armed
+FOSSIL_TEST(objc_test_crash_guard) {
+    fossil_maip_context_t *context = fossil_maip_context();
+
+    FOSSIL_TEST_ASSUME(context->guarded != 0, "Crash recovery should guard the case body");
+    FOSSIL_TEST_ASSUME(context->current_case->crash_signal == 0, "No crash should be recorded yet");
+}
+
+// Runs one case through the runner from inside the calling case and returns
+// the outcome it recorded. The inner run lands through the same per-thread
+// context, so the calling case's context is saved around it.
+static fossil_maip_case_t objc_sample_run_inner(fossil_maip_case_t test_case) {
+    fossil_maip_engine_t engine;
+    fossil_maip_suite_t suite;
+    memset(&engine, 0, sizeof(engine));
+    memset(&suite, 0, sizeof(suite));
+    suite.name = "objc_sample_inner_suite";
+    fossil_maip_add_case(&suite, test_case);
+
+    fossil_maip_context_t saved = *fossil_maip_context();
+    fossil_maip_run_suite(&engine, &suite);
+    *fossil_maip_context() = saved;
+
+    fossil_maip_case_t result = suite.cases[0];
+    maip_sys_memory_free(suite.cases);
+    return result;
+}
+
+// Inner case that never finishes on its own
+FOSSIL_TEST(objc_sample_inner_overrun) {
+    volatile uint64_t spin = 0;
+    for (;;)
+        spin = spin + 1;
+}
+
+// Inner case that faults
+FOSSIL_TEST(objc_sample_inner_fault) {
+    volatile uintptr_t address = 16; // a distinct address, not null
+    *(volatile int *)address = 1;
+}
+
+// The watchdog interrupts a case that overruns its budget
+FOSSIL_TEST(objc_test_timeout_interrupt) {
+    test_case_objc_sample_inner_overrun.timeout_ns = 50ULL * 1000000ULL;
+    fossil_maip_case_t result = objc_sample_run_inner(test_case_objc_sample_inner_overrun);
+
+    FOSSIL_TEST_ASSUME(result.state == FOSSIL_MAIP_CASE_TIMEOUT, "Overrunning case should time out");
+    FOSSIL_TEST_ASSUME(result.elapsed_ns >= 50ULL * 1000000ULL, "Case should run for its whole budget");
+    FOSSIL_TEST_ASSUME(result.elapsed_ns < 5000ULL * 1000000ULL, "Watchdog should interrupt the case soon after its budget");
+}
+
+// A fault in a case body is recovered and recorded as unexpected
+FOSSIL_TEST(objc_test_crash_recovered) {
+    fossil_maip_case_t result = objc_sample_run_inner(test_case_objc_sample_inner_fault);
+
+    FOSSIL_TEST_ASSUME(result.state == FOSSIL_MAIP_CASE_UNEXPECTED, "Faulting case should be unexpected");
+    FOSSIL_TEST_ASSUME(result.crash_signal == SIGSEGV || result.crash_signal == SIGBUS, "Fault signal should be recorded");
+    FOSSIL_TEST_ASSUME(result.crash_address == 16, "Faulting address should be recorded");
+    FOSSIL_TEST_ASSUME(result.elapsed_ns < 5000ULL * 1000000ULL, "Faulting case should end at once");
+}
+
+// Inner cases that fail expectations. The progress counter shows how far the
+// body ran, and the line is that of the first failing check.
+static int objc_sample_expect_progress = 0;
+static int objc_sample_expect_line = 0;
+
+FOSSIL_TEST(objc_sample_inner_expects) {
+    objc_sample_expect_progress = 0;
+    objc_sample_expect_line = __LINE__ + 1;
+    EXPECT_ITS_EQUAL_I32(1, 2);
+    objc_sample_expect_progress++;
+    EXPECT_ITS_TRUE(0);
+    objc_sample_expect_progress++;
+}
+
+FOSSIL_TEST(objc_sample_inner_expect_then_assume) {
+    objc_sample_expect_progress = 0;
+    EXPECT_ITS_TRUE(0);
+    objc_sample_expect_progress++;
+    ASSUME_ITS_EQUAL_I32(3, 4);
+    objc_sample_expect_progress++;
+}
+
+FOSSIL_TEST(objc_sample_inner_expect_overflow) {
+    objc_sample_expect_progress = 0;
+    for (int i = 0; i < FOSSIL_MAIP_EXPECT_MAX + 4; ++i) {
+        EXPECT_ITS_EQUAL_I32(i, -1);
+        objc_sample_expect_progress++;
+    }
+}
+
+// Runs an inner case with its output captured, for the expectation report
+static fossil_maip_case_t objc_sample_captured_case;
+static fossil_maip_case_t objc_sample_captured_result;
+
+static void objc_sample_run_captured(void) {
+    objc_sample_captured_result = objc_sample_run_inner(objc_sample_captured_case);
+}
+
+static fossil_maip_case_t objc_sample_run_reported(fossil_maip_case_t test_case, char *report, size_t size) {
+    objc_sample_captured_case = test_case;
+    if (fossil_mock_capture_output(report, size, objc_sample_run_captured) < 0)
+        report[0] = '\0';
+    return objc_sample_captured_result;
+}
+
+// Failed expectations let the body finish, then fail the case and are reported together
+FOSSIL_TEST(objc_test_expect_collected) {
+    char report[4096];
+    fossil_maip_case_t result = objc_sample_run_reported(test_case_objc_sample_inner_expects, report, sizeof(report));
+    char site[64];
+    snprintf(site, sizeof(site), "test_sample.m:%d", objc_sample_expect_line);
+
+    FOSSIL_TEST_ASSUME(result.state == FOSSIL_MAIP_CASE_FAIL, "Case with failed expectations should fail");
+    FOSSIL_TEST_ASSUME(objc_sample_expect_progress == 2, "Body should run past failed expectations");
+    FOSSIL_TEST_ASSUME(result.assert_count == 2, "Both expectations should be counted");
+    FOSSIL_TEST_ASSUME(result.message && strstr(result.message, "Expected 1 of value 1 to be equal to 2 of value 2"), "First failed expectation should be recorded");
+    FOSSIL_TEST_ASSUME(result.site && strstr(result.site, site), "Site of the first failed expectation should be recorded");
+    FOSSIL_TEST_ASSUME(strstr(report, "2 expectations failed in objc_sample_inner_expects") != NULL, "Failed expectations should be reported together");
+    FOSSIL_TEST_ASSUME(strstr(report, "Expected 1 of value 1 to be equal to 2 of value 2") != NULL, "First expectation should be reported");
+    FOSSIL_TEST_ASSUME(strstr(report, "Expected 0 of value false to be true") != NULL, "Second expectation should be reported");
+    FOSSIL_TEST_ASSUME(strstr(report, site) != NULL, "Site of the first expectation should be reported");
+    maip_sys_memory_free(result.message);
+    maip_sys_memory_free(result.site);
+}
+
+// A failed assumption after a failed expectation still ends the case at once
+FOSSIL_TEST(objc_test_expect_then_assume) {
+    char report[4096];
+    fossil_maip_case_t result = objc_sample_run_reported(test_case_objc_sample_inner_expect_then_assume, report, sizeof(report));
+
+    FOSSIL_TEST_ASSUME(result.state == FOSSIL_MAIP_CASE_FAIL, "Case should fail");
+    FOSSIL_TEST_ASSUME(objc_sample_expect_progress == 1, "Failed assumption should stop the body");
+    FOSSIL_TEST_ASSUME(result.message && strstr(result.message, "Expected 3 of value 3 to be equal to 4 of value 4"), "Failed assumption should be recorded");
+    FOSSIL_TEST_ASSUME(strstr(report, "1 expectation failed in objc_sample_inner_expect_then_assume") != NULL, "Earlier expectation should still be reported");
+    maip_sys_memory_free(result.message);
+    maip_sys_memory_free(result.site);
+}
+
+// Failures past FOSSIL_MAIP_EXPECT_MAX are counted but not kept
+FOSSIL_TEST(objc_test_expect_overflow) {
+    char report[8192];
+    fossil_maip_case_t result = objc_sample_run_reported(test_case_objc_sample_inner_expect_overflow, report, sizeof(report));
+    char summary[64];
+    snprintf(summary, sizeof(summary), "%d expectations failed", FOSSIL_MAIP_EXPECT_MAX + 4);
+    char overflow[64];
+    snprintf(overflow, sizeof(overflow), "... and 4 more past the first %d", FOSSIL_MAIP_EXPECT_MAX);
+
+    FOSSIL_TEST_ASSUME(result.state == FOSSIL_MAIP_CASE_FAIL, "Case should fail");
+    FOSSIL_TEST_ASSUME(objc_sample_expect_progress == FOSSIL_MAIP_EXPECT_MAX + 4, "Body should run through every failed expectation");
+    FOSSIL_TEST_ASSUME(result.assert_count == FOSSIL_MAIP_EXPECT_MAX + 4, "Every expectation should be counted");
+    FOSSIL_TEST_ASSUME(strstr(report, summary) != NULL, "Every failed expectation should be counted in the report");
+    FOSSIL_TEST_ASSUME(strstr(report, overflow) != NULL, "Failures past the kept ones should be summarized");
+    maip_sys_memory_free(result.message);
+    maip_sys_memory_free(result.site);
+}
+
+// Tag expressions combine exact tags with &, |, ! and parentheses
+FOSSIL_TEST(objc_test_tag_expressions) {
+    const char *tags = "fossil, math, fast";
+
+    FOSSIL_TEST_ASSUME(fossil_maip_tag_match("math & fast", tags) == 1, "& should need both tags");
+    FOSSIL_TEST_ASSUME(fossil_maip_tag_match("math & !fast", tags) == 0, "! should negate a tag");
+    FOSSIL_TEST_ASSUME(fossil_maip_tag_match("net | fast", tags) == 1, "| should need either tag");
+    FOSSIL_TEST_ASSUME(fossil_maip_tag_match("net | disk", tags) == 0, "| of absent tags should not match");
+    FOSSIL_TEST_ASSUME(fossil_maip_tag_match("!(net | disk) & math", tags) == 1, "Parentheses should group");
+    FOSSIL_TEST_ASSUME(fossil_maip_tag_match("net | math & !fast", tags) == 0, "& should bind tighter than |");
+    FOSSIL_TEST_ASSUME(fossil_maip_tag_match("net, fast", tags) == 1, "A comma should list alternatives");
+    FOSSIL_TEST_ASSUME(fossil_maip_tag_match("ma*", tags) == 1, "* should glob over tags");
+    FOSSIL_TEST_ASSUME(fossil_maip_tag_match("f?st & !n*", tags) == 1, "? should glob one character");
+    FOSSIL_TEST_ASSUME(fossil_maip_tag_match("io", "ratio") == 0, "Tags should match exactly, not as substrings");
+    FOSSIL_TEST_ASSUME(fossil_maip_tag_match("io", "ratio, io") == 1, "An exact tag should match");
+}
+
+// A malformed tag expression is rejected rather than matching nothing
+FOSSIL_TEST(objc_test_tag_expression_malformed) {
+    const char *tags = "fossil, math";
+
+    FOSSIL_TEST_ASSUME(fossil_maip_tag_match("math &", tags) == FOSSIL_MAIP_FAILURE, "A dangling & should be rejected");
+    FOSSIL_TEST_ASSUME(fossil_maip_tag_match("(math | fast", tags) == FOSSIL_MAIP_FAILURE, "An open parenthesis should be rejected");
+    FOSSIL_TEST_ASSUME(fossil_maip_tag_match("math)", tags) == FOSSIL_MAIP_FAILURE, "A stray parenthesis should be rejected");
+    FOSSIL_TEST_ASSUME(fossil_maip_tag_match("!", tags) == FOSSIL_MAIP_FAILURE, "! without a tag should be rejected");
+    FOSSIL_TEST_ASSUME(fossil_maip_tag_match("", tags) == FOSSIL_MAIP_FAILURE, "An empty expression should be rejected");
+    FOSSIL_TEST_ASSUME(fossil_maip_tag_match("math fast", tags) == FOSSIL_MAIP_FAILURE, "Tags without an operator should be rejected");
+}
+
+// The case clock never runs backwards and the thread CPU clock advances with work
+FOSSIL_TEST(objc_test_clock_monotonic) {
+    uint64_t start = maip_time_now_ns();
+    uint64_t cpu_start = maip_time_thread_cpu_ns();
+    volatile uint64_t spin = 0;
+    while (maip_time_thread_cpu_ns() == cpu_start && spin < 100000000ULL)
+        spin = spin + 1;
+    uint64_t end = maip_time_now_ns();
+
+    FOSSIL_TEST_ASSUME(end >= start, "Monotonic clock should not run backwards");
+    FOSSIL_TEST_ASSUME(maip_time_thread_cpu_ns() > cpu_start, "Thread CPU time should advance while spinning");
+    FOSSIL_TEST_ASSUME(maip_time_interval_ns(end, start) == 0, "A reversed interval should clamp to zero");
+}
+
+// Async cases wait on the suite's event loop instead of blocking the runner
+FOSSIL_TEST_ASYNC(objc_test_async_sleep) {
+    static uint64_t started;
+
+    FOSSIL_ASYNC_BEGIN();
+    started = maip_time_now_ns();
+    FOSSIL_ASYNC_SLEEP(5);
+    FOSSIL_TEST_ASSUME(FOSSIL_ASYNC_READY() == 0, "A timer wait should end without events");
+    FOSSIL_TEST_ASSUME(maip_time_now_ns() - started >= 5000000ULL, "The case should resume after its timer");
+    FOSSIL_ASYNC_END();
+}
+
+#if !defined(_WIN32)
+FOSSIL_TEST_ASYNC(objc_test_async_pipe) {
+    static int fds[2];
+    static char byte;
+
+    FOSSIL_ASYNC_BEGIN();
+    FOSSIL_TEST_ASSUME(pipe(fds) == 0, "A pipe should open");
+    FOSSIL_ASYNC_AWAIT_FD(fds[0], FOSSIL_MAIP_ASYNC_READ, 10);
+    FOSSIL_TEST_ASSUME(FOSSIL_ASYNC_READY() == 0, "An empty pipe should time out");
+    FOSSIL_TEST_ASSUME(write(fds[1], "x", 1) == 1, "Writing to the pipe should succeed");
+    FOSSIL_ASYNC_AWAIT_FD(fds[0], FOSSIL_MAIP_ASYNC_READ, 1000);
+    FOSSIL_TEST_ASSUME((FOSSIL_ASYNC_READY() & FOSSIL_MAIP_ASYNC_READ) != 0, "A written pipe should be readable");
+    FOSSIL_TEST_ASSUME(read(fds[0], &byte, 1) == 1 && byte == 'x', "The written byte should come back");
+    close(fds[0]);
+    close(fds[1]);
+    FOSSIL_ASYNC_END();
+}
+#endif
+
+// Every row of the table runs as a case of its own, objc_test_param_square/0 to /3
+typedef struct {
+    int input;
+    int expected;
+} objc_square_row_t;
+
+static const objc_square_row_t objc_square_rows[] = {{0, 0}, {1, 1}, {3, 9}, {-4, 16}};
+
+FOSSIL_TEST(objc_test_param_square) {
+    const objc_square_row_t *row = FOSSIL_TEST_PARAM_ROW(objc_square_row_t);
+
+    FOSSIL_TEST_ASSUME(row != NULL, "A parameterized case should see its row");
+    FOSSIL_TEST_ASSUME(row == &objc_square_rows[FOSSIL_TEST_PARAM_INDEX()], "The row should match its index");
+    FOSSIL_TEST_ASSUME(row->input * row->input == row->expected, "Square of the row input should match");
+}
+
+// Declared in the group to run after objc_test_input_increment and the whole
+// objc_static_suite, and to be skipped should any of them fail
+FOSSIL_TEST(objc_test_depend_ordered) {
+    int total = 0;
+    for (int i = 1; i <= 4; ++i)
+        total += i;
+
+    FOSSIL_TEST_ASSUME(total == 10, "Sum of 1 to 4 should be 10");
+}
+
+// Prerequisites go through the plan-wide scheduler, which still needs a runner
+// when the binary is invoked without a run command, as meson's test() does
+FOSSIL_TEST(objc_test_default_runner) {
+    char name[] = "maip";
+    char *argv[] = {name, NULL};
+    fossil_maip_pallet_t pallet = fossil_maip_pallet_create(1, argv);
+
+    FOSSIL_TEST_ASSUME(pallet.run.threads == 1, "Default invocation should have one runner thread");
+    FOSSIL_TEST_ASSUME(pallet.run.jobs == 1, "Default invocation should run cases in process");
+    FOSSIL_TEST_ASSUME(pallet.run.repeat == 1, "Default invocation should run each case once");
+}
+
+// Assertion sites in inline helpers count like the plain sites of the file
+static inline void objc_sample_inline_check(int value) {
+    ASSUME_ITS_EQUAL_I32(value, 1);
+}
+
+FOSSIL_TEST(objc_test_assume_in_inline) {
+    objc_sample_inline_check(1);
+    ASSUME_ITS_TRUE(1);
+}
+
+// Cases of this suite register themselves and are found by FOSSIL_TEST_START
+FOSSIL_SETUP(objc_static_suite) {
+    // Setup code for the statically registered suite
+}
+
+FOSSIL_TEARDOWN(objc_static_suite) {
+    // Teardown code for the statically registered suite
+}
+
+FOSSIL_SUITE(objc_static_suite);
+
+FOSSIL_SUITE_TEST(objc_static_suite, objc_static_registered_case) {
+    fossil_maip_context_t *context = fossil_maip_context();
+
+    FOSSIL_TEST_ASSUME(context->current_case != NULL, "A discovered case should run inside the engine");
+    FOSSIL_TEST_ASSUME(strcmp(context->current_case->name, "objc_static_registered_case") == 0, "The discovered case should keep its name");
+}
+
+FOSSIL_SUITE_TEST(objc_static_suite, objc_static_registered_second) {
+    int values[] = {1, 2, 3};
+    int sum = values[0] + values[1] + values[2];
+
+    FOSSIL_TEST_ASSUME(sum == 6, "Sum of 1, 2 and 3 should be 6");
+}
+
 FOSSIL_TEST_GROUP(objc_sample_test_cases) {
     FOSSIL_ADD_TEST(objc_sample_suite, objc_test_input_increment);
     FOSSIL_ADD_TEST(objc_sample_suite, objc_test_input_decrement);
     FOSSIL_ADD_TEST(objc_sample_suite, objc_test_input_double);
     FOSSIL_ADD_TEST(objc_sample_suite, objc_test_input_half);
+    FOSSIL_TEST_SET_TAGS(objc_test_input_modulo, "fossil, math, fast");
     FOSSIL_ADD_TEST(objc_sample_suite, objc_test_input_modulo);
+    FOSSIL_TEST_SET_TAGS(objc_test_input_square, "fossil, math");
     FOSSIL_ADD_TEST(objc_sample_suite, objc_test_input_square);
     FOSSIL_ADD_TEST(objc_sample_suite, objc_test_input_equal);
+    FOSSIL_TEST_SET_TIMEOUT(objc_test_timeout_budget, 5000);
+    FOSSIL_ADD_TEST(objc_sample_suite, objc_test_timeout_budget);
+    FOSSIL_ADD_TEST(objc_sample_suite, objc_test_crash_guard);
+    FOSSIL_ADD_TEST(objc_sample_suite, objc_test_timeout_interrupt);
+    FOSSIL_ADD_TEST(objc_sample_suite, objc_test_crash_recovered);
+    FOSSIL_ADD_TEST(objc_sample_suite, objc_test_expect_collected);
+    FOSSIL_ADD_TEST(objc_sample_suite, objc_test_expect_then_assume);
+    FOSSIL_ADD_TEST(objc_sample_suite, objc_test_expect_overflow);
+    FOSSIL_ADD_TEST(objc_sample_suite, objc_test_tag_expressions);
+    FOSSIL_ADD_TEST(objc_sample_suite, objc_test_tag_expression_malformed);
+    FOSSIL_ADD_TEST(objc_sample_suite, objc_test_clock_monotonic);
+    FOSSIL_ADD_TEST(objc_sample_suite, objc_test_async_sleep);
+#if !defined(_WIN32)
+    FOSSIL_ADD_TEST(objc_sample_suite, objc_test_async_pipe);
+#endif
+    FOSSIL_TEST_PARAM(objc_test_param_square, objc_square_rows);
+    FOSSIL_ADD_TEST(objc_sample_suite, objc_test_param_square);
+    FOSSIL_TEST_DEPEND_ON(objc_test_depend_ordered, "objc_test_input_increment, objc_static_suite");
+    FOSSIL_ADD_TEST(objc_sample_suite, objc_test_depend_ordered);
+    FOSSIL_ADD_TEST(objc_sample_suite, objc_test_default_runner);
+    FOSSIL_ADD_TEST(objc_sample_suite, objc_test_assume_in_inline);
 
     FOSSIL_ADD_SUITE(objc_sample_suite);
 }
@@ -1462,6 +1462,26 @@ FOSSIL_TEST(c_assume_run_of_bounds_checked_boundary) {
     ASSUME_ITS_BOUNDS_CHECKED(index_last, array_size);
 } // end case
 
+FOSSIL_TEST(c_expect_run_of_table) {
+    const int32_t inputs[] = {0, 1, 2, 3, 4, 5, 6, 7};
+    const int32_t squares[] = {0, 1, 4, 9, 16, 25, 36, 49};
+
+    // Test cases
+    for (size_t i = 0; i < sizeof(inputs) / sizeof(inputs[0]); ++i) {
+        EXPECT_ITS_EQUAL_I32(inputs[i] * inputs[i], squares[i]);
+        EXPECT_ITS_WITHIN_RANGE_I32(squares[i], 0, 49);
+    }
+} // end case
+
+FOSSIL_TEST(c_expect_run_of_mixed_with_assume) {
+    const char *name = "fossil";
+
+    // Test cases
+    EXPECT_ITS_TRUE(name != NULL);
+    EXPECT_ITS_EQUAL_CSTR(name, "fossil");
+    ASSUME_ITS_EQUAL_CSTR(name, "fossil");
+} // end case
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -1606,6 +1626,8 @@ FOSSIL_TEST_GROUP(c_tdd_test_cases) {
     FOSSIL_ADD_TEST(c_tdd_suite, c_assume_run_of_session_valid_future);
     FOSSIL_ADD_TEST(c_tdd_suite, c_assume_run_of_bounds_checked);
     FOSSIL_ADD_TEST(c_tdd_suite, c_assume_run_of_bounds_checked_boundary);
+    FOSSIL_ADD_TEST(c_tdd_suite, c_expect_run_of_table);
+    FOSSIL_ADD_TEST(c_tdd_suite, c_expect_run_of_mixed_with_assume);
 
     FOSSIL_ADD_SUITE(c_tdd_suite);
 } // end of group
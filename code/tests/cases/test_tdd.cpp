@@ -1333,6 +1333,26 @@ FOSSIL_TEST(cpp_assume_run_of_bit_operations_chained) {
     ASSUME_ITS_BITWISE_XOR_EQUAL(0xAA, 0x55, 0xFF);
 } // end case
 
+FOSSIL_TEST(cpp_expect_run_of_table) {
+    const int32_t inputs[] = {0, 1, 2, 3, 4, 5, 6, 7};
+    const int32_t squares[] = {0, 1, 4, 9, 16, 25, 36, 49};
+
+    // Test cases
+    for (size_t i = 0; i < sizeof(inputs) / sizeof(inputs[0]); ++i) {
+        EXPECT_ITS_EQUAL_I32(inputs[i] * inputs[i], squares[i]);
+        EXPECT_ITS_WITHIN_RANGE_I32(squares[i], 0, 49);
+    }
+} // end case
+
+FOSSIL_TEST(cpp_expect_run_of_mixed_with_assume) {
+    const char *name = "fossil";
+
+    // Test cases
+    EXPECT_ITS_TRUE(name != NULL);
+    EXPECT_ITS_EQUAL_CSTR(name, "fossil");
+    ASSUME_ITS_EQUAL_CSTR(name, "fossil");
+} // end case
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -1462,6 +1482,8 @@ FOSSIL_TEST_GROUP(cpp_tdd_test_cases) {
     FOSSIL_ADD_TEST(cpp_tdd_suite, cpp_assume_run_of_multiple_bit_operations);
     FOSSIL_ADD_TEST(cpp_tdd_suite, cpp_assume_run_of_power_of_two_variants);
     FOSSIL_ADD_TEST(cpp_tdd_suite, cpp_assume_run_of_bit_operations_chained);
+    FOSSIL_ADD_TEST(cpp_tdd_suite, cpp_expect_run_of_table);
+    FOSSIL_ADD_TEST(cpp_tdd_suite, cpp_expect_run_of_mixed_with_assume);
 
     FOSSIL_ADD_SUITE(cpp_tdd_suite);
 } // end of group
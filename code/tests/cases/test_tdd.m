@@ -944,6 +944,26 @@ FOSSIL_TEST(objc_assume_run_of_not_soap_tone_detected) {
     ASSUME_NOT_SOAP_TONE_DETECTED(text, expected_tone);
 } // end case
 
+FOSSIL_TEST(objc_expect_run_of_table) {
+    const int32_t inputs[] = {0, 1, 2, 3, 4, 5, 6, 7};
+    const int32_t squares[] = {0, 1, 4, 9, 16, 25, 36, 49};
+
+    // Test cases
+    for (size_t i = 0; i < sizeof(inputs) / sizeof(inputs[0]); ++i) {
+        EXPECT_ITS_EQUAL_I32(inputs[i] * inputs[i], squares[i]);
+        EXPECT_ITS_WITHIN_RANGE_I32(squares[i], 0, 49);
+    }
+} // end case
+
+FOSSIL_TEST(objc_expect_run_of_mixed_with_assume) {
+    const char *name = "fossil";
+
+    // Test cases
+    EXPECT_ITS_TRUE(name != NULL);
+    EXPECT_ITS_EQUAL_CSTR(name, "fossil");
+    ASSUME_ITS_EQUAL_CSTR(name, "fossil");
+} // end case
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -1035,6 +1055,8 @@ FOSSIL_TEST_GROUP(objc_tdd_test_cases) {
     FOSSIL_ADD_TEST(objc_tdd_suite, objc_assume_run_of_its_soap_rot_brain);
     FOSSIL_ADD_TEST(objc_tdd_suite, objc_assume_run_of_its_soap_tone_detected);
     FOSSIL_ADD_TEST(objc_tdd_suite, objc_assume_run_of_not_soap_tone_detected);
+    FOSSIL_ADD_TEST(objc_tdd_suite, objc_expect_run_of_table);
+    FOSSIL_ADD_TEST(objc_tdd_suite, objc_expect_run_of_mixed_with_assume);
 
     FOSSIL_ADD_SUITE(objc_tdd_suite);
 } // end of group